@@ -421,6 +421,10 @@ function(add_cfe_coverage_test MODULE_NAME UNIT_NAME TESTCASE_SRC UT_SRCS)
         $<TARGET_PROPERTY:${MODULE_NAME},COMPILE_DEFINITIONS>
     )
 
+    # The MSG header accessors are stubs in unit tests, so calls to them
+    # must not be replaced by the inline versions
+    target_compile_definitions(${OBJECT_TARGET} PRIVATE CFE_MSG_OMIT_INLINE)
+
     # Compile a test runner application, which contains the
     # actual coverage test code (test cases) and the unit under test
     add_executable(${RUNNER_TARGET}
@@ -435,6 +439,7 @@ function(add_cfe_coverage_test MODULE_NAME UNIT_NAME TESTCASE_SRC UT_SRCS)
     target_compile_definitions(${RUNNER_TARGET} PUBLIC
         $<TARGET_PROPERTY:${MODULE_NAME},COMPILE_DEFINITIONS>
     )
+    target_compile_definitions(${RUNNER_TARGET} PRIVATE CFE_MSG_OMIT_INLINE)
 
     # This also needs to be linked with UT_COVERAGE_LINK_FLAGS (for coverage)
     # This is also linked with any other stub libraries needed,
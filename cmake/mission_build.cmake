@@ -356,6 +356,12 @@ function(prepare)
     include("${${DEP_NAME}_MISSION_DIR}/mission_build.cmake" OPTIONAL)
   endforeach(DEP_NAME ${MISSION_DEPS})
 
+  # The inline message header accessors are generated by the MSG module in use, which
+  # a mission may have replaced with one that does not provide them
+  if (MISSION_MSG_INLINE_ACCESSORS AND NOT EXISTS "${CMAKE_BINARY_DIR}/inc/cfe_msg_inline.h")
+    message(FATAL_ERROR "MISSION_MSG_INLINE_ACCESSORS is set but the MSG module does not provide cfe_msg_inline.h")
+  endif (MISSION_MSG_INLINE_ACCESSORS AND NOT EXISTS "${CMAKE_BINARY_DIR}/inc/cfe_msg_inline.h")
+
   # Certain runtime variables need to be "exported" to the subordinate build, such as
   # the specific arch settings and the location of all the apps.  This is done by creating
   # a temporary file within the dir and then the subprocess will read that file and re-create
@@ -493,6 +493,66 @@
 */
 #define CFE_PLATFORM_ES_DEFAULT_ER_LOG_FILE "/ram/cfe_erlog.log"
 
+/**
+**  \cfeescfg Compress the Files Written by ES in the Background
+**
+**  \par Description:
+**       When true, the Exception and Reset (ER) Log and trace files that ES
+**       writes through the FS background file writer are compressed, and the
+**       #CFE_FS_SUBTYPE_COMPRESSED bit is set in the SubType of their file
+**       headers.  Ground tools that read these files need to expand them first,
+**       for example with the cfe_fs_decompress host tool.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_ES_COMPRESS_FILE_DUMPS false
+
+/**
+**  \cfeescfg Write the Exception and Reset (ER) Log to a File After a Processor Reset
+**
+**  \par Description:
+**       When true, ES writes the ER log to #CFE_PLATFORM_ES_DEFAULT_ER_LOG_FILE
+**       after each processor reset, as if commanded with an empty file name.
+**       The file is written by the FS background file writer as an automatic
+**       request, so it yields to file writes commanded by the ground, and uses
+**       the smaller I/O share set by #CFE_PLATFORM_FS_BACKGROUND_AUTO_IO_SHARE_PERCENT.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_ES_WRITE_ER_LOG_ON_PROCESSOR_RESET false
+
+/**
+**  \cfeplatformcfg Share of File System Time Used by Background File Writes
+**
+**  \par Description:
+**       The FS background file writer, which runs in the ES background task,
+**       limits its rate to this share of the measured write speed of the file
+**       system, in percent, so background files use about this share of the
+**       file system time whatever the device.  This applies to the files that
+**       are written on ground command.
+**
+**  \par Limits
+**       Must be greater than zero and no greater than 100.
+*/
+#define CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT 20
+
+/**
+**  \cfeplatformcfg Share of File System Time Used by Automatic Background File Writes
+**
+**  \par Description:
+**       Like #CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT, for the files that
+**       the cFE writes on its own, such as the ER log after a processor reset.
+**       These files are also written only when no file commanded by the ground
+**       is waiting, so a smaller share makes them stall other writers less.
+**
+**  \par Limits
+**       Must be greater than zero and no greater than
+**       #CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT.
+*/
+#define CFE_PLATFORM_FS_BACKGROUND_AUTO_IO_SHARE_PERCENT 5
+
 /**
 **  \cfeescfg Default Performance Data Filename
 **
@@ -507,6 +567,20 @@
 */
 #define CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME "/ram/cfe_es_perf.dat"
 
+/**
+**  \cfeescfg Default Trace Buffer Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       contents of the core trace buffer. This filename is used only when no
+**       filename is specified in the command to write the trace buffer.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_TRACE_FILE "/ram/cfe_es_trace.dat"
+
 /**
 **  \cfeescfg Default Critical Data Store Registry Filename
 **
@@ -573,6 +647,21 @@
 */
 #define CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE 10000
 
+/**
+**  \cfeescfg Define Core Trace Buffer Size
+**
+**  \par Description:
+**       Defines the number of records in the core trace buffer.  The buffer only
+**       exists when the mission is built with the RING tracepoint backend
+**       (MISSION_TRACE_BACKEND), where the oldest records are overwritten once
+**       the buffer is full.  Each record is 24 bytes.
+**
+**  \par Limits
+**       Must be greater than zero.  There are no restrictions on the upper limit
+**       however, the maximum buffer size is system dependent and should be verified.
+*/
+#define CFE_PLATFORM_ES_TRACE_BUFFER_SIZE 1024
+
 /**
 **  \cfeescfg Define Filter Mask Setting for Disabling All Performance Entries
 **
@@ -1205,6 +1294,21 @@
 */
 #define CFE_PLATFORM_SB_DEFAULT_MAP_FILENAME "/ram/cfe_sb_msgmap.dat"
 
+/**
+**  \cfesbcfg Compress the Files Written by SB in the Background
+**
+**  \par Description:
+**       When true, the routing, pipe and message map information files are
+**       compressed by the FS background file writer, and the
+**       #CFE_FS_SUBTYPE_COMPRESSED bit is set in the SubType of their file
+**       headers.  Ground tools that read these files need to expand them first,
+**       for example with the cfe_fs_decompress host tool.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_SB_COMPRESS_FILE_DUMPS false
+
 /**
 **  \cfesbcfg SB Event Filtering
 **
@@ -1374,6 +1478,52 @@
 */
 #define CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE 16384
 
+/**
+**  \cfetblcfg Size of the Chunks Read when Loading a Table from a File
+**
+**  \par Description:
+**       Defines the number of bytes Table Services reads from a table image file
+**       at a time when loading it.  Each chunk is folded into the table CRC right
+**       after it is read, while it is still in cache, so large tables are not
+**       traversed a second time just to compute the CRC.
+**
+**  \par Limits
+**       This number must be greater than zero.  Values much smaller than a typical
+**       file system block will increase the number of file system calls per load.
+*/
+#define CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE 4096
+
+/**
+**  \cfetblcfg Size of the Chunks Written when Dumping a Table to a File
+**
+**  \par Description:
+**       Defines the number of bytes of table data Table Services hands to the
+**       background file writer at a time when dumping a table.  Smaller chunks let
+**       the background writer interleave table dumps with its other work more
+**       finely; larger chunks reduce the number of file system calls per dump.
+**
+**  \par Limits
+**       This number must be greater than zero.
+*/
+#define CFE_PLATFORM_TBL_DUMP_CHUNK_SIZE 4096
+
+/**
+**  \cfetblcfg Number of Buffers of a Multi-Buffered Table
+**
+**  \par Description:
+**       Defines the total number of buffers Table Services allocates for a table
+**       registered with #CFE_TBL_OPT_MULTI_BUFFER: the active buffer, the inactive
+**       buffer and (this number - 2) spare buffers.  When readers still hold the
+**       inactive buffer, a spare that no reader holds any more takes its place, so
+**       a producer can keep loading the table while slow readers finish with
+**       older images.  Each multi-buffered table takes this many times its size
+**       from the Table Services memory pool.
+**
+**  \par Limits
+**       This number must be at least 3.
+*/
+#define CFE_PLATFORM_TBL_MULTI_BUFFER_DEPTH 3
+
 /**
 **  \cfetblcfg Maximum Number of Tables Allowed to be Registered
 **
@@ -1447,6 +1597,64 @@
 */
 #define CFE_PLATFORM_TBL_MAX_NUM_VALIDATIONS 10
 
+/**
+**  \cfetblcfg Number of Table Validation Worker Tasks
+**
+**  \par Description:
+**       Defines the number of child tasks Table Services starts to validate
+**       the inactive buffers of tables registered with #CFE_TBL_OPT_VALIDATE_ASYNC.
+**       Validation requests for those tables are queued to the workers instead of
+**       waiting for the owning application to call #CFE_TBL_Validate, so several
+**       tables can be validated at once without delaying their owners.
+**
+**  \par Limits
+**       This number may be zero, in which case no workers are started and all
+**       tables are validated by their owning applications.
+*/
+#define CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS 0
+
+/**
+**  \cfetblcfg Table Validation Worker Task Priority
+**
+**  \par Description:
+**       Defines the priority of the Table Services validation worker tasks.
+**       Lower numbers are higher priority, with 1 being the highest priority
+**       in the case of a child task.
+**
+**  \par Limits
+**       Valid range for a child task is 1 to 255 however, the priority cannot
+**       be higher (lower number) than the TBL parent application priority.
+*/
+#define CFE_PLATFORM_TBL_VALIDATION_WORKER_PRIORITY 200
+
+/**
+**  \cfetblcfg Table Validation Worker Task Stack Size
+**
+**  \par Description:
+**       Defines the stack size of each Table Services validation worker task.
+**       Application validation functions run on this stack.
+**
+**  \par Limits
+**       It is recommended this parameter be greater than or equal to 8KB. This parameter
+**       is limited by the maximum value allowed by the data type. In this case, the data
+**       type is an unsigned 32-bit integer, so the valid range is 0 to 0xFFFFFFFF.
+*/
+#define CFE_PLATFORM_TBL_VALIDATION_WORKER_STACK_SIZE 8192
+
+/**
+**  \cfetblcfg Table Validation Worker Timeout
+**
+**  \par Description:
+**       Defines how long, in milliseconds, a table being unregistered waits for a
+**       validation worker to finish validating its inactive buffer.  When the time
+**       runs out the validation is reported as failed and the table is released;
+**       the late result of the worker is discarded.
+**
+**  \par Limits
+**       This parameter must be greater than zero.
+*/
+#define CFE_PLATFORM_TBL_VALIDATION_TIMEOUT_MSEC 5000
+
 /**
 **  \cfetblcfg Default Filename for a Table Registry Dump
 **
@@ -1460,6 +1668,22 @@
 */
 #define CFE_PLATFORM_TBL_DEFAULT_REG_DUMP_FILE "/ram/cfe_tbl_reg.log"
 
+/**
+**  \cfetblcfg Compress the Files Written by TBL in the Background
+**
+**  \par Description:
+**       When true, table dumps and table registry dumps written by the FS
+**       background file writer are compressed, and the #CFE_FS_SUBTYPE_COMPRESSED
+**       bit is set in the SubType of their file headers.  A compressed table dump
+**       has to be expanded, for example with the cfe_fs_decompress host tool,
+**       before it can be loaded back into a table.  Dumps that are written
+**       immediately by the Table Services task are never compressed.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_TBL_COMPRESS_FILE_DUMPS false
+
 /**
 **  \cfetblcfg Number of Spacecraft ID's specified for validation
 **
@@ -1711,6 +1935,73 @@
 */
 #define CFE_PLATFORM_TIME_CFG_LATCH_FLY 8
 
+/**
+**  \cfetimecfg Define TIME Drift Correction
+**
+**  \par Description:
+**       When true, a time server estimates the drift rate of its local clock
+**       from the measured interval between valid tone signals and, while it is
+**       flywheeling, cancels that drift by applying an equal and opposite 1Hz
+**       STCF adjustment.  TIME owns the 1Hz adjustment while the correction is
+**       active and clears it again when the tone is reacquired, so a commanded
+**       1Hz adjustment made during flywheel is superseded.
+**
+**  \par Limits
+**       Must be false unless #CFE_PLATFORM_TIME_CFG_SERVER is true.
+*/
+#define CFE_PLATFORM_TIME_CFG_DRIFT_CORRECTION false
+
+/**
+**  \cfetimecfg Define TIME Minor Frame Rate
+**
+**  \par Description:
+**       Defines the number of minor frames in each one second major frame of the
+**       TIME minor frame scheduler.  Applications register with
+**       #CFE_TIME_RegisterFrameSem or #CFE_TIME_RegisterFrameMsg for a rate that
+**       divides this value and a phase within the resulting period, and are
+**       released at their minor frames as measured from the local clock latched
+**       at the most recent tone.
+**
+**  \par Limits
+**       This value may be zero, in which case the minor frame scheduler is not
+**       started.  Otherwise it must be no more than 1000, and the PSP must provide
+**       the "cFS-Master" OSAL time base used to drive it.
+*/
+#define CFE_PLATFORM_TIME_MINOR_FRAME_RATE 0
+
+/**
+**  \cfetimecfg Define TIME Timer Pool and Timer Wheel Sizes
+**
+**  \par Description:
+**       Defines the number of timers that applications may have started at once
+**       with #CFE_TIME_StartTimer and #CFE_TIME_StartTimerMsg, and the number of
+**       slots in the timer wheel that holds them.  The timer wheel advances one
+**       slot per minor frame, so a timer is only looked at by the minor frame
+**       child task in the minor frames that are a multiple of the number of slots
+**       away from its deadline.
+**
+**  \par Limits
+**       The number of timers must be between 1 and 65534.  The number of slots must
+**       be a power of two between 1 and 4096.  Timers are only available while the
+**       minor frame scheduler is running, see #CFE_PLATFORM_TIME_MINOR_FRAME_RATE.
+*/
+#define CFE_PLATFORM_TIME_MAX_TIMERS        128
+#define CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS 64
+
+/**
+**  \cfetimecfg Define TIME Synchronization Callback Registry Size
+**
+**  \par Description:
+**       Defines the number of time synchronization callbacks that may be registered
+**       at once with #CFE_TIME_RegisterSynchCallback and #CFE_TIME_RegisterSynchCallbackEx,
+**       shared by all applications.  An application may hold several of them.
+**
+**  \par Limits
+**       This value must be between 1 and 65534.  Every registered callback is looked at
+**       on each tone signal, so it should not be much larger than needed.
+*/
+#define CFE_PLATFORM_TIME_MAX_SYNCH_CALLBACKS 64
+
 /**
 **  \cfetimecfg Define TIME Task Priorities
 **
@@ -1718,6 +2009,8 @@
 **       Defines the cFE_TIME Task priority.
 **       Defines the cFE_TIME Tone Task priority.
 **       Defines the cFE_TIME 1HZ Task priority.
+**       Defines the cFE_TIME Minor Frame Task priority.
+**       Defines the cFE_TIME Synch Callback Task priority.
 **
 **  \par Limits
 **       There is a lower limit of zero and an upper limit of 255 on these
@@ -1727,6 +2020,8 @@
 #define CFE_PLATFORM_TIME_START_TASK_PRIORITY 60
 #define CFE_PLATFORM_TIME_TONE_TASK_PRIORITY  25
 #define CFE_PLATFORM_TIME_1HZ_TASK_PRIORITY   25
+#define CFE_PLATFORM_TIME_FRAME_TASK_PRIORITY 25
+#define CFE_PLATFORM_TIME_SYNCH_TASK_PRIORITY 40
 
 /**
 **  \cfetimecfg Define TIME Task Stack Sizes
@@ -1735,6 +2030,8 @@
 **       Defines the cFE_TIME Main Task Stack Size
 **       Defines the cFE_TIME Tone Task Stack Size
 **       Defines the cFE_TIME 1HZ Task Stack Size
+**       Defines the cFE_TIME Minor Frame Task Stack Size
+**       Defines the cFE_TIME Synch Callback Task Stack Size
 **
 **  \par Limits
 **       There is a lower limit of 2048 on these configuration parameters.  There
@@ -1746,6 +2043,8 @@
 #define CFE_PLATFORM_TIME_START_TASK_STACK_SIZE CFE_PLATFORM_ES_DEFAULT_STACK_SIZE
 #define CFE_PLATFORM_TIME_TONE_TASK_STACK_SIZE  4096
 #define CFE_PLATFORM_TIME_1HZ_TASK_STACK_SIZE   8192
+#define CFE_PLATFORM_TIME_FRAME_TASK_STACK_SIZE 4096
+#define CFE_PLATFORM_TIME_SYNCH_TASK_STACK_SIZE 8192
 
 #endif /* EXAMPLE_PLATFORM_CFG_H */
 
@@ -25,3 +25,18 @@ else()
   message (STATUS "OMIT_DEPRECATED=false: Deprecated elements included in build")
   set(MISSION_RESOURCEID_MODE "SIMPLE") # less type safe, but more backward compatible
 endif (OMIT_DEPRECATED)
+
+# If MISSION_MSG_INLINE_ACCESSORS is set, the message header accessors used on every
+# message (message id, size, type, sequence count, function code and time) are compiled
+# inline wherever they are used, rather than called in the MSG module.  The inline versions
+# are in cfe_msg_inline.h, which a mission with a custom header layout or MSG module must
+# also provide; configuration fails if this is set and the file is not generated.
+# Unit tests always use the stub versions.
+set(MISSION_MSG_INLINE_ACCESSORS $ENV{MISSION_MSG_INLINE_ACCESSORS} CACHE BOOL "Inline MSG header accessors")
+
+# MISSION_TRACE_BACKEND selects what the static tracepoints in the core services
+# (software bus traffic, memory pools, tables, events and time tones) compile to:
+#   NONE - nothing at all (default)
+#   USDT - Linux USDT probes in the "cfe" provider, for bpftrace/perf (needs sys/sdt.h)
+#   RING - records in an ES ring buffer, written to a file by the ES Write Trace command
+set(MISSION_TRACE_BACKEND "$ENV{MISSION_TRACE_BACKEND}" CACHE STRING "Core tracepoint backend (NONE, USDT or RING)")
@@ -29,3 +29,6 @@ foreach(TEST_CFGFILE ${TEST_MISSION_CONFIG_FILE_LIST})
     ${DEFAULT_SOURCE}
   )
 endforeach()
+
+# Host tool to compare benchmark results between builds
+add_subdirectory(${CMAKE_CURRENT_LIST_DIR}/tools cfe_testcase-tools)
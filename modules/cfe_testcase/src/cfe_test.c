@@ -28,6 +28,7 @@
 
 #include "cfe_assert.h"
 #include "cfe_test.h"
+#include "cfe_test_perf.h"
 
 CFE_FT_Global_t CFE_FT_Global;
 
@@ -56,7 +57,11 @@ void CFE_TestMain(void)
 
     /*
      * Register test cases in UtAssert
+     *
+     * A build with CFE_FT_BENCHMARK_ONLY defined registers only the performance
+     * benchmarks, for runs that are only interested in the benchmark results.
      */
+#ifndef CFE_FT_BENCHMARK_ONLY
     ESApplicationControlTestSetup();
     ESBehaviorestSetup();
     ESCDSTestSetup();
@@ -78,7 +83,6 @@ void CFE_TestMain(void)
     SBPipeMangSetup();
     SBSendRecvTestSetup();
     SBSubscriptionTestSetup();
-    SBPerformanceTestSetup();
     TBLContentAccessTestSetup();
     TBLContentMangTestSetup();
     TBLInformationTestSetup();
@@ -88,13 +92,24 @@ void CFE_TestMain(void)
     TimeCurrentTestSetup();
     TimeExternalTestSetup();
     TimeMiscTestSetup();
+#endif
+
+    ESPerformanceTestSetup();
+    EVSPerformanceTestSetup();
+    MsgPerformanceTestSetup();
+    SBPerformanceTestSetup();
+    SBScalabilityTestSetup();
+    TBLPerformanceTestSetup();
+    TimePerformanceTestSetup();
 
     /*
      * Execute the tests
      *
      * Note this also releases ownership of the UtAssert subsystem when complete
      */
+    CFE_FT_PerfOpenResults();
     CFE_Assert_ExecuteTest();
+    CFE_FT_PerfCloseResults();
 
     /* Nothing more for this app to do */
     CFE_ES_ExitApp(CFE_ES_RunStatus_APP_EXIT);
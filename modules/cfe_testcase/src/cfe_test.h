@@ -80,27 +80,33 @@ void ESInfoTestSetup(void);
 void ESMemPoolTestSetup(void);
 void ESMiscTestSetup(void);
 void ESPerfTestSetup(void);
+void ESPerformanceTestSetup(void);
 void ESResourceIDTestSetup(void);
 void ESTaskTestSetup(void);
 void EVSFiltersTestSetup(void);
+void EVSPerformanceTestSetup(void);
 void EVSSendTestSetup(void);
 void FSHeaderTestSetup(void);
 void FSUtilTestSetup(void);
 void MessageIdTestSetup(void);
 void MsgApiTestSetup(void);
+void MsgPerformanceTestSetup(void);
 void ResourceIdMiscTestSetup(void);
 void SBPerformanceTestSetup(void);
 void SBPipeMangSetup(void);
+void SBScalabilityTestSetup(void);
 void SBSendRecvTestSetup(void);
 void SBSubscriptionTestSetup(void);
 void TBLContentAccessTestSetup(void);
 void TBLContentMangTestSetup(void);
 void TBLInformationTestSetup(void);
+void TBLPerformanceTestSetup(void);
 void TBLRegistrationTestSetup(void);
 void TimeArithmeticTestSetup(void);
 void TimeConversionTestSetup(void);
 void TimeCurrentTestSetup(void);
 void TimeExternalTestSetup(void);
 void TimeMiscTestSetup(void);
+void TimePerformanceTestSetup(void);
 
 #endif /* CFE_TEST_H */
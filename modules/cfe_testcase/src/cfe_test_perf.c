@@ -0,0 +1,443 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Common timing, statistics and reporting of the performance benchmarks
+ */
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+#include "cfe_test_perf.h"
+
+/*
+ * Samples of the running case
+ *
+ * The batch times give the throughput, and the latency samples are the times
+ * of single operations, one timed operation per batch.
+ */
+typedef struct
+{
+    uint32 MaxSamples;
+    uint32 OpsPerSample;
+    uint32 NumSamples[CFE_FT_PERF_MAX_THREADS];
+    uint64 TotalUsec[CFE_FT_PERF_MAX_THREADS];
+    uint32 OpNsec[CFE_FT_PERF_MAX_THREADS * CFE_FT_PERF_MAX_SAMPLES];
+} CFE_FT_PerfStats_t;
+
+/* State shared with the child tasks of a multi-task case */
+typedef struct
+{
+    CFE_FT_PerfOp_t Op;
+    void *          Arg;
+    volatile uint32 NumStarted;
+    volatile bool   Go;
+    volatile bool   Failed;
+    volatile bool   Done[CFE_FT_PERF_MAX_THREADS];
+} CFE_FT_PerfRunState_t;
+
+static CFE_FT_PerfStats_t    CFE_FT_PerfStats;
+static CFE_FT_PerfRunState_t CFE_FT_PerfRunState;
+static osal_id_t             CFE_FT_PerfResultsFile = OS_OBJECT_ID_UNDEFINED;
+
+/*
+ * Opens the results file and writes the column names
+ *
+ * Failing to open it is not a test failure, the results are still in the test log.
+ */
+void CFE_FT_PerfOpenResults(void)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_OpenCreate(&CFE_FT_PerfResultsFile, CFE_FT_PERF_RESULTS_FILE_NAME,
+                             OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Failed to open %s, rc=%ld\n", __func__, CFE_FT_PERF_RESULTS_FILE_NAME,
+                             (long)OsStatus);
+        CFE_FT_PerfResultsFile = OS_OBJECT_ID_UNDEFINED;
+        return;
+    }
+
+    OS_write(CFE_FT_PerfResultsFile, CFE_FT_PERF_RESULTS_HEADER, sizeof(CFE_FT_PERF_RESULTS_HEADER) - 1);
+}
+
+void CFE_FT_PerfCloseResults(void)
+{
+    if (OS_ObjectIdDefined(CFE_FT_PerfResultsFile))
+    {
+        OS_close(CFE_FT_PerfResultsFile);
+    }
+
+    CFE_FT_PerfResultsFile = OS_OBJECT_ID_UNDEFINED;
+}
+
+/*
+ * Helper function to start a new set of samples
+ */
+void CFE_FT_PerfStatsInit(uint32 NumSamples, uint32 OpsPerSample)
+{
+    memset(&CFE_FT_PerfStats, 0, sizeof(CFE_FT_PerfStats));
+
+    if (NumSamples > CFE_FT_PERF_MAX_SAMPLES)
+    {
+        NumSamples = CFE_FT_PERF_MAX_SAMPLES;
+    }
+
+    CFE_FT_PerfStats.MaxSamples   = NumSamples;
+    CFE_FT_PerfStats.OpsPerSample = OpsPerSample;
+}
+
+/*
+ * Helper function to get which operation of a batch to time individually
+ *
+ * This rotates through the batch, so that any effect of the position of an
+ * operation within its batch is spread over the samples.
+ */
+uint32 CFE_FT_PerfTimedOp(uint32 Sample)
+{
+    if (CFE_FT_PerfStats.OpsPerSample == 0)
+    {
+        return 0;
+    }
+
+    return Sample % CFE_FT_PerfStats.OpsPerSample;
+}
+
+/*
+ * Helper function to record a batch of the given task that started at StartTime and just finished
+ *
+ * OpTime is the time taken by the single operation of the batch that was timed
+ * on its own, as selected by CFE_FT_PerfTimedOp().  Each task has its own range
+ * of samples, so tasks do not need to synchronize.
+ */
+void CFE_FT_PerfStatsAdd(uint32 Thread, OS_time_t StartTime, OS_time_t OpTime)
+{
+    OS_time_t ElapsedTime;
+    uint64    ElapsedUsec;
+    int64     OpNsec;
+    uint32    Sample;
+
+    CFE_PSP_GetTime(&ElapsedTime);
+    ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+    ElapsedUsec = OS_TimeGetTotalMicroseconds(ElapsedTime);
+
+    OpNsec = OS_TimeGetTotalNanoseconds(OpTime);
+    if (OpNsec < 0)
+    {
+        OpNsec = 0;
+    }
+    else if (OpNsec > 0xFFFFFFFF)
+    {
+        OpNsec = 0xFFFFFFFF;
+    }
+
+    if (Thread >= CFE_FT_PERF_MAX_THREADS)
+    {
+        return;
+    }
+
+    Sample = CFE_FT_PerfStats.NumSamples[Thread];
+    if (Sample < CFE_FT_PerfStats.MaxSamples)
+    {
+        CFE_FT_PerfStats.OpNsec[(Thread * CFE_FT_PERF_MAX_SAMPLES) + Sample] = (uint32)OpNsec;
+        CFE_FT_PerfStats.NumSamples[Thread] = Sample + 1;
+        CFE_FT_PerfStats.TotalUsec[Thread] += ElapsedUsec;
+    }
+}
+
+/*
+ * Helper function to get a percentile of sorted samples, by the nearest rank method
+ *
+ * The percentile is given in tenths of a percent.  Unlike a plain N * p index,
+ * this does not round up to the largest sample, so with 1000 samples p99.9 is
+ * the second largest one rather than the maximum.
+ */
+static uint32 CFE_FT_PerfPercentile(const uint32 *SortedSamples, uint32 NumSamples, uint32 PerMille)
+{
+    uint64 Rank;
+
+    Rank = (((uint64)NumSamples * PerMille) + 999) / 1000;
+    if (Rank == 0)
+    {
+        Rank = 1;
+    }
+
+    return SortedSamples[Rank - 1];
+}
+
+/*
+ * Helper function to report the result of a case
+ *
+ * Sorts the latency samples in place and reports the percentiles, both in the
+ * test log and in the results file.
+ */
+void CFE_FT_PerfReportResult(const char *Case, uint32 Size, uint32 Threads, uint64 TotalOps, uint64 OpsPerSec,
+                             uint32 *NsecSamples, uint32 NumSamples)
+{
+    uint32 i;
+    uint32 j;
+    uint32 Sample;
+    uint32 P50;
+    uint32 P99;
+    uint32 P999;
+    uint32 Max;
+    char   Line[160];
+    int    LineLen;
+
+    if (NumSamples == 0)
+    {
+        UtAssert_NA("%s: no samples collected", Case);
+        return;
+    }
+
+    /* The sample set is small, so a simple insertion sort is sufficient */
+    for (i = 1; i < NumSamples; ++i)
+    {
+        Sample = NsecSamples[i];
+        for (j = i; j > 0 && NsecSamples[j - 1] > Sample; --j)
+        {
+            NsecSamples[j] = NsecSamples[j - 1];
+        }
+        NsecSamples[j] = Sample;
+    }
+
+    P50  = CFE_FT_PerfPercentile(NsecSamples, NumSamples, 500);
+    P99  = CFE_FT_PerfPercentile(NsecSamples, NumSamples, 990);
+    P999 = CFE_FT_PerfPercentile(NsecSamples, NumSamples, 999);
+    Max  = NsecSamples[NumSamples - 1];
+
+    UtAssert_MIR("%s: size=%lu tasks=%lu, %lu ops, %lu ops/sec, latency p50=%lu p99=%lu p999=%lu max=%lu nsec", Case,
+                 (unsigned long)Size, (unsigned long)Threads, (unsigned long)TotalOps, (unsigned long)OpsPerSec,
+                 (unsigned long)P50, (unsigned long)P99, (unsigned long)P999, (unsigned long)Max);
+
+    if (OS_ObjectIdDefined(CFE_FT_PerfResultsFile))
+    {
+        LineLen = snprintf(Line, sizeof(Line), "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n", Case, (unsigned long)Size,
+                           (unsigned long)Threads, (unsigned long)TotalOps, (unsigned long)OpsPerSec,
+                           (unsigned long)P50, (unsigned long)P99, (unsigned long)P999, (unsigned long)Max);
+        if (LineLen > 0 && (size_t)LineLen < sizeof(Line))
+        {
+            OS_write(CFE_FT_PerfResultsFile, Line, LineLen);
+        }
+    }
+}
+
+/*
+ * Helper function to report throughput and latency percentiles of the recorded samples
+ *
+ * The throughput is the sum of the throughput of each task, and the percentiles
+ * are over the individually timed operations of all tasks together.
+ */
+void CFE_FT_PerfStatsReport(const char *Case, uint32 Size)
+{
+    uint32  i;
+    uint32  Threads    = 0;
+    uint32  NumSamples = 0;
+    uint32 *OpNsec     = CFE_FT_PerfStats.OpNsec;
+    uint64  TotalOps   = 0;
+    uint64  OpsPerSec  = 0;
+    uint64  ThreadOps;
+
+    /* Gather the samples of all tasks at the start of the array */
+    for (i = 0; i < CFE_FT_PERF_MAX_THREADS; ++i)
+    {
+        if (CFE_FT_PerfStats.NumSamples[i] == 0)
+        {
+            continue;
+        }
+
+        memmove(&OpNsec[NumSamples], &OpNsec[i * CFE_FT_PERF_MAX_SAMPLES],
+                CFE_FT_PerfStats.NumSamples[i] * sizeof(OpNsec[0]));
+        NumSamples += CFE_FT_PerfStats.NumSamples[i];
+
+        ThreadOps = (uint64)CFE_FT_PerfStats.NumSamples[i] * CFE_FT_PerfStats.OpsPerSample;
+        TotalOps += ThreadOps;
+        if (CFE_FT_PerfStats.TotalUsec[i] != 0)
+        {
+            OpsPerSec += (ThreadOps * 1000000) / CFE_FT_PerfStats.TotalUsec[i];
+        }
+
+        ++Threads;
+    }
+
+    CFE_FT_PerfReportResult(Case, Size, Threads, TotalOps, OpsPerSec, OpNsec, NumSamples);
+}
+
+/*
+ * Runs the timed batches of one task of a case
+ */
+void CFE_FT_PerfRunSamples(uint32 Thread)
+{
+    OS_time_t StartTime;
+    OS_time_t OpStartTime;
+    OS_time_t OpTime;
+    uint32    Sample;
+    uint32    TimedOp;
+    uint32    Op;
+    bool      OpStatus;
+
+    for (Sample = 0; Sample < CFE_FT_PerfStats.MaxSamples && !CFE_FT_PerfRunState.Failed; ++Sample)
+    {
+        TimedOp = CFE_FT_PerfTimedOp(Sample);
+        OpTime  = OS_TimeAssembleFromNanoseconds(0, 0);
+
+        CFE_PSP_GetTime(&StartTime);
+
+        for (Op = 0; Op < CFE_FT_PerfStats.OpsPerSample; ++Op)
+        {
+            if (Op == TimedOp)
+            {
+                CFE_PSP_GetTime(&OpStartTime);
+                OpStatus = CFE_FT_PerfRunState.Op(CFE_FT_PerfRunState.Arg, Thread);
+                CFE_PSP_GetTime(&OpTime);
+                OpTime = OS_TimeSubtract(OpTime, OpStartTime);
+            }
+            else
+            {
+                OpStatus = CFE_FT_PerfRunState.Op(CFE_FT_PerfRunState.Arg, Thread);
+            }
+
+            if (!OpStatus)
+            {
+                CFE_FT_PerfRunState.Failed = true;
+                break;
+            }
+        }
+
+        if (Op < CFE_FT_PerfStats.OpsPerSample)
+        {
+            break;
+        }
+
+        CFE_FT_PerfStatsAdd(Thread, StartTime, OpTime);
+    }
+}
+
+/*
+ * Entry point of the child tasks of a multi-task case
+ *
+ * The test task waits for each child to take its thread number before
+ * creating the next one, then releases all of them at once.
+ */
+void CFE_FT_PerfChildTask(void)
+{
+    uint32 Thread;
+
+    Thread = CFE_FT_PerfRunState.NumStarted + 1;
+    CFE_FT_PerfRunState.NumStarted = Thread;
+
+    while (!CFE_FT_PerfRunState.Go)
+    {
+        OS_TaskDelay(1);
+    }
+
+    CFE_FT_PerfRunSamples(Thread);
+
+    CFE_FT_PerfRunState.Done[Thread] = true;
+    CFE_ES_ExitChildTask();
+}
+
+/*
+ * Runs a complete case on the given number of tasks and reports the result
+ *
+ * The child tasks run at the priority of the test task, so that all tasks
+ * compete for the CPU on equal terms.
+ */
+bool CFE_FT_PerfRun(const char *Case, uint32 Size, uint32 Threads, CFE_FT_PerfOp_t Op, void *Arg, uint32 NumSamples,
+                    uint32 OpsPerSample)
+{
+    CFE_ES_TaskId_t   TaskId;
+    CFE_ES_TaskInfo_t TaskInfo;
+    CFE_ES_TaskId_t   ChildIds[CFE_FT_PERF_MAX_THREADS];
+    char              TaskName[OS_MAX_API_NAME];
+    CFE_Status_t      Status;
+    uint32            NumChildren;
+    uint32            i;
+    uint32            Wait;
+
+    if (Threads > CFE_FT_PERF_MAX_THREADS)
+    {
+        Threads = CFE_FT_PERF_MAX_THREADS;
+    }
+
+    CFE_FT_PerfStatsInit(NumSamples, OpsPerSample);
+
+    memset(&CFE_FT_PerfRunState, 0, sizeof(CFE_FT_PerfRunState));
+    CFE_FT_PerfRunState.Op  = Op;
+    CFE_FT_PerfRunState.Arg = Arg;
+
+    NumChildren = 0;
+    if (Threads > 1)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetTaskID(&TaskId), CFE_SUCCESS);
+        UtAssert_INT32_EQ(CFE_ES_GetTaskInfo(&TaskInfo, TaskId), CFE_SUCCESS);
+
+        while (NumChildren < (Threads - 1))
+        {
+            snprintf(TaskName, sizeof(TaskName), "PerfTask%lu", (unsigned long)(NumChildren + 1));
+            Status = CFE_ES_CreateChildTask(&ChildIds[NumChildren], TaskName, CFE_FT_PerfChildTask,
+                                            CFE_ES_TASK_STACK_ALLOCATE, CFE_FT_PERF_STACK_SIZE, TaskInfo.Priority, 0);
+            if (Status != CFE_SUCCESS)
+            {
+                UtAssert_NA("%s: child task not created (Status=0x%08lx)", Case, (unsigned long)Status);
+                break;
+            }
+
+            ++NumChildren;
+            for (Wait = 0; Wait < 1000 && CFE_FT_PerfRunState.NumStarted < NumChildren; ++Wait)
+            {
+                OS_TaskDelay(1);
+            }
+
+            /* A child that is late to start would take the number of the next one, so stop here */
+            if (CFE_FT_PerfRunState.NumStarted < NumChildren)
+            {
+                UtAssert_Failed("%s: child task %lu did not start", Case, (unsigned long)NumChildren);
+                break;
+            }
+        }
+    }
+
+    CFE_FT_PerfRunState.Go = true;
+    CFE_FT_PerfRunSamples(0);
+
+    /* Give the children as long as they need to finish, they run the same amount of work */
+    for (i = 1; i <= NumChildren; ++i)
+    {
+        for (Wait = 0; Wait < 60000 && !CFE_FT_PerfRunState.Done[i]; ++Wait)
+        {
+            OS_TaskDelay(1);
+        }
+
+        if (!CFE_FT_PerfRunState.Done[i])
+        {
+            UtAssert_Failed("%s: child task %lu did not finish", Case, (unsigned long)i);
+            UtAssert_INT32_EQ(CFE_ES_DeleteChildTask(ChildIds[i - 1]), CFE_SUCCESS);
+        }
+    }
+
+    UtAssert_BOOL_FALSE(CFE_FT_PerfRunState.Failed);
+
+    CFE_FT_PerfStatsReport(Case, Size);
+
+    return !CFE_FT_PerfRunState.Failed;
+}
@@ -0,0 +1,94 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Declarations and prototypes for the cfe_test module performance benchmarks
+ *
+ * Every benchmark case is timed in batches of operations, optionally on
+ * several tasks at once.  The batch times give the aggregate throughput, and
+ * one operation of each batch is also timed on its own, so the latency
+ * percentiles are over single operations rather than batch averages.  Both
+ * are reported as a manual inspection result in the test log, and as one line
+ * of the CSV results file, which the cfe_test_perf_compare host tool compares
+ * between builds.
+ *
+ * The latency of a single operation is limited to the resolution of the PSP
+ * time base, so the percentiles of the fastest operations are coarse.
+ */
+
+#ifndef CFE_TEST_PERF_H
+#define CFE_TEST_PERF_H
+
+/*
+ * Includes
+ */
+#include "cfe_test.h"
+
+/**
+ * Name of the benchmark results file
+ *
+ * Each benchmark case adds one line with the columns given by
+ * #CFE_FT_PERF_RESULTS_HEADER.
+ */
+#define CFE_FT_PERF_RESULTS_FILE_NAME "/cf/cfe_test_perf.csv"
+
+/**
+ * First line of the benchmark results file
+ */
+#define CFE_FT_PERF_RESULTS_HEADER "case,size,threads,ops,ops_per_sec,p50_nsec,p99_nsec,p999_nsec,max_nsec\n"
+
+/* Maximum number of timed batches collected by each task of a benchmark case */
+#define CFE_FT_PERF_MAX_SAMPLES 1000
+
+/* Maximum number of tasks a benchmark case runs on at once, including the test task itself */
+#define CFE_FT_PERF_MAX_THREADS 4
+
+/* Stack size of the child tasks used by multi-task benchmark cases */
+#define CFE_FT_PERF_STACK_SIZE 16384
+
+/**
+ * A single benchmark operation
+ *
+ * This may be called from child tasks, so it must not use the UtAssert
+ * facilities, and it must only use resources that are either thread safe
+ * or specific to the given thread number.
+ *
+ * @param Arg    Argument passed to CFE_FT_PerfRun()
+ * @param Thread Number of the task running the operation, 0 for the test task itself
+ *
+ * @returns true if the operation succeeded, false to stop the benchmark case
+ */
+typedef bool (*CFE_FT_PerfOp_t)(void *Arg, uint32 Thread);
+
+void CFE_FT_PerfOpenResults(void);
+void CFE_FT_PerfCloseResults(void);
+
+uint32 CFE_FT_PerfTimedOp(uint32 Sample);
+
+void CFE_FT_PerfStatsInit(uint32 NumSamples, uint32 OpsPerSample);
+void CFE_FT_PerfStatsAdd(uint32 Thread, OS_time_t StartTime, OS_time_t OpTime);
+void CFE_FT_PerfStatsReport(const char *Case, uint32 Size);
+void CFE_FT_PerfReportResult(const char *Case, uint32 Size, uint32 Threads, uint64 TotalOps, uint64 OpsPerSec,
+                             uint32 *NsecSamples, uint32 NumSamples);
+
+bool CFE_FT_PerfRun(const char *Case, uint32 Size, uint32 Threads, CFE_FT_PerfOp_t Op, void *Arg, uint32 NumSamples,
+                    uint32 OpsPerSample);
+
+#endif /* CFE_TEST_PERF_H */
@@ -0,0 +1,105 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Functional test of ES memory pool API performance
+ *
+ * The intent of this test is to get and put memory pool buffers at a
+ * sufficiently high volume such that their cost can be characterized, for
+ * several buffer sizes and with several tasks sharing one pool, so that the
+ * cost of the pool lock under contention shows in the results.
+ */
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+#include "cfe_test_perf.h"
+
+/* Number of timed batches and get/put pairs per batch for each buffer size */
+#define CFE_FT_ES_PERF_NUM_SAMPLES 1000
+#define CFE_FT_ES_PERF_BATCH_OPS   1000
+
+/* Smallest and largest buffer sizes used by the pool scenario */
+#define CFE_FT_ES_PERF_MIN_BUF_SIZE 32
+#define CFE_FT_ES_PERF_MAX_BUF_SIZE 2048
+
+/* Memory of the pool, enough for one buffer of the largest size for each task */
+typedef struct
+{
+    uint32 Mem[(CFE_FT_PERF_MAX_THREADS * 2 * CFE_FT_ES_PERF_MAX_BUF_SIZE) / sizeof(uint32)];
+} CFE_FT_ESPerfPoolMem_t;
+
+/* Pool and buffer size used by each operation of the pool scenario */
+typedef struct
+{
+    CFE_ES_MemHandle_t PoolId;
+    size_t             BufSize;
+} CFE_FT_ESPerfPool_t;
+
+static CFE_FT_ESPerfPoolMem_t CFE_FT_ESPerfPoolMem;
+static CFE_FT_ESPerfPool_t    CFE_FT_ESPerfPool;
+
+/*
+ * One operation of the pool scenario, get a buffer and put it back
+ */
+bool ESPerfGetPutPoolBuf(void *Arg, uint32 Thread)
+{
+    CFE_FT_ESPerfPool_t *Pool = Arg;
+    CFE_ES_MemPoolBuf_t  Buf;
+
+    if (CFE_ES_GetPoolBuf(&Buf, Pool->PoolId, Pool->BufSize) < 0)
+    {
+        return false;
+    }
+
+    return CFE_ES_PutPoolBuf(Pool->PoolId, Buf) >= 0;
+}
+
+void TestGetPutPoolBufPerf(void)
+{
+    CFE_FT_ESPerfPool_t *Pool = &CFE_FT_ESPerfPool;
+    uint32               BufSize;
+    uint32               Threads;
+
+    UtPrintf("Testing: CFE_ES_GetPoolBuf/CFE_ES_PutPoolBuf performance");
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreate(&Pool->PoolId, &CFE_FT_ESPerfPoolMem, sizeof(CFE_FT_ESPerfPoolMem)),
+                      CFE_SUCCESS);
+
+    for (BufSize = CFE_FT_ES_PERF_MIN_BUF_SIZE; BufSize <= CFE_FT_ES_PERF_MAX_BUF_SIZE; BufSize *= 4)
+    {
+        Pool->BufSize = BufSize;
+
+        for (Threads = 1; Threads <= CFE_FT_PERF_MAX_THREADS; Threads *= 2)
+        {
+            CFE_FT_PerfRun("ES GetPoolBuf+PutPoolBuf", BufSize, Threads, ESPerfGetPutPoolBuf, Pool,
+                           CFE_FT_ES_PERF_NUM_SAMPLES, CFE_FT_ES_PERF_BATCH_OPS);
+        }
+    }
+
+    UtAssert_INT32_EQ(CFE_ES_PoolDelete(Pool->PoolId), CFE_SUCCESS);
+}
+
+void ESPerformanceTestSetup(void)
+{
+    UtTest_Add(TestGetPutPoolBufPerf, NULL, NULL, "Test Memory Pool Get/Put Performance");
+}
@@ -0,0 +1,71 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Functional test of EVS send API performance
+ *
+ * The intent of this test is to send events at a sufficiently high volume
+ * such that the cost of the send path can be characterized.  The events are
+ * of the debug type, which is disabled for apps by default, so this times
+ * the checks every event goes through without flooding the event log and
+ * the ground with the events themselves.  Debug events should therefore not
+ * be enabled for the test app while this runs.
+ */
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+#include "cfe_test_perf.h"
+
+/* Number of timed batches and events per batch */
+#define CFE_FT_EVS_PERF_NUM_SAMPLES 1000
+#define CFE_FT_EVS_PERF_BATCH_OPS   100
+
+/* Event ID used by the scenario, not used by any other test */
+#define CFE_FT_EVS_PERF_EID 0x7E
+
+/*
+ * One operation of the send scenario
+ */
+bool EVSPerfSendEvent(void *Arg, uint32 Thread)
+{
+    return CFE_EVS_SendEvent(CFE_FT_EVS_PERF_EID, CFE_EVS_EventType_DEBUG, "Benchmark event from task %lu",
+                             (unsigned long)Thread) == CFE_SUCCESS;
+}
+
+void TestSendEventPerf(void)
+{
+    uint32 Threads;
+
+    UtPrintf("Testing: CFE_EVS_SendEvent performance");
+
+    for (Threads = 1; Threads <= CFE_FT_PERF_MAX_THREADS; Threads *= 2)
+    {
+        CFE_FT_PerfRun("EVS SendEvent of disabled type", 0, Threads, EVSPerfSendEvent, NULL,
+                       CFE_FT_EVS_PERF_NUM_SAMPLES, CFE_FT_EVS_PERF_BATCH_OPS);
+    }
+}
+
+void EVSPerformanceTestSetup(void)
+{
+    UtTest_Add(TestSendEventPerf, NULL, NULL, "Test Event Send Performance");
+}
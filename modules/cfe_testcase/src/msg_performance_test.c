@@ -0,0 +1,143 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Functional test of MSG API performance
+ *
+ * The intent of this test is to call the message header APIs at a
+ * sufficiently high volume such that their cost can be characterized.
+ * CFE_MSG_Init() is timed for several message sizes, as it clears the
+ * whole message, and the header reads done on every transmit are timed
+ * as a group.  Each task works on its own message.  Comparing the results
+ * of builds with and without MISSION_MSG_INLINE_ACCESSORS shows the cost
+ * of the calls to the MSG module.
+ */
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+#include "cfe_test_perf.h"
+#include "cfe_test_msgids.h"
+
+/* Number of timed batches and operations per batch for each scenario */
+#define CFE_FT_MSG_PERF_NUM_SAMPLES 1000
+#define CFE_FT_MSG_PERF_BATCH_OPS   1000
+
+/* Smallest and largest message sizes used by the init scenario */
+#define CFE_FT_MSG_PERF_MIN_MSG_SIZE 64
+#define CFE_FT_MSG_PERF_MAX_MSG_SIZE 4096
+
+/* A telemetry message of the largest size used by the init scenario */
+typedef union
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    uint8                     Bytes[CFE_FT_MSG_PERF_MAX_MSG_SIZE];
+} CFE_FT_MsgPerfMessage_t;
+
+static CFE_FT_MsgPerfMessage_t CFE_FT_MsgPerfMessages[CFE_FT_PERF_MAX_THREADS];
+
+/* Receives the header reads, so inline reads cannot be optimized away */
+static volatile CFE_MSG_Size_t CFE_FT_MsgPerfSink[CFE_FT_PERF_MAX_THREADS];
+
+static const CFE_SB_MsgId_t CFE_FT_TLM_MSGID = CFE_SB_MSGID_WRAP_VALUE(CFE_TEST_HK_TLM_MID);
+
+/*
+ * One operation of the init scenario, the message size is passed as the argument
+ */
+bool MsgPerfInit(void *Arg, uint32 Thread)
+{
+    const size_t *MsgSize = Arg;
+
+    return CFE_MSG_Init(CFE_MSG_PTR(CFE_FT_MsgPerfMessages[Thread].TelemetryHeader), CFE_FT_TLM_MSGID, *MsgSize) ==
+           CFE_SUCCESS;
+}
+
+/*
+ * One operation of the header read scenario, the same reads SB does to route a message
+ */
+bool MsgPerfGetHeader(void *Arg, uint32 Thread)
+{
+    const CFE_MSG_Message_t *MsgPtr = CFE_MSG_PTR(CFE_FT_MsgPerfMessages[Thread].TelemetryHeader);
+    CFE_SB_MsgId_t           MsgId;
+    CFE_MSG_Size_t           Size;
+    CFE_MSG_Type_t           Type;
+
+    if (CFE_MSG_GetMsgId(MsgPtr, &MsgId) != CFE_SUCCESS || CFE_MSG_GetSize(MsgPtr, &Size) != CFE_SUCCESS ||
+        CFE_MSG_GetType(MsgPtr, &Type) != CFE_SUCCESS)
+    {
+        return false;
+    }
+
+    CFE_FT_MsgPerfSink[Thread] = Size + CFE_SB_MsgIdToValue(MsgId) + Type;
+
+    return true;
+}
+
+void TestInitPerf(void)
+{
+    size_t MsgSize;
+    uint32 Threads;
+
+    UtPrintf("Testing: CFE_MSG_Init performance");
+
+    for (MsgSize = CFE_FT_MSG_PERF_MIN_MSG_SIZE; MsgSize <= CFE_FT_MSG_PERF_MAX_MSG_SIZE; MsgSize *= 4)
+    {
+        for (Threads = 1; Threads <= CFE_FT_PERF_MAX_THREADS; Threads *= 2)
+        {
+            CFE_FT_PerfRun("MSG Init", MsgSize, Threads, MsgPerfInit, &MsgSize, CFE_FT_MSG_PERF_NUM_SAMPLES,
+                           CFE_FT_MSG_PERF_BATCH_OPS);
+        }
+    }
+}
+
+void TestGetHeaderPerf(void)
+{
+    uint32 Threads;
+    uint32 i;
+
+    UtPrintf("Testing: CFE_MSG_GetMsgId/CFE_MSG_GetSize/CFE_MSG_GetType performance");
+
+#ifdef CFE_MSG_INLINE_ACCESSORS
+    UtPrintf("MSG header accessors are inline");
+#else
+    UtPrintf("MSG header accessors are function calls");
+#endif
+
+    for (i = 0; i < CFE_FT_PERF_MAX_THREADS; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_MSG_Init(CFE_MSG_PTR(CFE_FT_MsgPerfMessages[i].TelemetryHeader), CFE_FT_TLM_MSGID,
+                                       CFE_FT_MSG_PERF_MIN_MSG_SIZE),
+                          CFE_SUCCESS);
+    }
+
+    for (Threads = 1; Threads <= CFE_FT_PERF_MAX_THREADS; Threads *= 2)
+    {
+        CFE_FT_PerfRun("MSG GetMsgId+GetSize+GetType", CFE_FT_MSG_PERF_MIN_MSG_SIZE, Threads, MsgPerfGetHeader, NULL,
+                       CFE_FT_MSG_PERF_NUM_SAMPLES, CFE_FT_MSG_PERF_BATCH_OPS);
+    }
+}
+
+void MsgPerformanceTestSetup(void)
+{
+    UtTest_Add(TestInitPerf, NULL, NULL, "Test Message Init Performance");
+    UtTest_Add(TestGetHeaderPerf, NULL, NULL, "Test Message Header Read Performance");
+}
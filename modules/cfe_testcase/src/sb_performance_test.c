@@ -26,13 +26,24 @@
  * the implementation can be characterized.  Note that this
  * cannot (currently) measure the performance directly, it merely implements a
  * scenario that allows the performance to be measured by an external test
- * harness.
+ * harness.  A second scenario times transfers of several message sizes
+ * through the common benchmark reporting (see cfe_test_perf.h), which also
+ * shows the effect of MISSION_MSG_INLINE_ACCESSORS on the transmit path.
  */
 
 #include "cfe_test.h"
+#include "cfe_test_perf.h"
 #include "cfe_msgids.h"
 #include "cfe_test_msgids.h"
 
+/* Number of timed batches and transfers per batch for each message size */
+#define CFE_FT_SB_PERF_NUM_SAMPLES 1000
+#define CFE_FT_SB_PERF_BATCH_MSGS  100
+
+/* Smallest and largest message sizes used by the size scenario */
+#define CFE_FT_SB_PERF_MIN_MSG_SIZE 64
+#define CFE_FT_SB_PERF_MAX_MSG_SIZE 4096
+
 /* A simple command message */
 typedef struct
 {
@@ -47,6 +58,22 @@ typedef struct
     uint32                    TlmPayload;
 } CFE_FT_TestTlmMessage_t;
 
+/* A telemetry message of the largest size used by the size scenario */
+typedef union
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    uint8                     Bytes[CFE_FT_SB_PERF_MAX_MSG_SIZE];
+} CFE_FT_TestBigTlmMessage_t;
+
+/* Message and pipe used by each transfer of the size scenario */
+typedef struct
+{
+    CFE_SB_PipeId_t            PipeId;
+    CFE_FT_TestBigTlmMessage_t TlmMsg;
+} CFE_FT_SBPerfTransfer_t;
+
+static CFE_FT_SBPerfTransfer_t CFE_FT_SBPerfTransfer;
+
 /*
  * This test procedure should be agnostic to specific MID values, but it should
  * not overlap/interfere with real MIDs used by other apps.
@@ -140,9 +167,67 @@ void TestBulkTransmitRecv(void)
 
     UtAssert_MIR("Elapsed time for SB bulk message test: %lu usec",
                  (unsigned long)OS_TimeGetTotalMicroseconds(ElapsedTime));
+
+    /* Remove the pipes, so later tests using the same MsgIds do not overflow them */
+    UtAssert_INT32_EQ(CFE_SB_DeletePipe(PipeId1), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_DeletePipe(PipeId2), CFE_SUCCESS);
+}
+
+/*
+ * One transfer of the size scenario, transmit a message and receive it again
+ */
+bool SBPerfTransmitRecv(void *Arg, uint32 Thread)
+{
+    CFE_FT_SBPerfTransfer_t *Transfer = Arg;
+    CFE_SB_Buffer_t *        MsgBuf;
+
+    if (CFE_SB_TransmitMsg(CFE_MSG_PTR(Transfer->TlmMsg.TelemetryHeader), true) != CFE_SUCCESS)
+    {
+        return false;
+    }
+
+    return CFE_SB_ReceiveBuffer(&MsgBuf, Transfer->PipeId, CFE_SB_POLL) == CFE_SUCCESS;
+}
+
+void TestTransmitRecvSizePerf(void)
+{
+    CFE_FT_SBPerfTransfer_t *Transfer = &CFE_FT_SBPerfTransfer;
+    uint32                   MsgSize;
+
+    UtPrintf("Testing: SB Transmit/Receive performance by message size");
+
+#ifdef CFE_MSG_INLINE_ACCESSORS
+    UtPrintf("MSG header accessors are inline");
+#else
+    UtPrintf("MSG header accessors are function calls");
+#endif
+
+    memset(Transfer, 0, sizeof(*Transfer));
+
+    UtAssert_INT32_EQ(CFE_SB_CreatePipe(&Transfer->PipeId, 5, "PerfPipe"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_SubscribeEx(CFE_FT_TLM_MSGID, Transfer->PipeId, CFE_SB_DEFAULT_QOS, 3), CFE_SUCCESS);
+
+    for (MsgSize = CFE_FT_SB_PERF_MIN_MSG_SIZE; MsgSize <= CFE_FT_SB_PERF_MAX_MSG_SIZE; MsgSize *= 4)
+    {
+        if (MsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+        {
+            UtAssert_NA("SB Transmit/Receive: %lu byte message is larger than the mission limit",
+                        (unsigned long)MsgSize);
+            break;
+        }
+
+        UtAssert_INT32_EQ(CFE_MSG_Init(CFE_MSG_PTR(Transfer->TlmMsg.TelemetryHeader), CFE_FT_TLM_MSGID, MsgSize),
+                          CFE_SUCCESS);
+
+        CFE_FT_PerfRun("SB TransmitMsg+ReceiveBuffer", MsgSize, 1, SBPerfTransmitRecv, Transfer,
+                       CFE_FT_SB_PERF_NUM_SAMPLES, CFE_FT_SB_PERF_BATCH_MSGS);
+    }
+
+    UtAssert_INT32_EQ(CFE_SB_DeletePipe(Transfer->PipeId), CFE_SUCCESS);
 }
 
 void SBPerformanceTestSetup(void)
 {
     UtTest_Add(TestBulkTransmitRecv, NULL, NULL, "Test Bulk SB Transmit/Receive");
+    UtTest_Add(TestTransmitRecvSizePerf, NULL, NULL, "Test SB Transmit/Receive Performance by Size");
 }
@@ -0,0 +1,458 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Functional test of SB scalability with several publishers and subscribers
+ *
+ * The intent of this test is to characterize how SB throughput scales with
+ * the topology: each scenario runs a number of publisher tasks that transmit
+ * the same MsgId, which is subscribed by a number of pipes that each have a
+ * consumer child task.  For each scenario this reports
+ *
+ *  - the transmit rate and latency of the publishers, where an increase of the
+ *    latency with the number of publishers shows the contention on the SB lock
+ *  - the delivery rate and the latency from transmit to receive of the consumers
+ *  - the messages that were not delivered, split by cause using the error
+ *    counters of the SB housekeeping telemetry
+ *
+ * The scenarios are listed in CFE_FT_SBScaleScenarios, and can be changed there
+ * to match the topology of a mission.  The publishers of a scenario can send
+ * messages of different sizes, to show how large messages delay small ones.  Scenarios that drop messages also cause
+ * SB error events, subject to the event filters of SB.
+ */
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+#include "cfe_test_perf.h"
+#include "cfe_msgids.h"
+#include "cfe_sb_msg.h"
+#include "cfe_test_msgids.h"
+
+/* Number of timed batches and messages per batch of each publisher */
+#define CFE_FT_SB_SCALE_NUM_SAMPLES 200
+#define CFE_FT_SB_SCALE_BATCH_MSGS  50
+
+/* Maximum number of subscribing pipes, each with its own consumer task */
+#define CFE_FT_SB_SCALE_MAX_SUBSCRIBERS 4
+
+/* Depth of the subscribing pipes */
+#define CFE_FT_SB_SCALE_PIPE_DEPTH 32
+
+/* Maximum number of transmit to receive latency samples kept by each consumer */
+#define CFE_FT_SB_SCALE_MAX_LATENCY_SAMPLES 1000
+
+/* Time the consumers wait for each message while the publishers run, in ms */
+#define CFE_FT_SB_SCALE_RECV_TIMEOUT 10
+
+/* Time to wait for the SB housekeeping telemetry, in ms */
+#define CFE_FT_SB_SCALE_HK_TIMEOUT 1000
+
+/* Topology of a scenario */
+typedef struct
+{
+    uint32 Publishers;  /**< Number of publisher tasks, at most CFE_FT_PERF_MAX_THREADS */
+    uint32 Subscribers; /**< Number of subscribing pipes, at most CFE_FT_SB_SCALE_MAX_SUBSCRIBERS */
+    uint32 MsgSize;     /**< Size of the messages, raised to the smallest size that holds the test payload */
+    uint32 MaxMsgSize;  /**< Size of the messages of the last publisher, the others spread evenly from MsgSize,
+                             or 0 for every publisher to send MsgSize */
+    uint16 MsgLim;      /**< Message limit of each subscription */
+} CFE_FT_SBScaleScenario_t;
+
+static const CFE_FT_SBScaleScenario_t CFE_FT_SBScaleScenarios[] = {
+    /* Publisher scaling with one subscriber */
+    {1, 1, 16, 0, CFE_FT_SB_SCALE_PIPE_DEPTH},
+    {2, 1, 16, 0, CFE_FT_SB_SCALE_PIPE_DEPTH},
+    {4, 1, 16, 0, CFE_FT_SB_SCALE_PIPE_DEPTH},
+
+    /* Subscriber fan-out */
+    {1, 2, 16, 0, CFE_FT_SB_SCALE_PIPE_DEPTH},
+    {1, 4, 16, 0, CFE_FT_SB_SCALE_PIPE_DEPTH},
+    {4, 4, 16, 0, CFE_FT_SB_SCALE_PIPE_DEPTH},
+
+    /* Message sizes, up to the largest message the mission allows */
+    {4, 4, 1024, 0, CFE_FT_SB_SCALE_PIPE_DEPTH},
+    {4, 4, 16384, 0, CFE_FT_SB_SCALE_PIPE_DEPTH},
+    {2, 2, CFE_MISSION_SB_MAX_SB_MSG_SIZE, 0, CFE_FT_SB_SCALE_PIPE_DEPTH},
+
+    /* Publishers of small and large messages sharing the subscribers */
+    {4, 4, 16, 4096, CFE_FT_SB_SCALE_PIPE_DEPTH},
+
+    /* Message limit below the pipe depth, so slow consumers cause message limit drops */
+    {4, 2, 256, 0, 2},
+};
+
+/* The payload of the test messages, the rest of the message is not used */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    OS_time_t                 TransmitTime;
+} CFE_FT_SBScaleMsgHdr_t;
+
+/* A test message of the largest size SB allows */
+typedef union
+{
+    CFE_FT_SBScaleMsgHdr_t Hdr;
+    uint8                  Bytes[CFE_MISSION_SB_MAX_SB_MSG_SIZE];
+} CFE_FT_SBScaleMsg_t;
+
+/* State shared with the consumer tasks */
+typedef struct
+{
+    CFE_SB_PipeId_t PipeIds[CFE_FT_SB_SCALE_MAX_SUBSCRIBERS];
+    volatile uint32 NumStarted;
+    volatile bool   Stop;
+    volatile bool   Done[CFE_FT_SB_SCALE_MAX_SUBSCRIBERS];
+    uint32          Received[CFE_FT_SB_SCALE_MAX_SUBSCRIBERS];
+    uint32          NumLatencySamples[CFE_FT_SB_SCALE_MAX_SUBSCRIBERS];
+    uint32          LatencyStride;
+    uint32          LatencyNsec[CFE_FT_SB_SCALE_MAX_SUBSCRIBERS * CFE_FT_SB_SCALE_MAX_LATENCY_SAMPLES];
+} CFE_FT_SBScaleState_t;
+
+static CFE_FT_SBScaleMsg_t   CFE_FT_SBScaleMsgs[CFE_FT_PERF_MAX_THREADS];
+static CFE_FT_SBScaleState_t CFE_FT_SBScaleState;
+
+static const CFE_SB_MsgId_t CFE_FT_TLM_MSGID = CFE_SB_MSGID_WRAP_VALUE(CFE_TEST_HK_TLM_MID);
+
+/*
+ * Gets the SB drop counters from the SB housekeeping telemetry
+ *
+ * Returns false if the telemetry did not arrive in time.
+ */
+bool SBScaleGetDropCounters(uint16 *PipeOverflows, uint16 *MsgLimitErrors)
+{
+    CFE_SB_PipeId_t                 HkPipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_SendHkCmd_t              SendHkCmd;
+    CFE_SB_Buffer_t *               MsgBuf;
+    const CFE_SB_HousekeepingTlm_t *HkPtr;
+    bool                            Received = false;
+
+    memset(&SendHkCmd, 0, sizeof(SendHkCmd));
+
+    UtAssert_INT32_EQ(CFE_SB_CreatePipe(&HkPipeId, 2, "PerfHkPipe"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_Subscribe(CFE_SB_ValueToMsgId(CFE_SB_HK_TLM_MID), HkPipeId), CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(CFE_MSG_Init(CFE_MSG_PTR(SendHkCmd.CommandHeader), CFE_SB_ValueToMsgId(CFE_SB_SEND_HK_MID),
+                                   sizeof(SendHkCmd)),
+                      CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsg(CFE_MSG_PTR(SendHkCmd.CommandHeader), true), CFE_SUCCESS);
+
+    if (CFE_SB_ReceiveBuffer(&MsgBuf, HkPipeId, CFE_FT_SB_SCALE_HK_TIMEOUT) == CFE_SUCCESS)
+    {
+        HkPtr           = (const void *)MsgBuf;
+        *PipeOverflows  = HkPtr->Payload.PipeOverflowErrorCounter;
+        *MsgLimitErrors = HkPtr->Payload.MsgLimitErrorCounter;
+        Received        = true;
+    }
+
+    UtAssert_INT32_EQ(CFE_SB_DeletePipe(HkPipeId), CFE_SUCCESS);
+
+    return Received;
+}
+
+/*
+ * Records the transmit to receive latency of a received message, for one in every LatencyStride messages
+ */
+void SBScaleRecordLatency(uint32 Subscriber, const CFE_SB_Buffer_t *MsgBuf)
+{
+    const CFE_FT_SBScaleMsgHdr_t *MsgPtr = (const void *)MsgBuf;
+    OS_time_t                     Now;
+    int64                         LatencyNsec;
+    uint32                        Sample;
+
+    Sample = CFE_FT_SBScaleState.NumLatencySamples[Subscriber];
+    if ((CFE_FT_SBScaleState.Received[Subscriber] % CFE_FT_SBScaleState.LatencyStride) != 0 ||
+        Sample >= CFE_FT_SB_SCALE_MAX_LATENCY_SAMPLES)
+    {
+        return;
+    }
+
+    CFE_PSP_GetTime(&Now);
+    LatencyNsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, MsgPtr->TransmitTime)) * 1000;
+    if (LatencyNsec < 0)
+    {
+        LatencyNsec = 0;
+    }
+    else if (LatencyNsec > 0xFFFFFFFF)
+    {
+        LatencyNsec = 0xFFFFFFFF;
+    }
+
+    CFE_FT_SBScaleState.LatencyNsec[(Subscriber * CFE_FT_SB_SCALE_MAX_LATENCY_SAMPLES) + Sample] = (uint32)LatencyNsec;
+    CFE_FT_SBScaleState.NumLatencySamples[Subscriber] = Sample + 1;
+}
+
+/*
+ * Entry point of the consumer tasks
+ *
+ * Each consumer receives from its own pipe until the publishers are done
+ * and the pipe is empty.  As with the publishers, the test task waits for
+ * each consumer to take its number before creating the next one.
+ */
+void SBScaleConsumerTask(void)
+{
+    CFE_SB_Buffer_t *MsgBuf;
+    CFE_Status_t     Status;
+    uint32           Subscriber;
+
+    Subscriber                     = CFE_FT_SBScaleState.NumStarted;
+    CFE_FT_SBScaleState.NumStarted = Subscriber + 1;
+
+    while (true)
+    {
+        Status = CFE_SB_ReceiveBuffer(&MsgBuf, CFE_FT_SBScaleState.PipeIds[Subscriber],
+                                      CFE_FT_SBScaleState.Stop ? CFE_SB_POLL : CFE_FT_SB_SCALE_RECV_TIMEOUT);
+        if (Status == CFE_SUCCESS)
+        {
+            SBScaleRecordLatency(Subscriber, MsgBuf);
+            ++CFE_FT_SBScaleState.Received[Subscriber];
+        }
+        else if (Status != CFE_SB_TIME_OUT || CFE_FT_SBScaleState.Stop)
+        {
+            break;
+        }
+    }
+
+    CFE_FT_SBScaleState.Done[Subscriber] = true;
+    CFE_ES_ExitChildTask();
+}
+
+/*
+ * One operation of the publishers, transmit a message stamped with the current time
+ */
+bool SBScalePublish(void *Arg, uint32 Thread)
+{
+    CFE_FT_SBScaleMsgHdr_t *MsgPtr = &CFE_FT_SBScaleMsgs[Thread].Hdr;
+
+    CFE_PSP_GetTime(&MsgPtr->TransmitTime);
+
+    return CFE_SB_TransmitMsg(CFE_MSG_PTR(MsgPtr->TelemetryHeader), true) == CFE_SUCCESS;
+}
+
+/*
+ * Gets the message size of a publisher, spread evenly from MsgSize for the first
+ * publisher to MaxMsgSize for the last.  Unused publisher slots get MsgSize.
+ */
+uint32 SBScalePublisherMsgSize(uint32 Thread, uint32 Publishers, uint32 MsgSize, uint32 MaxMsgSize)
+{
+    if (Publishers < 2 || Thread >= Publishers)
+    {
+        return MsgSize;
+    }
+
+    return MsgSize + (uint32)(((uint64)(MaxMsgSize - MsgSize) * Thread) / (Publishers - 1));
+}
+
+/*
+ * Runs one scenario: creates the subscribing pipes and their consumers, runs the
+ * publishers, then waits for the consumers to empty the pipes and reports the result
+ */
+void SBScaleRunScenario(const CFE_FT_SBScaleScenario_t *Scenario)
+{
+    CFE_ES_TaskId_t   TaskId;
+    CFE_ES_TaskInfo_t TaskInfo;
+    CFE_ES_TaskId_t   ConsumerIds[CFE_FT_SB_SCALE_MAX_SUBSCRIBERS];
+    char              Name[OS_MAX_API_NAME];
+    char              Case[64];
+    uint32            Subscribers;
+    uint32            MsgSize;
+    uint32            MaxMsgSize;
+    uint32            NumConsumers;
+    uint32            NumLatencySamples;
+    uint32            i;
+    uint32            Wait;
+    uint16            OverflowsBefore = 0;
+    uint16            MsgLimitsBefore = 0;
+    uint16            OverflowsAfter  = 0;
+    uint16            MsgLimitsAfter  = 0;
+    bool              HaveCounters;
+    uint64            Published;
+    uint64            Delivered;
+    uint64            ElapsedUsec;
+    OS_time_t         StartTime;
+    OS_time_t         ElapsedTime;
+
+    Subscribers = Scenario->Subscribers;
+    if (Subscribers > CFE_FT_SB_SCALE_MAX_SUBSCRIBERS)
+    {
+        Subscribers = CFE_FT_SB_SCALE_MAX_SUBSCRIBERS;
+    }
+
+    MsgSize = Scenario->MsgSize;
+    if (MsgSize < sizeof(CFE_FT_SBScaleMsgHdr_t))
+    {
+        MsgSize = sizeof(CFE_FT_SBScaleMsgHdr_t);
+    }
+
+    MaxMsgSize = Scenario->MaxMsgSize;
+    if (MaxMsgSize < MsgSize)
+    {
+        MaxMsgSize = MsgSize;
+    }
+
+    if (MaxMsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+    {
+        UtAssert_NA("SB scalability: %lu byte message is larger than the mission limit", (unsigned long)MaxMsgSize);
+        return;
+    }
+
+    UtPrintf("SB scalability: %lu publishers, %lu subscribers, %lu to %lu byte messages, message limit %u",
+             (unsigned long)Scenario->Publishers, (unsigned long)Subscribers, (unsigned long)MsgSize,
+             (unsigned long)MaxMsgSize, (unsigned int)Scenario->MsgLim);
+
+    memset(&CFE_FT_SBScaleState, 0, sizeof(CFE_FT_SBScaleState));
+
+    /* Keep latency samples spread over all the messages each consumer should get */
+    CFE_FT_SBScaleState.LatencyStride =
+        ((Scenario->Publishers * CFE_FT_SB_SCALE_NUM_SAMPLES * CFE_FT_SB_SCALE_BATCH_MSGS) /
+         CFE_FT_SB_SCALE_MAX_LATENCY_SAMPLES) +
+        1;
+
+    /* The sizes of the publishers are spread evenly from MsgSize to MaxMsgSize */
+    for (i = 0; i < CFE_FT_PERF_MAX_THREADS; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_MSG_Init(CFE_MSG_PTR(CFE_FT_SBScaleMsgs[i].Hdr.TelemetryHeader), CFE_FT_TLM_MSGID,
+                                       SBScalePublisherMsgSize(i, Scenario->Publishers, MsgSize, MaxMsgSize)),
+                          CFE_SUCCESS);
+    }
+
+    for (i = 0; i < Subscribers; ++i)
+    {
+        snprintf(Name, sizeof(Name), "PerfSubPipe%lu", (unsigned long)i);
+        UtAssert_INT32_EQ(CFE_SB_CreatePipe(&CFE_FT_SBScaleState.PipeIds[i], CFE_FT_SB_SCALE_PIPE_DEPTH, Name),
+                          CFE_SUCCESS);
+        UtAssert_INT32_EQ(CFE_SB_SubscribeEx(CFE_FT_TLM_MSGID, CFE_FT_SBScaleState.PipeIds[i], CFE_SB_DEFAULT_QOS,
+                                             Scenario->MsgLim),
+                          CFE_SUCCESS);
+    }
+
+    HaveCounters = SBScaleGetDropCounters(&OverflowsBefore, &MsgLimitsBefore);
+
+    /* Consumers run at the priority of the test task, like the publishers */
+    UtAssert_INT32_EQ(CFE_ES_GetTaskID(&TaskId), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GetTaskInfo(&TaskInfo, TaskId), CFE_SUCCESS);
+
+    for (NumConsumers = 0; NumConsumers < Subscribers; ++NumConsumers)
+    {
+        snprintf(Name, sizeof(Name), "PerfSub%lu", (unsigned long)NumConsumers);
+        if (CFE_ES_CreateChildTask(&ConsumerIds[NumConsumers], Name, SBScaleConsumerTask, CFE_ES_TASK_STACK_ALLOCATE,
+                                   CFE_FT_PERF_STACK_SIZE, TaskInfo.Priority, 0) != CFE_SUCCESS)
+        {
+            UtAssert_Failed("SB scalability: consumer task %lu not created", (unsigned long)NumConsumers);
+            break;
+        }
+
+        for (Wait = 0; Wait < 1000 && CFE_FT_SBScaleState.NumStarted <= NumConsumers; ++Wait)
+        {
+            OS_TaskDelay(1);
+        }
+
+        if (CFE_FT_SBScaleState.NumStarted <= NumConsumers)
+        {
+            UtAssert_Failed("SB scalability: consumer task %lu did not start", (unsigned long)NumConsumers);
+            ++NumConsumers;
+            break;
+        }
+    }
+
+    snprintf(Case, sizeof(Case), "SB transmit to %lu pipes%s", (unsigned long)Subscribers,
+             (MaxMsgSize != MsgSize) ? ", mixed sizes" : "");
+
+    CFE_PSP_GetTime(&StartTime);
+
+    CFE_FT_PerfRun(Case, MaxMsgSize, Scenario->Publishers, SBScalePublish, NULL, CFE_FT_SB_SCALE_NUM_SAMPLES,
+                   CFE_FT_SB_SCALE_BATCH_MSGS);
+
+    /* Let the consumers empty their pipes, then stop */
+    CFE_FT_SBScaleState.Stop = true;
+    for (i = 0; i < NumConsumers; ++i)
+    {
+        for (Wait = 0; Wait < 10000 && !CFE_FT_SBScaleState.Done[i]; ++Wait)
+        {
+            OS_TaskDelay(1);
+        }
+
+        if (!CFE_FT_SBScaleState.Done[i])
+        {
+            UtAssert_Failed("SB scalability: consumer task %lu did not finish", (unsigned long)i);
+            UtAssert_INT32_EQ(CFE_ES_DeleteChildTask(ConsumerIds[i]), CFE_SUCCESS);
+        }
+    }
+
+    CFE_PSP_GetTime(&ElapsedTime);
+    ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+    ElapsedUsec = OS_TimeGetTotalMicroseconds(ElapsedTime);
+
+    for (i = 0; i < Subscribers; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_SB_DeletePipe(CFE_FT_SBScaleState.PipeIds[i]), CFE_SUCCESS);
+    }
+
+    /* Gather the latency samples of all consumers at the start of the array */
+    Published         = (uint64)Scenario->Publishers * CFE_FT_SB_SCALE_NUM_SAMPLES * CFE_FT_SB_SCALE_BATCH_MSGS;
+    Delivered         = 0;
+    NumLatencySamples = 0;
+    for (i = 0; i < Subscribers; ++i)
+    {
+        memmove(&CFE_FT_SBScaleState.LatencyNsec[NumLatencySamples],
+                &CFE_FT_SBScaleState.LatencyNsec[i * CFE_FT_SB_SCALE_MAX_LATENCY_SAMPLES],
+                CFE_FT_SBScaleState.NumLatencySamples[i] * sizeof(CFE_FT_SBScaleState.LatencyNsec[0]));
+        NumLatencySamples += CFE_FT_SBScaleState.NumLatencySamples[i];
+        Delivered += CFE_FT_SBScaleState.Received[i];
+    }
+
+    snprintf(Case, sizeof(Case), "SB delivery to %lu pipes%s", (unsigned long)Subscribers,
+             (MaxMsgSize != MsgSize) ? ", mixed sizes" : "");
+    CFE_FT_PerfReportResult(Case, MaxMsgSize, Scenario->Publishers, Delivered,
+                            (ElapsedUsec != 0) ? ((Delivered * 1000000) / ElapsedUsec) : 0,
+                            CFE_FT_SBScaleState.LatencyNsec, NumLatencySamples);
+
+    if (HaveCounters && SBScaleGetDropCounters(&OverflowsAfter, &MsgLimitsAfter))
+    {
+        UtAssert_MIR("%s: %lu of %lu messages not delivered, pipe overflow=%u msg limit=%u", Case,
+                     (unsigned long)((Published * Subscribers) - Delivered), (unsigned long)(Published * Subscribers),
+                     (unsigned int)(uint16)(OverflowsAfter - OverflowsBefore),
+                     (unsigned int)(uint16)(MsgLimitsAfter - MsgLimitsBefore));
+    }
+    else
+    {
+        UtAssert_MIR("%s: %lu of %lu messages not delivered, SB housekeeping not received", Case,
+                     (unsigned long)((Published * Subscribers) - Delivered), (unsigned long)(Published * Subscribers));
+    }
+}
+
+void TestMultiPublisherPerf(void)
+{
+    uint32 i;
+
+    UtPrintf("Testing: SB scalability with several publishers and subscribers");
+
+    for (i = 0; i < sizeof(CFE_FT_SBScaleScenarios) / sizeof(CFE_FT_SBScaleScenarios[0]); ++i)
+    {
+        SBScaleRunScenario(&CFE_FT_SBScaleScenarios[i]);
+    }
+}
+
+void SBScalabilityTestSetup(void)
+{
+    UtTest_Add(TestMultiPublisherPerf, NULL, NULL, "Test SB Multi-Publisher Scalability");
+}
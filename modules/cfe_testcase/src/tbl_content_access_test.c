@@ -87,16 +87,18 @@ void TestReleaseAddress(void)
     LoadTable(&TestTable, CFE_SUCCESS);
     UtAssert_INT32_EQ(CFE_TBL_ReleaseAddress(CFE_FT_Global.TblHandle), CFE_TBL_INFO_UPDATED);
 
-    /* Attempt to load while address is locked */
+    /* Load while address is held: the reader keeps the previous contents until release */
     LoadTable(&TestTable, CFE_SUCCESS);
     UtAssert_INT32_EQ(CFE_TBL_GetAddress(&TblPtr, CFE_FT_Global.TblHandle), CFE_TBL_INFO_UPDATED);
-    LoadTable(&TestTable, CFE_TBL_INFO_TABLE_LOCKED);
+    TestTable.Int1 = 3;
+    LoadTable(&TestTable, CFE_SUCCESS);
+    UtAssert_UINT32_EQ(((TBL_TEST_Table_t *)TblPtr)->Int1, 1);
 
-    /* Release and try again */
+    /* Release and get the address again to see the new contents */
+    UtAssert_INT32_EQ(CFE_TBL_ReleaseAddress(CFE_FT_Global.TblHandle), CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(CFE_TBL_GetAddress(&TblPtr, CFE_FT_Global.TblHandle), CFE_TBL_INFO_UPDATED);
+    UtAssert_UINT32_EQ(((TBL_TEST_Table_t *)TblPtr)->Int1, 3);
     UtAssert_INT32_EQ(CFE_TBL_ReleaseAddress(CFE_FT_Global.TblHandle), CFE_SUCCESS);
-    /* It is necessary to call CFE_TBL_Manage because the table still thinks there is a load in progress from the failed
-    load while the table was locked. This call shouldn't be necessary. */
-    UtAssert_INT32_EQ(CFE_TBL_Manage(CFE_FT_Global.TblHandle), CFE_TBL_INFO_UPDATED);
     LoadTable(&TestTable, CFE_SUCCESS);
 
     /* Attempt to release an unregistered table */
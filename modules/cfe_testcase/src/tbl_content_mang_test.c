@@ -232,6 +232,18 @@ void TestManage(void)
     UtAssert_INT32_EQ(CFE_TBL_Manage(CFE_TBL_BAD_TABLE_HANDLE), CFE_TBL_ERR_INVALID_HANDLE);
 }
 
+void TestManageAll(void)
+{
+    CFE_ES_AppId_t AppId;
+
+    UtPrintf("Testing: CFE_TBL_ManageAll");
+    UtAssert_INT32_EQ(CFE_ES_GetAppID(&AppId), CFE_SUCCESS);
+
+    /* Nothing has been requested of the test table, so there is nothing to do */
+    UtAssert_INT32_EQ(CFE_TBL_ManageAll(AppId), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_TBL_ManageAll(CFE_ES_APPID_UNDEFINED), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+}
+
 void TestDumpToBuffer(void)
 {
     UtPrintf("Testing: CFE_TBL_DumpToBuffer");
@@ -486,6 +498,7 @@ void TBLContentMangTestSetup(void)
     UtTest_Add(TestUpdate, RegisterTestTable, UnregisterTestTable, "Test Table Update");
     UtTest_Add(TestValidate, RegisterTestTable, UnregisterTestTable, "Test Table Validate");
     UtTest_Add(TestManage, RegisterTestTable, UnregisterTestTable, "Test Table Manage");
+    UtTest_Add(TestManageAll, RegisterTestTable, UnregisterTestTable, "Test Table Manage All");
     UtTest_Add(TestDumpToBuffer, RegisterTestTable, UnregisterTestTable, "Test Table Dump to Buffer");
     UtTest_Add(TestModified, RegisterTestTable, UnregisterTestTable, "Test Table Modified");
 }
@@ -74,6 +74,25 @@ void TestGetInfo(void)
     UtAssert_INT32_EQ(TblInfo.Critical, expectedCritical);
 }
 
+void TestGetLoadRange(void)
+{
+    size_t Offset   = 1;
+    size_t NumBytes = 0;
+
+    UtPrintf("Testing: CFE_TBL_GetLoadRange");
+
+    /* No load is pending, so the entire table is reported */
+    UtAssert_INT32_EQ(CFE_TBL_GetLoadRange(CFE_FT_Global.TblHandle, &Offset, &NumBytes),
+                      CFE_TBL_INFO_NO_UPDATE_PENDING);
+    UtAssert_UINT32_EQ(Offset, 0);
+    UtAssert_UINT32_EQ(NumBytes, sizeof(TBL_TEST_Table_t));
+
+    UtAssert_INT32_EQ(CFE_TBL_GetLoadRange(CFE_TBL_BAD_TABLE_HANDLE, &Offset, &NumBytes),
+                      CFE_TBL_ERR_INVALID_HANDLE);
+    UtAssert_INT32_EQ(CFE_TBL_GetLoadRange(CFE_FT_Global.TblHandle, NULL, &NumBytes), CFE_TBL_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TBL_GetLoadRange(CFE_FT_Global.TblHandle, &Offset, NULL), CFE_TBL_BAD_ARGUMENT);
+}
+
 void TestNotifyByMessage(void)
 {
     CFE_TBL_Handle_t  SharedTblHandle = CFE_TBL_BAD_TABLE_HANDLE;
@@ -100,5 +119,6 @@ void TBLInformationTestSetup(void)
 {
     UtTest_Add(TestGetStatus, RegisterTestTable, UnregisterTestTable, "Test Table Get Status");
     UtTest_Add(TestGetInfo, RegisterTestTable, UnregisterTestTable, "Test Table Get Info");
+    UtTest_Add(TestGetLoadRange, RegisterTestTable, UnregisterTestTable, "Test Table Get Load Range");
     UtTest_Add(TestNotifyByMessage, RegisterTestTable, UnregisterTestTable, "Test Table Notify by Message");
 }
@@ -0,0 +1,382 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Functional test of TBL access and load API performance
+ *
+ * The intent of this test is to exercise the table access and load paths
+ * at a sufficiently high rate / volume such that their performance can be
+ * characterized.  Each scenario is timed in batches of operations, and the
+ * throughput and the distribution of the per-operation latency across the
+ * batches are reported through the common benchmark reporting (see
+ * cfe_test_perf.h), so that regressions in the TBL hot paths can be spotted
+ * by comparing results between builds.
+ */
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+#include "cfe_test_table.h"
+#include "cfe_test_perf.h"
+
+/* Number of timed batches collected for each scenario */
+#define CFE_FT_TBL_PERF_NUM_SAMPLES 100
+
+/* Number of tables used by the multi-table scenarios */
+#define CFE_FT_TBL_PERF_NUM_TABLES 16
+
+/* Number of operations in each timed batch of the access scenarios */
+#define CFE_FT_TBL_PERF_ACCESS_OPS 10000
+#define CFE_FT_TBL_PERF_MULTI_OPS  1000
+
+/* Smallest and largest table sizes used by the load scenario */
+#define CFE_FT_TBL_PERF_MIN_LOAD_SIZE 1024
+#define CFE_FT_TBL_PERF_MAX_LOAD_SIZE (16 * 1024 * 1024)
+
+static CFE_TBL_Handle_t CFE_FT_TblPerfHandles[CFE_FT_TBL_PERF_NUM_TABLES];
+
+/*
+ * Validation function for the load scenario, so each load goes through validation
+ */
+int32 TblPerfValidate(void *TblPtr)
+{
+    return CFE_SUCCESS;
+}
+
+/* Setup function to register and load the set of tables used by the multi-table scenarios */
+void RegisterPerfTables(void)
+{
+    TBL_TEST_Table_t TestTable = {1, 2};
+    char             TblName[CFE_MISSION_TBL_MAX_NAME_LENGTH];
+    uint32           i;
+
+    for (i = 0; i < CFE_FT_TBL_PERF_NUM_TABLES; ++i)
+    {
+        snprintf(TblName, sizeof(TblName), "PerfTbl%02u", (unsigned int)i);
+        UtAssert_INT32_EQ(CFE_TBL_Register(&CFE_FT_TblPerfHandles[i], TblName, sizeof(TBL_TEST_Table_t),
+                                           CFE_TBL_OPT_DEFAULT, NULL),
+                          CFE_SUCCESS);
+        UtAssert_INT32_EQ(CFE_TBL_Load(CFE_FT_TblPerfHandles[i], CFE_TBL_SRC_ADDRESS, &TestTable), CFE_SUCCESS);
+    }
+}
+
+/* Teardown function to unregister the set of tables used by the multi-table scenarios */
+void UnregisterPerfTables(void)
+{
+    uint32 i;
+
+    for (i = 0; i < CFE_FT_TBL_PERF_NUM_TABLES; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_TBL_Unregister(CFE_FT_TblPerfHandles[i]), CFE_SUCCESS);
+    }
+}
+
+void TestGetReleaseAddressPerf(void)
+{
+    TBL_TEST_Table_t TestTable = {1, 2};
+    void *           TblPtr;
+    OS_time_t        StartTime;
+    OS_time_t        OpStartTime;
+    OS_time_t        OpTime;
+    uint32           Sample;
+    uint32           TimedOp;
+    uint32           Op;
+
+    UtPrintf("Testing: CFE_TBL_GetAddress/CFE_TBL_ReleaseAddress performance");
+
+    UtAssert_INT32_EQ(CFE_TBL_Load(CFE_FT_Global.TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_TBL_GetAddress(&TblPtr, CFE_FT_Global.TblHandle), CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(CFE_TBL_ReleaseAddress(CFE_FT_Global.TblHandle), CFE_SUCCESS);
+
+    CFE_FT_PerfStatsInit(CFE_FT_TBL_PERF_NUM_SAMPLES, CFE_FT_TBL_PERF_ACCESS_OPS);
+
+    for (Sample = 0; Sample < CFE_FT_TBL_PERF_NUM_SAMPLES; ++Sample)
+    {
+        TimedOp = CFE_FT_PerfTimedOp(Sample);
+        OpTime  = OS_TimeAssembleFromNanoseconds(0, 0);
+
+        CFE_PSP_GetTime(&StartTime);
+
+        for (Op = 0; Op < CFE_FT_TBL_PERF_ACCESS_OPS; ++Op)
+        {
+            if (Op == TimedOp)
+            {
+                CFE_PSP_GetTime(&OpStartTime);
+            }
+
+            /* In order to not "flood" with test results, this should be silent unless a failure occurs */
+            CFE_Assert_STATUS_STORE(CFE_TBL_GetAddress(&TblPtr, CFE_FT_Global.TblHandle));
+            if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+            {
+                break;
+            }
+
+            CFE_Assert_STATUS_STORE(CFE_TBL_ReleaseAddress(CFE_FT_Global.TblHandle));
+            if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+            {
+                break;
+            }
+
+            if (Op == TimedOp)
+            {
+                CFE_PSP_GetTime(&OpTime);
+                OpTime = OS_TimeSubtract(OpTime, OpStartTime);
+            }
+        }
+
+        if (Op < CFE_FT_TBL_PERF_ACCESS_OPS)
+        {
+            break;
+        }
+
+        CFE_FT_PerfStatsAdd(0, StartTime, OpTime);
+    }
+
+    CFE_FT_PerfStatsReport("TBL GetAddress+ReleaseAddress", sizeof(TBL_TEST_Table_t));
+}
+
+void TestGetReleaseAddressesPerf(void)
+{
+    void **   TblPtrs[CFE_FT_TBL_PERF_NUM_TABLES];
+    void *    TblPtrBuf[CFE_FT_TBL_PERF_NUM_TABLES];
+    OS_time_t StartTime;
+    OS_time_t OpStartTime;
+    OS_time_t OpTime;
+    uint32    Sample;
+    uint32    TimedOp;
+    uint32    Op;
+    uint32    i;
+
+    UtPrintf("Testing: CFE_TBL_GetAddresses/CFE_TBL_ReleaseAddresses performance");
+
+    for (i = 0; i < CFE_FT_TBL_PERF_NUM_TABLES; ++i)
+    {
+        TblPtrs[i] = &TblPtrBuf[i];
+    }
+
+    /* Clear the update notifications left over from the initial loads */
+    UtAssert_INT32_EQ(CFE_TBL_GetAddresses(TblPtrs, CFE_FT_TBL_PERF_NUM_TABLES, CFE_FT_TblPerfHandles),
+                      CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(CFE_TBL_ReleaseAddresses(CFE_FT_TBL_PERF_NUM_TABLES, CFE_FT_TblPerfHandles), CFE_SUCCESS);
+
+    CFE_FT_PerfStatsInit(CFE_FT_TBL_PERF_NUM_SAMPLES, CFE_FT_TBL_PERF_MULTI_OPS);
+
+    for (Sample = 0; Sample < CFE_FT_TBL_PERF_NUM_SAMPLES; ++Sample)
+    {
+        TimedOp = CFE_FT_PerfTimedOp(Sample);
+        OpTime  = OS_TimeAssembleFromNanoseconds(0, 0);
+
+        CFE_PSP_GetTime(&StartTime);
+
+        for (Op = 0; Op < CFE_FT_TBL_PERF_MULTI_OPS; ++Op)
+        {
+            if (Op == TimedOp)
+            {
+                CFE_PSP_GetTime(&OpStartTime);
+            }
+
+            CFE_Assert_STATUS_STORE(CFE_TBL_GetAddresses(TblPtrs, CFE_FT_TBL_PERF_NUM_TABLES, CFE_FT_TblPerfHandles));
+            if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+            {
+                break;
+            }
+
+            CFE_Assert_STATUS_STORE(CFE_TBL_ReleaseAddresses(CFE_FT_TBL_PERF_NUM_TABLES, CFE_FT_TblPerfHandles));
+            if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+            {
+                break;
+            }
+
+            if (Op == TimedOp)
+            {
+                CFE_PSP_GetTime(&OpTime);
+                OpTime = OS_TimeSubtract(OpTime, OpStartTime);
+            }
+        }
+
+        if (Op < CFE_FT_TBL_PERF_MULTI_OPS)
+        {
+            break;
+        }
+
+        CFE_FT_PerfStatsAdd(0, StartTime, OpTime);
+    }
+
+    CFE_FT_PerfStatsReport("TBL GetAddresses+ReleaseAddresses of 16 tables", sizeof(TBL_TEST_Table_t));
+}
+
+void TestManageIdlePerf(void)
+{
+    OS_time_t StartTime;
+    OS_time_t OpStartTime;
+    OS_time_t OpTime;
+    uint32    Sample;
+    uint32    TimedOp;
+    uint32    Op;
+    uint32    i;
+
+    UtPrintf("Testing: CFE_TBL_Manage performance on idle tables");
+
+    CFE_FT_PerfStatsInit(CFE_FT_TBL_PERF_NUM_SAMPLES, CFE_FT_TBL_PERF_MULTI_OPS);
+
+    for (Sample = 0; Sample < CFE_FT_TBL_PERF_NUM_SAMPLES; ++Sample)
+    {
+        TimedOp = CFE_FT_PerfTimedOp(Sample);
+        OpTime  = OS_TimeAssembleFromNanoseconds(0, 0);
+
+        CFE_PSP_GetTime(&StartTime);
+
+        for (Op = 0; Op < CFE_FT_TBL_PERF_MULTI_OPS; ++Op)
+        {
+            if (Op == TimedOp)
+            {
+                CFE_PSP_GetTime(&OpStartTime);
+            }
+
+            for (i = 0; i < CFE_FT_TBL_PERF_NUM_TABLES; ++i)
+            {
+                CFE_Assert_STATUS_STORE(CFE_TBL_Manage(CFE_FT_TblPerfHandles[i]));
+                if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+                {
+                    break;
+                }
+            }
+
+            if (i < CFE_FT_TBL_PERF_NUM_TABLES)
+            {
+                break;
+            }
+
+            if (Op == TimedOp)
+            {
+                CFE_PSP_GetTime(&OpTime);
+                OpTime = OS_TimeSubtract(OpTime, OpStartTime);
+            }
+        }
+
+        if (Op < CFE_FT_TBL_PERF_MULTI_OPS)
+        {
+            break;
+        }
+
+        CFE_FT_PerfStatsAdd(0, StartTime, OpTime);
+    }
+
+    CFE_FT_PerfStatsReport("TBL Manage of 16 idle tables", sizeof(TBL_TEST_Table_t));
+}
+
+/*
+ * Helper function to time load/validate/update cycles of a double buffered table of the given size
+ *
+ * The data to load comes from the buffer of a second table of the same size, so that
+ * no test-local storage of the largest size is needed.  Sizes that the platform
+ * configuration does not allow to be registered are skipped.
+ */
+void TblPerfLoadCycles(uint32 TblSize)
+{
+    CFE_TBL_Handle_t SrcHandle = CFE_TBL_BAD_TABLE_HANDLE;
+    CFE_TBL_Handle_t DstHandle = CFE_TBL_BAD_TABLE_HANDLE;
+    uint32 *         SrcPtr;
+    void *           DstPtr;
+    OS_time_t        StartTime;
+    OS_time_t        OpTime;
+    CFE_Status_t     Status;
+    uint32           Sample;
+    char             Scenario[64];
+
+    snprintf(Scenario, sizeof(Scenario), "TBL Load/validate/update of %lu byte table", (unsigned long)TblSize);
+
+    Status = CFE_TBL_Register(&SrcHandle, "PerfSrcTbl", TblSize, CFE_TBL_OPT_DEFAULT, NULL);
+    if (Status != CFE_SUCCESS)
+    {
+        UtAssert_NA("%s: source table not registered (Status=0x%08lx)", Scenario, (unsigned long)Status);
+        return;
+    }
+
+    Status = CFE_TBL_Register(&DstHandle, "PerfDstTbl", TblSize, CFE_TBL_OPT_DBL_BUFFER, TblPerfValidate);
+    if (Status != CFE_SUCCESS)
+    {
+        UtAssert_NA("%s: table not registered (Status=0x%08lx)", Scenario, (unsigned long)Status);
+        UtAssert_INT32_EQ(CFE_TBL_Unregister(SrcHandle), CFE_SUCCESS);
+        return;
+    }
+
+    /* The source table is never loaded, but its (zeroed) buffer is still returned */
+    UtAssert_INT32_EQ(CFE_TBL_GetAddress((void **)&SrcPtr, SrcHandle), CFE_TBL_ERR_NEVER_LOADED);
+    UtAssert_NOT_NULL(SrcPtr);
+
+    if (SrcPtr != NULL)
+    {
+        CFE_FT_PerfStatsInit(CFE_FT_TBL_PERF_NUM_SAMPLES, 1);
+
+        for (Sample = 0; Sample < CFE_FT_TBL_PERF_NUM_SAMPLES; ++Sample)
+        {
+            /* Make each image different from the last one */
+            *SrcPtr = Sample;
+
+            CFE_PSP_GetTime(&StartTime);
+
+            CFE_Assert_STATUS_STORE(CFE_TBL_Load(DstHandle, CFE_TBL_SRC_ADDRESS, SrcPtr));
+            if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+            {
+                break;
+            }
+
+            /* Each batch is a single load, so the batch time is also the time of the operation */
+            CFE_PSP_GetTime(&OpTime);
+            CFE_FT_PerfStatsAdd(0, StartTime, OS_TimeSubtract(OpTime, StartTime));
+        }
+
+        CFE_FT_PerfStatsReport("TBL Load/validate/update", TblSize);
+
+        /* Check that the last image loaded is the active one */
+        UtAssert_INT32_EQ(CFE_TBL_GetAddress(&DstPtr, DstHandle), CFE_TBL_INFO_UPDATED);
+        UtAssert_UINT32_EQ(*(uint32 *)DstPtr, CFE_FT_TBL_PERF_NUM_SAMPLES - 1);
+        UtAssert_INT32_EQ(CFE_TBL_ReleaseAddress(DstHandle), CFE_SUCCESS);
+    }
+
+    UtAssert_INT32_EQ(CFE_TBL_ReleaseAddress(SrcHandle), CFE_TBL_ERR_NEVER_LOADED);
+    UtAssert_INT32_EQ(CFE_TBL_Unregister(DstHandle), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_TBL_Unregister(SrcHandle), CFE_SUCCESS);
+}
+
+void TestLoadCyclePerf(void)
+{
+    uint32 TblSize;
+
+    UtPrintf("Testing: CFE_TBL_Load performance");
+
+    for (TblSize = CFE_FT_TBL_PERF_MIN_LOAD_SIZE; TblSize <= CFE_FT_TBL_PERF_MAX_LOAD_SIZE; TblSize *= 4)
+    {
+        TblPerfLoadCycles(TblSize);
+    }
+}
+
+void TBLPerformanceTestSetup(void)
+{
+    UtTest_Add(TestGetReleaseAddressPerf, RegisterTestTable, UnregisterTestTable,
+               "Test Table GetAddress/ReleaseAddress Performance");
+    UtTest_Add(TestGetReleaseAddressesPerf, RegisterPerfTables, UnregisterPerfTables,
+               "Test Table GetAddresses/ReleaseAddresses Performance");
+    UtTest_Add(TestManageIdlePerf, RegisterPerfTables, UnregisterPerfTables, "Test Table Manage Performance");
+    UtTest_Add(TestLoadCyclePerf, NULL, NULL, "Test Table Load Performance");
+}
@@ -29,6 +29,9 @@
 
 #include "cfe_test.h"
 
+/* Calls of the second callback, registered alongside the first by the same app */
+static int32 TestCallback2Count;
+
 int32 TestCallbackFunction(void)
 {
     CFE_FT_Global.Count += 1;
@@ -37,35 +40,53 @@ int32 TestCallbackFunction(void)
 
 int32 TestCallbackFunction2(void)
 {
-    CFE_FT_Global.Count = 0;
+    TestCallback2Count += 1;
     return CFE_SUCCESS;
 }
 
 void TestCallback(void)
 {
+    CFE_TIME_SynchCallbackId_t    SynchCallbackId;
+    CFE_TIME_SynchCallbackStats_t Stats;
+
     CFE_FT_Global.Count = 1;
+    TestCallback2Count  = 0;
 
-    UtPrintf("Testing: CFE_TIME_RegisterSynchCallback, CFE_TIME_UnregisterSynchCallback");
+    UtPrintf("Testing: CFE_TIME_RegisterSynchCallback, CFE_TIME_RegisterSynchCallbackEx, "
+             "CFE_TIME_UnregisterSynchCallback, CFE_TIME_UnregisterSynchCallbackById, CFE_TIME_GetSynchCallbackStats");
 
     UtAssert_INT32_EQ(CFE_TIME_RegisterSynchCallback(&TestCallbackFunction), CFE_SUCCESS);
-    UtAssert_INT32_EQ(CFE_TIME_RegisterSynchCallback(&TestCallbackFunction2), CFE_TIME_TOO_MANY_SYNCH_CALLBACKS);
+    UtAssert_INT32_EQ(
+        CFE_TIME_RegisterSynchCallbackEx(&SynchCallbackId, &TestCallbackFunction2, 2, CFE_TIME_SYNCH_DEFERRED),
+        CFE_SUCCESS);
 
     OS_TaskDelay(2500);
-    if (CFE_FT_Global.Count < 2)
+    if (CFE_FT_Global.Count < 2 || TestCallback2Count < 1)
     {
         UtAssert_MIR("CFE_TIME_RegisterSynchCallback requires manual inspection to determine if failure is with the "
                      "API or due to an insufficient timing performance of this machine");
     }
 
+    UtAssert_INT32_EQ(CFE_TIME_GetSynchCallbackStats(SynchCallbackId, &Stats), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Stats.RateDivisor, 2);
+    UtAssert_UINT32_EQ(Stats.Options, CFE_TIME_SYNCH_DEFERRED);
+    UtAssert_UINT32_LTEQ(Stats.CallCount, TestCallback2Count);
+
     CFE_FT_Global.Count = 1;
     UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallback(&TestCallbackFunction), CFE_SUCCESS);
     UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallback(&TestCallbackFunction), CFE_TIME_CALLBACK_NOT_REGISTERED);
+    UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallbackById(SynchCallbackId), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallbackById(SynchCallbackId), CFE_TIME_CALLBACK_NOT_REGISTERED);
+    UtAssert_INT32_EQ(CFE_TIME_GetSynchCallbackStats(SynchCallbackId, &Stats), CFE_TIME_CALLBACK_NOT_REGISTERED);
 
     OS_TaskDelay(2500);
     UtAssert_INT32_LTEQ(CFE_FT_Global.Count, 2);
 
     UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallback(NULL), CFE_TIME_BAD_ARGUMENT);
     UtAssert_INT32_EQ(CFE_TIME_RegisterSynchCallback(NULL), CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_RegisterSynchCallbackEx(NULL, &TestCallbackFunction, 1, CFE_TIME_SYNCH_INLINE),
+                      CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_GetSynchCallbackStats(SynchCallbackId, NULL), CFE_TIME_BAD_ARGUMENT);
 }
 
 void TestExternal(void)
@@ -0,0 +1,86 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Functional test of TIME current time API performance
+ *
+ * The intent of this test is to call the current time APIs at a sufficiently
+ * high volume such that their cost can be characterized.  CFE_TIME_GetTime()
+ * maps the local clock onto spacecraft time with a precomputed offset, while
+ * CFE_TIME_GetClockState() still takes a snapshot of the complete time
+ * reference, so timing both gives a comparison of the two read paths.
+ * Both are also timed on several tasks at once, to show how the read paths
+ * scale when the time reference is read concurrently.
+ */
+
+#include "cfe_test.h"
+#include "cfe_test_perf.h"
+
+/* Number of timed batches and calls per batch for each API */
+#define CFE_FT_TIME_PERF_NUM_SAMPLES 1000
+#define CFE_FT_TIME_PERF_BATCH_CALLS 1000
+
+/* Latest time read by each task, so the reads have a visible effect */
+static CFE_TIME_SysTime_t CFE_FT_TimePerfLast[CFE_FT_PERF_MAX_THREADS];
+
+bool TimePerfGetTime(void *Arg, uint32 Thread)
+{
+    CFE_FT_TimePerfLast[Thread] = CFE_TIME_GetTime();
+    return true;
+}
+
+bool TimePerfGetClockState(void *Arg, uint32 Thread)
+{
+    CFE_TIME_GetClockState();
+    return true;
+}
+
+void TestGetTimePerf(void)
+{
+    CFE_TIME_SysTime_t Start;
+    uint32             Threads;
+
+    UtPrintf("Testing: CFE_TIME_GetTime performance");
+
+    Start = CFE_TIME_GetTime();
+
+    for (Threads = 1; Threads <= CFE_FT_PERF_MAX_THREADS; Threads *= 2)
+    {
+        CFE_FT_PerfRun("TIME GetTime", 0, Threads, TimePerfGetTime, NULL, CFE_FT_TIME_PERF_NUM_SAMPLES,
+                       CFE_FT_TIME_PERF_BATCH_CALLS);
+    }
+
+    /* The clock keeps running while the test runs, so time should have advanced */
+    UtAssert_True(CFE_TIME_Compare(CFE_FT_TimePerfLast[0], Start) == CFE_TIME_A_GT_B,
+                  "Time advanced from %lu.%08lx to %lu.%08lx", (unsigned long)Start.Seconds,
+                  (unsigned long)Start.Subseconds, (unsigned long)CFE_FT_TimePerfLast[0].Seconds,
+                  (unsigned long)CFE_FT_TimePerfLast[0].Subseconds);
+
+    for (Threads = 1; Threads <= CFE_FT_PERF_MAX_THREADS; Threads *= 2)
+    {
+        CFE_FT_PerfRun("TIME GetClockState", 0, Threads, TimePerfGetClockState, NULL, CFE_FT_TIME_PERF_NUM_SAMPLES,
+                       CFE_FT_TIME_PERF_BATCH_CALLS);
+    }
+}
+
+void TimePerformanceTestSetup(void)
+{
+    UtTest_Add(TestGetTimePerf, NULL, NULL, "Test Time GetTime Performance");
+}
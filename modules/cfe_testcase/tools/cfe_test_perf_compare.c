@@ -0,0 +1,209 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Host tool to compare cfe_testcase benchmark results between builds
+ *
+ * Reads two results files written by the performance benchmarks of the
+ * cfe_testcase app, a baseline and a current one, and lists the change of
+ * every case that is in both.  A case regresses when its throughput drops,
+ * or its 99th percentile latency rises, by more than the threshold.
+ *
+ * The exit status is 0 when no case regressed, 1 when any case regressed,
+ * and 2 when the files could not be read, so it can gate automated builds.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Default regression threshold, in percent */
+#define PERF_COMPARE_DEFAULT_THRESHOLD 10.0
+
+/* Limits of the results files */
+#define PERF_COMPARE_MAX_CASES    512
+#define PERF_COMPARE_MAX_NAME_LEN 96
+#define PERF_COMPARE_MAX_LINE_LEN 256
+
+typedef struct
+{
+    char          Name[PERF_COMPARE_MAX_NAME_LEN];
+    unsigned long Size;
+    unsigned long Threads;
+    unsigned long Ops;
+    unsigned long OpsPerSec;
+    unsigned long P50Nsec;
+    unsigned long P99Nsec;
+    unsigned long P999Nsec;
+    unsigned long MaxNsec;
+} PerfCase_t;
+
+typedef struct
+{
+    size_t     NumCases;
+    PerfCase_t Cases[PERF_COMPARE_MAX_CASES];
+} PerfResults_t;
+
+static PerfResults_t Baseline;
+static PerfResults_t Current;
+
+/*
+ * Reads a results file, skipping the column names and any line that does not parse
+ *
+ * Returns 0 on success, -1 if the file cannot be opened
+ */
+static int ReadResults(const char *FileName, PerfResults_t *Results)
+{
+    FILE *      File;
+    char        Line[PERF_COMPARE_MAX_LINE_LEN];
+    PerfCase_t *Case;
+    char *      Comma;
+    size_t      NameLen;
+
+    File = fopen(FileName, "r");
+    if (File == NULL)
+    {
+        perror(FileName);
+        return -1;
+    }
+
+    Results->NumCases = 0;
+    while (Results->NumCases < PERF_COMPARE_MAX_CASES && fgets(Line, sizeof(Line), File) != NULL)
+    {
+        Case  = &Results->Cases[Results->NumCases];
+        Comma = strchr(Line, ',');
+        if (Comma == NULL)
+        {
+            continue;
+        }
+
+        NameLen = Comma - Line;
+        if (NameLen >= sizeof(Case->Name))
+        {
+            NameLen = sizeof(Case->Name) - 1;
+        }
+        memcpy(Case->Name, Line, NameLen);
+        Case->Name[NameLen] = 0;
+
+        if (sscanf(Comma + 1, "%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu", &Case->Size, &Case->Threads, &Case->Ops,
+                   &Case->OpsPerSec, &Case->P50Nsec, &Case->P99Nsec, &Case->P999Nsec, &Case->MaxNsec) == 8)
+        {
+            ++Results->NumCases;
+        }
+    }
+
+    fclose(File);
+    return 0;
+}
+
+static const PerfCase_t *FindCase(const PerfResults_t *Results, const PerfCase_t *Match)
+{
+    size_t i;
+
+    for (i = 0; i < Results->NumCases; ++i)
+    {
+        if (Results->Cases[i].Size == Match->Size && Results->Cases[i].Threads == Match->Threads &&
+            strcmp(Results->Cases[i].Name, Match->Name) == 0)
+        {
+            return &Results->Cases[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Change from the baseline value to the current one, in percent of the baseline
+ */
+static double PercentChange(unsigned long Base, unsigned long Curr)
+{
+    if (Base == 0)
+    {
+        return 0.0;
+    }
+
+    return (100.0 * ((double)Curr - (double)Base)) / (double)Base;
+}
+
+int main(int argc, char *argv[])
+{
+    const PerfCase_t *Base;
+    const PerfCase_t *Curr;
+    double            Threshold;
+    double            OpsChange;
+    double            P99Change;
+    size_t            i;
+    unsigned long     NumRegressed;
+    char *            EndPtr;
+
+    if (argc < 3 || argc > 4)
+    {
+        fprintf(stderr, "Usage: %s <baseline results> <current results> [threshold percent]\n", argv[0]);
+        return 2;
+    }
+
+    Threshold = PERF_COMPARE_DEFAULT_THRESHOLD;
+    if (argc == 4)
+    {
+        Threshold = strtod(argv[3], &EndPtr);
+        if (*EndPtr != 0 || Threshold < 0.0)
+        {
+            fprintf(stderr, "%s: invalid threshold %s\n", argv[0], argv[3]);
+            return 2;
+        }
+    }
+
+    if (ReadResults(argv[1], &Baseline) != 0 || ReadResults(argv[2], &Current) != 0)
+    {
+        return 2;
+    }
+
+    NumRegressed = 0;
+    for (i = 0; i < Current.NumCases; ++i)
+    {
+        Curr = &Current.Cases[i];
+        Base = FindCase(&Baseline, Curr);
+
+        printf("%s size=%lu tasks=%lu: ", Curr->Name, Curr->Size, Curr->Threads);
+        if (Base == NULL)
+        {
+            printf("%lu ops/sec p99=%lu nsec, not in baseline\n", Curr->OpsPerSec, Curr->P99Nsec);
+            continue;
+        }
+
+        OpsChange = PercentChange(Base->OpsPerSec, Curr->OpsPerSec);
+        P99Change = PercentChange(Base->P99Nsec, Curr->P99Nsec);
+
+        printf("%lu -> %lu ops/sec (%+.1f%%), p99 %lu -> %lu nsec (%+.1f%%)", Base->OpsPerSec, Curr->OpsPerSec,
+               OpsChange, Base->P99Nsec, Curr->P99Nsec, P99Change);
+
+        if (OpsChange < -Threshold || P99Change > Threshold)
+        {
+            printf(" REGRESSION");
+            ++NumRegressed;
+        }
+        printf("\n");
+    }
+
+    printf("%lu of %lu cases regressed by more than %.1f%%\n", NumRegressed, (unsigned long)Current.NumCases,
+           Threshold);
+
+    return (NumRegressed == 0) ? 0 : 1;
+}
@@ -1280,6 +1280,15 @@ char *CFE_ES_StatusToString(CFE_Status_t status, CFE_StatusString_t *status_stri
  */
 #define CFE_TBL_BAD_ARGUMENT ((CFE_Status_t)0xcc00002d)
 
+/**
+ * @brief Validation Timed Out
+ *
+ *  A validation worker did not finish validating a table before
+ *  the table was released, so the validation was failed.
+ *
+ */
+#define CFE_TBL_ERR_VALIDATION_TIMEOUT ((CFE_Status_t)0xcc00002e)
+
 /**
  * @brief Not Implemented
  *
@@ -1362,6 +1371,26 @@ char *CFE_ES_StatusToString(CFE_Status_t status, CFE_StatusString_t *status_stri
  *
  */
 #define CFE_TIME_BAD_ARGUMENT ((CFE_Status_t)0xce000005)
+
+/**
+ * @brief Too Many Timers
+ *
+ *  An attempt to start a cFE Time Services timer has failed because
+ *  all of the platform's timers are already in use.
+ *
+ */
+#define CFE_TIME_TOO_MANY_TIMERS ((CFE_Status_t)0xce000006)
+
+/**
+ * @brief Timer Not Active
+ *
+ *  An attempt to cancel a cFE Time Services timer has failed because
+ *  the specified identifier does not refer to a running timer.  The
+ *  timer may never have been started, or may already have been
+ *  cancelled or, if it was a one-shot timer, have expired.
+ *
+ */
+#define CFE_TIME_TIMER_NOT_ACTIVE ((CFE_Status_t)0xce000007)
 /**@}*/
 
 #endif /* CFE_ERROR_H */
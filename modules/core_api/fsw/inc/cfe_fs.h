@@ -216,6 +216,36 @@ const char *CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_t FileCategory);
 */
 const char *CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_t FileCategory);
 
+/*****************************************************************************/
+/**
+** \brief Split a file name into its path, name and extension without copying
+**
+** \par Description
+**        Locates the directory, base name and extension parts of a file name
+**        and stores pointers into the input buffer for each, so callers that
+**        only need to inspect or compare parts of a name do not have to copy
+**        it first.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The directory part ends at the last "/" and includes it.  The
+**           extension begins after the first "." of the remaining base name,
+**           any further leading "." characters are part of the separator.
+**        -# Input Buffer has a fixed max length.  Parsing will not exceed InputBufSize,
+**            and does not need to be null terminated.  However parsing will stop
+**            at the first null char, when the input is shorter than the maximum.
+**
+** \param[out] View          The view to fill in @nonnull
+** \param[in]  InputBuffer   The file name to split @nonnull
+** \param[in]  InputBufSize  Maximum Size of input buffer
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_FS_BAD_ARGUMENT    \copybrief CFE_FS_BAD_ARGUMENT
+** \retval #CFE_FS_INVALID_PATH    \copybrief CFE_FS_INVALID_PATH
+** \retval #CFE_SUCCESS            \copybrief CFE_SUCCESS
+**
+******************************************************************************/
+CFE_Status_t CFE_FS_GetPathView(CFE_FS_PathView_t *View, const char *InputBuffer, size_t InputBufSize);
+
 /*****************************************************************************/
 /**
 ** \brief Parse a filename input from an input buffer into a local buffer
@@ -35,6 +35,19 @@
 #include "osconfig.h"
 #include "cfe_fs_extern_typedefs.h"
 
+/**
+ * \brief Flag set in the FS header SubType of a compressed file
+ *
+ * A background file dump requested with CFE_FS_FileWriteMetaData_t::Compress
+ * set has this bit set in the SubType of its header, and the data following
+ * the header is a series of blocks.  Each block starts with its uncompressed
+ * size and its stored size, both as big-endian 16 bit values, followed by the
+ * stored data.  A block whose two sizes are equal is stored as-is, otherwise
+ * the stored data is a single LZ4 compressed block.  Blocks are independent
+ * of each other, so a truncated file can still be expanded up to the damage.
+ */
+#define CFE_FS_SUBTYPE_COMPRESSED 0x80000000
+
 /**
  * \brief Generalized file types/categories known to FS
  *
@@ -56,6 +69,23 @@ typedef enum
     CFE_FS_FileCategory_MAX               /**< Placeholder, keep last */
 } CFE_FS_FileCategory_t;
 
+/**
+ * \brief Zero-copy view of the components of a file name
+ *
+ * Filled in by CFE_FS_GetPathView().  All pointers reference the caller's
+ * input buffer, nothing is copied and the components are not NUL terminated,
+ * so the view is only valid as long as the input buffer is unchanged.
+ */
+typedef struct CFE_FS_PathView
+{
+    const char *Path;         /**< Directory part including its trailing separator, NULL if the input has none */
+    size_t      PathLen;      /**< Length of the directory part */
+    const char *Name;         /**< Base file name, without the extension */
+    size_t      NameLen;      /**< Length of the base file name */
+    const char *Extension;    /**< Extension following the "." separator, NULL if the input has none */
+    size_t      ExtensionLen; /**< Length of the extension */
+} CFE_FS_PathView_t;
+
 /*
  * Because FS is a library not an app, it does not have its own context or
  * event IDs.  The file writer runs in the context of the ES background task
@@ -77,6 +107,18 @@ typedef enum
     CFE_FS_FileWriteEvent_MAX /* placeholder, no-op, keep last */
 } CFE_FS_FileWriteEvent_t;
 
+/**
+ * \brief Priority of a background file write request
+ *
+ * Ground requested files start ahead of automatic ones that are waiting,
+ * and are written at a larger share of the file system time.
+ */
+typedef enum
+{
+    CFE_FS_FileWritePriority_GROUND,    /**< Requested from the ground (default) */
+    CFE_FS_FileWritePriority_AUTOMATIC, /**< Produced automatically, e.g. periodic housekeeping dumps */
+} CFE_FS_FileWritePriority_t;
+
 /**
  * Data Getter routine provided by requester
  *
@@ -129,6 +171,10 @@ typedef struct CFE_FS_FileWriteMetaData
     /* Data for FS header */
     uint32 FileSubType;                          /**< Type of file to write (for FS header) */
     char   Description[CFE_FS_HDR_DESC_MAX_LEN]; /**< Description of file (for FS header) */
+    bool   Compress;                             /**< Compress the data records (see #CFE_FS_SUBTYPE_COMPRESSED) */
+
+    CFE_FS_FileWritePriority_t Priority;       /**< Priority of the request */
+    uint32                     BytesPerSecond; /**< Average write rate of the file, set before the complete event */
 
     CFE_FS_FileWriteGetData_t GetData; /**< Application callback to get a data record */
     CFE_FS_FileWriteOnEvent_t OnEvent; /**< Application callback for abstract event processing */
@@ -751,4 +751,13 @@ CFE_Status_t CFE_MSG_Verify(const CFE_MSG_Message_t *MsgPtr, bool *VerifyStatus)
 
 /**\}*/
 
+/*
+ * With the MISSION_MSG_INLINE_ACCESSORS build option, the inline implementation of the
+ * hot path header accessors redirects some of the APIs above to their inline versions.
+ * This is included last, and only then, as the header is provided by the MSG module in use.
+ */
+#ifdef CFE_MSG_INLINE_ACCESSORS
+#include "cfe_msg_inline.h"
+#endif
+
 #endif /* CFE_MSG_H */
@@ -151,6 +151,30 @@
 **                                                                 quick and it could be blocked.  Therefore, critical
 **                                                                 tables should not be updated by Interrupt Service
 **                                                                 Routines.
+**                                 \arg #CFE_TBL_OPT_VALIDATE_ASYNC- When this option is selected and the platform
+**                                                                 provides validation workers, validation requests
+**                                                                 on the inactive buffer are performed by a Table
+**                                                                 Services worker task rather than by
+**                                                                 #CFE_TBL_Validate.  The validation function must
+**                                                                 then be reentrant and must not depend on the
+**                                                                 context of the owning application.  While a
+**                                                                 worker validates the table, #CFE_TBL_Load
+**                                                                 returns #CFE_TBL_ERR_NO_BUFFER_AVAIL and
+**                                                                 #CFE_TBL_Update returns #CFE_TBL_INFO_TABLE_LOCKED.
+**                                 \arg #CFE_TBL_OPT_RELOAD_IF_CHANGED- When this option is selected, a call to
+**                                                                 #CFE_TBL_Load whose image is identical to the
+**                                                                 active table contents succeeds without calling the
+**                                                                 validation function, updating the table or
+**                                                                 notifying its users.  Tables whose validation
+**                                                                 function has side effects should not select it.
+**                                 \arg #CFE_TBL_OPT_MULTI_BUFFER- When this option is selected, Table Services
+**                                                                 allocates #CFE_PLATFORM_TBL_MULTI_BUFFER_DEPTH
+**                                                                 buffers for the table.  A load never waits for
+**                                                                 readers of the inactive buffer to release it;
+**                                                                 a spare buffer that no reader holds any more is
+**                                                                 used instead.  This option implies the
+**                                                                 #CFE_TBL_OPT_DBL_BUFFER option and shares its
+**                                                                 restrictions.
 **
 ** \param[in] TblValidationFuncPtr is a pointer to a function that will be executed in the context of the Table
 **                                 Management Service when the contents of a table need to be validated.  If set
@@ -410,6 +434,37 @@ CFE_Status_t CFE_TBL_Validate(CFE_TBL_Handle_t TblHandle);
 ******************************************************************************/
 CFE_Status_t CFE_TBL_Manage(CFE_TBL_Handle_t TblHandle);
 
+/*****************************************************************************/
+/**
+** \brief Perform standard operations to maintain all of an application's tables.
+**
+** \par Description
+**        Equivalent to calling #CFE_TBL_Manage on every table owned by the
+**        application, but only tables with a pending request for update,
+**        validation, or dump to buffer are visited.  When no request is pending
+**        for any of the application's tables this API returns immediately
+**        without taking any locks, so it is suitable for calling every cycle.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# AppId must be the ID of the calling application, typically obtained
+**           once at initialization with #CFE_ES_GetAppID.  Tables are managed
+**           through the application's own handles, so the normal access checks
+**           still apply.
+**        -# Tables that are shared with, but not owned by, the application are not managed.
+**
+** \param[in] AppId  Application ID of the calling application
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                     \copybrief CFE_SUCCESS
+** \retval #CFE_TBL_INFO_UPDATED            \copybrief CFE_TBL_INFO_UPDATED
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_TBL_ERR_NO_ACCESS           \copybrief CFE_TBL_ERR_NO_ACCESS
+**
+** \sa #CFE_TBL_Manage, #CFE_TBL_GetStatus
+**
+******************************************************************************/
+CFE_Status_t CFE_TBL_ManageAll(CFE_ES_AppId_t AppId);
+
 /*****************************************************************************/
 /**
 ** \brief Copies the contents of a Dump Only Table to a shared buffer
@@ -487,8 +542,10 @@ CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle);
 **        -# An application must always release the returned table address using the
 **           #CFE_TBL_ReleaseAddress or #CFE_TBL_ReleaseAddresses function prior to
 **           either a #CFE_TBL_Update call or any blocking call (e.g. - pending on software
-**           bus message, etc).  Table updates cannot occur while table addresses have not
-**           been released.
+**           bus message, etc).  Table updates made while an address is held are
+**           published in a separate buffer, and the held address keeps referring to the
+**           previous contents until it is released.  If no memory is available for that
+**           buffer, the update is deferred until table addresses have been released.
 **        -# #CFE_TBL_ERR_NEVER_LOADED will be returned if the table has never been
 **           loaded (either from file or from a block of memory), but the function
 **           will still return a valid table pointer to a table with all zero content.
@@ -530,7 +587,8 @@ CFE_Status_t CFE_TBL_GetAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle);
 **        An application must always release the returned table address using the
 **        #CFE_TBL_ReleaseAddress function prior to either a #CFE_TBL_Update call
 **        or any blocking call (e.g. - pending on software bus message, etc).
-**        Table updates cannot occur while table addresses have not been released.
+**        Table updates made while an address is held are published in a separate
+**        buffer, so the address keeps referring to the previous contents until released.
 **
 ** \param[in] TblHandle  Handle, previously obtained from #CFE_TBL_Register or #CFE_TBL_Share, that
 **                       identifies the Table whose address is to be released.
@@ -567,8 +625,10 @@ CFE_Status_t CFE_TBL_ReleaseAddress(CFE_TBL_Handle_t TblHandle);
 **        -# An application must always release the returned table address using the
 **           #CFE_TBL_ReleaseAddress or #CFE_TBL_ReleaseAddresses function prior to
 **           either a #CFE_TBL_Update call or any blocking call (e.g. - pending on software
-**           bus message, etc).  Table updates cannot occur while table addresses have not
-**           been released.
+**           bus message, etc).  Table updates made while an address is held are
+**           published in a separate buffer, and the held address keeps referring to the
+**           previous contents until it is released.  If no memory is available for that
+**           buffer, the update is deferred until table addresses have been released.
 **        -# #CFE_TBL_ERR_NEVER_LOADED will be returned if the table has never been
 **           loaded (either from file or from a block of memory), but the function
 **           will still return a valid table pointer to a table with all zero content.
@@ -611,7 +671,8 @@ CFE_Status_t CFE_TBL_GetAddresses(void **TblPtrs[], uint16 NumTables, const CFE_
 **        An application must always release the returned table address using the
 **        #CFE_TBL_ReleaseAddress function prior to either a #CFE_TBL_Update call
 **        or any blocking call (e.g. - pending on software bus message, etc).
-**        Table updates cannot occur while table addresses have not been released.
+**        Table updates made while an address is held are published in a separate
+**        buffer, so the address keeps referring to the previous contents until released.
 **
 ** \param[in] NumTables  Size of TblHandles array.
 **
@@ -703,6 +764,42 @@ CFE_Status_t CFE_TBL_GetStatus(CFE_TBL_Handle_t TblHandle);
 ******************************************************************************/
 CFE_Status_t CFE_TBL_GetInfo(CFE_TBL_Info_t *TblInfoPtr, const char *TblName);
 
+/*****************************************************************************/
+/**
+** \brief Obtain the range of a table that has been changed by a pending load
+**
+** \par Description
+**        This API provides the range of bytes in the inactive buffer of a table that
+**        differ from the active table contents because of the load(s) in progress.
+**        It is intended to be called from a table's validation function so that
+**        validation of a small partial load only needs to examine the entries that
+**        were actually changed.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# When several partial loads are made before the table is updated, the
+**           returned range spans all of them and may include bytes that were not
+**           changed.
+**        -# When no load is in progress, the range of the entire table is returned
+**           along with #CFE_TBL_INFO_NO_UPDATE_PENDING.
+**
+** \param[in]  TblHandle    Handle, previously obtained from #CFE_TBL_Register or #CFE_TBL_Share, that
+**                          identifies the Table whose load range is requested.
+** \param[out] OffsetPtr    Pointer to a variable @nonnull that will receive the offset of the first changed byte.
+** \param[out] NumBytesPtr  Pointer to a variable @nonnull that will receive the number of bytes in the range.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                     \copybrief CFE_SUCCESS
+** \retval #CFE_TBL_INFO_NO_UPDATE_PENDING  \copybrief CFE_TBL_INFO_NO_UPDATE_PENDING
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_TBL_ERR_NO_ACCESS           \copybrief CFE_TBL_ERR_NO_ACCESS
+** \retval #CFE_TBL_ERR_INVALID_HANDLE      \copybrief CFE_TBL_ERR_INVALID_HANDLE
+** \retval #CFE_TBL_BAD_ARGUMENT            \copybrief CFE_TBL_BAD_ARGUMENT
+**
+** \sa #CFE_TBL_Register, #CFE_TBL_Validate
+**
+******************************************************************************/
+CFE_Status_t CFE_TBL_GetLoadRange(CFE_TBL_Handle_t TblHandle, size_t *OffsetPtr, size_t *NumBytesPtr);
+
 /*****************************************************************************/
 /**
 ** \brief Instruct cFE Table Services to notify Application via message when table requires management
@@ -62,6 +62,19 @@
 #define CFE_TBL_OPT_NOT_CRITICAL (0x0000) /**< \brief Not critical table */
 #define CFE_TBL_OPT_CRITICAL     (0x0008) /**< \brief Critical table */
 
+#define CFE_TBL_OPT_VALIDATE_MSK   (0x0010) /**< \brief Table validation mode mask */
+#define CFE_TBL_OPT_VALIDATE_SYNC  (0x0000) /**< \brief Validated by owning application */
+#define CFE_TBL_OPT_VALIDATE_ASYNC (0x0010) /**< \brief Inactive buffer may be validated by a worker task */
+
+#define CFE_TBL_OPT_RELOAD_MSK        (0x0020) /**< \brief Table reload mask */
+#define CFE_TBL_OPT_RELOAD_ALWAYS     (0x0000) /**< \brief Every load is validated and activated */
+#define CFE_TBL_OPT_RELOAD_IF_CHANGED (0x0020) /**< \brief Loads identical to the active contents are skipped */
+
+#define CFE_TBL_OPT_MULTI_BUF_MSK (0x0040) /**< \brief Table multi-buffer mask */
+#define CFE_TBL_OPT_NOT_MULTI_BUF (0x0000) /**< \brief No spare buffers */
+#define CFE_TBL_OPT_MULTI_BUFFER \
+    (0x0041) /**< \brief Multi-buffered table, @note Automatically includes #CFE_TBL_OPT_DBL_BUFFER option */
+
 /** @brief Default table options */
 #define CFE_TBL_OPT_DEFAULT (CFE_TBL_OPT_SNGL_BUFFER | CFE_TBL_OPT_LOAD_DUMP)
 /**@}*/
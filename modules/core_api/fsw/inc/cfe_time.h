@@ -37,6 +37,7 @@
 #include "cfe_error.h"
 #include "cfe_time_api_typedefs.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_sb_api_typedefs.h"
 
 /**
 ** \brief Time Copy
@@ -464,6 +465,253 @@ uint32 CFE_TIME_Sub2MicroSecs(uint32 SubSeconds);
 ******************************************************************************/
 uint32 CFE_TIME_Micro2SubSecs(uint32 MicroSeconds);
 
+/*****************************************************************************/
+/**
+** \brief Takes a snapshot of the time reference for batch conversions
+**
+** \par Description
+**        This routine reads the current STCF and leap seconds once, for use with
+**        #CFE_TIME_ConvertMETArray.  An application converting many timestamps at
+**        a time should take a new snapshot once per batch, rather than once per
+**        timestamp as #CFE_TIME_MET2SCTime does.
+**
+** \par Assumptions, External Events, and Notes:
+**          The snapshot does not follow later changes to the STCF or leap seconds.
+**
+** \param[out] Ref   Buffer to hold the time reference snapshot @nonnull
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_BAD_ARGUMENT \copybrief CFE_TIME_BAD_ARGUMENT
+**
+** \sa #CFE_TIME_ConvertMETArray, #CFE_TIME_MET2SCTime
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_GetConversionRef(CFE_TIME_ConversionRef_t *Ref);
+
+/*****************************************************************************/
+/**
+** \brief Converts an array of MET values into TAI, UTC or Spacecraft Time
+**
+** \par Description
+**        This routine converts each MET in METTimes the same way as #CFE_TIME_MET2SCTime,
+**        but against the time reference snapshot in Ref, storing the results in Times.
+**        Target selects #CFE_TIME_CONVERT_TO_SC for Spacecraft Time (UTC or TAI per
+**        the mission default), #CFE_TIME_CONVERT_TO_TAI or #CFE_TIME_CONVERT_TO_UTC.
+**
+** \par Assumptions, External Events, and Notes:
+**          The conversion is a single packed addition per element, which compilers
+**          can vectorize.  METTimes and Times may be the same array, to convert in place.
+**
+** \param[in]  Ref        Time reference snapshot from #CFE_TIME_GetConversionRef @nonnull
+** \param[in]  Target     Time format to convert into
+** \param[in]  METTimes   Array of Count MET values to convert @nonnull
+** \param[out] Times      Array of Count converted values @nonnull
+** \param[in]  Count      Number of values to convert
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_BAD_ARGUMENT \copybrief CFE_TIME_BAD_ARGUMENT
+**
+** \sa #CFE_TIME_GetConversionRef, #CFE_TIME_MET2SCTime
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_ConvertMETArray(const CFE_TIME_ConversionRef_t *Ref, uint32 Target,
+                                      const CFE_TIME_SysTime_t *METTimes, CFE_TIME_SysTime_t *Times, uint32 Count);
+
+/*****************************************************************************/
+/**
+** \brief Converts an array of sub-seconds counts to microseconds
+**
+** \par Description
+**        This routine converts each sub-seconds count in SubSeconds the same way as
+**        #CFE_TIME_Sub2MicroSecs, storing the results in MicroSeconds.
+**
+** \par Assumptions, External Events, and Notes:
+**          SubSeconds and MicroSeconds may be the same array, to convert in place.
+**
+** \param[in]  SubSeconds     Array of Count sub-seconds counts to convert @nonnull
+** \param[out] MicroSeconds   Array of Count equivalent numbers of microseconds @nonnull
+** \param[in]  Count          Number of values to convert
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_BAD_ARGUMENT \copybrief CFE_TIME_BAD_ARGUMENT
+**
+** \sa #CFE_TIME_Sub2MicroSecs
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_Sub2MicroSecsArray(const uint32 *SubSeconds, uint32 *MicroSeconds, uint32 Count);
+
+/**@}*/
+
+/** @defgroup CFEAPITIMEPacked cFE Packed Time APIs
+ * @{
+ */
+
+/*****************************************************************************/
+/**
+** \brief Packs a time value into a #CFE_TIME_Packed_t
+**
+** \par Description
+**        This inline function converts a #CFE_TIME_SysTime_t into the equivalent
+**        32.32 fixed point value, for code that does a lot of time arithmetic.
+**
+** \par Assumptions, External Events, and Notes:
+**          None
+**
+** \param[in] Time   The time value to pack.
+**
+** \return The packed time value.
+**
+** \sa #CFE_TIME_Unpack
+**
+******************************************************************************/
+static inline CFE_TIME_Packed_t CFE_TIME_Pack(CFE_TIME_SysTime_t Time)
+{
+    return ((CFE_TIME_Packed_t)Time.Seconds << 32) | Time.Subseconds;
+}
+
+/*****************************************************************************/
+/**
+** \brief Unpacks a #CFE_TIME_Packed_t into a time value
+**
+** \par Assumptions, External Events, and Notes:
+**          None
+**
+** \param[in] Time   The packed time value to unpack.
+**
+** \return The equivalent #CFE_TIME_SysTime_t.
+**
+** \sa #CFE_TIME_Pack
+**
+******************************************************************************/
+static inline CFE_TIME_SysTime_t CFE_TIME_Unpack(CFE_TIME_Packed_t Time)
+{
+    CFE_TIME_SysTime_t Result;
+
+    Result.Seconds    = (uint32)(Time >> 32);
+    Result.Subseconds = (uint32)Time;
+
+    return Result;
+}
+
+/*****************************************************************************/
+/**
+** \brief Adds two packed time values
+**
+** \par Assumptions, External Events, and Notes:
+**          Same semantics as #CFE_TIME_Add, the result rolls over.
+**
+** \param[in] Time1   The first time to be added.
+**
+** \param[in] Time2   The second time to be added.
+**
+** \return The sum of the two times.
+**
+** \sa #CFE_TIME_Add, #CFE_TIME_PackedSubtract
+**
+******************************************************************************/
+static inline CFE_TIME_Packed_t CFE_TIME_PackedAdd(CFE_TIME_Packed_t Time1, CFE_TIME_Packed_t Time2)
+{
+    return Time1 + Time2;
+}
+
+/*****************************************************************************/
+/**
+** \brief Subtracts two packed time values
+**
+** \par Assumptions, External Events, and Notes:
+**          Same semantics as #CFE_TIME_Subtract, the result rolls over.
+**
+** \param[in] Time1   The base time.
+**
+** \param[in] Time2   The time to be subtracted from the base time.
+**
+** \return The result of subtracting the two times.
+**
+** \sa #CFE_TIME_Subtract, #CFE_TIME_PackedAdd
+**
+******************************************************************************/
+static inline CFE_TIME_Packed_t CFE_TIME_PackedSubtract(CFE_TIME_Packed_t Time1, CFE_TIME_Packed_t Time2)
+{
+    return Time1 - Time2;
+}
+
+/*****************************************************************************/
+/**
+** \brief Compares two packed time values
+**
+** \par Description
+**        Like #CFE_TIME_Compare, this handles roll-over by treating time A as
+**        less than time B when the shortest arc from A to B runs forward,
+**        that is when B - A is less than half the range of the time value.
+**
+** \par Assumptions, External Events, and Notes:
+**          The comparison is branch free.  Unlike #CFE_TIME_Compare, two times
+**          exactly half the range apart always compare as #CFE_TIME_A_LT_B.
+**
+** \param[in] TimeA   The first time to compare.
+**
+** \param[in] TimeB   The second time to compare.
+**
+** \return The result of comparing the two times.
+** \retval #CFE_TIME_EQUAL  \copybrief CFE_TIME_EQUAL
+** \retval #CFE_TIME_A_GT_B \copybrief CFE_TIME_A_GT_B
+** \retval #CFE_TIME_A_LT_B \copybrief CFE_TIME_A_LT_B
+**
+** \sa #CFE_TIME_Compare
+**
+******************************************************************************/
+static inline CFE_TIME_Compare_t CFE_TIME_PackedCompare(CFE_TIME_Packed_t TimeA, CFE_TIME_Packed_t TimeB)
+{
+    CFE_TIME_Packed_t Diff = TimeA - TimeB;
+
+    /* 1 when different, less 2 when the difference is "negative" */
+    return (CFE_TIME_Compare_t)((int32)(Diff != 0) - (int32)((Diff >> 63) << 1));
+}
+
+/*****************************************************************************/
+/**
+** \brief Converts a packed time value to a number of microseconds
+**
+** \par Assumptions, External Events, and Notes:
+**          Subseconds are truncated to whole microseconds, the same as
+**          #CFE_TIME_Sub2MicroSecs does.
+**
+** \param[in] Time   The packed time value to convert.
+**
+** \return The equivalent number of microseconds.
+**
+** \sa #CFE_TIME_PackedFromMicroSecs, #CFE_TIME_Sub2MicroSecs
+**
+******************************************************************************/
+static inline uint64 CFE_TIME_PackedToMicroSecs(CFE_TIME_Packed_t Time)
+{
+    return ((Time >> 32) * 1000000) + (((Time & 0xFFFFFFFF) * 1000000) >> 32);
+}
+
+/*****************************************************************************/
+/**
+** \brief Converts a number of microseconds to a packed time value
+**
+** \par Assumptions, External Events, and Notes:
+**          Subseconds are rounded up, so that converting the result back
+**          with #CFE_TIME_PackedToMicroSecs yields the same number of
+**          microseconds.  Seconds beyond the range of a time value roll over.
+**
+** \param[in] MicroSeconds   The number of microseconds to convert.
+**
+** \return The equivalent packed time value.
+**
+** \sa #CFE_TIME_PackedToMicroSecs, #CFE_TIME_Micro2SubSecs
+**
+******************************************************************************/
+static inline CFE_TIME_Packed_t CFE_TIME_PackedFromMicroSecs(uint64 MicroSeconds)
+{
+    return ((MicroSeconds / 1000000) << 32) + ((((MicroSeconds % 1000000) << 32) + 999999) / 1000000);
+}
+
 /**@}*/
 
 /** @defgroup CFEAPITIMEExternSource cFE External Time Source APIs
@@ -626,10 +874,11 @@ void CFE_TIME_ExternalTime(CFE_TIME_SysTime_t NewTime);
 **        is received.
 **
 ** \par Assumptions, External Events, and Notes:
-**        Only a single callback per application is supported, and this function should only
-**        be called from a single thread within each application (typically the apps main thread).
-**        If an application requires triggering multiple child tasks at 1Hz, it should distribute
-**        the timing signal internally, rather than registering for multiple callbacks.
+**        An application may register several callbacks, up to the platform limit of
+**        #CFE_PLATFORM_TIME_MAX_SYNCH_CALLBACKS shared by all applications.  Registering
+**        with this routine is the same as #CFE_TIME_RegisterSynchCallbackEx with a rate
+**        divisor of 1 and #CFE_TIME_SYNCH_INLINE, without returning the registration
+**        identifier.
 **
 ** \param[in]  CallbackFuncPtr   Function to call at synchronization interval @nonnull
 **
@@ -638,11 +887,52 @@ void CFE_TIME_ExternalTime(CFE_TIME_SysTime_t NewTime);
 ** \retval #CFE_TIME_TOO_MANY_SYNCH_CALLBACKS \copybrief CFE_TIME_TOO_MANY_SYNCH_CALLBACKS
 ** \retval #CFE_TIME_BAD_ARGUMENT             \copybrief CFE_TIME_BAD_ARGUMENT
 **
-** \sa #CFE_TIME_UnregisterSynchCallback
+** \sa #CFE_TIME_UnregisterSynchCallback, #CFE_TIME_RegisterSynchCallbackEx
 **
 ******************************************************************************/
 CFE_Status_t CFE_TIME_RegisterSynchCallback(CFE_TIME_SynchCallbackPtr_t CallbackFuncPtr);
 
+/*****************************************************************************/
+/**
+** \brief Registers a time synchronization callback with a rate divisor and options
+**
+** \par Description
+**        This routine is the same as #CFE_TIME_RegisterSynchCallback, except that the
+**        callback is only called on every RateDivisor'th time synchronization signal,
+**        and Options selects where it is called from.  With #CFE_TIME_SYNCH_INLINE it is
+**        called directly from the tone signal context, as with
+**        #CFE_TIME_RegisterSynchCallback.  With #CFE_TIME_SYNCH_DEFERRED it is called
+**        from the TIME synchronization child task instead, so that it does not delay
+**        tone processing or the inline callbacks of other applications.  The returned
+**        identifier refers to this registration only, so an application may register
+**        several callbacks (or the same one at several rates) and remove or report
+**        each one separately.
+**
+** \par Assumptions, External Events, and Notes:
+**        Deferred callbacks lag the tone by the scheduling latency of the TIME
+**        synchronization child task, and a deferred call that is still pending at its
+**        next release is counted as an overrun rather than queued again, see
+**        #CFE_TIME_GetSynchCallbackStats.  The child task is only started by TIME on the
+**        local 1Hz signal after the first deferred callback is registered, so the calls
+**        released before then are made together once it starts.
+**
+** \param[out] IdPtr             Buffer to hold the registration identifier @nonnull
+** \param[in]  CallbackFuncPtr   Function to call at synchronization interval @nonnull
+** \param[in]  RateDivisor       Number of synchronization signals per call, at least 1
+** \param[in]  Options           #CFE_TIME_SYNCH_INLINE or #CFE_TIME_SYNCH_DEFERRED
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_TOO_MANY_SYNCH_CALLBACKS \copybrief CFE_TIME_TOO_MANY_SYNCH_CALLBACKS
+** \retval #CFE_TIME_BAD_ARGUMENT             \copybrief CFE_TIME_BAD_ARGUMENT
+**
+** \sa #CFE_TIME_UnregisterSynchCallbackById, #CFE_TIME_GetSynchCallbackStats
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_RegisterSynchCallbackEx(CFE_TIME_SynchCallbackId_t *IdPtr,
+                                              CFE_TIME_SynchCallbackPtr_t CallbackFuncPtr, uint32 RateDivisor,
+                                              uint32 Options);
+
 /*****************************************************************************/
 /**
 ** \brief Unregisters a callback function that is called whenever time synchronization occurs
@@ -653,8 +943,9 @@ CFE_Status_t CFE_TIME_RegisterSynchCallback(CFE_TIME_SynchCallbackPtr_t Callback
 **        the 1Hz signal) is received.
 **
 ** \par Assumptions, External Events, and Notes:
-**        Only a single callback per application is supported, and this function should only
-**        be called from a single thread within each application (typically the apps main thread).
+**        Only callbacks registered by the calling application are removed.  If the
+**        application registered the same function more than once, only one of the
+**        registrations is removed, use #CFE_TIME_UnregisterSynchCallbackById to select which.
 **
 ** \param[in]  CallbackFuncPtr   Function to remove from synchronization call list @nonnull
 **
@@ -667,6 +958,266 @@ CFE_Status_t CFE_TIME_RegisterSynchCallback(CFE_TIME_SynchCallbackPtr_t Callback
 **
 ******************************************************************************/
 CFE_Status_t CFE_TIME_UnregisterSynchCallback(CFE_TIME_SynchCallbackPtr_t CallbackFuncPtr);
+
+/*****************************************************************************/
+/**
+** \brief Unregisters a time synchronization callback by its registration identifier
+**
+** \par Description
+**        This routine removes the registration returned by #CFE_TIME_RegisterSynchCallbackEx,
+**        leaving any other callbacks of the application registered.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only registrations made by the calling application may be removed.  A deferred
+**        call that was released before the registration was removed is not made.
+**
+** \param[in]  SynchCallbackId   Registration to remove
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_CALLBACK_NOT_REGISTERED \copybrief CFE_TIME_CALLBACK_NOT_REGISTERED
+**
+** \sa #CFE_TIME_RegisterSynchCallbackEx
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_UnregisterSynchCallbackById(CFE_TIME_SynchCallbackId_t SynchCallbackId);
+
+/*****************************************************************************/
+/**
+** \brief Gets the execution statistics of a synchronization callback registration
+**
+** \par Description
+**        This routine returns the registered rate divisor and options of a time
+**        synchronization callback registration, with its call count, overrun count
+**        and execution time.  The counters are cleared by the TIME reset counters command.
+**
+** \par Assumptions, External Events, and Notes:
+**        The counters are updated by the caller of the callback while they are copied,
+**        so the values returned are not guaranteed to come from the same call.
+**
+** \param[in]  SynchCallbackId   Registration to report, from #CFE_TIME_RegisterSynchCallbackEx
+** \param[out] Stats             Buffer to hold the callback statistics @nonnull
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_CALLBACK_NOT_REGISTERED \copybrief CFE_TIME_CALLBACK_NOT_REGISTERED
+** \retval #CFE_TIME_BAD_ARGUMENT            \copybrief CFE_TIME_BAD_ARGUMENT
+**
+** \sa #CFE_TIME_RegisterSynchCallbackEx
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_GetSynchCallbackStats(CFE_TIME_SynchCallbackId_t     SynchCallbackId,
+                                            CFE_TIME_SynchCallbackStats_t *Stats);
+/**@}*/
+
+/** @defgroup CFEAPITIMEFrame cFE Minor Frame Scheduling APIs
+ * @{
+ */
+
+/*****************************************************************************/
+/**
+** \brief Registers a semaphore to be given at a minor frame rate and phase
+**
+** \par Description
+**        This routine registers the calling application with the TIME minor frame
+**        scheduler.  Each one second major frame, as marked by the tone, is divided into
+**        #CFE_PLATFORM_TIME_MINOR_FRAME_RATE minor frames.  The binary semaphore is given
+**        every (#CFE_PLATFORM_TIME_MINOR_FRAME_RATE / RateHz) minor frames, at the minor
+**        frames whose offset within that period equals Phase.  The application task pends
+**        on the semaphore to run at that rate in step with the tone.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only a single minor frame slot per application is supported.  The semaphore is
+**        created and owned by the application and must stay valid until the slot is
+**        unregistered.  A release made while the semaphore is still full is counted as
+**        an overrun, see #CFE_TIME_GetFrameSlotStats.
+**
+** \param[in]  RateHz   Release rate, which must divide #CFE_PLATFORM_TIME_MINOR_FRAME_RATE
+** \param[in]  Phase    Minor frame within the release period at which to release
+** \param[in]  SemId    Binary semaphore to give at each release
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_TOO_MANY_SYNCH_CALLBACKS \copybrief CFE_TIME_TOO_MANY_SYNCH_CALLBACKS
+** \retval #CFE_TIME_BAD_ARGUMENT             \copybrief CFE_TIME_BAD_ARGUMENT
+** \retval #CFE_TIME_NOT_IMPLEMENTED          \copybrief CFE_TIME_NOT_IMPLEMENTED
+**
+** \sa #CFE_TIME_RegisterFrameMsg, #CFE_TIME_UnregisterFrameSlot, #CFE_TIME_GetFrameSlotStats
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_RegisterFrameSem(uint32 RateHz, uint32 Phase, osal_id_t SemId);
+
+/*****************************************************************************/
+/**
+** \brief Registers a wakeup message to be sent at a minor frame rate and phase
+**
+** \par Description
+**        This routine is the same as #CFE_TIME_RegisterFrameSem, except that each
+**        release sends a command message with no payload and the given message ID on
+**        the software bus.  The application receives the wakeup on its own pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only a single minor frame slot per application is supported.  Messages are
+**        sent from the TIME minor frame child task, so they may lag the release by
+**        that task's scheduling latency.  A release made before the previous wakeup
+**        has been sent is counted as an overrun.
+**
+** \param[in]  RateHz   Release rate, which must divide #CFE_PLATFORM_TIME_MINOR_FRAME_RATE
+** \param[in]  Phase    Minor frame within the release period at which to release
+** \param[in]  MsgId    Message ID of the wakeup message to send at each release
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_TOO_MANY_SYNCH_CALLBACKS \copybrief CFE_TIME_TOO_MANY_SYNCH_CALLBACKS
+** \retval #CFE_TIME_BAD_ARGUMENT             \copybrief CFE_TIME_BAD_ARGUMENT
+** \retval #CFE_TIME_NOT_IMPLEMENTED          \copybrief CFE_TIME_NOT_IMPLEMENTED
+**
+** \sa #CFE_TIME_RegisterFrameSem, #CFE_TIME_UnregisterFrameSlot, #CFE_TIME_GetFrameSlotStats
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_RegisterFrameMsg(uint32 RateHz, uint32 Phase, CFE_SB_MsgId_t MsgId);
+
+/*****************************************************************************/
+/**
+** \brief Unregisters the minor frame slot of the calling application
+**
+** \par Description
+**        This routine stops the releases registered by #CFE_TIME_RegisterFrameSem or
+**        #CFE_TIME_RegisterFrameMsg for the calling application.  Slots are also
+**        released automatically when the application is deleted.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_CALLBACK_NOT_REGISTERED \copybrief CFE_TIME_CALLBACK_NOT_REGISTERED
+**
+** \sa #CFE_TIME_RegisterFrameSem, #CFE_TIME_RegisterFrameMsg
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_UnregisterFrameSlot(void);
+
+/*****************************************************************************/
+/**
+** \brief Gets the release statistics of an application's minor frame slot
+**
+** \par Description
+**        This routine returns the registered rate and phase of the slot owned by the
+**        given application, with its release count, overrun count and release jitter.
+**        The counters are cleared by the TIME reset counters command.
+**
+** \par Assumptions, External Events, and Notes:
+**        The counters are updated by the scheduler while they are copied, so the values
+**        returned are not guaranteed to come from the same minor frame.
+**
+** \param[in]  AppId    Application whose slot to report
+** \param[out] Stats    Buffer to hold the slot statistics @nonnull
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_CALLBACK_NOT_REGISTERED \copybrief CFE_TIME_CALLBACK_NOT_REGISTERED
+** \retval #CFE_TIME_BAD_ARGUMENT            \copybrief CFE_TIME_BAD_ARGUMENT
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_GetFrameSlotStats(CFE_ES_AppId_t AppId, CFE_TIME_FrameSlotStats_t *Stats);
+/**@}*/
+
+/** @defgroup CFEAPITIMETimer cFE Timer APIs
+ * @{
+ */
+
+/*****************************************************************************/
+/**
+** \brief Starts a one-shot or periodic timer that calls a function
+**
+** \par Description
+**        This routine starts a timer that expires at the given deadline, and then every
+**        Interval after that unless Interval is zero.  DeadlineType selects whether the
+**        deadline is a delay from the current MET (#CFE_TIME_TIMER_RELATIVE), an absolute
+**        MET (#CFE_TIME_TIMER_ABS_MET), or an absolute Spacecraft Time (#CFE_TIME_TIMER_ABS_SC).
+**        At each expiry the callback function is called with the timer identifier and Arg.
+**
+** \par Assumptions, External Events, and Notes:
+**        Timers are kept in a timer wheel that is advanced by the TIME minor frame child
+**        task, so they expire at the start of the first minor frame at or after their
+**        deadline, and only while the minor frame scheduler is running.  Deadlines are
+**        kept in MET; an absolute Spacecraft Time is converted with the STCF and leap
+**        seconds at the time the timer is started.  Callbacks are called from the TIME
+**        minor frame child task and must not block.  A periodic timer that falls more
+**        than one interval behind skips the missed expiries.  Timers are cancelled
+**        automatically when the application that started them is deleted.
+**
+** \param[out] TimerIdPtr     Buffer to hold the identifier of the new timer @nonnull
+** \param[in]  DeadlineType   #CFE_TIME_TIMER_RELATIVE, #CFE_TIME_TIMER_ABS_MET or #CFE_TIME_TIMER_ABS_SC
+** \param[in]  Deadline       Time of the first expiry
+** \param[in]  Interval       Time between expiries, or zero for a one-shot timer
+** \param[in]  CallbackPtr    Function to call at each expiry @nonnull
+** \param[in]  Arg            Argument to pass to the callback function
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS              \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_TOO_MANY_TIMERS \copybrief CFE_TIME_TOO_MANY_TIMERS
+** \retval #CFE_TIME_BAD_ARGUMENT    \copybrief CFE_TIME_BAD_ARGUMENT
+** \retval #CFE_TIME_NOT_IMPLEMENTED \copybrief CFE_TIME_NOT_IMPLEMENTED
+**
+** \sa #CFE_TIME_StartTimerMsg, #CFE_TIME_CancelTimer
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_StartTimer(CFE_TIME_TimerId_t *TimerIdPtr, uint32 DeadlineType, CFE_TIME_SysTime_t Deadline,
+                                 CFE_TIME_SysTime_t Interval, CFE_TIME_TimerCallbackPtr_t CallbackPtr, void *Arg);
+
+/*****************************************************************************/
+/**
+** \brief Starts a one-shot or periodic timer that sends a message
+**
+** \par Description
+**        This routine is the same as #CFE_TIME_StartTimer, except that each expiry sends
+**        a command message with no payload and the given message ID on the software bus.
+**
+** \par Assumptions, External Events, and Notes:
+**        Messages are sent from the TIME minor frame child task.
+**
+** \param[out] TimerIdPtr     Buffer to hold the identifier of the new timer @nonnull
+** \param[in]  DeadlineType   #CFE_TIME_TIMER_RELATIVE, #CFE_TIME_TIMER_ABS_MET or #CFE_TIME_TIMER_ABS_SC
+** \param[in]  Deadline       Time of the first expiry
+** \param[in]  Interval       Time between expiries, or zero for a one-shot timer
+** \param[in]  MsgId          Message ID of the message to send at each expiry
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS              \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_TOO_MANY_TIMERS \copybrief CFE_TIME_TOO_MANY_TIMERS
+** \retval #CFE_TIME_BAD_ARGUMENT    \copybrief CFE_TIME_BAD_ARGUMENT
+** \retval #CFE_TIME_NOT_IMPLEMENTED \copybrief CFE_TIME_NOT_IMPLEMENTED
+**
+** \sa #CFE_TIME_StartTimer, #CFE_TIME_CancelTimer
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_StartTimerMsg(CFE_TIME_TimerId_t *TimerIdPtr, uint32 DeadlineType, CFE_TIME_SysTime_t Deadline,
+                                    CFE_TIME_SysTime_t Interval, CFE_SB_MsgId_t MsgId);
+
+/*****************************************************************************/
+/**
+** \brief Cancels a timer
+**
+** \par Description
+**        This routine stops a timer started with #CFE_TIME_StartTimer or
+**        #CFE_TIME_StartTimerMsg, including an expiry that is due but has not been
+**        acted on yet.  A one-shot timer is cancelled automatically once it expires.
+**
+** \par Assumptions, External Events, and Notes:
+**        The callback of the timer may already be running when this routine is called.
+**
+** \param[in]  TimerId   Identifier of the timer to cancel
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS               \copybrief CFE_SUCCESS
+** \retval #CFE_TIME_TIMER_NOT_ACTIVE \copybrief CFE_TIME_TIMER_NOT_ACTIVE
+**
+** \sa #CFE_TIME_StartTimer, #CFE_TIME_StartTimerMsg
+**
+******************************************************************************/
+CFE_Status_t CFE_TIME_CancelTimer(CFE_TIME_TimerId_t TimerId);
 /**@}*/
 
 /** @defgroup CFEAPITIMEMisc cFE Miscellaneous Time APIs
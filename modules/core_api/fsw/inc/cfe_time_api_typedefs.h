@@ -64,6 +64,39 @@ typedef enum CFE_TIME_Compare
     CFE_TIME_A_GT_B = 1   /**< \brief The first specified time is considered to be after the second specified time */
 } CFE_TIME_Compare_t;
 
+/**
+**  \brief Time value packed into a single 64 bit, 32.32 fixed point number
+**
+**  \par Description
+**       The upper 32 bits hold the seconds and the lower 32 bits hold the subseconds
+**       (1/2^32 seconds) of a #CFE_TIME_SysTime_t.  Because the subseconds carry
+**       directly into the seconds, time arithmetic on this representation is plain
+**       (wrapping) integer arithmetic.  See #CFE_TIME_Pack and #CFE_TIME_Unpack.
+*/
+typedef uint64 CFE_TIME_Packed_t;
+
+/** \name Time Conversion Targets */
+/** \{ */
+#define CFE_TIME_CONVERT_TO_SC  0 /**< \brief Spacecraft time, TAI or UTC per the mission default */
+#define CFE_TIME_CONVERT_TO_TAI 1 /**< \brief International Atomic Time */
+#define CFE_TIME_CONVERT_TO_UTC 2 /**< \brief Coordinated Universal Time */
+/** \} */
+
+/**
+**  \brief Time Conversion Reference
+**
+**  \par Description
+**       A snapshot of the time reference values needed to convert MET into other
+**       time formats, as returned by #CFE_TIME_GetConversionRef.  Converting many
+**       times against the same snapshot reads the reference state only once, and
+**       gives consistent results should the STCF or leap seconds change part way.
+*/
+typedef struct CFE_TIME_ConversionRef
+{
+    CFE_TIME_SysTime_t STCF;        /**< \brief Spacecraft Time Correlation Factor */
+    int16              LeapSeconds; /**< \brief Leap seconds, TAI minus UTC */
+} CFE_TIME_ConversionRef_t;
+
 /**
 **   \brief Time Synchronization Callback Function Ptr Type
 **
@@ -74,4 +107,89 @@ typedef enum CFE_TIME_Compare
 */
 typedef int32 (*CFE_TIME_SynchCallbackPtr_t)(void);
 
+/**
+**   \brief Time Synchronization Callback Registration Identifier
+**
+**   \par Description
+**        Identifies a callback registered with #CFE_TIME_RegisterSynchCallbackEx.
+**        Identifiers are not reused immediately, so unregistering a callback that has
+**        already been unregistered fails rather than affecting another registration.
+*/
+typedef uint32 CFE_TIME_SynchCallbackId_t;
+
+/** \brief Identifier that is never a valid registration */
+#define CFE_TIME_SYNCHCALLBACKID_UNDEFINED ((CFE_TIME_SynchCallbackId_t)0)
+
+/** \name Time Synchronization Callback Options */
+/** \{ */
+#define CFE_TIME_SYNCH_INLINE   0x00 /**< \brief Call from the tone signal context (default) */
+#define CFE_TIME_SYNCH_DEFERRED 0x01 /**< \brief Call from the TIME synchronization child task */
+/** \} */
+
+/**
+**   \brief Time Synchronization Callback Statistics
+**
+**   \par Description
+**        Registration and execution statistics for a time synchronization callback, as
+**        returned by #CFE_TIME_GetSynchCallbackStats.  Execution time is measured with the
+**        local clock around each call of the callback function.
+*/
+typedef struct CFE_TIME_SynchCallbackStats
+{
+    uint32 RateDivisor;    /**< \brief Registered rate divisor, in tone signals per call */
+    uint32 Options;        /**< \brief Registered options, see CFE_TIME_SYNCH_INLINE and CFE_TIME_SYNCH_DEFERRED */
+    uint32 CallCount;      /**< \brief Number of calls */
+    uint32 OverrunCount;   /**< \brief Number of deferred calls dropped while the previous one was still pending */
+    uint32 LastExecMicros; /**< \brief Execution time of the most recent call, in microseconds */
+    uint32 MaxExecMicros;  /**< \brief Longest execution time of any call, in microseconds */
+} CFE_TIME_SynchCallbackStats_t;
+
+/**
+**   \brief Minor Frame Slot Statistics
+**
+**   \par Description
+**        Release statistics for an application registered with the TIME minor frame
+**        scheduler, as returned by #CFE_TIME_GetFrameSlotStats.  Jitter is the distance
+**        of a release from the ideal minor frame boundary, measured from the local clock
+**        latched at the tone.
+*/
+typedef struct CFE_TIME_FrameSlotStats
+{
+    uint32 RateHz;           /**< \brief Registered release rate, in Hz */
+    uint32 Phase;            /**< \brief Registered phase within the release period, in minor frames */
+    uint32 ReleaseCount;     /**< \brief Number of releases */
+    uint32 OverrunCount;     /**< \brief Number of releases made while the previous one was still pending */
+    uint32 LastJitterMicros; /**< \brief Jitter of the most recent release, in microseconds */
+    uint32 MaxJitterMicros;  /**< \brief Largest jitter of any release, in microseconds */
+} CFE_TIME_FrameSlotStats_t;
+
+/**
+**   \brief Timer Identifier
+**
+**   \par Description
+**        Identifies a timer started with #CFE_TIME_StartTimer or #CFE_TIME_StartTimerMsg.
+**        Identifiers are not reused immediately, so cancelling a timer that has already
+**        expired or been cancelled fails rather than affecting another timer.
+*/
+typedef uint32 CFE_TIME_TimerId_t;
+
+#define CFE_TIME_TIMERID_UNDEFINED ((CFE_TIME_TimerId_t)0) /**< \brief Identifier that is never a valid timer */
+
+/**
+**   \brief Timer Callback Function Ptr Type
+**
+**   \par Description
+**        Applications that start a timer with #CFE_TIME_StartTimer provide a callback
+**        function with the following prototype, which is called with the timer
+**        identifier and the argument given when the timer was started.
+*/
+typedef void (*CFE_TIME_TimerCallbackPtr_t)(CFE_TIME_TimerId_t TimerId, void *Arg);
+
+/** \name Timer Deadline Types */
+/** \{ */
+#define CFE_TIME_TIMER_RELATIVE 0 /**< \brief Deadline is a delay from the current MET */
+#define CFE_TIME_TIMER_ABS_MET  1 /**< \brief Deadline is an absolute MET */
+#define CFE_TIME_TIMER_ABS_SC   2 /**< \brief Deadline is an absolute Spacecraft Time (TAI or UTC per the mission default) */
+/** \} */
+
 #endif /* CFE_TIME_API_TYPEDEFS_H */
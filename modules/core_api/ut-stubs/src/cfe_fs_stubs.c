@@ -116,6 +116,24 @@ const char *CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_t FileCategory)
     return UT_GenStub_GetReturnValue(CFE_FS_GetDefaultMountPoint, const char *);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_FS_GetPathView()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_FS_GetPathView(CFE_FS_PathView_t *View, const char *InputBuffer, size_t InputBufSize)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_FS_GetPathView, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_FS_GetPathView, CFE_FS_PathView_t *, View);
+    UT_GenStub_AddParam(CFE_FS_GetPathView, const char *, InputBuffer);
+    UT_GenStub_AddParam(CFE_FS_GetPathView, size_t, InputBufSize);
+
+    UT_GenStub_Execute(CFE_FS_GetPathView, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_FS_GetPathView, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_FS_InitHeader()
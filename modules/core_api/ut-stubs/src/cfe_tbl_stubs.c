@@ -95,6 +95,24 @@ CFE_Status_t CFE_TBL_GetInfo(CFE_TBL_Info_t *TblInfoPtr, const char *TblName)
     return UT_GenStub_GetReturnValue(CFE_TBL_GetInfo, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TBL_GetLoadRange()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TBL_GetLoadRange(CFE_TBL_Handle_t TblHandle, size_t *OffsetPtr, size_t *NumBytesPtr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TBL_GetLoadRange, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TBL_GetLoadRange, CFE_TBL_Handle_t, TblHandle);
+    UT_GenStub_AddParam(CFE_TBL_GetLoadRange, size_t *, OffsetPtr);
+    UT_GenStub_AddParam(CFE_TBL_GetLoadRange, size_t *, NumBytesPtr);
+
+    UT_GenStub_Execute(CFE_TBL_GetLoadRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TBL_GetLoadRange, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TBL_GetStatus()
@@ -145,6 +163,22 @@ CFE_Status_t CFE_TBL_Manage(CFE_TBL_Handle_t TblHandle)
     return UT_GenStub_GetReturnValue(CFE_TBL_Manage, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TBL_ManageAll()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TBL_ManageAll(CFE_ES_AppId_t AppId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TBL_ManageAll, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TBL_ManageAll, CFE_ES_AppId_t, AppId);
+
+    UT_GenStub_Execute(CFE_TBL_ManageAll, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TBL_ManageAll, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TBL_Modified()
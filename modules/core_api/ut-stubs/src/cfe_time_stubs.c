@@ -52,6 +52,22 @@ CFE_TIME_SysTime_t CFE_TIME_Add(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Tim
     return UT_GenStub_GetReturnValue(CFE_TIME_Add, CFE_TIME_SysTime_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_CancelTimer()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_CancelTimer(CFE_TIME_TimerId_t TimerId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_CancelTimer, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TIME_CancelTimer, CFE_TIME_TimerId_t, TimerId);
+
+    UT_GenStub_Execute(CFE_TIME_CancelTimer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_CancelTimer, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TIME_Compare()
@@ -69,6 +85,27 @@ CFE_TIME_Compare_t CFE_TIME_Compare(CFE_TIME_SysTime_t TimeA, CFE_TIME_SysTime_t
     return UT_GenStub_GetReturnValue(CFE_TIME_Compare, CFE_TIME_Compare_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_ConvertMETArray()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_ConvertMETArray(const CFE_TIME_ConversionRef_t *Ref, uint32 Target,
+                                      const CFE_TIME_SysTime_t *METTimes, CFE_TIME_SysTime_t *Times, uint32 Count)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_ConvertMETArray, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TIME_ConvertMETArray, const CFE_TIME_ConversionRef_t *, Ref);
+    UT_GenStub_AddParam(CFE_TIME_ConvertMETArray, uint32, Target);
+    UT_GenStub_AddParam(CFE_TIME_ConvertMETArray, const CFE_TIME_SysTime_t *, METTimes);
+    UT_GenStub_AddParam(CFE_TIME_ConvertMETArray, CFE_TIME_SysTime_t *, Times);
+    UT_GenStub_AddParam(CFE_TIME_ConvertMETArray, uint32, Count);
+
+    UT_GenStub_Execute(CFE_TIME_ConvertMETArray, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_ConvertMETArray, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TIME_ExternalGPS()
@@ -145,6 +182,39 @@ CFE_TIME_ClockState_Enum_t CFE_TIME_GetClockState(void)
     return UT_GenStub_GetReturnValue(CFE_TIME_GetClockState, CFE_TIME_ClockState_Enum_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_GetConversionRef()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_GetConversionRef(CFE_TIME_ConversionRef_t *Ref)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_GetConversionRef, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TIME_GetConversionRef, CFE_TIME_ConversionRef_t *, Ref);
+
+    UT_GenStub_Execute(CFE_TIME_GetConversionRef, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_GetConversionRef, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_GetFrameSlotStats()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_GetFrameSlotStats(CFE_ES_AppId_t AppId, CFE_TIME_FrameSlotStats_t *Stats)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_GetFrameSlotStats, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TIME_GetFrameSlotStats, CFE_ES_AppId_t, AppId);
+    UT_GenStub_AddParam(CFE_TIME_GetFrameSlotStats, CFE_TIME_FrameSlotStats_t *, Stats);
+
+    UT_GenStub_Execute(CFE_TIME_GetFrameSlotStats, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_GetFrameSlotStats, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TIME_GetLeapSeconds()
@@ -215,6 +285,24 @@ CFE_TIME_SysTime_t CFE_TIME_GetSTCF(void)
     return UT_GenStub_GetReturnValue(CFE_TIME_GetSTCF, CFE_TIME_SysTime_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_GetSynchCallbackStats()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_GetSynchCallbackStats(CFE_TIME_SynchCallbackId_t     SynchCallbackId,
+                                            CFE_TIME_SynchCallbackStats_t *Stats)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_GetSynchCallbackStats, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TIME_GetSynchCallbackStats, CFE_TIME_SynchCallbackId_t, SynchCallbackId);
+    UT_GenStub_AddParam(CFE_TIME_GetSynchCallbackStats, CFE_TIME_SynchCallbackStats_t *, Stats);
+
+    UT_GenStub_Execute(CFE_TIME_GetSynchCallbackStats, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_GetSynchCallbackStats, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TIME_GetTAI()
@@ -313,6 +401,42 @@ void CFE_TIME_Print(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
     UT_GenStub_Execute(CFE_TIME_Print, Basic, UT_DefaultHandler_CFE_TIME_Print);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_RegisterFrameMsg()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_RegisterFrameMsg(uint32 RateHz, uint32 Phase, CFE_SB_MsgId_t MsgId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_RegisterFrameMsg, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TIME_RegisterFrameMsg, uint32, RateHz);
+    UT_GenStub_AddParam(CFE_TIME_RegisterFrameMsg, uint32, Phase);
+    UT_GenStub_AddParam(CFE_TIME_RegisterFrameMsg, CFE_SB_MsgId_t, MsgId);
+
+    UT_GenStub_Execute(CFE_TIME_RegisterFrameMsg, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_RegisterFrameMsg, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_RegisterFrameSem()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_RegisterFrameSem(uint32 RateHz, uint32 Phase, osal_id_t SemId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_RegisterFrameSem, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TIME_RegisterFrameSem, uint32, RateHz);
+    UT_GenStub_AddParam(CFE_TIME_RegisterFrameSem, uint32, Phase);
+    UT_GenStub_AddParam(CFE_TIME_RegisterFrameSem, osal_id_t, SemId);
+
+    UT_GenStub_Execute(CFE_TIME_RegisterFrameSem, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_RegisterFrameSem, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TIME_RegisterSynchCallback()
@@ -329,6 +453,70 @@ CFE_Status_t CFE_TIME_RegisterSynchCallback(CFE_TIME_SynchCallbackPtr_t Callback
     return UT_GenStub_GetReturnValue(CFE_TIME_RegisterSynchCallback, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_RegisterSynchCallbackEx()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_RegisterSynchCallbackEx(CFE_TIME_SynchCallbackId_t *IdPtr,
+                                              CFE_TIME_SynchCallbackPtr_t CallbackFuncPtr, uint32 RateDivisor,
+                                              uint32 Options)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_RegisterSynchCallbackEx, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TIME_RegisterSynchCallbackEx, CFE_TIME_SynchCallbackId_t *, IdPtr);
+    UT_GenStub_AddParam(CFE_TIME_RegisterSynchCallbackEx, CFE_TIME_SynchCallbackPtr_t, CallbackFuncPtr);
+    UT_GenStub_AddParam(CFE_TIME_RegisterSynchCallbackEx, uint32, RateDivisor);
+    UT_GenStub_AddParam(CFE_TIME_RegisterSynchCallbackEx, uint32, Options);
+
+    UT_GenStub_Execute(CFE_TIME_RegisterSynchCallbackEx, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_RegisterSynchCallbackEx, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_StartTimer()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_StartTimer(CFE_TIME_TimerId_t *TimerIdPtr, uint32 DeadlineType, CFE_TIME_SysTime_t Deadline,
+                                 CFE_TIME_SysTime_t Interval, CFE_TIME_TimerCallbackPtr_t CallbackPtr, void *Arg)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_StartTimer, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TIME_StartTimer, CFE_TIME_TimerId_t *, TimerIdPtr);
+    UT_GenStub_AddParam(CFE_TIME_StartTimer, uint32, DeadlineType);
+    UT_GenStub_AddParam(CFE_TIME_StartTimer, CFE_TIME_SysTime_t, Deadline);
+    UT_GenStub_AddParam(CFE_TIME_StartTimer, CFE_TIME_SysTime_t, Interval);
+    UT_GenStub_AddParam(CFE_TIME_StartTimer, CFE_TIME_TimerCallbackPtr_t, CallbackPtr);
+    UT_GenStub_AddParam(CFE_TIME_StartTimer, void *, Arg);
+
+    UT_GenStub_Execute(CFE_TIME_StartTimer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_StartTimer, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_StartTimerMsg()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_StartTimerMsg(CFE_TIME_TimerId_t *TimerIdPtr, uint32 DeadlineType, CFE_TIME_SysTime_t Deadline,
+                                    CFE_TIME_SysTime_t Interval, CFE_SB_MsgId_t MsgId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_StartTimerMsg, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TIME_StartTimerMsg, CFE_TIME_TimerId_t *, TimerIdPtr);
+    UT_GenStub_AddParam(CFE_TIME_StartTimerMsg, uint32, DeadlineType);
+    UT_GenStub_AddParam(CFE_TIME_StartTimerMsg, CFE_TIME_SysTime_t, Deadline);
+    UT_GenStub_AddParam(CFE_TIME_StartTimerMsg, CFE_TIME_SysTime_t, Interval);
+    UT_GenStub_AddParam(CFE_TIME_StartTimerMsg, CFE_SB_MsgId_t, MsgId);
+
+    UT_GenStub_Execute(CFE_TIME_StartTimerMsg, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_StartTimerMsg, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TIME_Sub2MicroSecs()
@@ -345,6 +533,24 @@ uint32 CFE_TIME_Sub2MicroSecs(uint32 SubSeconds)
     return UT_GenStub_GetReturnValue(CFE_TIME_Sub2MicroSecs, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_Sub2MicroSecsArray()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_Sub2MicroSecsArray(const uint32 *SubSeconds, uint32 *MicroSeconds, uint32 Count)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_Sub2MicroSecsArray, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TIME_Sub2MicroSecsArray, const uint32 *, SubSeconds);
+    UT_GenStub_AddParam(CFE_TIME_Sub2MicroSecsArray, uint32 *, MicroSeconds);
+    UT_GenStub_AddParam(CFE_TIME_Sub2MicroSecsArray, uint32, Count);
+
+    UT_GenStub_Execute(CFE_TIME_Sub2MicroSecsArray, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_Sub2MicroSecsArray, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TIME_Subtract()
@@ -362,6 +568,20 @@ CFE_TIME_SysTime_t CFE_TIME_Subtract(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_
     return UT_GenStub_GetReturnValue(CFE_TIME_Subtract, CFE_TIME_SysTime_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_UnregisterFrameSlot()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_UnregisterFrameSlot(void)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_UnregisterFrameSlot, CFE_Status_t);
+
+    UT_GenStub_Execute(CFE_TIME_UnregisterFrameSlot, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_UnregisterFrameSlot, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TIME_UnregisterSynchCallback()
@@ -377,3 +597,19 @@ CFE_Status_t CFE_TIME_UnregisterSynchCallback(CFE_TIME_SynchCallbackPtr_t Callba
 
     return UT_GenStub_GetReturnValue(CFE_TIME_UnregisterSynchCallback, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TIME_UnregisterSynchCallbackById()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TIME_UnregisterSynchCallbackById(CFE_TIME_SynchCallbackId_t SynchCallbackId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TIME_UnregisterSynchCallbackById, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TIME_UnregisterSynchCallbackById, CFE_TIME_SynchCallbackId_t, SynchCallbackId);
+
+    UT_GenStub_Execute(CFE_TIME_UnregisterSynchCallbackById, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TIME_UnregisterSynchCallbackById, CFE_Status_t);
+}
@@ -0,0 +1,93 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Static tracepoints within the CFE core services
+ *
+ * Core code marks events of interest with CFE_TRACE_POINT(Event, Arg1, Arg2),
+ * where Event is one of the names below without the CFE_TRACE_ID_ prefix.
+ * What this compiles to is selected at build time by MISSION_TRACE_BACKEND,
+ * through the generated cfe_core_trace_backend.h header.  With the default
+ * backend the tracepoints compile to nothing, and their arguments are not
+ * evaluated, so arguments should not have side effects.
+ */
+
+#ifndef CFE_CORE_TRACE_H
+#define CFE_CORE_TRACE_H
+
+#include "common_types.h"
+
+/**
+ * \brief Identifiers of the core tracepoints
+ *
+ * These are the record identifiers in the ES trace buffer.  The two
+ * arguments recorded with each are listed with the identifier.
+ */
+enum CFE_TRACE_Id
+{
+    CFE_TRACE_ID_UNDEFINED = 0,
+
+    CFE_TRACE_ID_SB_TRANSMIT,       /**< Message broadcast: MsgId, size */
+    CFE_TRACE_ID_SB_ENQUEUE,        /**< Message put on a pipe: MsgId, PipeId */
+    CFE_TRACE_ID_SB_DROP_MSG_LIMIT, /**< Message dropped, pipe message limit reached: MsgId, PipeId */
+    CFE_TRACE_ID_SB_DROP_PIPE_FULL, /**< Message dropped, pipe queue full or failed: MsgId, PipeId */
+    CFE_TRACE_ID_SB_RECEIVE,        /**< Message taken from a pipe: MsgId, PipeId */
+
+    CFE_TRACE_ID_ES_POOL_GET, /**< Memory pool block allocated: PoolId, size */
+    CFE_TRACE_ID_ES_POOL_PUT, /**< Memory pool block freed: PoolId, size */
+
+    CFE_TRACE_ID_TBL_LOAD,   /**< Table load into the inactive buffer: TblHandle, status */
+    CFE_TRACE_ID_TBL_UPDATE, /**< Table update of the active buffer: TblHandle, status */
+    CFE_TRACE_ID_TBL_LOCK,   /**< Table address obtained by an app: TblHandle, status */
+
+    CFE_TRACE_ID_EVS_SEND,    /**< Event message generated: AppId, EventID */
+    CFE_TRACE_ID_EVS_FILTER,  /**< Event message filtered out: AppId, EventID */
+    CFE_TRACE_ID_EVS_SQUELCH, /**< Event message squelched: AppId, squelched count */
+
+    CFE_TRACE_ID_TIME_TONE_ACCEPT, /**< Tone and data matched: elapsed seconds, subseconds between them */
+    CFE_TRACE_ID_TIME_TONE_REJECT, /**< Tone and data not matched: elapsed seconds, subseconds (0 if repeated) */
+
+    CFE_TRACE_ID_MAX /**< Placeholder, keep last */
+};
+
+/**
+ * \brief Core tracepoint identifier, see enum CFE_TRACE_Id
+ */
+typedef uint16 CFE_TRACE_Id_t;
+
+/**
+ * \brief Record in the ES trace buffer and in trace files
+ *
+ * The time stamp is the raw PSP time base, the same as in the performance log.
+ */
+typedef struct CFE_ES_TraceEntry
+{
+    uint32         Sequence;     /**< Count of records made before this one */
+    uint32         TimerUpper32; /**< Upper 32 bits of the time base */
+    uint32         TimerLower32; /**< Lower 32 bits of the time base */
+    CFE_TRACE_Id_t TraceId;      /**< Tracepoint identifier */
+    uint16         Spare;
+    uint32         Arg1; /**< First tracepoint argument */
+    uint32         Arg2; /**< Second tracepoint argument */
+} CFE_ES_TraceEntry_t;
+
+#include "cfe_core_trace_backend.h"
+
+#endif /* CFE_CORE_TRACE_H */
@@ -135,6 +135,27 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
 ******************************************************************************/
 int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices);
 
+/*****************************************************************************/
+/**
+** \brief Records a core tracepoint in the ES trace buffer
+**
+** \par Description
+**        Stores a time stamped record in the ES trace buffer, overwriting
+**        the oldest record when the buffer is full.  This is what the
+**        CFE_TRACE_POINT() macro calls when the RING trace backend is
+**        selected, it should not be called directly.
+**
+** \par Assumptions, External Events, and Notes:
+**        Records made before ES has created the trace buffer mutex are
+**        discarded.
+**
+** \param[in]  TraceId - Tracepoint identifier, see enum CFE_TRACE_Id
+** \param[in]  Arg1    - First tracepoint argument
+** \param[in]  Arg2    - Second tracepoint argument
+**
+******************************************************************************/
+void CFE_ES_TraceRecord(uint16 TraceId, uint32 Arg1, uint32 Arg2);
+
 /**@}*/
 
 #endif /* CFE_ES_CORE_INTERNAL_H */
@@ -86,3 +86,17 @@ void CFE_ES_TaskMain(void)
 {
     UT_GenStub_Execute(CFE_ES_TaskMain, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_TraceRecord()
+ * ----------------------------------------------------
+ */
+void CFE_ES_TraceRecord(uint16 TraceId, uint32 Arg1, uint32 Arg2)
+{
+    UT_GenStub_AddParam(CFE_ES_TraceRecord, uint16, TraceId);
+    UT_GenStub_AddParam(CFE_ES_TraceRecord, uint32, Arg1);
+    UT_GenStub_AddParam(CFE_ES_TraceRecord, uint32, Arg2);
+
+    UT_GenStub_Execute(CFE_ES_TraceRecord, Basic, NULL);
+}
@@ -1031,6 +1031,54 @@
 */
 #define CFE_ES_QUERY_ALL_TASKS_CC 24
 
+/** \cfeescmd Writes the Core Trace Buffer to a File
+**
+**  \par Description
+**       This command causes the records in the core trace buffer to be written
+**       to the specified file, oldest first.  The trace buffer and this command
+**       only exist when the mission is built with the RING tracepoint backend,
+**       otherwise the command is rejected as an invalid command code.  Records
+**       made while the file is being written are not included, and records
+**       overwritten meanwhile are skipped.
+**
+**  \cfecmdmnemonic \ES_WRITETRACE2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WriteTraceCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_TRACE_EID debug event message will be
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_TRACE_FILE configuration parameter) will be
+**         updated with the latest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The mission is not built with the RING tracepoint backend
+**       - A previous request to write the trace buffer has not yet completed
+**       - The specified FileName cannot be parsed
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system (or overwrite an existing one) and could,
+**       if performed repeatedly without sufficient file management by the
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_WRITE_ER_LOG_CC, #CFE_ES_STOP_PERF_DATA_CC
+*/
+#define CFE_ES_WRITE_TRACE_CC 25
+
 /** \} */
 
 #endif
@@ -436,6 +436,36 @@
 */
 #define CFE_PLATFORM_ES_DEFAULT_ER_LOG_FILE "/ram/cfe_erlog.log"
 
+/**
+**  \cfeescfg Compress the Files Written by ES in the Background
+**
+**  \par Description:
+**       When true, the Exception and Reset (ER) Log and trace files that ES
+**       writes through the FS background file writer are compressed, and the
+**       #CFE_FS_SUBTYPE_COMPRESSED bit is set in the SubType of their file
+**       headers.  Ground tools that read these files need to expand them first,
+**       for example with the cfe_fs_decompress host tool.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_ES_COMPRESS_FILE_DUMPS false
+
+/**
+**  \cfeescfg Write the Exception and Reset (ER) Log to a File After a Processor Reset
+**
+**  \par Description:
+**       When true, ES writes the ER log to #CFE_PLATFORM_ES_DEFAULT_ER_LOG_FILE
+**       after each processor reset, as if commanded with an empty file name.
+**       The file is written by the FS background file writer as an automatic
+**       request, so it yields to file writes commanded by the ground, and uses
+**       the smaller I/O share set by #CFE_PLATFORM_FS_BACKGROUND_AUTO_IO_SHARE_PERCENT.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_ES_WRITE_ER_LOG_ON_PROCESSOR_RESET false
+
 /**
 **  \cfeescfg Default Performance Data Filename
 **
@@ -450,6 +480,20 @@
 */
 #define CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME "/ram/cfe_es_perf.dat"
 
+/**
+**  \cfeescfg Default Trace Buffer Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       contents of the core trace buffer. This filename is used only when no
+**       filename is specified in the command to write the trace buffer.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_TRACE_FILE "/ram/cfe_es_trace.dat"
+
 /**
 **  \cfeescfg Default Critical Data Store Registry Filename
 **
@@ -516,6 +560,21 @@
 */
 #define CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE 10000
 
+/**
+**  \cfeescfg Define Core Trace Buffer Size
+**
+**  \par Description:
+**       Defines the number of records in the core trace buffer.  The buffer only
+**       exists when the mission is built with the RING tracepoint backend
+**       (MISSION_TRACE_BACKEND), where the oldest records are overwritten once
+**       the buffer is full.  Each record is 24 bytes.
+**
+**  \par Limits
+**       Must be greater than zero.  There are no restrictions on the upper limit
+**       however, the maximum buffer size is system dependent and should be verified.
+*/
+#define CFE_PLATFORM_ES_TRACE_BUFFER_SIZE 1024
+
 /**
 **  \cfeescfg Define Filter Mask Setting for Disabling All Performance Entries
 **
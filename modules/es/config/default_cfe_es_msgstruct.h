@@ -127,6 +127,12 @@ typedef struct CFE_ES_WriteERLogCmd
     CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_ES_WriteERLogCmd_t;
 
+typedef struct CFE_ES_WriteTraceCmd
+{
+    CFE_MSG_CommandHeader_t      CommandHeader; /**< \brief Command header */
+    CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_ES_WriteTraceCmd_t;
+
 /**
  * \brief Overwrite/Discard System Log Configuration Command Payload
  */
@@ -1057,6 +1057,41 @@
  *  a write already being in progress.
  */
 #define CFE_ES_ERLOG_PENDING_ERR_EID 93
+
+/**
+ * \brief ES Write Core Trace Buffer Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_TRACE_CC ES Write Core Trace Buffer Command \endlink success.
+ */
+#define CFE_ES_TRACE_EID 94
+
+/**
+ * \brief ES Write Core Trace Buffer Command Request Or File Creation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_TRACE_CC ES Write Core Trace Buffer Command \endlink request failed or
+ *  file creation failed.
+ */
+#define CFE_ES_TRACE_ERR_EID 95
+
+/**
+ * \brief ES Write Core Trace Buffer Command Already In Progress Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_TRACE_CC ES Write Core Trace Buffer Command \endlink failure due to
+ *  a write already being in progress.
+ */
+#define CFE_ES_TRACE_PENDING_ERR_EID 96
 /**\}*/
 
 #endif /* CFE_ES_EVENTS_H */
@@ -203,6 +203,15 @@ void CFE_ES_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
                     }
                     break;
 
+#ifdef CFE_TRACE_BACKEND_RING
+                case CFE_ES_WRITE_TRACE_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteTraceCmd_t)))
+                    {
+                        CFE_ES_WriteTraceCmd((const CFE_ES_WriteTraceCmd_t *)SBBufPtr);
+                    }
+                    break;
+#endif
+
                 case CFE_ES_START_PERF_DATA_CC:
                     if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_StartPerfDataCmd_t)))
                     {
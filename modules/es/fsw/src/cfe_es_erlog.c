@@ -239,8 +239,9 @@ void CFE_ES_BackgroundERLogFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t
     switch (Event)
     {
         case CFE_FS_FileWriteEvent_COMPLETE:
-            CFE_EVS_SendEvent(CFE_ES_ERLOG2_EID, CFE_EVS_EventType_DEBUG, "%s written:Size=%lu",
-                              BgFilePtr->FileWrite.FileName, (unsigned long)Position);
+            CFE_EVS_SendEvent(CFE_ES_ERLOG2_EID, CFE_EVS_EventType_DEBUG, "%s written:Size=%lu,Rate=%lu B/s",
+                              BgFilePtr->FileWrite.FileName, (unsigned long)Position,
+                              (unsigned long)BgFilePtr->FileWrite.BytesPerSecond);
             break;
 
         case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
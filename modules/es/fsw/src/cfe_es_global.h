@@ -41,6 +41,7 @@
 #include "cfe_es_erlog_typedef.h"
 #include "cfe_es_resetdata_typedef.h"
 #include "cfe_es_cds.h"
+#include "cfe_es_trace.h"
 
 #include <signal.h> /* for sig_atomic_t */
 
@@ -145,6 +146,13 @@ typedef struct
     */
     osal_id_t PerfDataMutex;
 
+#ifdef CFE_TRACE_BACKEND_RING
+    /*
+    ** Core Trace Buffer Mutex
+    */
+    osal_id_t TraceMutex;
+#endif
+
     /*
     ** Startup Sync
     */
@@ -205,6 +213,14 @@ typedef struct
      */
     CFE_ES_PerfDumpGlobal_t BackgroundPerfDumpState;
 
+#ifdef CFE_TRACE_BACKEND_RING
+    /*
+     * Core trace buffer, and the state of writing it to a file
+     */
+    CFE_ES_TraceBuffer_t               TraceBuffer;
+    CFE_ES_BackgroundTraceDumpGlobal_t BackgroundTraceDumpState;
+#endif
+
     /*
      * Persistent state data associated with background app table scans
      */
@@ -459,6 +459,8 @@ int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle,
     /* Compute the actual buffer address. */
     *BufPtr = CFE_ES_MEMPOOLBUF_C(PoolRecPtr->BaseAddr + DataOffset);
 
+    CFE_TRACE_POINT(ES_POOL_GET, CFE_RESOURCEID_TO_ULONG(Handle), Size);
+
     return (int32)Size;
 }
 
@@ -587,6 +589,8 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
     if (Status == CFE_SUCCESS)
     {
         Status = (int32)DataSize;
+
+        CFE_TRACE_POINT(ES_POOL_PUT, CFE_RESOURCEID_TO_ULONG(Handle), DataSize);
     }
     else if (Status == CFE_ES_POOL_BLOCK_INVALID)
     {
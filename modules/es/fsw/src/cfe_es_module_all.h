@@ -39,10 +39,12 @@
 #include "cfe_perfids.h"
 
 #include "cfe_es_core_internal.h"
+#include "cfe_core_trace.h"
 #include "cfe_es_apps.h"
 #include "cfe_es_cds.h"
 #include "cfe_es_crc.h"
 #include "cfe_es_perf.h"
+#include "cfe_es_trace.h"
 #include "cfe_es_generic_pool.h"
 #include "cfe_es_mempool.h"
 #include "cfe_es_global.h"
@@ -151,6 +151,34 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
         return;
     }
 
+#ifdef CFE_TRACE_BACKEND_RING
+    /*
+    ** Also Create the Core Trace Buffer Mutex
+    ** This protects the trace buffer, which tracepoints in any task may write to
+    */
+    OsStatus = OS_MutSemCreate(&CFE_ES_Global.TraceMutex, "ES_TRACE_MUTEX", 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_SysLogWrite_Unsync("%s: Error: ES Trace Buffer Mutex could not be created. RC=%ld\n", __func__,
+                                  (long)OsStatus);
+
+        /*
+        ** Delay to allow the message to be read
+        */
+        OS_TaskDelay(CFE_ES_PANIC_DELAY);
+
+        /*
+        ** cFE Cannot continue to start up.
+        */
+        CFE_PSP_Panic(CFE_PSP_PANIC_STARTUP_SEM);
+
+        /*
+         * Normally CFE_PSP_Panic() will not return but it will under UT
+         */
+        return;
+    }
+#endif
+
     /*
     ** Announce the startup
     */
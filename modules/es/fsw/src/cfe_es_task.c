@@ -431,6 +431,21 @@ int32 CFE_ES_TaskInit(void)
         return Status;
     }
 
+    /*
+     * After a processor reset the ER log holds the reason for the reset, so
+     * save it to a file in the background.  This is not requested by the
+     * ground, so it yields to any commanded file writes.
+     */
+    if (CFE_PLATFORM_ES_WRITE_ER_LOG_ON_PROCESSOR_RESET && CFE_ES_GetResetType(NULL) == CFE_PSP_RST_TYPE_PROCESSOR)
+    {
+        Status = CFE_ES_RequestERLogFileWrite(NULL, 0, CFE_FS_FileWritePriority_AUTOMATIC);
+        if (Status != CFE_SUCCESS)
+        {
+            /* Not fatal, the ER log can still be written by command */
+            CFE_ES_WriteToSysLog("%s: Error writing ER log after reset:RC=0x%08X\n", __func__, (unsigned int)Status);
+        }
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -1392,11 +1407,10 @@ int32 CFE_ES_ClearERLogCmd(const CFE_ES_ClearERLogCmd_t *data)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLogCmd_t *data)
+int32 CFE_ES_RequestERLogFileWrite(const char *FileName, size_t FileNameSize, CFE_FS_FileWritePriority_t Priority)
 {
-    const CFE_ES_FileNameCmd_Payload_t *CmdPtr = &data->Payload;
-    CFE_ES_BackgroundLogDumpGlobal_t *  StatePtr;
-    int32                               Status;
+    CFE_ES_BackgroundLogDumpGlobal_t *StatePtr;
+    int32                             Status;
 
     StatePtr = &CFE_ES_Global.BackgroundERLogDumpState;
 
@@ -1416,6 +1430,8 @@ int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLogCmd_t *data)
          */
         StatePtr->FileWrite.FileSubType = CFE_FS_SubType_ES_ERLOG;
         snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), CFE_ES_ER_LOG_DESC);
+        StatePtr->FileWrite.Compress = CFE_PLATFORM_ES_COMPRESS_FILE_DUMPS;
+        StatePtr->FileWrite.Priority = Priority;
 
         StatePtr->FileWrite.GetData = CFE_ES_BackgroundERLogFileDataGetter;
         StatePtr->FileWrite.OnEvent = CFE_ES_BackgroundERLogFileEventHandler;
@@ -1423,8 +1439,8 @@ int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLogCmd_t *data)
         /*
         ** Copy the filename into local buffer with default name/path/extension if not specified
         */
-        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, CmdPtr->FileName,
-                                             sizeof(StatePtr->FileWrite.FileName), sizeof(CmdPtr->FileName),
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, FileName,
+                                             sizeof(StatePtr->FileWrite.FileName), FileNameSize,
                                              CFE_PLATFORM_ES_DEFAULT_ER_LOG_FILE,
                                              CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
                                              CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
@@ -1435,6 +1451,23 @@ int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLogCmd_t *data)
         }
     }
 
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLogCmd_t *data)
+{
+    const CFE_ES_FileNameCmd_Payload_t *CmdPtr = &data->Payload;
+    int32                               Status;
+
+    Status = CFE_ES_RequestERLogFileWrite(CmdPtr->FileName, sizeof(CmdPtr->FileName),
+                                          CFE_FS_FileWritePriority_GROUND);
+
     if (Status != CFE_SUCCESS)
     {
         if (Status == CFE_STATUS_REQUEST_ALREADY_PENDING)
@@ -1461,6 +1494,84 @@ int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLogCmd_t *data)
     return CFE_SUCCESS;
 }
 
+#ifdef CFE_TRACE_BACKEND_RING
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WriteTraceCmd(const CFE_ES_WriteTraceCmd_t *data)
+{
+    const CFE_ES_FileNameCmd_Payload_t *CmdPtr = &data->Payload;
+    CFE_ES_BackgroundTraceDumpGlobal_t *StatePtr;
+    int32                               Status;
+
+    StatePtr = &CFE_ES_Global.BackgroundTraceDumpState;
+
+    /* check if pending before overwriting fields in the structure */
+    if (CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else
+    {
+        /* Reset the entire state object (just for good measure, ensure no stale data) */
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
+        /*
+         * Fill out the remainder of meta data.
+         * This data is currently the same for every request
+         */
+        StatePtr->FileWrite.FileSubType = CFE_FS_SubType_ES_TRACE;
+        snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), CFE_ES_TRACE_DESC);
+        StatePtr->FileWrite.Compress = CFE_PLATFORM_ES_COMPRESS_FILE_DUMPS;
+
+        StatePtr->FileWrite.GetData = CFE_ES_BackgroundTraceFileDataGetter;
+        StatePtr->FileWrite.OnEvent = CFE_ES_BackgroundTraceFileEventHandler;
+
+        /*
+        ** Copy the filename into local buffer with default name/path/extension if not specified
+        */
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, CmdPtr->FileName,
+                                             sizeof(StatePtr->FileWrite.FileName), sizeof(CmdPtr->FileName),
+                                             CFE_PLATFORM_ES_DEFAULT_TRACE_FILE,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+        }
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        if (Status == CFE_STATUS_REQUEST_ALREADY_PENDING)
+        {
+            /* Specific event if already pending */
+            CFE_EVS_SendEvent(CFE_ES_TRACE_PENDING_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Trace buffer write already in progress");
+        }
+        else
+        {
+            /* Some other validation issue e.g. bad file name */
+            CFE_EVS_SendEvent(CFE_ES_TRACE_ERR_EID, CFE_EVS_EventType_ERROR, "Error creating file, RC = %d",
+                              (int)Status);
+        }
+
+        /* background dump did not start, consider this an error */
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+    }
+    else
+    {
+        CFE_ES_Global.TaskData.CommandCounter++;
+    }
+
+    return CFE_SUCCESS;
+}
+#endif /* CFE_TRACE_BACKEND_RING */
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -42,6 +42,7 @@
 #include "cfe_fs_api_typedefs.h"
 #include "cfe_sb_api_typedefs.h"
 #include "cfe_es_erlog_typedef.h"
+#include "cfe_core_trace.h"
 #include "cfe_msg_api_typedefs.h"
 
 /*************************************************************************/
@@ -59,6 +60,7 @@
 #define CFE_ES_APP_LOG_DESC  "ES Application Info file"
 #define CFE_ES_ER_LOG_DESC   "ES ERlog data file"
 #define CFE_ES_PERF_LOG_DESC "ES Performance data file"
+#define CFE_ES_TRACE_DESC    "ES Core trace data file"
 
 /*
  * Limit for the total number of entries that may be
@@ -207,12 +209,38 @@ int32 CFE_ES_WriteSysLogCmd(const CFE_ES_WriteSysLogCmd_t *data);
  */
 int32 CFE_ES_ClearERLogCmd(const CFE_ES_ClearERLogCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Request a background write of the exception & reset log to a file.
+ *
+ * An empty or NULL FileName selects #CFE_PLATFORM_ES_DEFAULT_ER_LOG_FILE.
+ *
+ * \param[in] FileName     Name of the file to write, need not be null terminated
+ * \param[in] FileNameSize Size of the FileName buffer
+ * \param[in] Priority     Whether the ground asked for the file, or ES writes it on its own
+ *
+ * \return CFE_SUCCESS if the write was started, #CFE_STATUS_REQUEST_ALREADY_PENDING
+ *         if another write of the log is still in progress, or a file name error
+ */
+int32 CFE_ES_RequestERLogFileWrite(const char *FileName, size_t FileNameSize, CFE_FS_FileWritePriority_t Priority);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief  Process Cmd to write exception & reset log to a file.
  */
 int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLogCmd_t *data);
 
+#ifdef CFE_TRACE_BACKEND_RING
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Process Cmd to write the core trace buffer to a file.
+ *
+ * Only built with the RING trace backend, with other backends the command
+ * code is rejected like any unknown one.
+ */
+int32 CFE_ES_WriteTraceCmd(const CFE_ES_WriteTraceCmd_t *data);
+#endif
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief  Processor Reset Count
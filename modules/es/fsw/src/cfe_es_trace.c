@@ -0,0 +1,182 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+**  File:
+**    cfe_es_trace.c
+**
+**  Purpose:
+**    This file implements the cFE Executive Services core trace buffer.
+**
+**  References:
+**     Flight Software Branch C Coding Standard Version 1.0a
+**     cFE Flight Software Application Developers Guide
+**
+**  Notes:
+**
+*/
+
+/*
+** Required header files.
+*/
+#include "cfe_es_module_all.h"
+
+#include <string.h>
+
+#ifdef CFE_TRACE_BACKEND_RING
+
+/*----------------------------------------------------------------
+ *
+ * CFE core internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_TraceRecord(uint16 TraceId, uint32 Arg1, uint32 Arg2)
+{
+    CFE_ES_TraceBuffer_t *TracePtr;
+    CFE_ES_TraceEntry_t * EntryPtr;
+
+    TracePtr = &CFE_ES_Global.TraceBuffer;
+
+    /*
+     * This fails until ES has created the mutex during startup,
+     * records made before that are simply not kept.
+     */
+    if (OS_MutSemTake(CFE_ES_Global.TraceMutex) == OS_SUCCESS)
+    {
+        EntryPtr = &TracePtr->Buffer[TracePtr->Next];
+
+        EntryPtr->Sequence = TracePtr->Count;
+        CFE_PSP_Get_Timebase(&EntryPtr->TimerUpper32, &EntryPtr->TimerLower32);
+        EntryPtr->TraceId = TraceId;
+        EntryPtr->Spare   = 0;
+        EntryPtr->Arg1    = Arg1;
+        EntryPtr->Arg2    = Arg2;
+
+        ++TracePtr->Count;
+        ++TracePtr->Next;
+        if (TracePtr->Next >= CFE_PLATFORM_ES_TRACE_BUFFER_SIZE)
+        {
+            TracePtr->Next = 0;
+        }
+
+        OS_MutSemGive(CFE_ES_Global.TraceMutex);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_BackgroundTraceFileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_ES_BackgroundTraceDumpGlobal_t *BgFilePtr;
+    CFE_ES_TraceBuffer_t *              TracePtr;
+    uint32                              Age;
+
+    BgFilePtr = (CFE_ES_BackgroundTraceDumpGlobal_t *)Meta;
+    TracePtr  = &CFE_ES_Global.TraceBuffer;
+
+    *Buffer  = NULL;
+    *BufSize = 0;
+
+    if (OS_MutSemTake(CFE_ES_Global.TraceMutex) == OS_SUCCESS)
+    {
+        /* The file holds the records in the buffer when the write starts */
+        if (RecordNum == 0)
+        {
+            if (TracePtr->Count < CFE_PLATFORM_ES_TRACE_BUFFER_SIZE)
+            {
+                BgFilePtr->NumRecords = TracePtr->Count;
+            }
+            else
+            {
+                BgFilePtr->NumRecords = CFE_PLATFORM_ES_TRACE_BUFFER_SIZE;
+            }
+            BgFilePtr->FirstSequence = TracePtr->Count - BgFilePtr->NumRecords;
+        }
+
+        if (RecordNum < BgFilePtr->NumRecords)
+        {
+            /*
+             * Locate the record by how many records were made after it,
+             * if this exceeds the buffer size it has been overwritten since.
+             */
+            Age = TracePtr->Count - (BgFilePtr->FirstSequence + RecordNum);
+            if (Age <= CFE_PLATFORM_ES_TRACE_BUFFER_SIZE)
+            {
+                BgFilePtr->EntryBuffer =
+                    TracePtr->Buffer[(TracePtr->Next + CFE_PLATFORM_ES_TRACE_BUFFER_SIZE - Age) %
+                                     CFE_PLATFORM_ES_TRACE_BUFFER_SIZE];
+
+                *Buffer  = &BgFilePtr->EntryBuffer;
+                *BufSize = sizeof(BgFilePtr->EntryBuffer);
+            }
+        }
+
+        OS_MutSemGive(CFE_ES_Global.TraceMutex);
+    }
+
+    /* Check for EOF (last entry)  */
+    return (RecordNum + 1 >= BgFilePtr->NumRecords);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_BackgroundTraceFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
+                                            size_t BlockSize, size_t Position)
+{
+    CFE_ES_BackgroundTraceDumpGlobal_t *BgFilePtr;
+
+    BgFilePtr = (CFE_ES_BackgroundTraceDumpGlobal_t *)Meta;
+
+    /* Note that this runs in the context of ES background task (file writer background job) */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            CFE_EVS_SendEvent(CFE_ES_TRACE_EID, CFE_EVS_EventType_DEBUG,
+                              "%s written:Records=%lu,Size=%lu,Rate=%lu B/s", BgFilePtr->FileWrite.FileName,
+                              (unsigned long)BgFilePtr->NumRecords, (unsigned long)Position,
+                              (unsigned long)BgFilePtr->FileWrite.BytesPerSecond);
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_FILEWRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File write,byte cnt err,file %s,request=%u,actual=%u", BgFilePtr->FileWrite.FileName,
+                              (int)BlockSize, (int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_TRACE_ERR_EID, CFE_EVS_EventType_ERROR, "Error creating file %s, RC = %d",
+                              BgFilePtr->FileWrite.FileName, (int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            break;
+    }
+}
+
+#endif /* CFE_TRACE_BACKEND_RING */
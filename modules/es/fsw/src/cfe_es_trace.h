@@ -0,0 +1,93 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose: Core trace buffer data structures
+ *
+ * Design Notes:
+ *   The trace buffer holds the records made by the core tracepoints when
+ *   the RING trace backend is selected (see cfe_core_trace.h).  With other
+ *   backends it is not built at all, nor is its mutex or the command to
+ *   write it to a file.
+ *
+ * References:
+ *
+ */
+
+#ifndef CFE_ES_TRACE_H
+#define CFE_ES_TRACE_H
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "cfe_platform_cfg.h"
+#include "cfe_fs_api_typedefs.h"
+#include "cfe_core_trace.h"
+
+#ifdef CFE_TRACE_BACKEND_RING
+
+/*
+ * Core trace ring buffer
+ *
+ * Protected by CFE_ES_Global.TraceMutex.  Once the buffer is full each
+ * new record overwrites the oldest one.
+ */
+typedef struct
+{
+    uint32              Count; /* number of records ever made, sequence of the next record */
+    uint32              Next;  /* index in Buffer of the next record */
+    CFE_ES_TraceEntry_t Buffer[CFE_PLATFORM_ES_TRACE_BUFFER_SIZE];
+} CFE_ES_TraceBuffer_t;
+
+/*
+ * Background trace dump state structure
+ *
+ * The records to write are chosen when the first one is fetched, and
+ * records overwritten while the file is being written are skipped.
+ */
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t FileWrite;     /**< FS state data - must be first */
+    CFE_ES_TraceEntry_t        EntryBuffer;   /**< Temp holding area for record to write */
+    uint32                     FirstSequence; /**< Sequence of the oldest record to write */
+    uint32                     NumRecords;    /**< Number of records to write */
+} CFE_ES_BackgroundTraceDumpGlobal_t;
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write data getter for the trace buffer
+ *
+ * Gets a single record from the trace buffer to write to a file.
+ */
+bool CFE_ES_BackgroundTraceFileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write event handler for the trace buffer
+ *
+ * Report events during writing the trace buffer to a file
+ */
+void CFE_ES_BackgroundTraceFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
+                                            size_t BlockSize, size_t Position);
+
+#endif /* CFE_TRACE_BACKEND_RING */
+
+#endif /* CFE_ES_TRACE_H */
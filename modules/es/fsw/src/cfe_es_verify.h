@@ -140,6 +140,10 @@
 #error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE cannot be less than 1025 entries!
 #endif
 
+#if CFE_PLATFORM_ES_TRACE_BUFFER_SIZE < 1
+#error CFE_PLATFORM_ES_TRACE_BUFFER_SIZE cannot be less than 1 entry!
+#endif
+
 /*
 ** Maximum number of Registered CDS blocks
 */
@@ -35,3 +35,17 @@ foreach(ES_CFGFILE ${ES_MISSION_CONFIG_FILE_LIST})
     ${DEFAULT_SOURCE}
   )
 endforeach()
+
+# Core tracepoint backend selection
+if (MISSION_TRACE_BACKEND STREQUAL "USDT")
+  set(TRACE_BACKEND_FILE "cfe_core_trace_usdt.h")
+elseif (MISSION_TRACE_BACKEND STREQUAL "RING")
+  set(TRACE_BACKEND_FILE "cfe_core_trace_ring.h")
+else ()
+  set(TRACE_BACKEND_FILE "cfe_core_trace_none.h")
+endif ()
+
+generate_config_includefile(
+    FILE_NAME           "cfe_core_trace_backend.h"
+    FALLBACK_FILE       "${CMAKE_CURRENT_LIST_DIR}/option_inc/${TRACE_BACKEND_FILE}"
+)
@@ -0,0 +1,42 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Core tracepoint backend for builds with tracing disabled
+ *
+ * Tracepoints compile to nothing.  The arguments are referenced in a
+ * dead branch only so that values computed just for a tracepoint do not
+ * produce unused variable warnings; they are never evaluated.
+ */
+
+#ifndef CFE_CORE_TRACE_BACKEND_H
+#define CFE_CORE_TRACE_BACKEND_H
+
+#define CFE_TRACE_POINT(Event, Arg1, Arg2) \
+    do                                     \
+    {                                      \
+        if (0)                             \
+        {                                  \
+            (void)(Arg1);                  \
+            (void)(Arg2);                  \
+        }                                  \
+    } while (0)
+
+#endif /* CFE_CORE_TRACE_BACKEND_H */
@@ -0,0 +1,44 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Core tracepoint backend recording into the ES trace buffer
+ *
+ * Each tracepoint stores a time stamped record in a fixed size ring buffer
+ * kept by ES, where the oldest records are overwritten.  The buffer can be
+ * written to a file with the #CFE_ES_WRITE_TRACE_CC command.  This works on
+ * every platform, at the cost of a mutex and a time base read per tracepoint.
+ */
+
+#ifndef CFE_CORE_TRACE_BACKEND_H
+#define CFE_CORE_TRACE_BACKEND_H
+
+#include "cfe_es_core_internal.h"
+
+/*
+ * ES only builds the trace buffer, its mutex and the command to write it
+ * with this backend
+ */
+#define CFE_TRACE_BACKEND_RING 1
+
+#define CFE_TRACE_POINT(Event, Arg1, Arg2) \
+    CFE_ES_TraceRecord(CFE_TRACE_ID_##Event, (uint32)(Arg1), (uint32)(Arg2))
+
+#endif /* CFE_CORE_TRACE_BACKEND_H */
@@ -0,0 +1,41 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Core tracepoint backend emitting USDT probes
+ *
+ * Each tracepoint becomes a statically defined probe in the "cfe" provider,
+ * named after the event (e.g. SB_TRANSMIT), which can be attached from user
+ * space tools such as bpftrace or perf without rebuilding:
+ *
+ *     bpftrace -e 'usdt:./core-cpu1:cfe:SB_TRANSMIT { @[arg0] = count(); }'
+ *
+ * A probe that is not attached costs a single no-op instruction.  This needs
+ * the SystemTap SDT header (sys/sdt.h), which is only available on Linux.
+ */
+
+#ifndef CFE_CORE_TRACE_BACKEND_H
+#define CFE_CORE_TRACE_BACKEND_H
+
+#include <sys/sdt.h>
+
+#define CFE_TRACE_POINT(Event, Arg1, Arg2) DTRACE_PROBE2(cfe, Event, (uint32)(Arg1), (uint32)(Arg2))
+
+#endif /* CFE_CORE_TRACE_BACKEND_H */
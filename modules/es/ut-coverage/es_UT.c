@@ -121,6 +121,8 @@ static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_CLEAR_ER_LOG_CC = {
     .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID), .CommandCode = CFE_ES_CLEAR_ER_LOG_CC};
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_ER_LOG_CC = {
     .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID), .CommandCode = CFE_ES_WRITE_ER_LOG_CC};
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_TRACE_CC = {
+    .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID), .CommandCode = CFE_ES_WRITE_TRACE_CC};
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC = {
     .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID), .CommandCode = CFE_ES_START_PERF_DATA_CC};
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC = {
@@ -627,6 +629,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestERLog);
     UT_ADD_TEST(TestTask);
     UT_ADD_TEST(TestPerf);
+    UT_ADD_TEST(TestTrace);
     UT_ADD_TEST(TestAPI);
     UT_ADD_TEST(TestGenericCounterAPI);
     UT_ADD_TEST(TestCDS);
@@ -741,6 +744,14 @@ void TestStartupErrorPaths(void)
     UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_STARTUP_SEM);
     UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_Panic)), 1);
 
+    /* Perform ES main startup with an ES Trace Buffer mutex creation failure */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 3, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_Panic), &PanicStatus, sizeof(PanicStatus), false);
+    CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
+    UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_STARTUP_SEM);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_Panic)), 1);
+
     /* Perform ES main startup with an ES Shared Data mutex creation failure */
     ES_ResetUnitTest();
     UT_SetDummyFuncRtn(OS_SUCCESS);
@@ -2548,6 +2559,7 @@ void TestTask(void)
     ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_RUNNING, NULL, NULL, NULL);
     CFE_ES_Global.ResetDataPtr->ResetVars.ResetType = 2;
     CFE_UtAssert_SUCCESS(CFE_ES_TaskInit());
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
 
     /* Test successful task main process loop - Processor Reset Path */
     ES_ResetUnitTest();
@@ -2555,6 +2567,27 @@ void TestTask(void)
     ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_RUNNING, NULL, NULL, NULL);
     CFE_ES_Global.ResetDataPtr->ResetVars.ResetType = 1;
     CFE_UtAssert_SUCCESS(CFE_ES_TaskInit());
+    if (CFE_PLATFORM_ES_WRITE_ER_LOG_ON_PROCESSOR_RESET)
+    {
+        /* The ER log is written on its own, as an automatic request */
+        UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+        UtAssert_INT32_EQ(CFE_ES_Global.BackgroundERLogDumpState.FileWrite.Priority,
+                          CFE_FS_FileWritePriority_AUTOMATIC);
+        UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandCounter, 0);
+
+        /* A failure to start the write does not fail the init */
+        ES_ResetUnitTest();
+        ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_RUNNING, NULL, NULL, NULL);
+        CFE_ES_Global.ResetDataPtr->ResetVars.ResetType = 1;
+        UT_SetDeferredRetcode(UT_KEY(CFE_FS_BackgroundFileDumpRequest), 1, CFE_STATUS_REQUEST_ALREADY_PENDING);
+        CFE_UtAssert_SUCCESS(CFE_ES_TaskInit());
+        CFE_UtAssert_PRINTF("%s: Error writing ER log after reset:RC=0x%08X\n");
+    }
+    else
+    {
+        /* The ER log is not written on its own */
+        UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
+    }
 
     /* Test task main process loop with a with an EVS register failure */
     ES_ResetUnitTest();
@@ -3107,6 +3140,8 @@ void TestTask(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteERLogCmd), UT_TPID_CFE_ES_CMD_WRITE_ER_LOG_CC);
     UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundERLogDumpState.FileWrite.Compress, CFE_PLATFORM_ES_COMPRESS_FILE_DUMPS);
+    UtAssert_INT32_EQ(CFE_ES_Global.BackgroundERLogDumpState.FileWrite.Priority, CFE_FS_FileWritePriority_GROUND);
     CFE_UtAssert_EVENTCOUNT(0);
 
     /* Failure of parsing the file name */
@@ -3940,6 +3975,148 @@ void TestPerf(void)
     UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDumpRemaining(), 10);
 }
 
+void TestTrace(void)
+{
+    union
+    {
+        CFE_MSG_Message_t      Msg;
+        CFE_ES_WriteTraceCmd_t WriteTraceCmd;
+    } CmdBuf;
+    CFE_ES_TraceBuffer_t *             TracePtr;
+    CFE_ES_BackgroundTraceDumpGlobal_t State;
+    void *                             LocalBuffer;
+    size_t                             LocalBufSize;
+
+    UtPrintf("Begin Test Core Trace Buffer");
+
+    TracePtr = &CFE_ES_Global.TraceBuffer;
+
+    /* Test that nothing is recorded if the mutex is not available */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, OS_ERR_INVALID_ID);
+    CFE_ES_TraceRecord(CFE_TRACE_ID_SB_TRANSMIT, 1, 2);
+    UtAssert_ZERO(TracePtr->Count);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 0);
+
+    /* Test successful recording */
+    CFE_ES_TraceRecord(CFE_TRACE_ID_SB_TRANSMIT, 1, 2);
+    CFE_ES_TraceRecord(CFE_TRACE_ID_SB_RECEIVE, 3, 4);
+    UtAssert_UINT32_EQ(TracePtr->Count, 2);
+    UtAssert_UINT32_EQ(TracePtr->Next, 2);
+    UtAssert_UINT32_EQ(TracePtr->Buffer[1].Sequence, 1);
+    UtAssert_UINT32_EQ(TracePtr->Buffer[1].TraceId, CFE_TRACE_ID_SB_RECEIVE);
+    UtAssert_UINT32_EQ(TracePtr->Buffer[1].Arg1, 3);
+    UtAssert_UINT32_EQ(TracePtr->Buffer[1].Arg2, 4);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+
+    /* Test the write position wrapping around at the end of the buffer */
+    TracePtr->Next = CFE_PLATFORM_ES_TRACE_BUFFER_SIZE - 1;
+    CFE_ES_TraceRecord(CFE_TRACE_ID_EVS_SEND, 5, 6);
+    UtAssert_ZERO(TracePtr->Next);
+    UtAssert_UINT32_EQ(TracePtr->Buffer[CFE_PLATFORM_ES_TRACE_BUFFER_SIZE - 1].Sequence, 2);
+
+    /* Test trace background write functions with a partly filled buffer */
+    ES_ResetUnitTest();
+    CFE_ES_TraceRecord(CFE_TRACE_ID_ES_POOL_GET, 1, 2);
+    CFE_ES_TraceRecord(CFE_TRACE_ID_ES_POOL_PUT, 3, 4);
+    memset(&State, 0, sizeof(State));
+    LocalBuffer  = NULL;
+    LocalBufSize = 0;
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundTraceFileDataGetter(&State, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_UINT32_EQ(State.NumRecords, 2);
+    UtAssert_ADDRESS_EQ(LocalBuffer, &State.EntryBuffer);
+    UtAssert_UINT32_EQ(LocalBufSize, sizeof(State.EntryBuffer));
+    UtAssert_UINT32_EQ(State.EntryBuffer.TraceId, CFE_TRACE_ID_ES_POOL_GET);
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundTraceFileDataGetter(&State, 1, &LocalBuffer, &LocalBufSize));
+    UtAssert_UINT32_EQ(State.EntryBuffer.TraceId, CFE_TRACE_ID_ES_POOL_PUT);
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundTraceFileDataGetter(&State, 2, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    /* Records overwritten while the file is being written are skipped */
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundTraceFileDataGetter(&State, 0, &LocalBuffer, &LocalBufSize));
+    TracePtr->Count += CFE_PLATFORM_ES_TRACE_BUFFER_SIZE;
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundTraceFileDataGetter(&State, 1, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    /* Test a full buffer, the oldest record is at the write position */
+    ES_ResetUnitTest();
+    memset(&State, 0, sizeof(State));
+    TracePtr->Count                           = CFE_PLATFORM_ES_TRACE_BUFFER_SIZE + 5;
+    TracePtr->Next                            = 5 % CFE_PLATFORM_ES_TRACE_BUFFER_SIZE;
+    TracePtr->Buffer[TracePtr->Next].Sequence = 5;
+    CFE_ES_BackgroundTraceFileDataGetter(&State, 0, &LocalBuffer, &LocalBufSize);
+    UtAssert_UINT32_EQ(State.NumRecords, CFE_PLATFORM_ES_TRACE_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(State.FirstSequence, 5);
+    UtAssert_UINT32_EQ(State.EntryBuffer.Sequence, 5);
+
+    /* Test an empty file if the mutex is not available */
+    ES_ResetUnitTest();
+    memset(&State, 0, sizeof(State));
+    CFE_ES_TraceRecord(CFE_TRACE_ID_TBL_LOAD, 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, OS_ERR_INVALID_ID);
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundTraceFileDataGetter(&State, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    /* Test trace background write event handling */
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundTraceFileEventHandler(&State, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 10, 0, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_TRACE_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundTraceFileEventHandler(&State, CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR, -1, 10, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundTraceFileEventHandler(&State, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, -1, 10, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundTraceFileEventHandler(&State, CFE_FS_FileWriteEvent_CREATE_ERROR, -1, 10, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_TRACE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundTraceFileEventHandler(&State, CFE_FS_FileWriteEvent_UNDEFINED, CFE_SUCCESS, 10, 0, 100);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test successful request to write the trace buffer */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    strncpy(CmdBuf.WriteTraceCmd.Payload.FileName, "filename", sizeof(CmdBuf.WriteTraceCmd.Payload.FileName) - 1);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteTraceCmd), UT_TPID_CFE_ES_CMD_WRITE_TRACE_CC);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTraceDumpState.FileWrite.FileSubType, CFE_FS_SubType_ES_TRACE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandCounter, 1);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Failure of parsing the file name */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteTraceCmd), UT_TPID_CFE_ES_CMD_WRITE_TRACE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_TRACE_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandErrorCounter, 1);
+
+    /* Failure from CFE_FS_BackgroundFileDumpRequest() should send the pending error event ID */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_BackgroundFileDumpRequest), 1, CFE_STATUS_REQUEST_ALREADY_PENDING);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteTraceCmd), UT_TPID_CFE_ES_CMD_WRITE_TRACE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_TRACE_PENDING_ERR_EID);
+
+    /* Same event but pending locally */
+    UT_ClearEventHistory();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteTraceCmd), UT_TPID_CFE_ES_CMD_WRITE_TRACE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_TRACE_PENDING_ERR_EID);
+
+    /* Test sending a request to write the trace buffer with an invalid command length */
+    ES_ResetUnitTest();
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, 0, UT_TPID_CFE_ES_CMD_WRITE_TRACE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LEN_ERR_EID);
+}
+
 void TestAPI(void)
 {
     osal_id_t            TestObjId;
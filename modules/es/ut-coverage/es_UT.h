@@ -178,6 +178,22 @@ void TestBackground(void);
 ******************************************************************************/
 void TestPerf(void);
 
+/*****************************************************************************/
+/**
+** \brief Performs tests on the core trace buffer functions contained in
+**        cfe_es_trace.c and the command to write the trace buffer
+**
+** \par Description
+**        This function tests the trace buffer recording and file writing.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestTrace(void);
+
 /*****************************************************************************/
 /**
 ** \brief Perform tests on the ES API functions contained in cfe_es_api.c
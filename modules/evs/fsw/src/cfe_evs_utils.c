@@ -273,6 +273,11 @@ bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
         }
     }
 
+    if (Filtered)
+    {
+        CFE_TRACE_POINT(EVS_FILTER, CFE_RESOURCEID_TO_ULONG(EVS_AppDataGetID(AppDataPtr)), EventID);
+    }
+
     return Filtered;
 }
 
@@ -357,6 +362,9 @@ bool EVS_CheckAndIncrementSquelchTokens(EVS_AppData_t *AppDataPtr)
             }
             NotSquelched = false;
 
+            CFE_TRACE_POINT(EVS_SQUELCH, CFE_RESOURCEID_TO_ULONG(EVS_AppDataGetID(AppDataPtr)),
+                            AppDataPtr->SquelchedCount);
+
             /*
              * Send squelch event message if cross threshold. This has to be a
              * range between -EVENT_COST and 0 due to non-whole event-cost credits being
@@ -456,6 +464,8 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
     CFE_EVS_ShortEventTlm_t ShortEventTlm; /* The "short" flavor is only generated if selected */
     int                     ExpandedLength;
 
+    CFE_TRACE_POINT(EVS_SEND, CFE_RESOURCEID_TO_ULONG(EVS_AppDataGetID(AppDataPtr)), EventID);
+
     memset(&LongEventTlm, 0, sizeof(LongEventTlm));
     memset(&ShortEventTlm, 0, sizeof(ShortEventTlm));
 
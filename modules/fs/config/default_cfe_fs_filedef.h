@@ -165,7 +165,17 @@ enum CFE_FS_SubType
      * command.
      *
      */
-    CFE_FS_SubType_ES_QUERYALLTASKS = 23
+    CFE_FS_SubType_ES_QUERYALLTASKS = 23,
+
+    /**
+     * @brief Executive Services Core Trace Data File
+     *
+     * Executive Services Core Trace Data File which is generated in response to a
+     * \link #CFE_ES_WRITE_TRACE_CC \ES_WRITETRACE2FILE \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_ES_TRACE = 24
 };
 
 /**
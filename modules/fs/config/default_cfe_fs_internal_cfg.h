@@ -0,0 +1,65 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   CFE File Services (CFE_FS) Application Private Config Definitions
+ *
+ * This provides default values for configurable items that are internal
+ * to this module and do NOT affect the interface(s) of this module.  Changes
+ * to items in this file only affect the local module and will be transparent
+ * to external entities that are using the public interface(s).
+ *
+ * @note This file may be overridden/superceded by mission-provided defintions
+ * either by overriding this header or by generating definitions from a command/data
+ * dictionary tool.
+ */
+#ifndef CFE_FS_INTERNAL_CFG_H
+#define CFE_FS_INTERNAL_CFG_H
+
+/**
+**  \cfeplatformcfg Share of File System Time Used by Background File Writes
+**
+**  \par Description:
+**       The FS background file writer, which runs in the ES background task,
+**       limits its rate to this share of the measured write speed of the file
+**       system, in percent, so background files use about this share of the
+**       file system time whatever the device.  This applies to the files that
+**       are written on ground command.
+**
+**  \par Limits
+**       Must be greater than zero and no greater than 100.
+*/
+#define CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT 20
+
+/**
+**  \cfeplatformcfg Share of File System Time Used by Automatic Background File Writes
+**
+**  \par Description:
+**       Like #CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT, for the files that
+**       the cFE writes on its own, such as the ER log after a processor reset.
+**       These files are also written only when no file commanded by the ground
+**       is waiting, so a smaller share makes them stall other writers less.
+**
+**  \par Limits
+**       Must be greater than zero and no greater than
+**       #CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT.
+*/
+#define CFE_PLATFORM_FS_BACKGROUND_AUTO_IO_SHARE_PERCENT 5
+
+#endif
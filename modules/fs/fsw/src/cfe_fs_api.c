@@ -360,6 +360,81 @@ void CFE_FS_ByteSwapUint32(uint32 *Uint32ToSwapPtr)
     OutPtr[3] = InPtr[0];
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_FS_GetPathView(CFE_FS_PathView_t *View, const char *InputBuffer, size_t InputBufSize)
+{
+    size_t InputLen;
+    size_t PathLen;
+    size_t DotPos;
+    size_t ExtPos;
+    bool   HasPath;
+    bool   HasDot;
+
+    if (View == NULL || InputBuffer == NULL)
+    {
+        return CFE_FS_BAD_ARGUMENT;
+    }
+
+    /*
+     * Single pass over the input, which ends at the first NUL char.  The path ends
+     * at the last '/' and the extension separator is the first '.' after that.
+     */
+    PathLen = 0;
+    DotPos  = 0;
+    HasPath = false;
+    HasDot  = false;
+    for (InputLen = 0; InputLen < InputBufSize && InputBuffer[InputLen] != 0; ++InputLen)
+    {
+        if (InputBuffer[InputLen] == '/')
+        {
+            PathLen = InputLen + 1;
+            HasPath = true;
+            HasDot  = false;
+        }
+        else if (InputBuffer[InputLen] == '.' && !HasDot)
+        {
+            DotPos = InputLen;
+            HasDot = true;
+        }
+    }
+
+    View->Path    = HasPath ? InputBuffer : NULL;
+    View->PathLen = PathLen;
+    View->Name    = &InputBuffer[PathLen];
+
+    if (HasDot)
+    {
+        /* Any run of '.' chars is a single separator */
+        ExtPos = DotPos;
+        while (ExtPos < InputLen && InputBuffer[ExtPos] == '.')
+        {
+            ++ExtPos;
+        }
+
+        View->NameLen      = DotPos - PathLen;
+        View->Extension    = &InputBuffer[ExtPos];
+        View->ExtensionLen = InputLen - ExtPos;
+    }
+    else
+    {
+        View->NameLen      = InputLen - PathLen;
+        View->Extension    = NULL;
+        View->ExtensionLen = 0;
+    }
+
+    if (View->NameLen == 0)
+    {
+        return CFE_FS_INVALID_PATH;
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -370,26 +445,12 @@ int32 CFE_FS_ParseInputFileNameEx(char *OutputBuffer, const char *InputBuffer, s
                                   size_t InputBufSize, const char *DefaultInput, const char *DefaultPath,
                                   const char *DefaultExtension)
 {
-    int32       Status;
-    const char *InputPtr;
-    const char *ComponentPtr;
-    size_t      ComponentLen;
-    char        ComponentTerm;
-    size_t      OutputLen;
-    size_t      InputLen;
-    bool        LastPathReached;
-
-    /* The filename consists of a pathname, filename, and extension component. */
-    enum
-    {
-        PROCESS_INIT,
-        PATHNAME_COMPONENT,
-        PATHNAME_SEPARATOR,
-        FILENAME_COMPONENT,
-        EXTENSION_SEPARATOR,
-        EXTENSION_COMPONENT,
-        END_COMPONENT
-    } Component;
+    int32             Status;
+    const char *      InputPtr;
+    size_t            InputLen;
+    size_t            OutputLen;
+    bool              Fits;
+    CFE_FS_PathView_t View;
 
     /* Sanity check buffer input */
     if (OutputBuffer == NULL || OutputBufSize == 0)
@@ -397,10 +458,8 @@ int32 CFE_FS_ParseInputFileNameEx(char *OutputBuffer, const char *InputBuffer, s
         return CFE_FS_BAD_ARGUMENT;
     }
 
-    Status          = CFE_FS_INVALID_PATH;
-    OutputLen       = 0;
-    ComponentTerm   = 0;
-    LastPathReached = false;
+    Status    = CFE_FS_INVALID_PATH;
+    OutputLen = 0;
 
     /* If input buffer is not empty, then use it, otherwise use DefaultInput */
     if (InputBuffer != NULL && InputBufSize > 0 && InputBuffer[0] != 0)
@@ -421,151 +480,72 @@ int32 CFE_FS_ParseInputFileNameEx(char *OutputBuffer, const char *InputBuffer, s
         InputLen = 0;
     }
 
-    Component = PROCESS_INIT;
-    while (InputPtr != NULL && Component < END_COMPONENT)
+    if (InputPtr != NULL)
     {
-        /* Move to next component */
-        if (Component == PATHNAME_SEPARATOR && !LastPathReached)
+        /*
+         * The view locates each part of the input in place, so the output is built
+         * with one copy per part.  An empty file name is the only failure here, and
+         * the rest of the name is still assembled for the output in that case.
+         */
+        Status = CFE_FS_GetPathView(&View, InputPtr, InputLen);
+
+        /* no path: use default pathname, otherwise use the input path without duplicate separators */
+        if (View.Path != NULL)
+        {
+            Fits = CFE_FS_AppendPathComponent(OutputBuffer, OutputBufSize, &OutputLen, View.Path, View.PathLen, '/');
+        }
+        else if (DefaultPath != NULL)
         {
-            /* repeat until LastPathReached */
-            Component = PATHNAME_COMPONENT;
+            Fits = CFE_FS_AppendPathComponent(OutputBuffer, OutputBufSize, &OutputLen, DefaultPath,
+                                              strlen(DefaultPath), 0);
         }
         else
         {
-            ++Component;
+            Fits = true;
         }
 
-        switch (Component)
+        if (Fits)
         {
-            case PATHNAME_COMPONENT:
-                /* path part ends with the last / char, which begins the filename */
-                ComponentTerm = '/';
-                ComponentPtr  = memchr(InputPtr, ComponentTerm, InputLen);
-                if (ComponentPtr != NULL)
-                {
-                    /* has path: use pathname from input, advance InputPtr to next part (filename) */
-                    ComponentLen = ComponentPtr - InputPtr;
-                    ComponentPtr = InputPtr;
-                    InputPtr += ComponentLen;
-                    InputLen -= ComponentLen;
-                }
-                else
-                {
-                    LastPathReached = true;
-
-                    /* no path: if no output at all yet, use default pathname, otherwise move on. */
-                    if (DefaultPath != NULL && OutputLen == 0)
-                    {
-                        ComponentLen = strlen(DefaultPath);
-                        ComponentPtr = DefaultPath;
-                    }
-                    else
-                    {
-                        /* use no pathname at all */
-                        ComponentLen = 0;
-                        ComponentPtr = NULL;
-                    }
-                }
-                break;
-
-            case FILENAME_COMPONENT:
-                /* filename ends with a . char, which begins the extension */
-                ComponentTerm = '.';
-                ComponentPtr  = memchr(InputPtr, ComponentTerm, InputLen);
-                if (ComponentPtr != NULL)
-                {
-                    /* has ext: use pathname from input, advance InputPtr to next part (extension) */
-                    ComponentLen = ComponentPtr - InputPtr;
-                    ComponentPtr = InputPtr;
-                    InputPtr += ComponentLen;
-                    InputLen -= ComponentLen;
-                }
-                else
-                {
-                    /* no ext: use remainder of input here - then use default extension for next part */
-                    ComponentLen = InputLen;
-                    ComponentPtr = InputPtr;
-                    if (DefaultExtension != NULL)
-                    {
-                        InputPtr = DefaultExtension;
-                        InputLen = strlen(DefaultExtension);
-                    }
-                    else
-                    {
-                        /* Use no extension */
-                        InputPtr = NULL;
-                        InputLen = 0;
-                    }
-                }
-
-                if (ComponentLen > 0 && *ComponentPtr != 0)
-                {
-                    /*
-                     * If the filename part is non-empty, then consider the conversion successful
-                     * (note that extension is not really needed for an acceptable filename)
-                     */
-                    Status = CFE_SUCCESS;
-                }
-
-                break;
-
-            case PATHNAME_SEPARATOR:
-            case EXTENSION_SEPARATOR:
-                /* Remove duplicate terminators that may have been in the input */
-                while (OutputLen > 0 && OutputBuffer[OutputLen - 1] == ComponentTerm)
-                {
-                    --OutputLen;
-                }
-
-                ComponentLen = 1;
-                ComponentPtr = &ComponentTerm;
-
-                /* advance past any separators in input to get to the next content */
-                while (*InputPtr == ComponentTerm && InputLen > 0)
-                {
-                    ++InputPtr;
-                    --InputLen;
-                }
-                break;
+            Fits = CFE_FS_AppendPathSeparator(OutputBuffer, OutputBufSize, &OutputLen, '/');
+        }
 
-            case EXTENSION_COMPONENT:
-                /* Intentional fall through to default case */
-
-            default:
-                /* Just consume the rest of input -
-                 * should already be pointing to correct data */
-                ComponentTerm = 0;
-                ComponentLen  = InputLen;
-                ComponentPtr  = InputPtr;
-                InputPtr      = NULL; /* no more input */
-                InputLen      = 0;
-                break;
+        if (Fits)
+        {
+            Fits = CFE_FS_AppendPathComponent(OutputBuffer, OutputBufSize, &OutputLen, View.Name, View.NameLen, 0);
         }
 
-        /* Append component */
-        while (ComponentLen > 0 && *ComponentPtr != 0)
+        /* no ext: use default extension, skipping its own separator if it has one */
+        if (View.Extension == NULL && DefaultExtension != NULL)
         {
-            OutputBuffer[OutputLen] = *ComponentPtr;
-            ++ComponentPtr;
-            ++OutputLen;
-            --ComponentLen;
+            View.Extension = DefaultExtension;
+            while (*View.Extension == '.')
+            {
+                ++View.Extension;
+            }
+            View.ExtensionLen = strlen(View.Extension);
+        }
 
-            if (OutputLen >= OutputBufSize)
+        if (Fits && View.Extension != NULL)
+        {
+            Fits = CFE_FS_AppendPathSeparator(OutputBuffer, OutputBufSize, &OutputLen, '.');
+            if (Fits)
             {
-                /* name is too long to fit in output buffer */
-                Status   = CFE_FS_FNAME_TOO_LONG;
-                InputPtr = NULL; /* no more input */
-                InputLen = 0;
-                --OutputLen; /* back up one char for term */
-                break;
+                Fits = CFE_FS_AppendPathComponent(OutputBuffer, OutputBufSize, &OutputLen, View.Extension,
+                                                  View.ExtensionLen, 0);
             }
         }
+
+        if (!Fits)
+        {
+            /* name is too long to fit in output buffer */
+            Status = CFE_FS_FNAME_TOO_LONG;
+        }
     }
 
     /*
      * Always add a final terminating NUL char.
      *
-     * Note that the loop above should never entirely fill
+     * Note that the append functions never entirely fill
      * buffer (length check includes extra char).
      */
     OutputBuffer[OutputLen] = 0;
@@ -681,6 +661,12 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
     void *                            RecordPtr;
     size_t                            RecordSize;
     bool                              IsEOF;
+    bool                              IsWritten;
+    uint32                            CreditRate;
+    uint64                            CreditIncrement;
+    size_t                            WriteStartSize;
+    OS_time_t                         WriteStartTime;
+    OS_time_t                         WriteEndTime;
 
     State      = &CFE_FS_Global.FileDump.Current;
     Curr       = NULL;
@@ -688,27 +674,50 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
     RecordPtr  = NULL;
     RecordSize = 0;
 
-    State->Credit += (ElapsedTime * CFE_FS_BACKGROUND_CREDIT_PER_SECOND) / 1000;
-    if (State->Credit > CFE_FS_BACKGROUND_MAX_CREDIT)
-    {
-        State->Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
-    }
-
     /*
      * Lock shared data.
-     * Not strictly necessary as the "CompleteCount" is only updated
-     * by this task but this helps in case the access isn't atomic.
+     * The "CompleteCount" is only updated by this task, but waiting
+     * requests may be reordered while others are being queued.
      */
     CFE_FS_LockSharedData(__func__);
 
     if (CFE_FS_Global.FileDump.CompleteCount != CFE_FS_Global.FileDump.RequestCount)
     {
+        /* Ground requests go ahead of automatic ones, but never interrupt a file in progress */
+        if (!OS_ObjectIdDefined(State->Fd))
+        {
+            CFE_FS_PrioritizeBackgroundFileDumps();
+        }
+
         Curr = &CFE_FS_Global.FileDump
                     .Entries[CFE_FS_Global.FileDump.CompleteCount & (CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1)];
     }
 
     CFE_FS_UnlockSharedData(__func__);
 
+    /* Credit accumulates at the rate for the request being written, or for a ground request when idle */
+    if (Curr == NULL)
+    {
+        CreditRate = CFE_FS_BackgroundCreditRate(CFE_FS_FileWritePriority_GROUND);
+    }
+    else
+    {
+        CreditRate = CFE_FS_BackgroundCreditRate(Curr->Meta->Priority);
+    }
+
+    /* At most one second's worth, which also keeps the sum in range */
+    CreditIncrement = ((uint64)ElapsedTime * CreditRate) / 1000;
+    if (CreditIncrement > CreditRate)
+    {
+        CreditIncrement = CreditRate;
+    }
+
+    State->Credit += (int32)CreditIncrement;
+    if (State->Credit > (int32)CreditRate)
+    {
+        State->Credit = CreditRate;
+    }
+
     if (Curr == NULL)
     {
         return false;
@@ -729,7 +738,16 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
         }
         else
         {
-            CFE_FS_InitHeader(&FileHdr, Meta->Description, Meta->FileSubType);
+            State->Compress = Meta->Compress;
+            if (State->Compress)
+            {
+                State->Compressor.BlockFill = 0;
+                CFE_FS_InitHeader(&FileHdr, Meta->Description, Meta->FileSubType | CFE_FS_SUBTYPE_COMPRESSED);
+            }
+            else
+            {
+                CFE_FS_InitHeader(&FileHdr, Meta->Description, Meta->FileSubType);
+            }
 
             /* write the cFE header to the file */
             Status = CFE_FS_WriteHeader(State->Fd, &FileHdr);
@@ -745,10 +763,18 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
                 State->FileSize = sizeof(CFE_FS_Header_t);
                 State->Credit -= sizeof(CFE_FS_Header_t);
                 State->RecordNum = 0;
+                CFE_PSP_GetTime(&State->StartTime);
             }
         }
     }
 
+    /*
+     * Time this pass of writes to adapt the credit rate to the speed
+     * of the file system, including the time to get the records...
+     */
+    CFE_PSP_GetTime(&WriteStartTime);
+    WriteStartSize = State->FileSize;
+
     while (OS_ObjectIdDefined(State->Fd) && State->Credit > 0 && !IsEOF)
     {
         /*
@@ -763,14 +789,31 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
          */
         if (RecordSize > 0)
         {
-            State->Credit -= RecordSize;
+            if (State->Compress)
+            {
+                /*
+                 * Compressed blocks are charged against the credit as they are
+                 * written, so the record only counts once its block fills
+                 */
+                OsStatus = CFE_FS_WriteCompressed(State, RecordPtr, RecordSize);
+                IsWritten = (OsStatus == OS_SUCCESS);
+            }
+            else
+            {
+                State->Credit -= RecordSize;
 
-            /*
-             * Now write to file
-             */
-            OsStatus = OS_write(State->Fd, RecordPtr, RecordSize);
+                /*
+                 * Now write to file
+                 */
+                OsStatus  = OS_write(State->Fd, RecordPtr, RecordSize);
+                IsWritten = (OsStatus == RecordSize);
+                if (IsWritten)
+                {
+                    State->FileSize += RecordSize;
+                }
+            }
 
-            if (OsStatus != RecordSize)
+            if (!IsWritten)
             {
                 /* end the file early (cannot set "IsEOF" as this would cause the complete event to be generated too) */
                 OS_close(State->Fd);
@@ -782,21 +825,42 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
                               RecordSize, State->FileSize);
                 break;
             }
-            else
-            {
-                State->FileSize += RecordSize;
-            }
         }
 
         ++State->RecordNum;
     }
 
+    /* On normal EOF write out the final partial block of a compressed file */
+    if (IsEOF && State->Compress && OS_ObjectIdDefined(State->Fd))
+    {
+        OsStatus = CFE_FS_WriteCompressedBlock(State);
+        if (OsStatus != OS_SUCCESS)
+        {
+            OS_close(State->Fd);
+            State->Fd = OS_OBJECT_ID_UNDEFINED;
+            IsEOF     = false;
+
+            /* NOTE: This converts the OSAL status directly into a CFE status for logging */
+            Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, (long)OsStatus, State->RecordNum, 0,
+                          State->FileSize);
+        }
+    }
+
+    CFE_PSP_GetTime(&WriteEndTime);
+    if (State->FileSize > WriteStartSize)
+    {
+        CFE_FS_UpdateWriteSpeed(State->FileSize - WriteStartSize, WriteStartTime, WriteEndTime);
+    }
+
     /* On normal EOF close the file and generate the complete event */
     if (IsEOF)
     {
         OS_close(State->Fd);
         State->Fd = OS_OBJECT_ID_UNDEFINED;
 
+        /* the average rate includes time spent waiting for credit */
+        Meta->BytesPerSecond = CFE_FS_BytesPerSecond(State->FileSize, State->StartTime, WriteEndTime);
+
         /* generate complete event */
         Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, State->RecordNum, 0, State->FileSize);
     }
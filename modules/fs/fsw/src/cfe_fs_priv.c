@@ -31,6 +31,7 @@
 ** Required header files
 */
 #include "cfe_fs_module_all.h"
+#include "cfe_fs_verify.h"
 
 #include <string.h>
 
@@ -101,3 +102,440 @@ void CFE_FS_UnlockSharedData(const char *FunctionName)
                              CFE_RESOURCEID_TO_ULONG(AppId), FunctionName);
     }
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_FS_PrioritizeBackgroundFileDumps(void)
+{
+    CFE_FS_BackgroundFileDumpState_t *Queue = &CFE_FS_Global.FileDump;
+    CFE_FS_BackgroundFileDumpEntry_t  Entry;
+    uint32                            Pos;
+
+    for (Pos = Queue->CompleteCount; Pos != Queue->RequestCount; ++Pos)
+    {
+        if (Queue->Entries[Pos & (CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1)].Meta->Priority !=
+            CFE_FS_FileWritePriority_AUTOMATIC)
+        {
+            break;
+        }
+    }
+
+    if (Pos == Queue->RequestCount)
+    {
+        /* Only automatic requests are waiting */
+        return;
+    }
+
+    /* Move it to the head, keeping the requests it passes in order */
+    Entry = Queue->Entries[Pos & (CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1)];
+    while (Pos != Queue->CompleteCount)
+    {
+        Queue->Entries[Pos & (CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1)] =
+            Queue->Entries[(Pos - 1) & (CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1)];
+        --Pos;
+    }
+    Queue->Entries[Pos & (CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1)] = Entry;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_FS_BackgroundCreditRate(CFE_FS_FileWritePriority_t Priority)
+{
+    uint64 Rate;
+    uint32 SharePercent;
+
+    if (Priority == CFE_FS_FileWritePriority_AUTOMATIC)
+    {
+        SharePercent = CFE_PLATFORM_FS_BACKGROUND_AUTO_IO_SHARE_PERCENT;
+    }
+    else
+    {
+        SharePercent = CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT;
+    }
+
+    if (CFE_FS_Global.FileDump.WriteBytesPerSecond == 0)
+    {
+        Rate = ((uint64)CFE_FS_BACKGROUND_CREDIT_PER_SECOND * SharePercent) /
+               CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT;
+    }
+    else
+    {
+        Rate = ((uint64)CFE_FS_Global.FileDump.WriteBytesPerSecond * SharePercent) / 100;
+    }
+
+    if (Rate < CFE_FS_BACKGROUND_MIN_CREDIT_PER_SECOND)
+    {
+        Rate = CFE_FS_BACKGROUND_MIN_CREDIT_PER_SECOND;
+    }
+    else if (Rate > CFE_FS_BACKGROUND_MAX_CREDIT_PER_SECOND)
+    {
+        Rate = CFE_FS_BACKGROUND_MAX_CREDIT_PER_SECOND;
+    }
+
+    return (uint32)Rate;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_FS_BytesPerSecond(size_t Bytes, OS_time_t Start, OS_time_t End)
+{
+    int64  Micros;
+    uint64 Rate;
+
+    /* Writes quicker than the clock resolution count as one microsecond */
+    Micros = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(End, Start));
+    if (Micros < 1)
+    {
+        Micros = 1;
+    }
+
+    Rate = ((uint64)Bytes * 1000000) / (uint64)Micros;
+    if (Rate > 0xFFFFFFFF)
+    {
+        Rate = 0xFFFFFFFF;
+    }
+
+    return (uint32)Rate;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_FS_UpdateWriteSpeed(size_t Bytes, OS_time_t Start, OS_time_t End)
+{
+    uint32 Sample;
+    uint32 Speed;
+
+    if (Bytes < CFE_FS_BACKGROUND_MIN_SPEED_SAMPLE)
+    {
+        return;
+    }
+
+    Sample = CFE_FS_BytesPerSecond(Bytes, Start, End);
+    Speed  = CFE_FS_Global.FileDump.WriteBytesPerSecond;
+
+    /* Smooth over a few passes, as each measures only a short burst of writes */
+    if (Speed == 0)
+    {
+        Speed = Sample;
+    }
+    else
+    {
+        Speed = Speed - (Speed / 4) + (Sample / 4);
+    }
+
+    CFE_FS_Global.FileDump.WriteBytesPerSecond = Speed;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_FS_CompressSequence(uint8 *Dst, size_t *DstPos, size_t DstLimit, const uint8 *Literals, size_t LiteralLen,
+                             size_t Offset, size_t MatchLen)
+{
+    size_t Pos;
+    size_t Token;
+    size_t Remain;
+
+    /*
+     * Worst case is the token, the literals with their length bytes,
+     * and the offset and match length bytes...
+     */
+    Pos = *DstPos;
+    if ((Pos + 1 + LiteralLen + (LiteralLen / 255) + 1 + 2 + (MatchLen / 255) + 1) > DstLimit)
+    {
+        return false;
+    }
+
+    Token = Pos++;
+    if (LiteralLen >= 15)
+    {
+        Dst[Token] = 0xF0;
+        for (Remain = LiteralLen - 15; Remain >= 255; Remain -= 255)
+        {
+            Dst[Pos++] = 255;
+        }
+        Dst[Pos++] = (uint8)Remain;
+    }
+    else
+    {
+        Dst[Token] = (uint8)(LiteralLen << 4);
+    }
+
+    memcpy(&Dst[Pos], Literals, LiteralLen);
+    Pos += LiteralLen;
+
+    /* The final literals of a block have no match */
+    if (MatchLen != 0)
+    {
+        Dst[Pos++] = (uint8)(Offset & 0xFF);
+        Dst[Pos++] = (uint8)(Offset >> 8);
+
+        if ((MatchLen - 4) >= 15)
+        {
+            Dst[Token] |= 0x0F;
+            for (Remain = MatchLen - 4 - 15; Remain >= 255; Remain -= 255)
+            {
+                Dst[Pos++] = 255;
+            }
+            Dst[Pos++] = (uint8)Remain;
+        }
+        else
+        {
+            Dst[Token] |= (uint8)(MatchLen - 4);
+        }
+    }
+
+    *DstPos = Pos;
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_FS_CompressBlock(CFE_FS_Compressor_t *Comp)
+{
+    const uint8 *Src     = Comp->Block;
+    size_t       SrcSize = Comp->BlockFill;
+    size_t       DstPos;
+    size_t       DstLimit;
+    size_t       Pos;
+    size_t       Anchor;
+    size_t       Ref;
+    size_t       MatchLen;
+    uint32       Hash;
+    bool         Fits;
+
+    DstPos   = CFE_FS_COMPRESS_BLOCK_HDR_SIZE;
+    DstLimit = CFE_FS_COMPRESS_BLOCK_HDR_SIZE + SrcSize - 1;
+    Anchor   = 0;
+    Fits     = true;
+
+    /*
+     * LZ4 requires the last match to start at least 12 bytes before the end
+     * of the block, and the last 5 bytes to be literals.  Hash table entries
+     * may be left over from earlier blocks, so every candidate is checked
+     * against the data before it is used...
+     */
+    if (SrcSize > 12)
+    {
+        Pos = 0;
+        while (Fits && Pos <= (SrcSize - 12))
+        {
+            Hash = ((uint32)Src[Pos] | ((uint32)Src[Pos + 1] << 8) | ((uint32)Src[Pos + 2] << 16) |
+                    ((uint32)Src[Pos + 3] << 24)) *
+                   2654435761U;
+            Hash >>= 32 - CFE_FS_COMPRESS_HASH_BITS;
+
+            Ref                   = Comp->HashTable[Hash];
+            Comp->HashTable[Hash] = (uint16)Pos;
+
+            if (Ref >= Pos || memcmp(&Src[Ref], &Src[Pos], 4) != 0)
+            {
+                ++Pos;
+                continue;
+            }
+
+            MatchLen = 4;
+            while ((Pos + MatchLen) < (SrcSize - 5) && Src[Ref + MatchLen] == Src[Pos + MatchLen])
+            {
+                ++MatchLen;
+            }
+
+            Fits = CFE_FS_CompressSequence(Comp->Coded, &DstPos, DstLimit, &Src[Anchor], Pos - Anchor, Pos - Ref,
+                                           MatchLen);
+
+            Pos += MatchLen;
+            Anchor = Pos;
+        }
+    }
+
+    if (Fits)
+    {
+        Fits = CFE_FS_CompressSequence(Comp->Coded, &DstPos, DstLimit, &Src[Anchor], SrcSize - Anchor, 0, 0);
+    }
+
+    /* Store the block as-is when coding does not make it smaller */
+    if (!Fits)
+    {
+        memcpy(&Comp->Coded[CFE_FS_COMPRESS_BLOCK_HDR_SIZE], Src, SrcSize);
+        DstPos = CFE_FS_COMPRESS_BLOCK_HDR_SIZE + SrcSize;
+    }
+
+    Comp->Coded[0] = (uint8)(SrcSize >> 8);
+    Comp->Coded[1] = (uint8)(SrcSize & 0xFF);
+    Comp->Coded[2] = (uint8)((DstPos - CFE_FS_COMPRESS_BLOCK_HDR_SIZE) >> 8);
+    Comp->Coded[3] = (uint8)((DstPos - CFE_FS_COMPRESS_BLOCK_HDR_SIZE) & 0xFF);
+
+    return DstPos;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_FS_WriteCompressedBlock(CFE_FS_CurrentFileState_t *State)
+{
+    int32  OsStatus;
+    size_t CodedSize;
+
+    if (State->Compressor.BlockFill == 0)
+    {
+        return OS_SUCCESS;
+    }
+
+    CodedSize                   = CFE_FS_CompressBlock(&State->Compressor);
+    State->Compressor.BlockFill = 0;
+    State->Credit -= CodedSize;
+
+    OsStatus = OS_write(State->Fd, State->Compressor.Coded, CodedSize);
+    if (OsStatus != CodedSize)
+    {
+        /* A short write is an error too */
+        if (OsStatus >= 0)
+        {
+            OsStatus = OS_ERROR;
+        }
+
+        return OsStatus;
+    }
+
+    State->FileSize += CodedSize;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_FS_WriteCompressed(CFE_FS_CurrentFileState_t *State, const void *Data, size_t Size)
+{
+    const uint8 *DataPtr = Data;
+    size_t       Chunk;
+    int32        OsStatus;
+
+    OsStatus = OS_SUCCESS;
+    while (OsStatus == OS_SUCCESS && Size > 0)
+    {
+        Chunk = CFE_FS_COMPRESS_BLOCK_SIZE - State->Compressor.BlockFill;
+        if (Chunk > Size)
+        {
+            Chunk = Size;
+        }
+
+        memcpy(&State->Compressor.Block[State->Compressor.BlockFill], DataPtr, Chunk);
+        State->Compressor.BlockFill += Chunk;
+        DataPtr += Chunk;
+        Size -= Chunk;
+
+        if (State->Compressor.BlockFill == CFE_FS_COMPRESS_BLOCK_SIZE)
+        {
+            OsStatus = CFE_FS_WriteCompressedBlock(State);
+        }
+    }
+
+    return OsStatus;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_FS_AppendPathComponent(char *OutputBuffer, size_t OutputBufSize, size_t *OutputLen, const char *Component,
+                                size_t ComponentLen, char Collapse)
+{
+    const char *EndPtr;
+    size_t      Room;
+    bool        Fits;
+
+    /* A NUL char ends the component early */
+    EndPtr = memchr(Component, 0, ComponentLen);
+    if (EndPtr != NULL)
+    {
+        ComponentLen = EndPtr - Component;
+    }
+
+    /* The last char of the buffer is always kept for the terminator */
+    Room = OutputBufSize - 1 - *OutputLen;
+    Fits = true;
+
+    if (Collapse == 0)
+    {
+        if (ComponentLen > Room)
+        {
+            ComponentLen = Room;
+            Fits         = false;
+        }
+
+        memcpy(&OutputBuffer[*OutputLen], Component, ComponentLen);
+        *OutputLen += ComponentLen;
+    }
+    else
+    {
+        while (ComponentLen > 0)
+        {
+            if (*Component != Collapse || *OutputLen == 0 || OutputBuffer[*OutputLen - 1] != Collapse)
+            {
+                if (Room == 0)
+                {
+                    Fits = false;
+                    break;
+                }
+
+                OutputBuffer[*OutputLen] = *Component;
+                ++(*OutputLen);
+                --Room;
+            }
+
+            ++Component;
+            --ComponentLen;
+        }
+    }
+
+    return Fits;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_FS_AppendPathSeparator(char *OutputBuffer, size_t OutputBufSize, size_t *OutputLen, char Separator)
+{
+    /* Remove duplicate separators that may have been in the input */
+    while (*OutputLen > 0 && OutputBuffer[*OutputLen - 1] == Separator)
+    {
+        --(*OutputLen);
+    }
+
+    return CFE_FS_AppendPathComponent(OutputBuffer, OutputBufSize, OutputLen, &Separator, 1, 0);
+}
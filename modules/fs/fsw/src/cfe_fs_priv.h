@@ -36,6 +36,7 @@
 #include "common_types.h"
 #include "cfe_fs_api_typedefs.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_fs_internal_cfg.h"
 
 /*
 ** Macro Definitions
@@ -55,22 +56,54 @@
  * controls the amount of "credit" (bytes that can be written) per second
  * of elapsed time.
  *
- * This permits a file writing rate of up to 10kbytes/sec.
+ * This is the rate for ground requested files until the writer has measured
+ * how fast files are written, after which the rate adapts to the measured speed.
+ * The adapted rate is CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT of that speed,
+ * or the smaller CFE_PLATFORM_FS_BACKGROUND_AUTO_IO_SHARE_PERCENT for automatic
+ * requests, so they stall other writers less.
+ *
+ * Credit accumulates while no writes are in progress, but only up to one
+ * second's worth at the current rate.  Without this limit, after a long period
+ * of inactivity a large credit would essentially bypass the rate limiting for
+ * the next file write command(s) once they are issued.
  */
 #define CFE_FS_BACKGROUND_CREDIT_PER_SECOND 10000
 
 /*
- * Maximum credit that the background write task can accumulate
+ * Limits of the adapted credit rate
  *
- * The background file writer will limit the total bytes written over time, and
- * will accumulate credit against this limit while no writes are in progress.
- * This is an upper cap on the amount of credit that can be accumulated.
+ * The slowest rate keeps files moving on a heavily loaded file system, and
+ * the fastest bounds the burst after a very fast write was measured.
+ */
+#define CFE_FS_BACKGROUND_MIN_CREDIT_PER_SECOND 1000
+#define CFE_FS_BACKGROUND_MAX_CREDIT_PER_SECOND 16000000
+
+/*
+ * Least number of bytes written in one pass to measure the write speed from
  *
- * Without this limit, after a long period of inactivity without any file
- * writes, a large credit would essentially bypass the rate limiting for
- * the next file write command(s) once they are issued.
+ * Smaller writes take too little time to measure reliably.
+ */
+#define CFE_FS_BACKGROUND_MIN_SPEED_SAMPLE 512
+
+/*
+ * Size of the blocks in which background file dumps are compressed
+ *
+ * Each block is compressed on its own, which bounds the memory used by the
+ * compressor.  Matches cannot reach back past the start of a block, so larger
+ * blocks compress the repeated records of a dump better.  Block sizes are
+ * stored in 16 bits, so this must not exceed 65535.
+ */
+#define CFE_FS_COMPRESS_BLOCK_SIZE 8192
+
+/*
+ * Number of bits in the hash of the compressor match finder
+ */
+#define CFE_FS_COMPRESS_HASH_BITS 12
+
+/*
+ * Size of the sizes stored at the start of each compressed block
  */
-#define CFE_FS_BACKGROUND_MAX_CREDIT 10000
+#define CFE_FS_COMPRESS_BLOCK_HDR_SIZE 4
 
 /*
 ** Type Definitions
@@ -88,12 +121,30 @@ typedef struct
     CFE_FS_FileWriteMetaData_t *Meta;
 } CFE_FS_BackgroundFileDumpEntry_t;
 
+/*
+ * Compressor state for the current file write
+ *
+ * Records are gathered into a block, which is compressed and written
+ * out when it fills and at the end of the file.
+ */
+typedef struct
+{
+    size_t BlockFill;                                                          /**< Bytes waiting in Block */
+    uint16 HashTable[1 << CFE_FS_COMPRESS_HASH_BITS];                          /**< Last position of each hash */
+    uint8  Block[CFE_FS_COMPRESS_BLOCK_SIZE];                                  /**< Data waiting to be compressed */
+    uint8  Coded[CFE_FS_COMPRESS_BLOCK_HDR_SIZE + CFE_FS_COMPRESS_BLOCK_SIZE]; /**< Block as written to file */
+} CFE_FS_Compressor_t;
+
 typedef struct
 {
     osal_id_t Fd;
     int32     Credit;
     uint32    RecordNum;
     size_t    FileSize;
+    bool      Compress;
+    OS_time_t StartTime;
+
+    CFE_FS_Compressor_t Compressor;
 } CFE_FS_CurrentFileState_t;
 
 /*---------------------------------------------------------------------------------------*/
@@ -113,6 +164,11 @@ typedef struct
     uint32 RequestCount;  /**< Total Number of background file writes requested */
     uint32 CompleteCount; /**< Total Number of background file writes completed */
 
+    /**
+     * Smoothed measured write speed in bytes per second, 0 until first measured
+     */
+    uint32 WriteBytesPerSecond;
+
     /**
      * Data related to each background file write request
      */
@@ -176,4 +232,135 @@ void CFE_FS_ByteSwapCFEHeader(CFE_FS_Header_t *Hdr);
  */
 void CFE_FS_ByteSwapUint32(uint32 *Uint32ToSwapPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Moves the oldest ground request to the head of the background file dump queue
+ *
+ * Must be called with the shared data locked, and only when the file at the
+ * head of the queue has not been started.
+ */
+void CFE_FS_PrioritizeBackgroundFileDumps(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Gets the background file credit rate for a request priority
+ *
+ * @param Priority The priority of the request being written
+ *
+ * @returns Credit per second of elapsed time
+ */
+uint32 CFE_FS_BackgroundCreditRate(CFE_FS_FileWritePriority_t Priority);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Computes the rate bytes were written at between two times
+ *
+ * @param Bytes The number of bytes written
+ * @param Start Time the writes started
+ * @param End   Time the writes ended
+ *
+ * @returns Bytes per second, saturated at the largest uint32 value
+ */
+uint32 CFE_FS_BytesPerSecond(size_t Bytes, OS_time_t Start, OS_time_t End);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Folds a measurement of the write speed into the smoothed write speed
+ *
+ * Measurements of fewer than #CFE_FS_BACKGROUND_MIN_SPEED_SAMPLE bytes are ignored.
+ *
+ * @param Bytes The number of bytes written
+ * @param Start Time the writes started
+ * @param End   Time the writes ended
+ */
+void CFE_FS_UpdateWriteSpeed(size_t Bytes, OS_time_t Start, OS_time_t End);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Compresses the data waiting in the compressor block
+ *
+ * Codes the block as an LZ4 block, or stores it as-is if that would not
+ * make it smaller, preceded by the block sizes.
+ *
+ * @param Comp The compressor state
+ *
+ * @returns Size of the coded block, including the block sizes
+ */
+size_t CFE_FS_CompressBlock(CFE_FS_Compressor_t *Comp);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Codes one sequence of literals followed by a match into a compressed block
+ *
+ * @param Dst        Buffer holding the coded block
+ * @param DstPos     Position in Dst to code at, updated past the sequence
+ * @param DstLimit   Position in Dst the sequence must not go past
+ * @param Literals   Literal bytes of the sequence
+ * @param LiteralLen Number of literal bytes
+ * @param Offset     Distance back to the match
+ * @param MatchLen   Length of the match, or 0 for the final literals of the block
+ *
+ * @returns true if the sequence fit within DstLimit, false otherwise
+ */
+bool CFE_FS_CompressSequence(uint8 *Dst, size_t *DstPos, size_t DstLimit, const uint8 *Literals, size_t LiteralLen,
+                             size_t Offset, size_t MatchLen);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a record to the current compressed file
+ *
+ * Each block that fills is compressed and written to the file,
+ * charging its written size against the write credit.
+ *
+ * @param State The current file state
+ * @param Data  The record data
+ * @param Size  The record size
+ *
+ * @returns OS_SUCCESS, or the status of the write that failed
+ */
+int32 CFE_FS_WriteCompressed(CFE_FS_CurrentFileState_t *State, const void *Data, size_t Size);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Compresses and writes the data waiting in the compressor block, if any
+ *
+ * @param State The current file state
+ *
+ * @returns OS_SUCCESS, or the status of the write that failed
+ */
+int32 CFE_FS_WriteCompressedBlock(CFE_FS_CurrentFileState_t *State);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Appends part of a file name to an output buffer
+ *
+ * The output always keeps room for a terminating NUL char, which the caller
+ * adds once the name is complete.  Copying stops early at a NUL char in the
+ * component.
+ *
+ * @param OutputBuffer  Buffer holding the name being built
+ * @param OutputBufSize Size of the output buffer
+ * @param OutputLen     Length of the name so far, updated for the appended chars
+ * @param Component     The chars to append
+ * @param ComponentLen  Maximum number of chars to append
+ * @param Collapse      Char that is dropped when it repeats, or 0 to copy all chars
+ *
+ * @returns true if the component fit, false if the output buffer is full
+ */
+bool CFE_FS_AppendPathComponent(char *OutputBuffer, size_t OutputBufSize, size_t *OutputLen, const char *Component,
+                                size_t ComponentLen, char Collapse);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Appends a separator char to an output buffer, replacing any already at its end
+ *
+ * @param OutputBuffer  Buffer holding the name being built
+ * @param OutputBufSize Size of the output buffer
+ * @param OutputLen     Length of the name so far, updated for the separator
+ * @param Separator     The separator char
+ *
+ * @returns true if the separator fit, false if the output buffer is full
+ */
+bool CFE_FS_AppendPathSeparator(char *OutputBuffer, size_t OutputBufSize, size_t *OutputLen, char Separator);
+
 #endif /* CFE_FS_PRIV_H */
@@ -0,0 +1,44 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose:  cFE File Services (FS) configuration verification
+ *
+ * Notes:
+ *
+ */
+
+#ifndef CFE_FS_VERIFY_H
+#define CFE_FS_VERIFY_H
+
+#include "cfe_fs_internal_cfg.h"
+
+/*
+** Validate background file write I/O shares
+*/
+#if CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT < 1 || CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT > 100
+#error CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT must be between 1 and 100
+#endif
+#if CFE_PLATFORM_FS_BACKGROUND_AUTO_IO_SHARE_PERCENT < 1 || \
+    CFE_PLATFORM_FS_BACKGROUND_AUTO_IO_SHARE_PERCENT > CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT
+#error CFE_PLATFORM_FS_BACKGROUND_AUTO_IO_SHARE_PERCENT must be between 1 and CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT
+#endif
+
+#endif /* CFE_FS_VERIFY_H */
@@ -31,3 +31,6 @@ foreach(FS_CFGFILE ${FS_MISSION_CONFIG_FILE_LIST})
     ${DEFAULT_SOURCE}
   )
 endforeach()
+
+# Host tool to expand compressed background file dumps
+add_subdirectory(${CMAKE_CURRENT_LIST_DIR}/tools fs-tools)
@@ -0,0 +1,269 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Host tool to expand compressed cFE background file dumps
+ *
+ * Reads a file written with CFE_FS_FileWriteMetaData_t::Compress set and
+ * writes the equivalent uncompressed file, with the compressed flag cleared
+ * from the header SubType, so existing ground tools can read it.
+ *
+ * This is built for the host and deliberately does not depend on any
+ * flight software headers, so the format constants are repeated here.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Values from cfe_fs_api_typedefs.h and the FS header definition */
+#define CFE_FS_FILE_CONTENT_ID    0x63464531 /* 'cFE1' */
+#define CFE_FS_SUBTYPE_COMPRESSED 0x80000000
+
+/* Offsets of the FS header fields used here, all big-endian uint32 */
+#define CFE_FS_HDR_CONTENT_TYPE_OFFSET 0
+#define CFE_FS_HDR_SUBTYPE_OFFSET      4
+#define CFE_FS_HDR_LENGTH_OFFSET       8
+#define CFE_FS_HDR_MIN_LENGTH          32
+#define CFE_FS_HDR_MAX_LENGTH          1024
+
+#define CFE_FS_BLOCK_HDR_SIZE 4
+#define CFE_FS_MAX_BLOCK_SIZE 65535
+
+static uint32_t GetBigEndian32(const uint8_t *Ptr)
+{
+    return ((uint32_t)Ptr[0] << 24) | ((uint32_t)Ptr[1] << 16) | ((uint32_t)Ptr[2] << 8) | (uint32_t)Ptr[3];
+}
+
+static void PutBigEndian32(uint8_t *Ptr, uint32_t Value)
+{
+    Ptr[0] = (uint8_t)(Value >> 24);
+    Ptr[1] = (uint8_t)(Value >> 16);
+    Ptr[2] = (uint8_t)(Value >> 8);
+    Ptr[3] = (uint8_t)Value;
+}
+
+/*
+ * Reads the extra length bytes that follow a token nibble of 15
+ *
+ * Returns 0 on success, -1 if the data runs out
+ */
+static int ReadLength(const uint8_t *Src, size_t SrcSize, size_t *SrcPos, size_t *Length)
+{
+    uint8_t Byte;
+
+    do
+    {
+        if (*SrcPos >= SrcSize)
+        {
+            return -1;
+        }
+        Byte = Src[(*SrcPos)++];
+        *Length += Byte;
+    } while (Byte == 255);
+
+    return 0;
+}
+
+/*
+ * Expands one LZ4 block
+ *
+ * Returns 0 if the block expanded to exactly DstSize bytes, -1 otherwise
+ */
+static int DecodeBlock(const uint8_t *Src, size_t SrcSize, uint8_t *Dst, size_t DstSize)
+{
+    size_t  SrcPos = 0;
+    size_t  DstPos = 0;
+    size_t  Length;
+    size_t  Offset;
+    uint8_t Token;
+
+    while (SrcPos < SrcSize)
+    {
+        Token = Src[SrcPos++];
+
+        /* Literals */
+        Length = Token >> 4;
+        if (Length == 15 && ReadLength(Src, SrcSize, &SrcPos, &Length) != 0)
+        {
+            return -1;
+        }
+        if (Length > (SrcSize - SrcPos) || Length > (DstSize - DstPos))
+        {
+            return -1;
+        }
+        memcpy(&Dst[DstPos], &Src[SrcPos], Length);
+        SrcPos += Length;
+        DstPos += Length;
+
+        /* The last sequence has no match */
+        if (SrcPos == SrcSize)
+        {
+            break;
+        }
+
+        /* Match */
+        if ((SrcSize - SrcPos) < 2)
+        {
+            return -1;
+        }
+        Offset = (size_t)Src[SrcPos] | ((size_t)Src[SrcPos + 1] << 8);
+        SrcPos += 2;
+
+        Length = Token & 0x0F;
+        if (Length == 15 && ReadLength(Src, SrcSize, &SrcPos, &Length) != 0)
+        {
+            return -1;
+        }
+        Length += 4;
+
+        if (Offset == 0 || Offset > DstPos || Length > (DstSize - DstPos))
+        {
+            return -1;
+        }
+
+        /* Matches may overlap the bytes they produce, so copy a byte at a time */
+        while (Length > 0)
+        {
+            Dst[DstPos] = Dst[DstPos - Offset];
+            ++DstPos;
+            --Length;
+        }
+    }
+
+    return (DstPos == DstSize) ? 0 : -1;
+}
+
+static int Expand(FILE *In, FILE *Out)
+{
+    static uint8_t Coded[CFE_FS_MAX_BLOCK_SIZE];
+    static uint8_t Block[CFE_FS_MAX_BLOCK_SIZE];
+    uint8_t        Header[CFE_FS_HDR_MAX_LENGTH];
+    uint8_t        BlockHdr[CFE_FS_BLOCK_HDR_SIZE];
+    uint32_t       HeaderLength;
+    uint32_t       SubType;
+    size_t         RawSize;
+    size_t         CodedSize;
+    size_t         ReadSize;
+    unsigned long  BlockNum;
+
+    if (fread(Header, 1, CFE_FS_HDR_MIN_LENGTH, In) != CFE_FS_HDR_MIN_LENGTH ||
+        GetBigEndian32(&Header[CFE_FS_HDR_CONTENT_TYPE_OFFSET]) != CFE_FS_FILE_CONTENT_ID)
+    {
+        fprintf(stderr, "Not a cFE file\n");
+        return -1;
+    }
+
+    HeaderLength = GetBigEndian32(&Header[CFE_FS_HDR_LENGTH_OFFSET]);
+    if (HeaderLength < CFE_FS_HDR_MIN_LENGTH || HeaderLength > CFE_FS_HDR_MAX_LENGTH ||
+        fread(&Header[CFE_FS_HDR_MIN_LENGTH], 1, HeaderLength - CFE_FS_HDR_MIN_LENGTH, In) !=
+            (HeaderLength - CFE_FS_HDR_MIN_LENGTH))
+    {
+        fprintf(stderr, "Bad cFE file header length %lu\n", (unsigned long)HeaderLength);
+        return -1;
+    }
+
+    SubType = GetBigEndian32(&Header[CFE_FS_HDR_SUBTYPE_OFFSET]);
+    if ((SubType & CFE_FS_SUBTYPE_COMPRESSED) == 0)
+    {
+        fprintf(stderr, "File is not compressed\n");
+        return -1;
+    }
+
+    PutBigEndian32(&Header[CFE_FS_HDR_SUBTYPE_OFFSET], SubType & ~(uint32_t)CFE_FS_SUBTYPE_COMPRESSED);
+    if (fwrite(Header, 1, HeaderLength, Out) != HeaderLength)
+    {
+        perror("fwrite");
+        return -1;
+    }
+
+    BlockNum = 0;
+    while ((ReadSize = fread(BlockHdr, 1, sizeof(BlockHdr), In)) != 0)
+    {
+        RawSize   = ((size_t)BlockHdr[0] << 8) | BlockHdr[1];
+        CodedSize = ((size_t)BlockHdr[2] << 8) | BlockHdr[3];
+
+        if (ReadSize != sizeof(BlockHdr) || fread(Coded, 1, CodedSize, In) != CodedSize)
+        {
+            fprintf(stderr, "File truncated in block %lu\n", BlockNum);
+            return -1;
+        }
+
+        if (CodedSize == RawSize)
+        {
+            memcpy(Block, Coded, RawSize);
+        }
+        else if (CodedSize > RawSize || DecodeBlock(Coded, CodedSize, Block, RawSize) != 0)
+        {
+            fprintf(stderr, "Corrupt block %lu\n", BlockNum);
+            return -1;
+        }
+
+        if (fwrite(Block, 1, RawSize, Out) != RawSize)
+        {
+            perror("fwrite");
+            return -1;
+        }
+
+        ++BlockNum;
+    }
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *In;
+    FILE *Out;
+    int   Status;
+
+    if (argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <compressed file> <output file>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    In = fopen(argv[1], "rb");
+    if (In == NULL)
+    {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    Out = fopen(argv[2], "wb");
+    if (Out == NULL)
+    {
+        perror(argv[2]);
+        fclose(In);
+        return EXIT_FAILURE;
+    }
+
+    Status = Expand(In, Out);
+
+    fclose(In);
+    if (fclose(Out) != 0)
+    {
+        perror(argv[2]);
+        Status = -1;
+    }
+
+    return (Status == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -78,11 +78,14 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_FS_DefaultFileStrings);
     UT_ADD_TEST(Test_CFE_FS_ByteSwapCFEHeader);
     UT_ADD_TEST(Test_CFE_FS_ByteSwapUint32);
+    UT_ADD_TEST(Test_CFE_FS_GetPathView);
     UT_ADD_TEST(Test_CFE_FS_ParseInputFileNameEx);
     UT_ADD_TEST(Test_CFE_FS_ExtractFileNameFromPath);
     UT_ADD_TEST(Test_CFE_FS_Private);
 
     UT_ADD_TEST(Test_CFE_FS_BackgroundFileDump);
+    UT_ADD_TEST(Test_CFE_FS_BackgroundFileDumpCompressed);
+    UT_ADD_TEST(Test_CFE_FS_BackgroundFileDumpScheduling);
 }
 
 /*
@@ -233,6 +236,54 @@ void Test_CFE_FS_ByteSwapUint32(void)
     UtAssert_UINT32_EQ(test, 0x44332211);
 }
 
+/*
+** Test CFE_FS_GetPathView function
+*/
+void Test_CFE_FS_GetPathView(void)
+{
+    /*
+     * Test case for:
+     * CFE_Status_t CFE_FS_GetPathView(CFE_FS_PathView_t *View, const char *InputBuffer, size_t InputBufSize)
+     */
+    const char        TEST_INPUT_FULLY_QUALIFIED[] = "/path/to/file..tar.gz";
+    CFE_FS_PathView_t View;
+
+    /* nominal, view references the input in place */
+    CFE_UtAssert_SUCCESS(CFE_FS_GetPathView(&View, TEST_INPUT_FULLY_QUALIFIED, sizeof(TEST_INPUT_FULLY_QUALIFIED)));
+    UtAssert_ADDRESS_EQ(View.Path, TEST_INPUT_FULLY_QUALIFIED);
+    UtAssert_UINT32_EQ(View.PathLen, 9);
+    UtAssert_ADDRESS_EQ(View.Name, &TEST_INPUT_FULLY_QUALIFIED[9]);
+    UtAssert_UINT32_EQ(View.NameLen, 4);
+    UtAssert_ADDRESS_EQ(View.Extension, &TEST_INPUT_FULLY_QUALIFIED[15]);
+    UtAssert_UINT32_EQ(View.ExtensionLen, 6);
+
+    /* a '.' in the path does not start the extension */
+    CFE_UtAssert_SUCCESS(CFE_FS_GetPathView(&View, "/a.b/file", 10));
+    UtAssert_UINT32_EQ(View.PathLen, 5);
+    UtAssert_UINT32_EQ(View.NameLen, 4);
+    UtAssert_NULL(View.Extension);
+    UtAssert_UINT32_EQ(View.ExtensionLen, 0);
+
+    /* no path, and parsing stops at the size limit */
+    CFE_UtAssert_SUCCESS(CFE_FS_GetPathView(&View, "file.log", 6));
+    UtAssert_NULL(View.Path);
+    UtAssert_UINT32_EQ(View.PathLen, 0);
+    UtAssert_UINT32_EQ(View.NameLen, 4);
+    UtAssert_UINT32_EQ(View.ExtensionLen, 1);
+
+    /* empty file name */
+    UtAssert_INT32_EQ(CFE_FS_GetPathView(&View, "/path/", 10), CFE_FS_INVALID_PATH);
+    UtAssert_UINT32_EQ(View.PathLen, 6);
+    UtAssert_UINT32_EQ(View.NameLen, 0);
+    UtAssert_INT32_EQ(CFE_FS_GetPathView(&View, ".log", 5), CFE_FS_INVALID_PATH);
+    UtAssert_UINT32_EQ(View.ExtensionLen, 3);
+    UtAssert_INT32_EQ(CFE_FS_GetPathView(&View, "file", 0), CFE_FS_INVALID_PATH);
+
+    /* Bad arguments */
+    UtAssert_INT32_EQ(CFE_FS_GetPathView(NULL, "file", 5), CFE_FS_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_FS_GetPathView(&View, NULL, 5), CFE_FS_BAD_ARGUMENT);
+}
+
 /*
 ** Test CFE_FS_ParseInputFileNameEx function
 */
@@ -369,6 +420,13 @@ void Test_CFE_FS_ParseInputFileNameEx(void)
     UtAssert_INT32_EQ(OutBuffer[0], 0);
     UtAssert_INT32_EQ(OutBuffer[1], 0x7F);
 
+    /* test case for where the path from the input does not fit */
+    memset(OutBuffer, 0x7F, sizeof(OutBuffer));
+    UtAssert_INT32_EQ(CFE_FS_ParseInputFileNameEx(OutBuffer, TEST_XTRA_SEPARATOR_PATH, 5,
+                                                  sizeof(TEST_XTRA_SEPARATOR_PATH), NULL, NULL, NULL),
+                      CFE_FS_FNAME_TOO_LONG);
+    UtAssert_StrCmp(OutBuffer, "/xtr", "Path too long -> %s", OutBuffer);
+
     /* test case for where input is not terminated */
     /* Test w/input truncated via size argument (not null char) */
     UtAssert_INT32_EQ(CFE_FS_ParseInputFileNameEx(OutBuffer, TEST_INPUT_FULLY_QUALIFIED, sizeof(OutBuffer),
@@ -532,10 +590,10 @@ void Test_CFE_FS_BackgroundFileDump(void)
     /* Nominal with nothing pending - should accumulate credit */
     UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(1, NULL));
     UtAssert_INT32_GTEQ(CFE_FS_Global.FileDump.Current.Credit, 1);
-    UtAssert_INT32_LTEQ(CFE_FS_Global.FileDump.Current.Credit, CFE_FS_BACKGROUND_MAX_CREDIT);
+    UtAssert_INT32_LTEQ(CFE_FS_Global.FileDump.Current.Credit, CFE_FS_BACKGROUND_CREDIT_PER_SECOND);
 
     UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100000, NULL));
-    UtAssert_INT32_EQ(CFE_FS_Global.FileDump.Current.Credit, CFE_FS_BACKGROUND_MAX_CREDIT);
+    UtAssert_INT32_EQ(CFE_FS_Global.FileDump.Current.Credit, CFE_FS_BACKGROUND_CREDIT_PER_SECOND);
 
     UtAssert_INT32_EQ(CFE_FS_BackgroundFileDumpRequest(NULL), CFE_FS_BAD_ARGUMENT);
 
@@ -654,3 +712,240 @@ void Test_CFE_FS_BackgroundFileDump(void)
     UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true); /* avoid infinite loop */
     UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
 }
+
+void Test_CFE_FS_BackgroundFileDumpCompressed(void)
+{
+    /*
+     * Test routines for:
+     * size_t CFE_FS_CompressBlock(CFE_FS_Compressor_t *Comp)
+     * bool CFE_FS_CompressSequence(uint8 *Dst, size_t *DstPos, size_t DstLimit, const uint8 *Literals,
+     *                              size_t LiteralLen, size_t Offset, size_t MatchLen)
+     * int32 CFE_FS_WriteCompressed(CFE_FS_CurrentFileState_t *State, const void *Data, size_t Size)
+     * int32 CFE_FS_WriteCompressedBlock(CFE_FS_CurrentFileState_t *State)
+     */
+    CFE_FS_FileWriteMetaData_t State;
+    CFE_FS_Compressor_t *      Comp;
+    uint32                     MyBuffer[2];
+    uint8                      Literals[300];
+    uint8                      Coded[320];
+    size_t                     DstPos;
+
+    memset(UT_FS_FileWriteEventCount, 0, sizeof(UT_FS_FileWriteEventCount));
+    memset(&State, 0, sizeof(State));
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+    memset(Literals, 0xA5, sizeof(Literals));
+    Comp = &CFE_FS_Global.FileDump.Current.Compressor;
+
+    /* A run of zeros codes as one literal, a long match and the final literals */
+    memset(Comp->Block, 0, 1000);
+    Comp->BlockFill = 1000;
+    UtAssert_UINT32_EQ(CFE_FS_CompressBlock(Comp), CFE_FS_COMPRESS_BLOCK_HDR_SIZE + 14);
+    UtAssert_UINT32_EQ(Comp->Coded[0], 0x03);
+    UtAssert_UINT32_EQ(Comp->Coded[1], 0xE8);
+    UtAssert_UINT32_EQ(Comp->Coded[2], 0x00);
+    UtAssert_UINT32_EQ(Comp->Coded[3], 14);
+    UtAssert_UINT32_EQ(Comp->Coded[4], 0x1F);
+    UtAssert_UINT32_EQ(Comp->Coded[6], 0x01);
+    UtAssert_UINT32_EQ(Comp->Coded[11], 210);
+    UtAssert_UINT32_EQ(Comp->Coded[12], 0x50);
+
+    /* A block too small to shrink is stored as-is */
+    memcpy(Comp->Block, "cFE", 3);
+    Comp->BlockFill = 3;
+    UtAssert_UINT32_EQ(CFE_FS_CompressBlock(Comp), CFE_FS_COMPRESS_BLOCK_HDR_SIZE + 3);
+    UtAssert_UINT32_EQ(Comp->Coded[1], 3);
+    UtAssert_UINT32_EQ(Comp->Coded[3], 3);
+    UtAssert_MemCmp(&Comp->Coded[CFE_FS_COMPRESS_BLOCK_HDR_SIZE], "cFE", 3, "Stored block");
+
+    /* Long literal and match lengths carry extra length bytes */
+    DstPos = 0;
+    UtAssert_BOOL_TRUE(CFE_FS_CompressSequence(Coded, &DstPos, sizeof(Coded), Literals, 300, 0x1234, 300));
+    UtAssert_UINT32_EQ(DstPos, 1 + 2 + 300 + 2 + 2);
+    UtAssert_UINT32_EQ(Coded[0], 0xFF);
+    UtAssert_UINT32_EQ(Coded[1], 255);
+    UtAssert_UINT32_EQ(Coded[2], 30);
+    UtAssert_UINT32_EQ(Coded[303], 0x34);
+    UtAssert_UINT32_EQ(Coded[304], 0x12);
+    UtAssert_UINT32_EQ(Coded[305], 255);
+    UtAssert_UINT32_EQ(Coded[306], 26);
+
+    /* A sequence that does not fit is not coded */
+    DstPos = 0;
+    UtAssert_BOOL_FALSE(CFE_FS_CompressSequence(Coded, &DstPos, 300, Literals, 300, 0, 0));
+    UtAssert_ZERO(DstPos);
+
+    /* Nothing to write */
+    UT_InitData();
+    Comp->BlockFill = 0;
+    CFE_UtAssert_SUCCESS(CFE_FS_WriteCompressedBlock(&CFE_FS_Global.FileDump.Current));
+    UtAssert_STUB_COUNT(OS_write, 0);
+
+    /* A short write is an error */
+    Comp->BlockFill = 3;
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 1);
+    UtAssert_INT32_EQ(CFE_FS_WriteCompressedBlock(&CFE_FS_Global.FileDump.Current), OS_ERROR);
+    UtAssert_ZERO(Comp->BlockFill);
+
+    /* Nominal compressed dump, one full block and one partial block at EOF */
+    UT_InitData();
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+    State.FileSubType = 2;
+    State.GetData     = UT_FS_DataGetter;
+    State.OnEvent     = UT_FS_OnEvent;
+    State.Compress    = true;
+    strncpy(State.FileName, "/ram/UT.bin", sizeof(State.FileName));
+    strncpy(State.Description, "UT", sizeof(State.Description));
+
+    MyBuffer[0] = 10;
+    MyBuffer[1] = 20;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2000, true);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100000, NULL));
+    UtAssert_STUB_COUNT(OS_write, 3);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+    UtAssert_UINT32_LT(CFE_FS_Global.FileDump.Current.FileSize, sizeof(CFE_FS_Header_t) + 2000 * sizeof(MyBuffer));
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+
+    /* Error writing a full block */
+    UT_InitData();
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100000, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 1);
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+
+    /* Error writing the final partial block */
+    UT_InitData();
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 3, true);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100000, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 2);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+}
+
+void Test_CFE_FS_BackgroundFileDumpScheduling(void)
+{
+    /*
+     * Test routines for:
+     * void CFE_FS_PrioritizeBackgroundFileDumps(void)
+     * uint32 CFE_FS_BackgroundCreditRate(CFE_FS_FileWritePriority_t Priority)
+     * uint32 CFE_FS_BytesPerSecond(size_t Bytes, OS_time_t Start, OS_time_t End)
+     * void CFE_FS_UpdateWriteSpeed(size_t Bytes, OS_time_t Start, OS_time_t End)
+     */
+    CFE_FS_FileWriteMetaData_t Ground;
+    CFE_FS_FileWriteMetaData_t Auto1;
+    CFE_FS_FileWriteMetaData_t Auto2;
+    CFE_FS_BackgroundFileDumpEntry_t *Entries;
+    OS_time_t                  Start;
+    OS_time_t                  Times[3];
+    uint32                     MyBuffer[2];
+
+    memset(UT_FS_FileWriteEventCount, 0, sizeof(UT_FS_FileWriteEventCount));
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+    memset(&Ground, 0, sizeof(Ground));
+    Entries = CFE_FS_Global.FileDump.Entries;
+    Start   = OS_TimeAssembleFromMilliseconds(10, 0);
+
+    /* Credit rate before the write speed is measured */
+    UtAssert_UINT32_EQ(CFE_FS_BackgroundCreditRate(CFE_FS_FileWritePriority_GROUND),
+                       CFE_FS_BACKGROUND_CREDIT_PER_SECOND);
+    UtAssert_UINT32_EQ(CFE_FS_BackgroundCreditRate(CFE_FS_FileWritePriority_AUTOMATIC),
+                       (CFE_FS_BACKGROUND_CREDIT_PER_SECOND * CFE_PLATFORM_FS_BACKGROUND_AUTO_IO_SHARE_PERCENT) /
+                           CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT);
+
+    /* Credit rate follows the measured write speed, within limits */
+    CFE_FS_Global.FileDump.WriteBytesPerSecond = 1000000;
+    UtAssert_UINT32_EQ(CFE_FS_BackgroundCreditRate(CFE_FS_FileWritePriority_GROUND),
+                       10000 * CFE_PLATFORM_FS_BACKGROUND_IO_SHARE_PERCENT);
+    UtAssert_UINT32_EQ(CFE_FS_BackgroundCreditRate(CFE_FS_FileWritePriority_AUTOMATIC),
+                       10000 * CFE_PLATFORM_FS_BACKGROUND_AUTO_IO_SHARE_PERCENT);
+    CFE_FS_Global.FileDump.WriteBytesPerSecond = 100;
+    UtAssert_UINT32_EQ(CFE_FS_BackgroundCreditRate(CFE_FS_FileWritePriority_GROUND),
+                       CFE_FS_BACKGROUND_MIN_CREDIT_PER_SECOND);
+    CFE_FS_Global.FileDump.WriteBytesPerSecond = 0xFFFFFFFF;
+    UtAssert_UINT32_EQ(CFE_FS_BackgroundCreditRate(CFE_FS_FileWritePriority_GROUND),
+                       CFE_FS_BACKGROUND_MAX_CREDIT_PER_SECOND);
+
+    /* Write rates */
+    UtAssert_UINT32_EQ(CFE_FS_BytesPerSecond(1000, Start, OS_TimeAssembleFromMilliseconds(12, 0)), 500);
+    UtAssert_UINT32_EQ(CFE_FS_BytesPerSecond(1000, Start, Start), 1000000000);
+    UtAssert_UINT32_EQ(CFE_FS_BytesPerSecond(5000, Start, Start), 0xFFFFFFFF);
+
+    /* Write speed is smoothed, and small writes are not measured */
+    CFE_FS_Global.FileDump.WriteBytesPerSecond = 0;
+    CFE_FS_UpdateWriteSpeed(CFE_FS_BACKGROUND_MIN_SPEED_SAMPLE - 1, Start, OS_TimeAssembleFromMilliseconds(10, 1));
+    UtAssert_ZERO(CFE_FS_Global.FileDump.WriteBytesPerSecond);
+    CFE_FS_UpdateWriteSpeed(1000, Start, OS_TimeAssembleFromMilliseconds(10, 1));
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.WriteBytesPerSecond, 1000000);
+    CFE_FS_UpdateWriteSpeed(1000, Start, OS_TimeAssembleFromMicroseconds(10, 500));
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.WriteBytesPerSecond, 1250000);
+
+    /* The oldest ground request moves ahead of waiting automatic ones, across the wrap of the queue */
+    Auto1          = Ground;
+    Auto2          = Ground;
+    Auto1.Priority = CFE_FS_FileWritePriority_AUTOMATIC;
+    Auto2.Priority = CFE_FS_FileWritePriority_AUTOMATIC;
+    CFE_FS_Global.FileDump.CompleteCount = CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1;
+    CFE_FS_Global.FileDump.RequestCount  = CFE_FS_Global.FileDump.CompleteCount + 3;
+    Entries[(CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1)].Meta = &Auto1;
+    Entries[0].Meta                                       = &Auto2;
+    Entries[1].Meta                                       = &Ground;
+    CFE_FS_PrioritizeBackgroundFileDumps();
+    UtAssert_ADDRESS_EQ(Entries[(CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1)].Meta, &Ground);
+    UtAssert_ADDRESS_EQ(Entries[0].Meta, &Auto1);
+    UtAssert_ADDRESS_EQ(Entries[1].Meta, &Auto2);
+
+    /* Only automatic requests waiting */
+    CFE_FS_Global.FileDump.CompleteCount = 0;
+    CFE_FS_Global.FileDump.RequestCount  = 2;
+    CFE_FS_PrioritizeBackgroundFileDumps();
+    UtAssert_ADDRESS_EQ(Entries[0].Meta, &Auto1);
+    UtAssert_ADDRESS_EQ(Entries[1].Meta, &Auto2);
+
+    /* A ground request is written first and reports its average rate */
+    UT_InitData();
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+    Ground.GetData = UT_FS_DataGetter;
+    Ground.OnEvent = UT_FS_OnEvent;
+    strncpy(Ground.FileName, "/ram/UT.bin", sizeof(Ground.FileName));
+    Auto1.GetData  = UT_FS_DataGetter;
+    Auto1.OnEvent  = UT_FS_OnEvent;
+    strncpy(Auto1.FileName, "/ram/UT_auto.bin", sizeof(Auto1.FileName));
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&Auto1));
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&Ground));
+
+    MyBuffer[0] = 10;
+    MyBuffer[1] = 20;
+    Times[0]    = Start;
+    Times[1]    = Start;
+    Times[2]    = OS_TimeAssembleFromMilliseconds(12, 0);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), Times, sizeof(Times), false);
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&Ground));
+    UtAssert_BOOL_TRUE(CFE_FS_BackgroundFileDumpIsPending(&Auto1));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+    UtAssert_UINT32_EQ(Ground.BytesPerSecond, (sizeof(CFE_FS_Header_t) + 2 * sizeof(MyBuffer)) / 2);
+    UtAssert_ZERO(CFE_FS_Global.FileDump.WriteBytesPerSecond);
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+
+    /* The automatic request accumulates credit at its smaller rate */
+    UT_InitData();
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    CFE_FS_Global.FileDump.Current.Credit = 0;
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100000, NULL));
+    UtAssert_INT32_EQ(CFE_FS_Global.FileDump.Current.Credit + sizeof(CFE_FS_Header_t) + sizeof(MyBuffer),
+                      CFE_FS_BackgroundCreditRate(CFE_FS_FileWritePriority_AUTOMATIC));
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&Auto1));
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+}
@@ -207,6 +207,24 @@ void Test_CFE_FS_ByteSwapUint32(void);
 ******************************************************************************/
 void Test_CFE_FS_IsGzFile(void);
 
+/*****************************************************************************/
+/**
+** \brief Test FS API path view function
+**
+** \par Description
+**        This function tests splitting a file name into its parts in place.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_InitData, #CFE_FS_GetPathView
+**
+******************************************************************************/
+void Test_CFE_FS_GetPathView(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test FS API parse input file name function
@@ -312,4 +330,30 @@ void Test_CFE_FS_GetUncompressedFile(void);
 ******************************************************************************/
 void Test_CFE_FS_BackgroundFileDump(void);
 
+/*****************************************************************************/
+/**
+** \brief Tests for FS background file dump with compression
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_BackgroundFileDumpCompressed(void);
+
+/*****************************************************************************/
+/**
+** \brief Tests for FS background file dump credit and priority scheduling
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_BackgroundFileDumpScheduling(void);
+
 #endif /* FS_UT_H */
@@ -21,11 +21,11 @@
  */
 #include "cfe_msg.h"
 #include "cfe_msg_priv.h"
+#include "cfe_msg_inline.h"
 #include "cfe_msg_defaults.h"
 #include "cfe_error.h"
 
 /* CCSDS Primary Standard definitions */
-#define CFE_MSG_SIZE_OFFSET    7      /**< \brief CCSDS size offset */
 #define CFE_MSG_CCSDSVER_MASK  0xE000 /**< \brief CCSDS version mask */
 #define CFE_MSG_CCSDSVER_SHIFT 13     /**< \brief CCSDS version shift */
 #define CFE_MSG_TYPE_MASK      0x1000 /**< \brief CCSDS type mask, command when set */
@@ -36,7 +36,6 @@
 #define CFE_MSG_SEGFLG_FIRST   0x4000 /**< \brief CCSDS Segment first flag */
 #define CFE_MSG_SEGFLG_LAST    0x8000 /**< \brief CCSDS Segment last flag */
 #define CFE_MSG_SEGFLG_UNSEG   0xC000 /**< \brief CCSDS Unsegmented flag */
-#define CFE_MSG_SEQCNT_MASK    0x3FFF /**< \brief CCSDS Sequence count mask */
 
 /*----------------------------------------------------------------
  *
@@ -104,21 +103,7 @@ CFE_Status_t CFE_MSG_SetHeaderVersion(CFE_MSG_Message_t *MsgPtr, CFE_MSG_HeaderV
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_MSG_GetType(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Type_t *Type)
 {
-    if (MsgPtr == NULL || Type == NULL)
-    {
-        return CFE_MSG_BAD_ARGUMENT;
-    }
-
-    if ((MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_TYPE_MASK >> 8)) != 0)
-    {
-        *Type = CFE_MSG_Type_Cmd;
-    }
-    else
-    {
-        *Type = CFE_MSG_Type_Tlm;
-    }
-
-    return CFE_SUCCESS;
+    return CFE_MSG_Inline_GetType(MsgPtr, Type);
 }
 
 /*----------------------------------------------------------------
@@ -160,14 +145,7 @@ CFE_Status_t CFE_MSG_SetType(CFE_MSG_Message_t *MsgPtr, CFE_MSG_Type_t Type)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_MSG_GetHasSecondaryHeader(const CFE_MSG_Message_t *MsgPtr, bool *HasSecondary)
 {
-    if (MsgPtr == NULL || HasSecondary == NULL)
-    {
-        return CFE_MSG_BAD_ARGUMENT;
-    }
-
-    *HasSecondary = (MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_SHDR_MASK >> 8)) != 0;
-
-    return CFE_SUCCESS;
+    return CFE_MSG_Inline_GetHasSecondaryHeader(MsgPtr, HasSecondary);
 }
 
 /*----------------------------------------------------------------
@@ -318,14 +296,7 @@ CFE_Status_t CFE_MSG_SetSegmentationFlag(CFE_MSG_Message_t *MsgPtr, CFE_MSG_Segm
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_MSG_GetSequenceCount(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_SequenceCount_t *SeqCnt)
 {
-    if (MsgPtr == NULL || SeqCnt == NULL)
-    {
-        return CFE_MSG_BAD_ARGUMENT;
-    }
-
-    CFE_MSG_GetHeaderField(MsgPtr->CCSDS.Pri.Sequence, SeqCnt, CFE_MSG_SEQCNT_MASK);
-
-    return CFE_SUCCESS;
+    return CFE_MSG_Inline_GetSequenceCount(MsgPtr, SeqCnt);
 }
 
 /*----------------------------------------------------------------
@@ -336,14 +307,7 @@ CFE_Status_t CFE_MSG_GetSequenceCount(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_S
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_MSG_SetSequenceCount(CFE_MSG_Message_t *MsgPtr, CFE_MSG_SequenceCount_t SeqCnt)
 {
-    if (MsgPtr == NULL || ((SeqCnt & ~CFE_MSG_SEQCNT_MASK) != 0))
-    {
-        return CFE_MSG_BAD_ARGUMENT;
-    }
-
-    CFE_MSG_SetHeaderField(MsgPtr->CCSDS.Pri.Sequence, SeqCnt, CFE_MSG_SEQCNT_MASK);
-
-    return CFE_SUCCESS;
+    return CFE_MSG_Inline_SetSequenceCount(MsgPtr, SeqCnt);
 }
 
 /*----------------------------------------------------------------
@@ -354,14 +318,7 @@ CFE_Status_t CFE_MSG_SetSequenceCount(CFE_MSG_Message_t *MsgPtr, CFE_MSG_Sequenc
  *-----------------------------------------------------------------*/
 CFE_MSG_SequenceCount_t CFE_MSG_GetNextSequenceCount(CFE_MSG_SequenceCount_t SeqCnt)
 {
-    SeqCnt++;
-
-    if (SeqCnt > CFE_MSG_SEQCNT_MASK)
-    {
-        SeqCnt = 0;
-    }
-
-    return SeqCnt;
+    return CFE_MSG_Inline_GetNextSequenceCount(SeqCnt);
 }
 
 /*----------------------------------------------------------------
@@ -372,14 +329,7 @@ CFE_MSG_SequenceCount_t CFE_MSG_GetNextSequenceCount(CFE_MSG_SequenceCount_t Seq
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_MSG_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Size)
 {
-    if (MsgPtr == NULL || Size == NULL)
-    {
-        return CFE_MSG_BAD_ARGUMENT;
-    }
-
-    *Size = (MsgPtr->CCSDS.Pri.Length[0] << 8) + MsgPtr->CCSDS.Pri.Length[1] + CFE_MSG_SIZE_OFFSET;
-
-    return CFE_SUCCESS;
+    return CFE_MSG_Inline_GetSize(MsgPtr, Size);
 }
 
 /*----------------------------------------------------------------
@@ -390,16 +340,5 @@ CFE_Status_t CFE_MSG_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Si
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_MSG_SetSize(CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t Size)
 {
-    if (MsgPtr == NULL || Size < CFE_MSG_SIZE_OFFSET || Size > (0xFFFF + CFE_MSG_SIZE_OFFSET))
-    {
-        return CFE_MSG_BAD_ARGUMENT;
-    }
-
-    /* Size is CCSDS header is total packet size - CFE_MSG_SIZE_OFFSET (7) */
-    Size -= CFE_MSG_SIZE_OFFSET;
-
-    MsgPtr->CCSDS.Pri.Length[0] = (Size >> 8) & 0xFF;
-    MsgPtr->CCSDS.Pri.Length[1] = Size & 0xFF;
-
-    return CFE_SUCCESS;
+    return CFE_MSG_Inline_SetSize(MsgPtr, Size);
 }
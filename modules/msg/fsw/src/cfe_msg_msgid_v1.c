@@ -21,6 +21,7 @@
  */
 #include "cfe_msg.h"
 #include "cfe_msg_priv.h"
+#include "cfe_msg_inline.h"
 #include "cfe_error.h"
 #include "cfe_platform_cfg.h"
 #include "cfe_sb.h"
@@ -33,17 +34,7 @@
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_MSG_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId)
 {
-    CFE_SB_MsgId_Atom_t msgidval;
-
-    if (MsgPtr == NULL || MsgId == NULL)
-    {
-        return CFE_MSG_BAD_ARGUMENT;
-    }
-
-    msgidval = (MsgPtr->CCSDS.Pri.StreamId[0] << 8) + MsgPtr->CCSDS.Pri.StreamId[1];
-    *MsgId   = CFE_SB_ValueToMsgId(msgidval);
-
-    return CFE_SUCCESS;
+    return CFE_MSG_Inline_GetMsgId(MsgPtr, MsgId);
 }
 
 /*----------------------------------------------------------------
@@ -25,3 +25,20 @@ generate_config_includefile(
     FILE_NAME           "cfe_msg_sechdr.h"
     FALLBACK_FILE       "${CMAKE_CURRENT_LIST_DIR}/option_inc/default_cfe_msg_sechdr.h"
 )
+
+# Inline header accessors, for the message id version in use
+if (MISSION_MSGID_V2)
+  set(MSG_INLINE_MSGID_FILE "default_cfe_msg_inline_msgid_v2.h")
+else (MISSION_MSGID_V2)
+  set(MSG_INLINE_MSGID_FILE "default_cfe_msg_inline_msgid_v1.h")
+endif (MISSION_MSGID_V2)
+
+generate_config_includefile(
+    FILE_NAME           "cfe_msg_inline.h"
+    FALLBACK_FILE       "${CMAKE_CURRENT_LIST_DIR}/option_inc/default_cfe_msg_inline.h"
+)
+
+generate_config_includefile(
+    FILE_NAME           "cfe_msg_inline_msgid.h"
+    FALLBACK_FILE       "${CMAKE_CURRENT_LIST_DIR}/option_inc/${MSG_INLINE_MSGID_FILE}"
+)
@@ -0,0 +1,296 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Inline implementation of the hot path message header accessors for the
+ * cFS standard header layout (see default_cfe_msg_hdr_pri.h, default_cfe_msg_hdr_priext.h
+ * and default_cfe_msg_sechdr.h)
+ *  - The MSG module implements the matching public APIs with these
+ *  - If CFE_MSG_INLINE_ACCESSORS is defined (MISSION_MSG_INLINE_ACCESSORS build option)
+ *    callers of those APIs are also redirected to these, so header access is compiled
+ *    in place of the function call
+ *  - A mission with a different header layout must provide a matching version of this file
+ */
+
+#ifndef DEFAULT_CFE_MSG_INLINE_H
+#define DEFAULT_CFE_MSG_INLINE_H
+
+/*
+ * Include Files
+ */
+
+#include "common_types.h"
+#include "cfe_error.h"
+#include "cfe_msg_hdr.h"
+#include "cfe_msg_api_typedefs.h"
+#include "cfe_sb_api_typedefs.h"
+#include "cfe_time_api_typedefs.h"
+
+/*
+ * Defines
+ */
+
+#define CFE_MSG_INLINE_SIZE_OFFSET 7      /**< \brief CCSDS size offset */
+#define CFE_MSG_INLINE_TYPE_MASK   0x1000 /**< \brief CCSDS type mask, command when set */
+#define CFE_MSG_INLINE_SHDR_MASK   0x0800 /**< \brief CCSDS secondary header mask, exists when set*/
+#define CFE_MSG_INLINE_SEQCNT_MASK 0x3FFF /**< \brief CCSDS Sequence count mask */
+#define CFE_MSG_INLINE_FC_MASK     0x7F   /**< \brief Function code mask */
+
+/*
+ * Inline accessors, see the public API of the same name in cfe_msg.h for argument/return detail
+ */
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of #CFE_MSG_GetSize
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Size)
+{
+    if (MsgPtr == NULL || Size == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    *Size = (MsgPtr->CCSDS.Pri.Length[0] << 8) + MsgPtr->CCSDS.Pri.Length[1] + CFE_MSG_INLINE_SIZE_OFFSET;
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of #CFE_MSG_SetSize
+ */
+static inline CFE_Status_t CFE_MSG_Inline_SetSize(CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t Size)
+{
+    if (MsgPtr == NULL || Size < CFE_MSG_INLINE_SIZE_OFFSET || Size > (0xFFFF + CFE_MSG_INLINE_SIZE_OFFSET))
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    /* Size is CCSDS header is total packet size - CFE_MSG_INLINE_SIZE_OFFSET (7) */
+    Size -= CFE_MSG_INLINE_SIZE_OFFSET;
+
+    MsgPtr->CCSDS.Pri.Length[0] = (Size >> 8) & 0xFF;
+    MsgPtr->CCSDS.Pri.Length[1] = Size & 0xFF;
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of #CFE_MSG_GetType
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetType(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Type_t *Type)
+{
+    if (MsgPtr == NULL || Type == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    if ((MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_INLINE_TYPE_MASK >> 8)) != 0)
+    {
+        *Type = CFE_MSG_Type_Cmd;
+    }
+    else
+    {
+        *Type = CFE_MSG_Type_Tlm;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of #CFE_MSG_GetHasSecondaryHeader
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetHasSecondaryHeader(const CFE_MSG_Message_t *MsgPtr, bool *HasSecondary)
+{
+    if (MsgPtr == NULL || HasSecondary == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    *HasSecondary = (MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_INLINE_SHDR_MASK >> 8)) != 0;
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of #CFE_MSG_GetSequenceCount
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetSequenceCount(const CFE_MSG_Message_t *MsgPtr,
+                                                           CFE_MSG_SequenceCount_t *SeqCnt)
+{
+    if (MsgPtr == NULL || SeqCnt == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    *SeqCnt = ((MsgPtr->CCSDS.Pri.Sequence[0] << 8) | MsgPtr->CCSDS.Pri.Sequence[1]) & CFE_MSG_INLINE_SEQCNT_MASK;
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of #CFE_MSG_SetSequenceCount
+ */
+static inline CFE_Status_t CFE_MSG_Inline_SetSequenceCount(CFE_MSG_Message_t *MsgPtr, CFE_MSG_SequenceCount_t SeqCnt)
+{
+    if (MsgPtr == NULL || ((SeqCnt & ~CFE_MSG_INLINE_SEQCNT_MASK) != 0))
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    /* Only the sequence count bits change, the segmentation flags are kept */
+    MsgPtr->CCSDS.Pri.Sequence[0] =
+        (MsgPtr->CCSDS.Pri.Sequence[0] & ~(CFE_MSG_INLINE_SEQCNT_MASK >> 8)) | (SeqCnt >> 8);
+    MsgPtr->CCSDS.Pri.Sequence[1] = SeqCnt & 0xFF;
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of #CFE_MSG_GetNextSequenceCount
+ */
+static inline CFE_MSG_SequenceCount_t CFE_MSG_Inline_GetNextSequenceCount(CFE_MSG_SequenceCount_t SeqCnt)
+{
+    SeqCnt++;
+
+    if (SeqCnt > CFE_MSG_INLINE_SEQCNT_MASK)
+    {
+        SeqCnt = 0;
+    }
+
+    return SeqCnt;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of #CFE_MSG_GetFcnCode
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetFcnCode(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_FcnCode_t *FcnCode)
+{
+    const CFE_MSG_CommandHeader_t *cmd = (const CFE_MSG_CommandHeader_t *)MsgPtr;
+
+    if (MsgPtr == NULL || FcnCode == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    /* Must be a command with a secondary header */
+    if ((MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_INLINE_TYPE_MASK >> 8)) == 0 ||
+        (MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_INLINE_SHDR_MASK >> 8)) == 0)
+    {
+        *FcnCode = 0;
+        return CFE_MSG_WRONG_MSG_TYPE;
+    }
+
+    *FcnCode = cmd->Sec.FunctionCode & CFE_MSG_INLINE_FC_MASK;
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of #CFE_MSG_SetMsgTime
+ */
+static inline CFE_Status_t CFE_MSG_Inline_SetMsgTime(CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t NewTime)
+{
+    CFE_MSG_TelemetryHeader_t *tlm = (CFE_MSG_TelemetryHeader_t *)MsgPtr;
+
+    if (MsgPtr == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    /* Must be telemetry with a secondary header */
+    if ((MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_INLINE_TYPE_MASK >> 8)) != 0 ||
+        (MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_INLINE_SHDR_MASK >> 8)) == 0)
+    {
+        return CFE_MSG_WRONG_MSG_TYPE;
+    }
+
+    /* Set big endian time field with default 32/16 layout */
+    tlm->Sec.Time[0] = (NewTime.Seconds >> 24) & 0xFF;
+    tlm->Sec.Time[1] = (NewTime.Seconds >> 16) & 0xFF;
+    tlm->Sec.Time[2] = (NewTime.Seconds >> 8) & 0xFF;
+    tlm->Sec.Time[3] = NewTime.Seconds & 0xFF;
+    tlm->Sec.Time[4] = (NewTime.Subseconds >> 24) & 0xFF;
+    tlm->Sec.Time[5] = (NewTime.Subseconds >> 16) & 0xFF;
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of #CFE_MSG_GetMsgTime
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetMsgTime(const CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t *Time)
+{
+    const CFE_MSG_TelemetryHeader_t *tlm = (const CFE_MSG_TelemetryHeader_t *)MsgPtr;
+
+    if (MsgPtr == NULL || Time == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    /* Must be telemetry with a secondary header */
+    if ((MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_INLINE_TYPE_MASK >> 8)) != 0 ||
+        (MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_INLINE_SHDR_MASK >> 8)) == 0)
+    {
+        Time->Seconds    = 0;
+        Time->Subseconds = 0;
+        return CFE_MSG_WRONG_MSG_TYPE;
+    }
+
+    /* Get big endian time fields with default 32/16 layout */
+    Time->Subseconds = (tlm->Sec.Time[4] << 24) + (tlm->Sec.Time[5] << 16);
+    Time->Seconds    = (tlm->Sec.Time[0] << 24) + (tlm->Sec.Time[1] << 16) + (tlm->Sec.Time[2] << 8) + tlm->Sec.Time[3];
+
+    return CFE_SUCCESS;
+}
+
+/*
+ * Message id, depends on the message id version in use
+ */
+#include "cfe_msg_inline_msgid.h"
+
+/*
+ * Redirect callers of the public APIs, except in the MSG module itself, which
+ * provides the out of line versions, and in unit tests, which use the stubs
+ */
+#if defined(CFE_MSG_INLINE_ACCESSORS) && !defined(CFE_MSG_OMIT_INLINE)
+#define CFE_MSG_GetSize(MsgPtr, Size)                   CFE_MSG_Inline_GetSize(MsgPtr, Size)
+#define CFE_MSG_SetSize(MsgPtr, Size)                   CFE_MSG_Inline_SetSize(MsgPtr, Size)
+#define CFE_MSG_GetType(MsgPtr, Type)                   CFE_MSG_Inline_GetType(MsgPtr, Type)
+#define CFE_MSG_GetHasSecondaryHeader(MsgPtr, HasSec)   CFE_MSG_Inline_GetHasSecondaryHeader(MsgPtr, HasSec)
+#define CFE_MSG_GetSequenceCount(MsgPtr, SeqCnt)        CFE_MSG_Inline_GetSequenceCount(MsgPtr, SeqCnt)
+#define CFE_MSG_SetSequenceCount(MsgPtr, SeqCnt)        CFE_MSG_Inline_SetSequenceCount(MsgPtr, SeqCnt)
+#define CFE_MSG_GetNextSequenceCount(SeqCnt)            CFE_MSG_Inline_GetNextSequenceCount(SeqCnt)
+#define CFE_MSG_GetFcnCode(MsgPtr, FcnCode)             CFE_MSG_Inline_GetFcnCode(MsgPtr, FcnCode)
+#define CFE_MSG_SetMsgTime(MsgPtr, NewTime)             CFE_MSG_Inline_SetMsgTime(MsgPtr, NewTime)
+#define CFE_MSG_GetMsgTime(MsgPtr, Time)                CFE_MSG_Inline_GetMsgTime(MsgPtr, Time)
+#define CFE_MSG_GetMsgId(MsgPtr, MsgId)                 CFE_MSG_Inline_GetMsgId(MsgPtr, MsgId)
+#endif
+
+#endif /* DEFAULT_CFE_MSG_INLINE_H */
@@ -0,0 +1,58 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Inline implementation of the message id accessor, cFS version 1
+ *  - Included from cfe_msg_inline.h, after the header field accessors
+ *  - Message id is the 16 bit stream id of the CCSDS primary header
+ */
+
+#ifndef DEFAULT_CFE_MSG_INLINE_MSGID_V1_H
+#define DEFAULT_CFE_MSG_INLINE_MSGID_V1_H
+
+/*
+ * Include Files
+ */
+
+#include "common_types.h"
+#include "cfe_error.h"
+#include "cfe_msg_hdr.h"
+#include "cfe_sb_api_typedefs.h"
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of #CFE_MSG_GetMsgId
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId)
+{
+    CFE_SB_MsgId_Atom_t msgidval;
+
+    if (MsgPtr == NULL || MsgId == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    msgidval = (MsgPtr->CCSDS.Pri.StreamId[0] << 8) + MsgPtr->CCSDS.Pri.StreamId[1];
+    *MsgId   = CFE_SB_MSGID_C(msgidval);
+
+    return CFE_SUCCESS;
+}
+
+#endif /* DEFAULT_CFE_MSG_INLINE_MSGID_V1_H */
@@ -193,6 +193,21 @@
 */
 #define CFE_PLATFORM_SB_DEFAULT_MAP_FILENAME "/ram/cfe_sb_msgmap.dat"
 
+/**
+**  \cfesbcfg Compress the Files Written by SB in the Background
+**
+**  \par Description:
+**       When true, the routing, pipe and message map information files are
+**       compressed by the FS background file writer, and the
+**       #CFE_FS_SUBTYPE_COMPRESSED bit is set in the SubType of their file
+**       headers.  Ground tools that read these files need to expand them first,
+**       for example with the cfe_fs_decompress host tool.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_SB_COMPRESS_FILE_DUMPS false
+
 /**
 **  \cfesbcfg SB Event Filtering
 **
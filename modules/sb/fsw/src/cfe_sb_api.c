@@ -1550,6 +1550,8 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
     /* For an invalid route / no subscribers this whole logic can be skipped */
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
+        CFE_TRACE_POINT(SB_TRANSMIT, CFE_SB_MsgIdToValue(BufDscPtr->MsgId), BufDscPtr->ContentSize);
+
         /* Set the seq count if requested (while locked) before actually sending */
         if (BufDscPtr->NeedsUpdate)
         {
@@ -1595,6 +1597,9 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
                 CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter++;
                 PipeDscPtr->SendErrors++;
 
+                CFE_TRACE_POINT(SB_DROP_MSG_LIMIT, CFE_SB_MsgIdToValue(BufDscPtr->MsgId),
+                                CFE_RESOURCEID_TO_ULONG(DestPtr->PipeId));
+
                 continue;
             }
 
@@ -1616,6 +1621,9 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
                 {
                     PipeDscPtr->PeakQueueDepth = PipeDscPtr->CurrentQueueDepth;
                 }
+
+                CFE_TRACE_POINT(SB_ENQUEUE, CFE_SB_MsgIdToValue(BufDscPtr->MsgId),
+                                CFE_RESOURCEID_TO_ULONG(DestPtr->PipeId));
             }
             else
             {
@@ -1634,6 +1642,9 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
                 }
                 SBSndErr.EvtsToSnd++;
                 PipeDscPtr->SendErrors++;
+
+                CFE_TRACE_POINT(SB_DROP_PIPE_FULL, CFE_SB_MsgIdToValue(BufDscPtr->MsgId),
+                                CFE_RESOURCEID_TO_ULONG(DestPtr->PipeId));
             } /*end if */
 
         } /* end loop over destinations */
@@ -1907,6 +1918,8 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
              */
             *BufPtr = &BufDscPtr->Content;
 
+            CFE_TRACE_POINT(SB_RECEIVE, CFE_SB_MsgIdToValue(BufDscPtr->MsgId), CFE_RESOURCEID_TO_ULONG(PipeId));
+
             /* get pointer to destination to be used in decrementing msg limit cnt*/
             RouteId = CFE_SBR_GetRouteId(BufDscPtr->MsgId);
             DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
@@ -735,8 +735,9 @@ void CFE_SB_BackgroundFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event
     {
         case CFE_FS_FileWriteEvent_COMPLETE:
             CFE_EVS_SendEventWithAppID(CFE_SB_SND_RTG_EID, CFE_EVS_EventType_DEBUG, CFE_SB_Global.AppId,
-                                       "%s written:Size=%d,Entries=%d", BgFilePtr->FileWrite.FileName, (int)Position,
-                                       (int)RecordNum);
+                                       "%s written:Size=%d,Entries=%d,Rate=%lu B/s", BgFilePtr->FileWrite.FileName,
+                                       (int)Position, (int)RecordNum,
+                                       (unsigned long)BgFilePtr->FileWrite.BytesPerSecond);
             break;
 
         case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
@@ -784,6 +785,7 @@ int32 CFE_SB_WriteRoutingInfoCmd(const CFE_SB_WriteRoutingInfoCmd_t *data)
          */
         StatePtr->FileWrite.FileSubType = CFE_FS_SubType_SB_ROUTEDATA;
         snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), "SB Routing Information");
+        StatePtr->FileWrite.Compress = CFE_PLATFORM_SB_COMPRESS_FILE_DUMPS;
 
         StatePtr->FileWrite.GetData = CFE_SB_WriteRouteInfoDataGetter;
         StatePtr->FileWrite.OnEvent = CFE_SB_BackgroundFileEventHandler;
@@ -923,6 +925,7 @@ int32 CFE_SB_WritePipeInfoCmd(const CFE_SB_WritePipeInfoCmd_t *data)
          */
         StatePtr->FileWrite.FileSubType = CFE_FS_SubType_SB_PIPEDATA;
         snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), "SB Pipe Information");
+        StatePtr->FileWrite.Compress = CFE_PLATFORM_SB_COMPRESS_FILE_DUMPS;
 
         StatePtr->FileWrite.GetData = CFE_SB_WritePipeInfoDataGetter;
         StatePtr->FileWrite.OnEvent = CFE_SB_BackgroundFileEventHandler;
@@ -1047,6 +1050,7 @@ int32 CFE_SB_WriteMapInfoCmd(const CFE_SB_WriteMapInfoCmd_t *data)
          */
         StatePtr->FileWrite.FileSubType = CFE_FS_SubType_SB_MAPDATA;
         snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), "SB Map Information");
+        StatePtr->FileWrite.Compress = CFE_PLATFORM_SB_COMPRESS_FILE_DUMPS;
 
         StatePtr->FileWrite.GetData = CFE_SB_WriteMsgMapInfoDataGetter;
         StatePtr->FileWrite.OnEvent = CFE_SB_BackgroundFileEventHandler;
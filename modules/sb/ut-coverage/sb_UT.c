@@ -615,6 +615,7 @@ void Test_SB_Cmds_RoutingInfoDef(void)
                     UT_TPID_CFE_SB_CMD_WRITE_ROUTING_INFO_CC);
 
     CFE_UtAssert_EVENTCOUNT(5);
+    UtAssert_UINT32_EQ(CFE_SB_Global.BackgroundFile.FileWrite.Compress, CFE_PLATFORM_SB_COMPRESS_FILE_DUMPS);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_INIT_EID);
 
@@ -181,7 +181,9 @@
 **  \par Error Conditions
 **       This command may fail for the following reason(s):
 **       - A single buffered table's inactive buffer was requested to be
-**         dumped and no such buffer is currently allocated.
+**         dumped.  Its shared load buffer cannot be held while the dump is
+**         written in the background.
+**       - Too many dumps are already being written in the background.
 **       - Error occurred during write operation to file. Possible causes
 **         might be insufficient space in the file system or the filename
 **         or file path is improperly specified.
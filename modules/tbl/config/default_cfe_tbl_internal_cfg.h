@@ -102,6 +102,52 @@
 */
 #define CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE 16384
 
+/**
+**  \cfetblcfg Size of the Chunks Read when Loading a Table from a File
+**
+**  \par Description:
+**       Defines the number of bytes Table Services reads from a table image file
+**       at a time when loading it.  Each chunk is folded into the table CRC right
+**       after it is read, while it is still in cache, so large tables are not
+**       traversed a second time just to compute the CRC.
+**
+**  \par Limits
+**       This number must be greater than zero.  Values much smaller than a typical
+**       file system block will increase the number of file system calls per load.
+*/
+#define CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE 4096
+
+/**
+**  \cfetblcfg Size of the Chunks Written when Dumping a Table to a File
+**
+**  \par Description:
+**       Defines the number of bytes of table data Table Services hands to the
+**       background file writer at a time when dumping a table.  Smaller chunks let
+**       the background writer interleave table dumps with its other work more
+**       finely; larger chunks reduce the number of file system calls per dump.
+**
+**  \par Limits
+**       This number must be greater than zero.
+*/
+#define CFE_PLATFORM_TBL_DUMP_CHUNK_SIZE 4096
+
+/**
+**  \cfetblcfg Number of Buffers of a Multi-Buffered Table
+**
+**  \par Description:
+**       Defines the total number of buffers Table Services allocates for a table
+**       registered with #CFE_TBL_OPT_MULTI_BUFFER: the active buffer, the inactive
+**       buffer and (this number - 2) spare buffers.  When readers still hold the
+**       inactive buffer, a spare that no reader holds any more takes its place, so
+**       a producer can keep loading the table while slow readers finish with
+**       older images.  Each multi-buffered table takes this many times its size
+**       from the Table Services memory pool.
+**
+**  \par Limits
+**       This number must be at least 3.
+*/
+#define CFE_PLATFORM_TBL_MULTI_BUFFER_DEPTH 3
+
 /**
 **  \cfetblcfg Maximum Number of Tables Allowed to be Registered
 **
@@ -175,6 +221,64 @@
 */
 #define CFE_PLATFORM_TBL_MAX_NUM_VALIDATIONS 10
 
+/**
+**  \cfetblcfg Number of Table Validation Worker Tasks
+**
+**  \par Description:
+**       Defines the number of child tasks Table Services starts to validate
+**       the inactive buffers of tables registered with #CFE_TBL_OPT_VALIDATE_ASYNC.
+**       Validation requests for those tables are queued to the workers instead of
+**       waiting for the owning application to call #CFE_TBL_Validate, so several
+**       tables can be validated at once without delaying their owners.
+**
+**  \par Limits
+**       This number may be zero, in which case no workers are started and all
+**       tables are validated by their owning applications.
+*/
+#define CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS 0
+
+/**
+**  \cfetblcfg Table Validation Worker Task Priority
+**
+**  \par Description:
+**       Defines the priority of the Table Services validation worker tasks.
+**       Lower numbers are higher priority, with 1 being the highest priority
+**       in the case of a child task.
+**
+**  \par Limits
+**       Valid range for a child task is 1 to 255 however, the priority cannot
+**       be higher (lower number) than the TBL parent application priority.
+*/
+#define CFE_PLATFORM_TBL_VALIDATION_WORKER_PRIORITY 200
+
+/**
+**  \cfetblcfg Table Validation Worker Task Stack Size
+**
+**  \par Description:
+**       Defines the stack size of each Table Services validation worker task.
+**       Application validation functions run on this stack.
+**
+**  \par Limits
+**       It is recommended this parameter be greater than or equal to 8KB. This parameter
+**       is limited by the maximum value allowed by the data type. In this case, the data
+**       type is an unsigned 32-bit integer, so the valid range is 0 to 0xFFFFFFFF.
+*/
+#define CFE_PLATFORM_TBL_VALIDATION_WORKER_STACK_SIZE 8192
+
+/**
+**  \cfetblcfg Table Validation Worker Timeout
+**
+**  \par Description:
+**       Defines how long, in milliseconds, a table being unregistered waits for a
+**       validation worker to finish validating its inactive buffer.  When the time
+**       runs out the validation is reported as failed and the table is released;
+**       the late result of the worker is discarded.
+**
+**  \par Limits
+**       This parameter must be greater than zero.
+*/
+#define CFE_PLATFORM_TBL_VALIDATION_TIMEOUT_MSEC 5000
+
 /**
 **  \cfetblcfg Default Filename for a Table Registry Dump
 **
@@ -188,6 +292,22 @@
 */
 #define CFE_PLATFORM_TBL_DEFAULT_REG_DUMP_FILE "/ram/cfe_tbl_reg.log"
 
+/**
+**  \cfetblcfg Compress the Files Written by TBL in the Background
+**
+**  \par Description:
+**       When true, table dumps and table registry dumps written by the FS
+**       background file writer are compressed, and the #CFE_FS_SUBTYPE_COMPRESSED
+**       bit is set in the SubType of their file headers.  A compressed table dump
+**       has to be expanded, for example with the cfe_fs_decompress host tool,
+**       before it can be loaded back into a table.  Dumps that are written
+**       immediately by the Table Services task are never compressed.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_TBL_COMPRESS_FILE_DUMPS false
+
 /**
 **  \cfetblcfg Number of Spacecraft ID's specified for validation
 **
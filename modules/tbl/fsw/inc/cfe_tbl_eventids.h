@@ -352,7 +352,8 @@
  *
  *  \par Cause:
  *
- *  TBL Write Table or Table Registry File failed to create file. OVERLOADED
+ *  TBL Write Table or Table Registry File failed to create file, or the write
+ *  could not be queued with the background file writer. OVERLOADED
  */
 #define CFE_TBL_CREATING_DUMP_FILE_ERR_EID 62
 
@@ -515,7 +516,7 @@
  *  \par Cause:
  *
  *  \link #CFE_TBL_DUMP_CC TBL Write Table Command \endlink failure due to exceeding the
- *  allocated number of control blocks available to write a dump only table.
+ *  allocated number of control blocks available to write a table.
  */
 #define CFE_TBL_TOO_MANY_DUMPS_ERR_EID 76
 
@@ -815,6 +816,31 @@
  *  #CFE_TBL_Load API failure due to the application not owning the table.
  */
 #define CFE_TBL_HANDLE_ACCESS_ERR_EID 103
+
+/**
+ * \brief TBL Load Table API Unchanged Contents Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  #CFE_TBL_Load API success where the loaded image was identical to the active table
+ *  contents, so the table was neither validated nor updated.
+ */
+#define CFE_TBL_LOAD_UNCHANGED_INF_EID 104
+
+/**
+ * \brief TBL Validation Worker Timeout Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  A table was released while a validation worker was still validating its inactive
+ *  buffer, and the worker did not finish within #CFE_PLATFORM_TBL_VALIDATION_TIMEOUT_MSEC.
+ *  The validation is reported as failed with #CFE_TBL_ERR_VALIDATION_TIMEOUT.
+ */
+#define CFE_TBL_VALIDATION_TIMEOUT_ERR_EID 105
 /**\}*/
 
 #endif /* CFE_TBL_EVENTS_H */
@@ -58,6 +58,7 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
     char                        AppName[OS_MAX_API_NAME]           = {"UNKNOWN"};
     char                        TblName[CFE_TBL_MAX_FULL_NAME_LEN] = {""};
     CFE_TBL_Handle_t            AccessIndex;
+    uint32                      i;
 
     if (TblHandlePtr == NULL || Name == NULL)
     {
@@ -292,6 +293,35 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
 
                     RegRecPtr->ActiveBufferIndex = 0;
                     RegRecPtr->DoubleBuffered    = true;
+
+                    /* A multi-buffered table also gets spare buffers to load into while the inactive one is busy */
+                    if ((TblOptionFlags & CFE_TBL_OPT_MULTI_BUF_MSK) ==
+                        (CFE_TBL_OPT_MULTI_BUFFER & CFE_TBL_OPT_MULTI_BUF_MSK))
+                    {
+                        RegRecPtr->MultiBuffered = true;
+
+                        for (i = 0; (i < CFE_TBL_NUM_SPARE_BUFFERS) &&
+                                    ((Status & CFE_SEVERITY_BITMASK) != CFE_SEVERITY_ERROR);
+                             i++)
+                        {
+                            Status =
+                                CFE_ES_GetPoolBuf(&RegRecPtr->SpareBufferPtr[i], CFE_TBL_Global.Buf.PoolHdl, Size);
+                            if (Status < 0)
+                            {
+                                RegRecPtr->SpareBufferPtr[i] = NULL;
+
+                                CFE_ES_WriteToSysLog("%s: Spare Buf Alloc GetPool fail Stat=0x%08X MemPoolHndl=0x%08lX\n",
+                                                     __func__, (unsigned int)Status,
+                                                     CFE_RESOURCEID_TO_ULONG(CFE_TBL_Global.Buf.PoolHdl));
+                            }
+                            else
+                            {
+                                /* Zero the spare buffer */
+                                Status = CFE_SUCCESS;
+                                memset(RegRecPtr->SpareBufferPtr[i], 0x0, Size);
+                            }
+                        }
+                    }
                 }
                 else /* Single Buffered Table */
                 {
@@ -304,6 +334,10 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                     /* Save the size of the table */
                     RegRecPtr->Size = Size;
 
+                    /* Be conservative about what the inactive buffer holds until it has been loaded once */
+                    RegRecPtr->DirtyOffset   = 0;
+                    RegRecPtr->DirtyNumBytes = Size;
+
                     /* Save the Callback function pointer */
                     RegRecPtr->ValidationFuncPtr = TblValidationFuncPtr;
 
@@ -311,6 +345,14 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                     strncpy(RegRecPtr->Name, TblName, sizeof(RegRecPtr->Name) - 1);
                     RegRecPtr->Name[sizeof(RegRecPtr->Name) - 1] = '\0';
 
+                    /* Remember whether the owner allows its validation function to run on a worker task */
+                    RegRecPtr->AsyncValidation =
+                        ((TblOptionFlags & CFE_TBL_OPT_VALIDATE_MSK) == CFE_TBL_OPT_VALIDATE_ASYNC);
+
+                    /* Remember whether the owner wants loads of the active contents to be skipped */
+                    RegRecPtr->ReloadIfChanged =
+                        ((TblOptionFlags & CFE_TBL_OPT_RELOAD_MSK) == CFE_TBL_OPT_RELOAD_IF_CHANGED);
+
                     /* Set the "Dump Only" flag to value based upon selected option */
                     if ((TblOptionFlags & CFE_TBL_OPT_LD_DMP_MSK) == CFE_TBL_OPT_DUMP_ONLY)
                     {
@@ -324,9 +366,9 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                     /* Initialize the Table Access Descriptor */
                     AccessDescPtr = &CFE_TBL_Global.Handles[*TblHandlePtr];
 
-                    AccessDescPtr->AppId    = ThisAppId;
-                    AccessDescPtr->LockFlag = false;
-                    AccessDescPtr->Updated  = false;
+                    AccessDescPtr->AppId       = ThisAppId;
+                    AccessDescPtr->PinnedEpoch = CFE_TBL_NO_EPOCH_PINNED;
+                    AccessDescPtr->Updated     = false;
 
                     if ((RegRecPtr->DumpOnly) && (!RegRecPtr->UserDefAddr))
                     {
@@ -342,6 +384,7 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                     AccessDescPtr->NextLink = CFE_TBL_END_OF_LIST; /* We are the end of the list */
 
                     AccessDescPtr->UsedFlag = true;
+                    CFE_TBL_ClaimHandle(*TblHandlePtr);
 
                     /* Make sure the Table Registry entry points to First Access Descriptor */
                     RegRecPtr->HeadOfAccessList = *TblHandlePtr;
@@ -473,6 +516,7 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                     /* to share the table or get its address because registry entries that */
                     /* are unowned are not checked to see if they match names, etc.        */
                     RegRecPtr->OwnerAppId = ThisAppId;
+                    CFE_TBL_ClaimRegistryEntry(RegIndx);
                 }
             }
         }
@@ -548,9 +592,9 @@ CFE_Status_t CFE_TBL_Share(CFE_TBL_Handle_t *TblHandlePtr, const char *TblName)
                 /* Initialize the Table Access Descriptor */
                 AccessDescPtr = &CFE_TBL_Global.Handles[*TblHandlePtr];
 
-                AccessDescPtr->AppId    = ThisAppId;
-                AccessDescPtr->LockFlag = false;
-                AccessDescPtr->Updated  = false;
+                AccessDescPtr->AppId       = ThisAppId;
+                AccessDescPtr->PinnedEpoch = CFE_TBL_NO_EPOCH_PINNED;
+                AccessDescPtr->Updated     = false;
 
                 /* Check current state of table in order to set Notification flags properly */
                 if (RegRecPtr->TableLoadedOnce)
@@ -560,6 +604,7 @@ CFE_Status_t CFE_TBL_Share(CFE_TBL_Handle_t *TblHandlePtr, const char *TblName)
 
                 AccessDescPtr->RegIndex = RegIndx;
                 AccessDescPtr->UsedFlag = true;
+                CFE_TBL_ClaimHandle(*TblHandlePtr);
 
                 AccessDescPtr->PrevLink = CFE_TBL_END_OF_LIST; /* We are the new head of the list */
                 AccessDescPtr->NextLink = RegRecPtr->HeadOfAccessList;
@@ -626,6 +671,9 @@ CFE_Status_t CFE_TBL_Unregister(CFE_TBL_Handle_t TblHandle)
         /* Verify that the application unregistering the table owns the table */
         if (CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, ThisAppId))
         {
+            /* A worker may still be running the owner's validation function on the inactive buffer */
+            CFE_TBL_WaitForAsyncValidation(RegRecPtr);
+
             /* Mark table as free, although, technically, it isn't free until the */
             /* linked list of Access Descriptors has no links in it.              */
             /* NOTE: Allocated memory is freed when all Access Links have been    */
@@ -634,6 +682,7 @@ CFE_Status_t CFE_TBL_Unregister(CFE_TBL_Handle_t TblHandle)
             RegRecPtr->OwnerAppId = CFE_TBL_NOT_OWNED;
 
             /* Remove Table Name */
+            CFE_TBL_RemoveFromNameIndex(AccessDescPtr->RegIndex);
             RegRecPtr->Name[0] = '\0';
         }
 
@@ -669,223 +718,11 @@ CFE_Status_t CFE_TBL_Unregister(CFE_TBL_Handle_t TblHandle)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType, const void *SrcDataPtr)
 {
-    int32                       Status;
-    CFE_ES_AppId_t              ThisAppId;
-    CFE_TBL_LoadBuff_t *        WorkingBufferPtr;
-    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
-    CFE_TBL_RegistryRec_t *     RegRecPtr;
-    char                        AppName[OS_MAX_API_NAME] = {"UNKNOWN"};
-    bool                        FirstTime                = false;
-
-    if (SrcDataPtr == NULL)
-    {
-        return CFE_TBL_BAD_ARGUMENT;
-    }
-
-    /* Verify access rights and get a valid Application ID for calling App */
-    Status = CFE_TBL_ValidateAccess(TblHandle, &ThisAppId);
-
-    if (Status != CFE_SUCCESS)
-    {
-        CFE_EVS_SendEventWithAppID(CFE_TBL_HANDLE_ACCESS_ERR_EID, CFE_EVS_EventType_ERROR,
-                                   CFE_TBL_Global.TableTaskAppId, "%s: No access to Tbl Handle=%d", AppName,
-                                   (int)TblHandle);
-
-        return Status;
-    }
-
-    AccessDescPtr = &CFE_TBL_Global.Handles[TblHandle];
-    RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
-
-    /* Translate AppID of caller into App Name */
-    CFE_ES_GetAppName(AppName, ThisAppId, sizeof(AppName));
-
-    /* Initialize return pointer to NULL */
-    WorkingBufferPtr = NULL;
-
-    /* Check to see if this is a dump only table */
-    if (RegRecPtr->DumpOnly)
-    {
-        if ((!RegRecPtr->UserDefAddr) || (RegRecPtr->TableLoadedOnce))
-        {
-            CFE_EVS_SendEventWithAppID(CFE_TBL_LOADING_A_DUMP_ONLY_ERR_EID, CFE_EVS_EventType_ERROR,
-                                       CFE_TBL_Global.TableTaskAppId, "%s: Attempted to load Dump Only Tbl '%s'",
-                                       AppName, RegRecPtr->Name);
-
-            return CFE_TBL_ERR_DUMP_ONLY;
-        }
+    int32 Status;
 
-        /* The Application is allowed to call Load once when the address  */
-        /* of the dump only table is being defined by the application.    */
-        RegRecPtr->Buffers[0].BufferPtr = (void *)SrcDataPtr;
-        RegRecPtr->TableLoadedOnce      = true;
-
-        snprintf(RegRecPtr->Buffers[0].DataSource, sizeof(RegRecPtr->Buffers[0].DataSource), "Addr 0x%08lX",
-                 (unsigned long)SrcDataPtr);
-        RegRecPtr->Buffers[0].FileCreateTimeSecs    = 0;
-        RegRecPtr->Buffers[0].FileCreateTimeSubSecs = 0;
-
-        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_SUCCESS_INF_EID, CFE_EVS_EventType_DEBUG, CFE_TBL_Global.TableTaskAppId,
-                                   "Successfully loaded '%s' from '%s'", RegRecPtr->Name,
-                                   RegRecPtr->Buffers[0].DataSource);
-
-        return CFE_SUCCESS;
-    }
-
-    /* Loads by an Application are not allowed if a table load is already in progress */
-    if (RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS)
-    {
-        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_IN_PROGRESS_ERR_EID, CFE_EVS_EventType_ERROR,
-                                   CFE_TBL_Global.TableTaskAppId, "%s: Load already in progress for '%s'", AppName,
-                                   RegRecPtr->Name);
-
-        return CFE_TBL_ERR_LOAD_IN_PROGRESS;
-    }
-
-    /* Obtain a working buffer (either the table's dedicated buffer or one of the shared buffers) */
-    Status = CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, true);
-
-    if (Status != CFE_SUCCESS)
-    {
-        CFE_EVS_SendEventWithAppID(CFE_TBL_NO_WORK_BUFFERS_ERR_EID, CFE_EVS_EventType_ERROR,
-                                   CFE_TBL_Global.TableTaskAppId, "%s: Failed to get Working Buffer (Stat=%u)", AppName,
-                                   (unsigned int)Status);
-
-        return Status;
-    }
-
-    /* Perform appropriate update to working buffer */
-    /* Determine whether the load is to occur from a file or from a block of memory */
-    switch (SrcType)
-    {
-        case CFE_TBL_SRC_FILE:
-            /* Load the data from the file into the specified buffer */
-            Status = CFE_TBL_LoadFromFile(AppName, WorkingBufferPtr, RegRecPtr, (const char *)SrcDataPtr);
-
-            if ((Status == CFE_TBL_WARN_PARTIAL_LOAD) && (!RegRecPtr->TableLoadedOnce))
-            {
-                /* Uninitialized tables cannot be loaded with partial table loads */
-                /* Partial loads can only occur on previously loaded tables.      */
-                CFE_EVS_SendEventWithAppID(CFE_TBL_PARTIAL_LOAD_ERR_EID, CFE_EVS_EventType_ERROR,
-                                           CFE_TBL_Global.TableTaskAppId,
-                                           "%s: Attempted to load from partial Tbl '%s' from '%s' (Stat=%u)", AppName,
-                                           RegRecPtr->Name, (const char *)SrcDataPtr, (unsigned int)Status);
-
-                Status = CFE_TBL_ERR_PARTIAL_LOAD;
-            }
-
-            break;
-        case CFE_TBL_SRC_ADDRESS:
-            /* When the source is a block of memory, it is assumed to be a complete load */
-            memcpy(WorkingBufferPtr->BufferPtr, (uint8 *)SrcDataPtr, RegRecPtr->Size);
-
-            snprintf(WorkingBufferPtr->DataSource, sizeof(WorkingBufferPtr->DataSource), "Addr 0x%08lX",
-                     (unsigned long)SrcDataPtr);
-            WorkingBufferPtr->FileCreateTimeSecs    = 0;
-            WorkingBufferPtr->FileCreateTimeSubSecs = 0;
-
-            /* Compute the CRC on the specified table buffer */
-            WorkingBufferPtr->Crc =
-                CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
-
-            break;
-        default:
-            CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_TYPE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                       CFE_TBL_Global.TableTaskAppId,
-                                       "%s: Attempted to load from illegal source type=%d", AppName, (int)SrcType);
-
-            Status = CFE_TBL_ERR_ILLEGAL_SRC_TYPE;
-    }
-
-    /* If the data was successfully loaded, then validate its contents */
-    if ((Status >= CFE_SUCCESS) && (RegRecPtr->ValidationFuncPtr != NULL))
-    {
-        Status = (RegRecPtr->ValidationFuncPtr)(WorkingBufferPtr->BufferPtr);
-
-        if (Status > CFE_SUCCESS)
-        {
-            CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_VAL_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
-                                       "%s: Validation func return code invalid (Stat=%u) for '%s'", AppName,
-                                       (unsigned int)Status, RegRecPtr->Name);
-
-            Status = -1;
-        }
-
-        if (Status < 0)
-        {
-            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID, CFE_EVS_EventType_ERROR,
-                                       CFE_TBL_Global.TableTaskAppId,
-                                       "%s: Validation func reports table invalid (Stat=%u) for '%s'", AppName,
-                                       (unsigned int)Status, RegRecPtr->Name);
-
-            /* Zero out the buffer to remove any bad data */
-            memset(WorkingBufferPtr->BufferPtr, 0, RegRecPtr->Size);
-        }
-    }
-
-    /* Perform the table update to complete the load */
-    if (Status < CFE_SUCCESS)
-    {
-        /* The load has had a problem, free the working buffer for another attempt */
-        if ((!RegRecPtr->DoubleBuffered) && (RegRecPtr->TableLoadedOnce == true))
-        {
-            /* For single buffered tables, freeing entails resetting flag */
-            CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Taken = false;
-        }
-
-        /* For double buffered tables, freeing buffer is simple */
-        RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
-
-        return Status;
-    }
-
-    FirstTime = !RegRecPtr->TableLoadedOnce;
-
-    /* If this is not the first load, then the data must be moved from the inactive buffer      */
-    /* to the active buffer to complete the load.  First loads are done directly to the active. */
-    if (!FirstTime)
-    {
-        /* Force the table update */
-        RegRecPtr->LoadPending = true;
-
-        Status = CFE_TBL_UpdateInternal(TblHandle, RegRecPtr, AccessDescPtr);
-
-        if (Status != CFE_SUCCESS)
-        {
-            CFE_EVS_SendEventWithAppID(CFE_TBL_UPDATE_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
-                                       "%s: Failed to update '%s' (Stat=%u)", AppName, RegRecPtr->Name,
-                                       (unsigned int)Status);
-        }
-    }
-    else
-    {
-        /* On initial loads, make sure registry is given file/address of data source */
-        strncpy(RegRecPtr->LastFileLoaded, WorkingBufferPtr->DataSource, sizeof(RegRecPtr->LastFileLoaded) - 1);
-        RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 1] = '\0';
-
-        CFE_TBL_NotifyTblUsersOfUpdate(RegRecPtr);
-
-        /* If the table is a critical table, update the appropriate CDS with the new data */
-        if (RegRecPtr->CriticalTable == true)
-        {
-            CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
-        }
-
-        Status = CFE_SUCCESS;
-    }
+    Status = CFE_TBL_LoadInternal(TblHandle, SrcType, SrcDataPtr);
 
-    if (Status == CFE_SUCCESS)
-    {
-        /* The first time a table is loaded, the event message is DEBUG */
-        /* to help eliminate a flood of events during a startup         */
-        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_SUCCESS_INF_EID,
-                                   FirstTime ? CFE_EVS_EventType_DEBUG : CFE_EVS_EventType_INFORMATION,
-                                   CFE_TBL_Global.TableTaskAppId, "Successfully loaded '%s' from '%s'", RegRecPtr->Name,
-                                   RegRecPtr->LastFileLoaded);
-
-        /* Save the index of the table for housekeeping telemetry */
-        CFE_TBL_Global.LastTblUpdated = AccessDescPtr->RegIndex;
-    }
+    CFE_TRACE_POINT(TBL_LOAD, TblHandle, Status);
 
     return Status;
 }
@@ -962,6 +799,8 @@ CFE_Status_t CFE_TBL_Update(CFE_TBL_Handle_t TblHandle)
         }
     }
 
+    CFE_TRACE_POINT(TBL_UPDATE, TblHandle, Status);
+
     return Status;
 }
 
@@ -1019,8 +858,14 @@ CFE_Status_t CFE_TBL_ReleaseAddress(CFE_TBL_Handle_t TblHandle)
 
     if (Status == CFE_SUCCESS)
     {
-        /* Clear the lock flag */
-        CFE_TBL_Global.Handles[TblHandle].LockFlag = false;
+        /* Unpin the buffer this thread was accessing, after all of its reads of the table */
+        CFE_TBL_EPOCH_STORE(CFE_TBL_Global.Handles[TblHandle].PinnedEpoch, CFE_TBL_NO_EPOCH_PINNED);
+
+        /* Order the unpin before the check of the retired buffer's pins */
+        CFE_TBL_EPOCH_FENCE();
+
+        /* If an update retired the buffer while it was pinned, this may have been the last reader */
+        CFE_TBL_ReclaimRetiredBuffer(&CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[TblHandle].RegIndex]);
 
         /* Return any pending warning or info status indicators */
         Status = CFE_TBL_GetNextNotification(TblHandle);
@@ -1135,6 +980,7 @@ CFE_Status_t CFE_TBL_Validate(CFE_TBL_Handle_t TblHandle)
     CFE_ES_AppId_t              ThisAppId;
     CFE_TBL_RegistryRec_t *     RegRecPtr;
     CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_LoadBuff_t *        InactiveBufPtr;
     char                        AppName[OS_MAX_API_NAME] = {"UNKNOWN"};
 
     /* Verify that this application has the right to perform operation */
@@ -1151,58 +997,10 @@ CFE_Status_t CFE_TBL_Validate(CFE_TBL_Handle_t TblHandle)
         /* Identify the image to be validated, starting with the Inactive Buffer */
         if (RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING)
         {
-            /* Identify whether the Inactive Buffer is a shared buffer or a dedicated one */
-            if (RegRecPtr->DoubleBuffered)
-            {
-                /* Call the Application's Validation function for the Inactive Buffer */
-                Status =
-                    (RegRecPtr->ValidationFuncPtr)(RegRecPtr->Buffers[(1U - RegRecPtr->ActiveBufferIndex)].BufferPtr);
-
-                /* Allow buffer to be activated after passing validation */
-                if (Status == CFE_SUCCESS)
-                {
-                    RegRecPtr->Buffers[(1U - RegRecPtr->ActiveBufferIndex)].Validated = true;
-                }
-            }
-            else
-            {
-                /* Call the Application's Validation function for the appropriate shared buffer */
-                Status = (RegRecPtr->ValidationFuncPtr)(CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr);
-
-                /* Allow buffer to be activated after passing validation */
-                if (Status == CFE_SUCCESS)
-                {
-                    CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Validated = true;
-                }
-            }
-
-            if (Status == CFE_SUCCESS)
-            {
-                CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                           CFE_TBL_Global.TableTaskAppId, "%s validation successful for Inactive '%s'",
-                                           AppName, RegRecPtr->Name);
-            }
-            else
-            {
-                CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID, CFE_EVS_EventType_ERROR,
-                                           CFE_TBL_Global.TableTaskAppId,
-                                           "%s validation failed for Inactive '%s', Status=0x%08X", AppName,
-                                           RegRecPtr->Name, (unsigned int)Status);
-
-                if (Status > CFE_SUCCESS)
-                {
-                    CFE_ES_WriteToSysLog("%s: App(%lu) Validation func return code invalid (Stat=0x%08X) for '%s'\n",
-                                         __func__, CFE_RESOURCEID_TO_ULONG(CFE_TBL_Global.TableTaskAppId),
-                                         (unsigned int)Status, RegRecPtr->Name);
-                }
-            }
-
-            /* Save the result of the Validation function for the Table Services Task */
-            CFE_TBL_Global.ValidationResults[RegRecPtr->ValidateInactiveIndex].Result = Status;
-
-            /* Once validation is complete, set flags to indicate response is ready */
-            CFE_TBL_Global.ValidationResults[RegRecPtr->ValidateInactiveIndex].State = CFE_TBL_VALIDATION_PERFORMED;
-            RegRecPtr->ValidateInactiveIndex                                         = CFE_TBL_NO_VALIDATION_PENDING;
+            InactiveBufPtr = CFE_TBL_GetInactiveBuffer(RegRecPtr);
+            Status         = CFE_TBL_ValidateInactiveBuffer(RegRecPtr, InactiveBufPtr, AppName);
+            CFE_TBL_CompleteValidation(InactiveBufPtr, RegRecPtr->ValidateInactiveIndex, Status);
+            RegRecPtr->ValidateInactiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
 
             /* Since the validation was successfully performed (although maybe not a successful result) */
             /* return a success status */
@@ -1327,6 +1125,90 @@ CFE_Status_t CFE_TBL_Manage(CFE_TBL_Handle_t TblHandle)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TBL_ManageAll(CFE_ES_AppId_t AppId)
+{
+    int32                       Status = CFE_SUCCESS;
+    int32                       ManageStatus;
+    uint32                      AppIndex;
+    uint32                      PendingWork;
+    uint32                      Count = 0;
+    CFE_TBL_Handle_t            TblHandle;
+    CFE_TBL_Handle_t            NextHandle;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_RegistryRec_t *     RegRecPtr;
+
+    if (CFE_ES_AppID_ToIndex(AppId, &AppIndex) != CFE_SUCCESS || AppIndex >= CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    /* Nothing needs to be locked or scanned when none of the Application's tables has a request pending */
+    if (CFE_TBL_EPOCH_LOAD(CFE_TBL_Global.PendingWork[AppIndex]) == 0)
+    {
+        return CFE_SUCCESS;
+    }
+
+    /*
+    ** Requests made from here on are seen on the next call.  The fence keeps the
+    ** table state read below from being loaded ahead of clearing the mask, so a
+    ** request is either seen now or left marked for the next call.
+    */
+    CFE_TBL_LockRegistry();
+    CFE_TBL_EPOCH_STORE(CFE_TBL_Global.PendingWork[AppIndex], 0);
+    CFE_TBL_UnlockRegistry();
+    CFE_TBL_EPOCH_FENCE();
+
+    /* Only the Application itself adds or removes handles on its own list */
+    TblHandle = CFE_TBL_Global.Index.AppHandleHead[AppIndex];
+    while (TblHandle != CFE_TBL_END_OF_LIST && Count < CFE_PLATFORM_TBL_MAX_NUM_HANDLES)
+    {
+        AccessDescPtr = &CFE_TBL_Global.Handles[TblHandle];
+        NextHandle    = CFE_TBL_Global.Index.AppNextHandle[TblHandle];
+
+        if (AccessDescPtr->UsedFlag && CFE_RESOURCEID_TEST_EQUAL(AccessDescPtr->AppId, AppId))
+        {
+            RegRecPtr = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
+
+            /* Only the owner of a table services its requests */
+            if (CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, AppId) && CFE_TBL_GetPendingWork(RegRecPtr) != 0)
+            {
+                ManageStatus = CFE_TBL_Manage(TblHandle);
+
+                /* Anything that could not be serviced now (e.g. a locked table) is retried on the next call */
+                PendingWork = CFE_TBL_GetPendingWork(RegRecPtr);
+                if (PendingWork != 0)
+                {
+                    CFE_TBL_MarkPendingWork(RegRecPtr, PendingWork);
+                }
+
+                /* Report the first error encountered, otherwise whether any table was updated */
+                if (ManageStatus < 0)
+                {
+                    if (Status >= 0)
+                    {
+                        Status = ManageStatus;
+                    }
+                }
+                else if (ManageStatus == CFE_TBL_INFO_UPDATED && Status == CFE_SUCCESS)
+                {
+                    Status = CFE_TBL_INFO_UPDATED;
+                }
+            }
+        }
+
+        TblHandle = NextHandle;
+        Count++;
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -1435,6 +1317,43 @@ CFE_Status_t CFE_TBL_GetInfo(CFE_TBL_Info_t *TblInfoPtr, const char *TblName)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TBL_GetLoadRange(CFE_TBL_Handle_t TblHandle, size_t *OffsetPtr, size_t *NumBytesPtr)
+{
+    int32          Status;
+    CFE_ES_AppId_t ThisAppId;
+
+    if (OffsetPtr == NULL || NumBytesPtr == NULL)
+    {
+        return CFE_TBL_BAD_ARGUMENT;
+    }
+
+    /*
+    ** Verify that the caller has the right to perform operation.  Validation functions
+    ** that call this API from a validation worker run as a child task of Table Services,
+    ** so they are granted access as the Table Services application.
+    */
+    Status = CFE_TBL_ValidateAccess(TblHandle, &ThisAppId);
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_TBL_GetLoadRangeInternal(&CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[TblHandle].RegIndex],
+                                              OffsetPtr, NumBytesPtr);
+    }
+    else
+    {
+        CFE_ES_WriteToSysLog("%s: App(%lu) does not have access to Tbl Handle=%d\n", __func__,
+                             CFE_RESOURCEID_TO_ULONG(ThisAppId), (int)TblHandle);
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -1511,6 +1430,10 @@ CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle)
         RegRecPtr->TimeOfLastUpdate                                      = CFE_TIME_GetTime();
         RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 1] = '\0';
 
+        /* The active buffer may have changed anywhere, so the inactive buffer can no longer be trusted */
+        RegRecPtr->DirtyOffset   = 0;
+        RegRecPtr->DirtyNumBytes = RegRecPtr->Size;
+
         /* Update CRC on contents of table */
         RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Crc = CFE_ES_CalculateCRC(
             RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
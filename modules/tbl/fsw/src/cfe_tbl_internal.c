@@ -65,6 +65,9 @@ int32 CFE_TBL_EarlyInit(void)
         CFE_TBL_Global.Handles[i].NextLink = CFE_TBL_END_OF_LIST;
     }
 
+    /* Every registry entry and access descriptor starts out on its free list */
+    CFE_TBL_RebuildRegistryIndex();
+
     /* Initialize the Table Validation Results Records nonzero values */
     for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_VALIDATIONS; i++)
     {
@@ -205,8 +208,11 @@ void CFE_TBL_InitRegistryRecord(CFE_TBL_RegistryRec_t *RegRecPtr)
     RegRecPtr->LoadInProgress        = CFE_TBL_NO_LOAD_IN_PROGRESS;
     RegRecPtr->ValidateActiveIndex   = CFE_TBL_NO_VALIDATION_PENDING;
     RegRecPtr->ValidateInactiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
+    RegRecPtr->AsyncValidateIndex    = CFE_TBL_NO_VALIDATION_PENDING;
+    RegRecPtr->AsyncValidateBufPtr   = NULL;
     RegRecPtr->CDSHandle             = CFE_ES_CDS_BAD_HANDLE;
     RegRecPtr->DumpControlIndex      = CFE_TBL_NO_DUMP_PENDING;
+    RegRecPtr->ActiveEpoch           = CFE_TBL_NO_EPOCH_PINNED + 1;
 }
 
 /*----------------------------------------------------------------
@@ -296,6 +302,7 @@ int32 CFE_TBL_CheckAccessRights(CFE_TBL_Handle_t TblHandle, CFE_ES_AppId_t ThisA
 int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
 {
     int32                       Status        = CFE_SUCCESS;
+    uint32                      i;
     CFE_TBL_AccessDescriptor_t *AccessDescPtr = &CFE_TBL_Global.Handles[TblHandle];
     CFE_TBL_RegistryRec_t *     RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
 
@@ -329,10 +336,14 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
 
     /* Return the Access Descriptor to the pool */
     AccessDescPtr->UsedFlag = false;
+    CFE_TBL_ReleaseHandle(TblHandle);
 
     /* If this was the last Access Descriptor for this table, we can free the memory buffers as well */
     if (RegRecPtr->HeadOfAccessList == CFE_TBL_END_OF_LIST)
     {
+        /* Background dumps must stop reading the buffers before they are released */
+        CFE_TBL_AbortDumps(RegRecPtr);
+
         /* Only free memory that we have allocated.  If the image is User Defined, then don't bother */
         if (RegRecPtr->UserDefAddr == false)
         {
@@ -359,6 +370,23 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
                                          (unsigned int)Status, CFE_RESOURCEID_TO_ULONG(CFE_TBL_Global.Buf.PoolHdl),
                                          (unsigned long)RegRecPtr->Buffers[1].BufferPtr);
                 }
+
+                /* Spare buffers of a multi-buffered table go back to the pool too */
+                for (i = 0; i < CFE_TBL_NUM_SPARE_BUFFERS; i++)
+                {
+                    if (RegRecPtr->SpareBufferPtr[i] != NULL)
+                    {
+                        Status = CFE_ES_PutPoolBuf(CFE_TBL_Global.Buf.PoolHdl, RegRecPtr->SpareBufferPtr[i]);
+                        RegRecPtr->SpareBufferPtr[i] = NULL;
+
+                        if (Status < 0)
+                        {
+                            CFE_ES_WriteToSysLog("%s: PutPoolBuf[Spare] Fail Stat=0x%08X, Hndl=0x%08lX\n", __func__,
+                                                 (unsigned int)Status,
+                                                 CFE_RESOURCEID_TO_ULONG(CFE_TBL_Global.Buf.PoolHdl));
+                        }
+                    }
+                }
             }
             else
             {
@@ -369,8 +397,28 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
                     CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Taken = false;
                     RegRecPtr->LoadInProgress                                 = CFE_TBL_NO_LOAD_IN_PROGRESS;
                 }
+
+                /* A buffer retired by an update may still be waiting for its last reader to release it */
+                if (RegRecPtr->RetiredBufferPtr != NULL)
+                {
+                    Status = CFE_ES_PutPoolBuf(CFE_TBL_Global.Buf.PoolHdl, RegRecPtr->RetiredBufferPtr);
+                    RegRecPtr->RetiredBufferPtr = NULL;
+
+                    if (Status < 0)
+                    {
+                        CFE_ES_WriteToSysLog("%s: PutPoolBuf[Retired] Fail Stat=0x%08X, Hndl=0x%08lX\n", __func__,
+                                             (unsigned int)Status,
+                                             CFE_RESOURCEID_TO_ULONG(CFE_TBL_Global.Buf.PoolHdl));
+                    }
+                }
             }
         }
+
+        /* Once the owner is gone too, the entry can be registered again */
+        if (CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, CFE_TBL_NOT_OWNED))
+        {
+            CFE_TBL_ReleaseRegistryEntry(AccessDescPtr->RegIndex);
+        }
     }
 
     /* Unlock the registry to allow others to modify it */
@@ -388,6 +436,7 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
 int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, CFE_ES_AppId_t ThisAppId)
 {
     int32                       Status;
+    uint32                      Epoch;
     CFE_TBL_AccessDescriptor_t *AccessDescPtr;
     CFE_TBL_RegistryRec_t *     RegRecPtr;
 
@@ -417,15 +466,25 @@ int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, CFE_
             }
             else /* Table Registry Entry is valid */
             {
-                /* Lock the table and return the current pointer */
-                AccessDescPtr->LockFlag = true;
+                /* Pin the current publication epoch and return the current pointer.  Updates publish */
+                /* the new buffer before advancing the epoch, so if the epoch moved while the pointer  */
+                /* was being read, retry to make sure the pin covers the buffer actually returned.     */
+                do
+                {
+                    Epoch = CFE_TBL_EPOCH_LOAD(RegRecPtr->ActiveEpoch);
+                    CFE_TBL_EPOCH_STORE(AccessDescPtr->PinnedEpoch, Epoch);
+
+                    /* Save the buffer we are using in the access descriptor */
+                    /* This is used to ensure that if the buffer becomes inactive while */
+                    /* we are using it, no one will modify it until we are done */
+                    AccessDescPtr->BufferIndex = RegRecPtr->ActiveBufferIndex;
 
-                /* Save the buffer we are using in the access descriptor */
-                /* This is used to ensure that if the buffer becomes inactive while */
-                /* we are using it, no one will modify it until we are done */
-                AccessDescPtr->BufferIndex = RegRecPtr->ActiveBufferIndex;
+                    *TblPtr                        = RegRecPtr->Buffers[AccessDescPtr->BufferIndex].BufferPtr;
+                    AccessDescPtr->PinnedBufferPtr = *TblPtr;
 
-                *TblPtr = RegRecPtr->Buffers[AccessDescPtr->BufferIndex].BufferPtr;
+                    /* The pin must be visible to updates before the epoch is checked again */
+                    CFE_TBL_EPOCH_FENCE();
+                } while (Epoch != CFE_TBL_EPOCH_LOAD(RegRecPtr->ActiveEpoch));
 
                 /* Return any pending warning or info status indicators */
                 Status = CFE_TBL_GetNextNotification(TblHandle);
@@ -446,6 +505,8 @@ int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, CFE_
                              (int)TblHandle);
     }
 
+    CFE_TRACE_POINT(TBL_LOCK, TblHandle, Status);
+
     return Status;
 }
 
@@ -483,25 +544,27 @@ int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle)
  *-----------------------------------------------------------------*/
 int16 CFE_TBL_FindTableInRegistry(const char *TblName)
 {
-    int16 RegIndx = CFE_TBL_NOT_FOUND;
-    int16 i       = -1;
+    int16  RegIndx = CFE_TBL_Global.Index.NameBucketHead[CFE_TBL_NameIndexBucket(TblName)];
+    uint32 Count   = 0;
 
-    do
+    /* Only owned entries are indexed, but an entry is re-checked in case it was released meanwhile */
+    while ((RegIndx != CFE_TBL_NOT_FOUND) && (Count < CFE_PLATFORM_TBL_MAX_NUM_TABLES))
     {
-        /* Point to next record in the Table Registry */
-        i++;
-
-        /* Check to see if the record is currently being used */
-        if (!CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[i].OwnerAppId, CFE_TBL_NOT_OWNED))
+        /* Perform a case sensitive name comparison */
+        if (!CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[RegIndx].OwnerAppId, CFE_TBL_NOT_OWNED) &&
+            (strcmp(TblName, CFE_TBL_Global.Registry[RegIndx].Name) == 0))
         {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(TblName, CFE_TBL_Global.Registry[i].Name) == 0)
-            {
-                /* If the names match, then return the index */
-                RegIndx = i;
-            }
+            break;
         }
-    } while ((RegIndx == CFE_TBL_NOT_FOUND) && (i < (CFE_PLATFORM_TBL_MAX_NUM_TABLES - 1)));
+
+        RegIndx = CFE_TBL_Global.Index.NextInBucket[RegIndx];
+        Count++;
+    }
+
+    if (Count >= CFE_PLATFORM_TBL_MAX_NUM_TABLES)
+    {
+        RegIndx = CFE_TBL_NOT_FOUND;
+    }
 
     return RegIndx;
 }
@@ -514,13 +577,38 @@ int16 CFE_TBL_FindTableInRegistry(const char *TblName)
  *-----------------------------------------------------------------*/
 int16 CFE_TBL_FindFreeRegistryEntry(void)
 {
-    int16 RegIndx = CFE_TBL_NOT_FOUND;
-    int16 i       = 0;
+    CFE_TBL_RegistryIndex_t *IndexPtr = &CFE_TBL_Global.Index;
+    int16                    RegIndx  = CFE_TBL_NOT_FOUND;
+    int16                    i        = 0;
+    uint32                   Count    = 0;
+
+    /* A Table Registry is only "Free" when there isn't an owner AND */
+    /* all other applications are not sharing or locking the table   */
+    while ((IndexPtr->FreeEntryHead != CFE_TBL_NOT_FOUND) && (RegIndx == CFE_TBL_NOT_FOUND))
+    {
+        i = IndexPtr->FreeEntryHead;
+
+        if (CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[i].OwnerAppId, CFE_TBL_NOT_OWNED) &&
+            (CFE_TBL_Global.Registry[i].HeadOfAccessList == CFE_TBL_END_OF_LIST))
+        {
+            RegIndx = i;
+        }
+        else if (Count < CFE_PLATFORM_TBL_MAX_NUM_TABLES)
+        {
+            /* Drop an entry that was taken without going through the free list */
+            IndexPtr->FreeEntryHead = IndexPtr->NextFreeEntry[i];
+            Count++;
+        }
+        else
+        {
+            IndexPtr->FreeEntryHead = CFE_TBL_NOT_FOUND;
+        }
+    }
 
+    /* The free list only runs dry when the registry is full; make sure of it */
+    i = 0;
     while ((RegIndx == CFE_TBL_NOT_FOUND) && (i < CFE_PLATFORM_TBL_MAX_NUM_TABLES))
     {
-        /* A Table Registry is only "Free" when there isn't an owner AND */
-        /* all other applications are not sharing or locking the table   */
         if (CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[i].OwnerAppId, CFE_TBL_NOT_OWNED) &&
             (CFE_TBL_Global.Registry[i].HeadOfAccessList == CFE_TBL_END_OF_LIST))
         {
@@ -543,9 +631,33 @@ int16 CFE_TBL_FindFreeRegistryEntry(void)
  *-----------------------------------------------------------------*/
 CFE_TBL_Handle_t CFE_TBL_FindFreeHandle(void)
 {
-    CFE_TBL_Handle_t HandleIndx = CFE_TBL_END_OF_LIST;
-    int16            i          = 0;
+    CFE_TBL_RegistryIndex_t *IndexPtr   = &CFE_TBL_Global.Index;
+    CFE_TBL_Handle_t         HandleIndx = CFE_TBL_END_OF_LIST;
+    CFE_TBL_Handle_t         i          = 0;
+    uint32                   Count      = 0;
+
+    while ((IndexPtr->FreeHandleHead != CFE_TBL_END_OF_LIST) && (HandleIndx == CFE_TBL_END_OF_LIST))
+    {
+        i = IndexPtr->FreeHandleHead;
+
+        if (CFE_TBL_Global.Handles[i].UsedFlag == false)
+        {
+            HandleIndx = i;
+        }
+        else if (Count < CFE_PLATFORM_TBL_MAX_NUM_HANDLES)
+        {
+            /* Drop a descriptor that was taken without going through the free list */
+            IndexPtr->FreeHandleHead = IndexPtr->NextFreeHandle[i];
+            Count++;
+        }
+        else
+        {
+            IndexPtr->FreeHandleHead = CFE_TBL_END_OF_LIST;
+        }
+    }
 
+    /* The free list only runs dry when all handles are in use; make sure of it */
+    i = 0;
     while ((HandleIndx == CFE_TBL_END_OF_LIST) && (i < CFE_PLATFORM_TBL_MAX_NUM_HANDLES))
     {
         if (CFE_TBL_Global.Handles[i].UsedFlag == false)
@@ -561,6 +673,262 @@ CFE_TBL_Handle_t CFE_TBL_FindFreeHandle(void)
     return HandleIndx;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_TBL_NameIndexBucket(const char *TblName)
+{
+    uint32 Hash = 2166136261U; /* FNV-1a offset basis */
+
+    while (*TblName != '\0')
+    {
+        Hash ^= (uint8)*TblName;
+        Hash *= 16777619U; /* FNV-1a prime */
+        TblName++;
+    }
+
+    return Hash % CFE_PLATFORM_TBL_MAX_NUM_TABLES;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_ClaimRegistryEntry(int16 RegIndx)
+{
+    CFE_TBL_RegistryIndex_t *IndexPtr = &CFE_TBL_Global.Index;
+    uint32                   Bucket;
+    int16                    i;
+    uint32                   Count = 0;
+
+    /* The entry handed out by CFE_TBL_FindFreeRegistryEntry is the head of the free list */
+    if (IndexPtr->FreeEntryHead == RegIndx)
+    {
+        IndexPtr->FreeEntryHead = IndexPtr->NextFreeEntry[RegIndx];
+    }
+
+    /* Index the entry by name unless it already is */
+    Bucket = CFE_TBL_NameIndexBucket(CFE_TBL_Global.Registry[RegIndx].Name);
+    i      = IndexPtr->NameBucketHead[Bucket];
+    while ((i != CFE_TBL_NOT_FOUND) && (i != RegIndx) && (Count < CFE_PLATFORM_TBL_MAX_NUM_TABLES))
+    {
+        i = IndexPtr->NextInBucket[i];
+        Count++;
+    }
+
+    if (i != RegIndx)
+    {
+        IndexPtr->NextInBucket[RegIndx] = IndexPtr->NameBucketHead[Bucket];
+        IndexPtr->NameBucketHead[Bucket] = RegIndx;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_RemoveFromNameIndex(int16 RegIndx)
+{
+    CFE_TBL_RegistryIndex_t *IndexPtr = &CFE_TBL_Global.Index;
+    uint32                   Bucket;
+    int16                    i;
+    int16                    Prev  = CFE_TBL_NOT_FOUND;
+    uint32                   Count = 0;
+
+    Bucket = CFE_TBL_NameIndexBucket(CFE_TBL_Global.Registry[RegIndx].Name);
+    i      = IndexPtr->NameBucketHead[Bucket];
+    while ((i != CFE_TBL_NOT_FOUND) && (i != RegIndx) && (Count < CFE_PLATFORM_TBL_MAX_NUM_TABLES))
+    {
+        Prev = i;
+        i    = IndexPtr->NextInBucket[i];
+        Count++;
+    }
+
+    if (i == RegIndx)
+    {
+        if (Prev == CFE_TBL_NOT_FOUND)
+        {
+            IndexPtr->NameBucketHead[Bucket] = IndexPtr->NextInBucket[RegIndx];
+        }
+        else
+        {
+            IndexPtr->NextInBucket[Prev] = IndexPtr->NextInBucket[RegIndx];
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_ReleaseRegistryEntry(int16 RegIndx)
+{
+    CFE_TBL_Global.Index.NextFreeEntry[RegIndx] = CFE_TBL_Global.Index.FreeEntryHead;
+    CFE_TBL_Global.Index.FreeEntryHead          = RegIndx;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_ClaimHandle(CFE_TBL_Handle_t TblHandle)
+{
+    CFE_TBL_RegistryIndex_t *IndexPtr = &CFE_TBL_Global.Index;
+    uint32                   AppIndex;
+
+    /* The descriptor handed out by CFE_TBL_FindFreeHandle is the head of the free list */
+    if (IndexPtr->FreeHandleHead == TblHandle)
+    {
+        IndexPtr->FreeHandleHead = IndexPtr->NextFreeHandle[TblHandle];
+    }
+
+    /* Add the descriptor to the list of those held by its application */
+    CFE_TBL_UnlinkAppHandle(TblHandle);
+
+    if (CFE_ES_AppID_ToIndex(CFE_TBL_Global.Handles[TblHandle].AppId, &AppIndex) == CFE_SUCCESS &&
+        AppIndex < CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        IndexPtr->AppNextHandle[TblHandle] = IndexPtr->AppHandleHead[AppIndex];
+        IndexPtr->AppPrevHandle[TblHandle] = CFE_TBL_END_OF_LIST;
+
+        if (IndexPtr->AppHandleHead[AppIndex] != CFE_TBL_END_OF_LIST)
+        {
+            IndexPtr->AppPrevHandle[IndexPtr->AppHandleHead[AppIndex]] = TblHandle;
+        }
+
+        IndexPtr->AppHandleHead[AppIndex] = TblHandle;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_ReleaseHandle(CFE_TBL_Handle_t TblHandle)
+{
+    CFE_TBL_UnlinkAppHandle(TblHandle);
+
+    CFE_TBL_Global.Index.NextFreeHandle[TblHandle] = CFE_TBL_Global.Index.FreeHandleHead;
+    CFE_TBL_Global.Index.FreeHandleHead            = TblHandle;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_UnlinkAppHandle(CFE_TBL_Handle_t TblHandle)
+{
+    CFE_TBL_RegistryIndex_t *IndexPtr = &CFE_TBL_Global.Index;
+    CFE_TBL_Handle_t         Prev     = IndexPtr->AppPrevHandle[TblHandle];
+    CFE_TBL_Handle_t         Next     = IndexPtr->AppNextHandle[TblHandle];
+    uint32                   AppIndex;
+
+    if (Prev != CFE_TBL_END_OF_LIST)
+    {
+        IndexPtr->AppNextHandle[Prev] = Next;
+    }
+    else if (CFE_ES_AppID_ToIndex(CFE_TBL_Global.Handles[TblHandle].AppId, &AppIndex) == CFE_SUCCESS &&
+             AppIndex < CFE_PLATFORM_ES_MAX_APPLICATIONS && IndexPtr->AppHandleHead[AppIndex] == TblHandle)
+    {
+        IndexPtr->AppHandleHead[AppIndex] = Next;
+    }
+    else
+    {
+        /* Not on any list */
+        return;
+    }
+
+    if (Next != CFE_TBL_END_OF_LIST)
+    {
+        IndexPtr->AppPrevHandle[Next] = Prev;
+    }
+
+    IndexPtr->AppPrevHandle[TblHandle] = CFE_TBL_END_OF_LIST;
+    IndexPtr->AppNextHandle[TblHandle] = CFE_TBL_END_OF_LIST;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_RebuildRegistryIndex(void)
+{
+    CFE_TBL_RegistryIndex_t *IndexPtr = &CFE_TBL_Global.Index;
+    CFE_TBL_RegistryRec_t *  RegRecPtr;
+    uint32                   Bucket;
+    int32                    i;
+
+    IndexPtr->FreeEntryHead = CFE_TBL_NOT_FOUND;
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_TABLES; i++)
+    {
+        IndexPtr->NameBucketHead[i] = CFE_TBL_NOT_FOUND;
+        IndexPtr->NextInBucket[i]   = CFE_TBL_NOT_FOUND;
+        IndexPtr->NextFreeEntry[i]  = CFE_TBL_NOT_FOUND;
+    }
+
+    /* Walk backwards so that the lowest numbered entries are handed out first */
+    for (i = CFE_PLATFORM_TBL_MAX_NUM_TABLES - 1; i >= 0; i--)
+    {
+        RegRecPtr = &CFE_TBL_Global.Registry[i];
+
+        if (!CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, CFE_TBL_NOT_OWNED))
+        {
+            Bucket                           = CFE_TBL_NameIndexBucket(RegRecPtr->Name);
+            IndexPtr->NextInBucket[i]        = IndexPtr->NameBucketHead[Bucket];
+            IndexPtr->NameBucketHead[Bucket] = i;
+        }
+        else if (RegRecPtr->HeadOfAccessList == CFE_TBL_END_OF_LIST)
+        {
+            IndexPtr->NextFreeEntry[i] = IndexPtr->FreeEntryHead;
+            IndexPtr->FreeEntryHead    = i;
+        }
+    }
+
+    IndexPtr->FreeHandleHead = CFE_TBL_END_OF_LIST;
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; i++)
+    {
+        IndexPtr->AppHandleHead[i] = CFE_TBL_END_OF_LIST;
+    }
+
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_HANDLES; i++)
+    {
+        IndexPtr->NextFreeHandle[i] = CFE_TBL_END_OF_LIST;
+        IndexPtr->AppNextHandle[i]  = CFE_TBL_END_OF_LIST;
+        IndexPtr->AppPrevHandle[i]  = CFE_TBL_END_OF_LIST;
+    }
+
+    for (i = CFE_PLATFORM_TBL_MAX_NUM_HANDLES - 1; i >= 0; i--)
+    {
+        if (CFE_TBL_Global.Handles[i].UsedFlag == false)
+        {
+            IndexPtr->NextFreeHandle[i] = IndexPtr->FreeHandleHead;
+            IndexPtr->FreeHandleHead    = i;
+        }
+        else
+        {
+            /* Claiming an in-use descriptor just adds it to its application's list */
+            CFE_TBL_ClaimHandle(i);
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -648,12 +1016,32 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
     /* Initialize return pointer to NULL */
     *WorkingBufferPtr = NULL;
 
+    /* The inactive buffer cannot be reloaded while a validation worker is reading it */
+    if (RegRecPtr->AsyncValidateIndex != CFE_TBL_NO_VALIDATION_PENDING)
+    {
+        CFE_ES_WriteToSysLog("%s: Inactive buffer of '%s' is being validated\n", __func__, RegRecPtr->Name);
+        return CFE_TBL_ERR_NO_BUFFER_AVAIL;
+    }
+
     /* If a load is already in progress, return the previously allocated working buffer */
     if (RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS)
     {
         if (RegRecPtr->DoubleBuffered)
         {
-            *WorkingBufferPtr = &RegRecPtr->Buffers[(1U - RegRecPtr->ActiveBufferIndex)];
+            /* A background dump of the inactive image reads it straight from the buffer */
+            CFE_TBL_LockRegistry();
+            if (CFE_TBL_IsDumpPinned(RegRecPtr, RegRecPtr->ActiveEpoch - 1))
+            {
+                Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
+
+                CFE_ES_WriteToSysLog("%s: Inactive Dbl Buff Locked for '%s' by table dump\n", __func__,
+                                     RegRecPtr->Name);
+            }
+            else
+            {
+                *WorkingBufferPtr = &RegRecPtr->Buffers[(1U - RegRecPtr->ActiveBufferIndex)];
+            }
+            CFE_TBL_UnlockRegistry();
         }
         else
         {
@@ -686,22 +1074,44 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
                 /* Determine the index of the Inactive Buffer Pointer */
                 InactiveBufferIndex = 1 - RegRecPtr->ActiveBufferIndex;
 
-                /* Scan the access descriptor table to determine if anyone is still using the inactive buffer */
-                AccessIterator = RegRecPtr->HeadOfAccessList;
-                while ((AccessIterator != CFE_TBL_END_OF_LIST) && (Status == CFE_SUCCESS))
+                if (RegRecPtr->MultiBuffered)
+                {
+                    /* Rather than waiting for readers of the inactive buffer, trade it for a spare */
+                    CFE_TBL_LockRegistry();
+                    Status = CFE_TBL_SwapInSpareBuffer(RegRecPtr);
+                }
+                else
                 {
-                    if ((CFE_TBL_Global.Handles[AccessIterator].BufferIndex == InactiveBufferIndex) &&
-                        (CFE_TBL_Global.Handles[AccessIterator].LockFlag))
+                    /* Scan the access descriptor table to determine if anyone is still using the inactive buffer */
+                    AccessIterator = RegRecPtr->HeadOfAccessList;
+                    while ((AccessIterator != CFE_TBL_END_OF_LIST) && (Status == CFE_SUCCESS))
                     {
-                        Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
+                        if ((CFE_TBL_Global.Handles[AccessIterator].BufferIndex == InactiveBufferIndex) &&
+                            (CFE_TBL_EPOCH_LOAD(CFE_TBL_Global.Handles[AccessIterator].PinnedEpoch) !=
+                             CFE_TBL_NO_EPOCH_PINNED))
+                        {
+                            Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
+
+                            CFE_ES_WriteToSysLog("%s: Inactive Dbl Buff Locked for '%s' by AppId=%lu\n", __func__,
+                                                 RegRecPtr->Name,
+                                                 CFE_RESOURCEID_TO_ULONG(CFE_TBL_Global.Handles[AccessIterator].AppId));
+                        }
 
-                        CFE_ES_WriteToSysLog("%s: Inactive Dbl Buff Locked for '%s' by AppId=%lu\n", __func__,
-                                             RegRecPtr->Name,
-                                             CFE_RESOURCEID_TO_ULONG(CFE_TBL_Global.Handles[AccessIterator].AppId));
+                        /* Move to next access descriptor in linked list */
+                        AccessIterator = CFE_TBL_Global.Handles[AccessIterator].NextLink;
                     }
 
-                    /* Move to next access descriptor in linked list */
-                    AccessIterator = CFE_TBL_Global.Handles[AccessIterator].NextLink;
+                    /* Claim the buffer under the registry lock so a dump cannot start reading it meanwhile */
+                    CFE_TBL_LockRegistry();
+
+                    /* A background dump of the inactive image reads it straight from the buffer */
+                    if ((Status == CFE_SUCCESS) && CFE_TBL_IsDumpPinned(RegRecPtr, RegRecPtr->ActiveEpoch - 1))
+                    {
+                        Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
+
+                        CFE_ES_WriteToSysLog("%s: Inactive Dbl Buff Locked for '%s' by table dump\n", __func__,
+                                             RegRecPtr->Name);
+                    }
                 }
 
                 /* If buffer is free, then return the pointer to it */
@@ -710,6 +1120,8 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
                     *WorkingBufferPtr         = &RegRecPtr->Buffers[InactiveBufferIndex];
                     RegRecPtr->LoadInProgress = InactiveBufferIndex;
                 }
+
+                CFE_TBL_UnlockRegistry();
             }
             else /* Single Buffered Table */
             {
@@ -752,12 +1164,21 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
                 OS_MutSemGive(CFE_TBL_Global.WorkBufMutex);
             }
 
-            if ((*WorkingBufferPtr) != NULL &&
-                (*WorkingBufferPtr)->BufferPtr != RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr)
+            if ((*WorkingBufferPtr) != NULL)
             {
-                /* In case the file contains a partial table load, get the active buffer contents first */
-                memcpy((*WorkingBufferPtr)->BufferPtr, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
-                       RegRecPtr->Size);
+                /* In case the file contains a partial table load, the active buffer contents are needed in the */
+                /* parts of the table the load does not cover.  That copy is deferred to the loader (see         */
+                /* CFE_TBL_PrefillWorkingBuffer) so that loads of the entire table do not pay for it.             */
+                (*WorkingBufferPtr)->Prefilled =
+                    ((*WorkingBufferPtr)->BufferPtr == RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr);
+
+                /* The inactive buffer of a double buffered table only differs from the active buffer where */
+                /* the last loads were made, so its dirty range is kept.  Anything else is unknown.          */
+                if ((!RegRecPtr->DoubleBuffered) || ((*WorkingBufferPtr)->Prefilled))
+                {
+                    RegRecPtr->DirtyOffset   = 0;
+                    RegRecPtr->DirtyNumBytes = RegRecPtr->Size;
+                }
             }
         }
     }
@@ -771,140 +1192,1175 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr,
-                           const char *Filename)
+void CFE_TBL_PrefillWorkingBuffer(CFE_TBL_LoadBuff_t *WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr, size_t Offset,
+                                  size_t NumBytes)
 {
-    int32              Status = CFE_SUCCESS;
-    int32              OsStatus;
-    CFE_FS_Header_t    StdFileHeader;
-    CFE_TBL_File_Hdr_t TblFileHeader;
-    osal_id_t          FileDescriptor = OS_OBJECT_ID_UNDEFINED;
-    size_t             FilenameLen    = strlen(Filename);
-    uint32             NumBytes;
-    uint8              ExtraByte;
+    const uint8 *ActivePtr = RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr;
+    uint8 *      WorkPtr   = WorkingBufferPtr->BufferPtr;
+    size_t       LoadEnd   = Offset + NumBytes;
+    size_t       DirtyEnd  = RegRecPtr->DirtyOffset + RegRecPtr->DirtyNumBytes;
 
-    if (FilenameLen > (OS_MAX_PATH_LEN - 1))
+    if (WorkPtr == ActivePtr)
     {
-        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_FILENAME_LONG_ERR_EID, CFE_EVS_EventType_ERROR,
-                                   CFE_TBL_Global.TableTaskAppId, "%s: Filename is too long ('%s' (%lu) > %lu)",
-                                   AppName, Filename, (long unsigned int)FilenameLen,
-                                   (long unsigned int)OS_MAX_PATH_LEN - 1);
-
-        return CFE_TBL_ERR_FILENAME_TOO_LONG;
+        /* Loading straight into the active buffer, there is nothing to copy */
+        WorkingBufferPtr->Prefilled = true;
     }
-
-    /* Try to open the specified table file */
-    OsStatus = OS_OpenCreate(&FileDescriptor, Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
-
-    if (OsStatus != OS_SUCCESS)
+    else if (!WorkingBufferPtr->Prefilled)
     {
-        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_ACCESS_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
-                                   "%s: Unable to open file (Status=%ld)", AppName, (long)OsStatus);
+        /* Only the part of the dirty range that this load does not overwrite needs the active contents */
+        if (RegRecPtr->DirtyOffset < Offset)
+        {
+            memcpy(&WorkPtr[RegRecPtr->DirtyOffset], &ActivePtr[RegRecPtr->DirtyOffset],
+                   ((DirtyEnd < Offset) ? DirtyEnd : Offset) - RegRecPtr->DirtyOffset);
+        }
 
-        return CFE_TBL_ERR_ACCESS;
+        if (DirtyEnd > LoadEnd)
+        {
+            if (RegRecPtr->DirtyOffset > LoadEnd)
+            {
+                LoadEnd = RegRecPtr->DirtyOffset;
+            }
+
+            memcpy(&WorkPtr[LoadEnd], &ActivePtr[LoadEnd], DirtyEnd - LoadEnd);
+        }
+
+        /* From now on the working buffer only differs from the active buffer where it is loaded */
+        WorkingBufferPtr->Prefilled = true;
+        RegRecPtr->DirtyOffset      = Offset;
+        RegRecPtr->DirtyNumBytes    = NumBytes;
+    }
+    else if (RegRecPtr->DirtyNumBytes == 0)
+    {
+        RegRecPtr->DirtyOffset   = Offset;
+        RegRecPtr->DirtyNumBytes = NumBytes;
+    }
+    else
+    {
+        /* Grow the dirty range to also cover this load */
+        if (Offset < RegRecPtr->DirtyOffset)
+        {
+            RegRecPtr->DirtyOffset = Offset;
+        }
+
+        if (LoadEnd > DirtyEnd)
+        {
+            DirtyEnd = LoadEnd;
+        }
+
+        RegRecPtr->DirtyNumBytes = DirtyEnd - RegRecPtr->DirtyOffset;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_TBL_IsLoadUnchanged(const CFE_TBL_LoadBuff_t *WorkingBufferPtr, const CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    const CFE_TBL_LoadBuff_t *ActiveBufPtr = &RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex];
+    const uint8 *             WorkPtr      = WorkingBufferPtr->BufferPtr;
+    const uint8 *             ActivePtr    = ActiveBufPtr->BufferPtr;
+
+    /* Before the first load there is nothing to compare against, and a working */
+    /* buffer that is the active buffer has already overwritten the contents     */
+    if ((!RegRecPtr->ReloadIfChanged) || (!RegRecPtr->TableLoadedOnce) || (WorkPtr == ActivePtr))
+    {
+        return false;
+    }
+
+    /* The CRC of both images is already known, so most changed loads are rejected without touching the data */
+    if (WorkingBufferPtr->Crc != ActiveBufPtr->Crc)
+    {
+        return false;
+    }
+
+    /* Outside of the dirty range the working buffer is known to match the active buffer, */
+    /* so only the dirty range has to be compared to rule out a CRC collision.            */
+    return (memcmp(&WorkPtr[RegRecPtr->DirtyOffset], &ActivePtr[RegRecPtr->DirtyOffset], RegRecPtr->DirtyNumBytes) ==
+            0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_DiscardUnchangedLoad(CFE_TBL_LoadBuff_t *WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    CFE_TBL_LoadBuff_t *ActiveBufPtr = &RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex];
+    bool                NewSource;
+
+    /* The active contents now also represent the image just loaded, so credit it as the source */
+    NewSource = ((strcmp(ActiveBufPtr->DataSource, WorkingBufferPtr->DataSource) != 0) ||
+                 (ActiveBufPtr->FileCreateTimeSecs != WorkingBufferPtr->FileCreateTimeSecs) ||
+                 (ActiveBufPtr->FileCreateTimeSubSecs != WorkingBufferPtr->FileCreateTimeSubSecs));
+
+    if (NewSource)
+    {
+        strncpy(ActiveBufPtr->DataSource, WorkingBufferPtr->DataSource, sizeof(ActiveBufPtr->DataSource) - 1);
+        ActiveBufPtr->DataSource[sizeof(ActiveBufPtr->DataSource) - 1] = '\0';
+        ActiveBufPtr->FileCreateTimeSecs                                = WorkingBufferPtr->FileCreateTimeSecs;
+        ActiveBufPtr->FileCreateTimeSubSecs                             = WorkingBufferPtr->FileCreateTimeSubSecs;
+
+        strncpy(RegRecPtr->LastFileLoaded, ActiveBufPtr->DataSource, sizeof(RegRecPtr->LastFileLoaded) - 1);
+        RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 1] = '\0';
+
+        /* Keep the source recorded with a critical table's saved image consistent as well */
+        if (RegRecPtr->CriticalTable == true)
+        {
+            CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
+        }
+    }
+
+    if (RegRecPtr->DoubleBuffered)
+    {
+        /* The inactive buffer now holds exactly the active contents */
+        RegRecPtr->DirtyOffset   = 0;
+        RegRecPtr->DirtyNumBytes = 0;
+    }
+    else
+    {
+        /* For single buffered tables, freeing entails resetting flag */
+        CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Taken = false;
+    }
+
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr,
+                           const char *Filename)
+{
+    int32              Status = CFE_SUCCESS;
+    int32              OsStatus;
+    CFE_FS_Header_t    StdFileHeader;
+    CFE_TBL_File_Hdr_t TblFileHeader;
+    osal_id_t          FileDescriptor = OS_OBJECT_ID_UNDEFINED;
+    size_t             FilenameLen    = strlen(Filename);
+    uint32             NumBytes;
+    uint32             ChunkSize;
+    uint32             Crc;
+    uint8 *            BufferPtr;
+    uint8              ExtraByte;
+
+    if (FilenameLen > (OS_MAX_PATH_LEN - 1))
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_FILENAME_LONG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                   CFE_TBL_Global.TableTaskAppId, "%s: Filename is too long ('%s' (%lu) > %lu)",
+                                   AppName, Filename, (long unsigned int)FilenameLen,
+                                   (long unsigned int)OS_MAX_PATH_LEN - 1);
+
+        return CFE_TBL_ERR_FILENAME_TOO_LONG;
+    }
+
+    /* Try to open the specified table file */
+    OsStatus = OS_OpenCreate(&FileDescriptor, Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_ACCESS_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
+                                   "%s: Unable to open file (Status=%ld)", AppName, (long)OsStatus);
+
+        return CFE_TBL_ERR_ACCESS;
     }
 
     Status = CFE_TBL_ReadHeaders(FileDescriptor, &StdFileHeader, &TblFileHeader, Filename);
 
-    if (Status != CFE_SUCCESS)
+    if (Status != CFE_SUCCESS)
+    {
+        /* CFE_TBL_ReadHeaders() generates its own events */
+
+        OS_close(FileDescriptor);
+        return Status;
+    }
+
+    /* Verify that the specified file has compatible data for specified table */
+    if (strcmp(RegRecPtr->Name, TblFileHeader.TableName) != 0)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_TBLNAME_MISMATCH_ERR_EID, CFE_EVS_EventType_ERROR,
+                                   CFE_TBL_Global.TableTaskAppId, "%s: Table name mismatch (exp=%s, tblfilhdr=%s)",
+                                   AppName, RegRecPtr->Name, TblFileHeader.TableName);
+
+        OS_close(FileDescriptor);
+        return CFE_TBL_ERR_FILE_FOR_WRONG_TABLE;
+    }
+
+    if ((TblFileHeader.Offset + TblFileHeader.NumBytes) > RegRecPtr->Size)
+    {
+        CFE_EVS_SendEventWithAppID(
+            CFE_TBL_LOAD_EXCEEDS_SIZE_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
+            "%s: File reports size larger than expected (file=%lu, exp=%lu)", AppName,
+            (long unsigned int)(TblFileHeader.Offset + TblFileHeader.NumBytes), (long unsigned int)RegRecPtr->Size);
+
+        OS_close(FileDescriptor);
+        return CFE_TBL_ERR_FILE_TOO_LARGE;
+    }
+
+    /* Any Table load that starts beyond the first byte is a "partial load" */
+    /* But a file that starts with the first byte and ends before filling   */
+    /* the whole table is just considered "short".                          */
+    if (TblFileHeader.Offset > 0)
+    {
+        Status = CFE_TBL_WARN_PARTIAL_LOAD;
+    }
+    else if (TblFileHeader.NumBytes < RegRecPtr->Size)
+    {
+        Status = CFE_TBL_WARN_SHORT_FILE;
+    }
+
+    /* Fill in whatever part of the table the file does not cover from the active buffer */
+    CFE_TBL_PrefillWorkingBuffer(WorkingBufferPtr, RegRecPtr, TblFileHeader.Offset, TblFileHeader.NumBytes);
+
+    /* Read the table image a chunk at a time, folding each chunk into the CRC while  */
+    /* it is still in cache rather than making a second pass over the whole table.    */
+    BufferPtr = WorkingBufferPtr->BufferPtr;
+    Crc       = CFE_ES_CalculateCRC(BufferPtr, TblFileHeader.Offset, 0, CFE_MISSION_ES_DEFAULT_CRC);
+    NumBytes  = 0;
+    while (NumBytes < TblFileHeader.NumBytes)
+    {
+        ChunkSize = TblFileHeader.NumBytes - NumBytes;
+        if (ChunkSize > CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE)
+        {
+            ChunkSize = CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE;
+        }
+
+        OsStatus = OS_read(FileDescriptor, &BufferPtr[TblFileHeader.Offset + NumBytes], ChunkSize);
+        if (OsStatus <= OS_SUCCESS)
+        {
+            /* End of file or read error, either way the load is incomplete */
+            break;
+        }
+
+        Crc = CFE_ES_CalculateCRC(&BufferPtr[TblFileHeader.Offset + NumBytes], OsStatus, Crc,
+                                  CFE_MISSION_ES_DEFAULT_CRC);
+        NumBytes += OsStatus; /* status code conversion (size) */
+    }
+
+    if (NumBytes != TblFileHeader.NumBytes)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_INCOMPLETE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                   CFE_TBL_Global.TableTaskAppId, "%s: File load incomplete (exp=%lu, read=%lu)",
+                                   AppName, (long unsigned int)TblFileHeader.NumBytes, (long unsigned int)NumBytes);
+
+        OS_close(FileDescriptor);
+        return CFE_TBL_ERR_LOAD_INCOMPLETE;
+    }
+
+    /* Check to see if the file is too large (ie - more data than header claims) */
+    OsStatus = OS_read(FileDescriptor, &ExtraByte, 1);
+    if (OsStatus >= OS_SUCCESS)
+    {
+        NumBytes = OsStatus; /* status code conversion (size) */
+    }
+    else
+    {
+        NumBytes = 0;
+    }
+
+    /* If successfully read another byte, then file must have too much data */
+    if (NumBytes == 1)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TOO_BIG_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
+                                   "%s: File load too long (file length > %lu)", AppName,
+                                   (long unsigned int)TblFileHeader.NumBytes);
+
+        OS_close(FileDescriptor);
+        return CFE_TBL_ERR_FILE_TOO_LARGE;
+    }
+
+    strncpy(WorkingBufferPtr->DataSource, Filename, sizeof(WorkingBufferPtr->DataSource) - 1);
+    WorkingBufferPtr->DataSource[sizeof(WorkingBufferPtr->DataSource) - 1] = '\0';
+
+    /* Save file creation time for later storage into Registry */
+    WorkingBufferPtr->FileCreateTimeSecs    = StdFileHeader.TimeSeconds;
+    WorkingBufferPtr->FileCreateTimeSubSecs = StdFileHeader.TimeSubSeconds;
+
+    /* Complete the CRC with the remainder of the table beyond the loaded data */
+    NumBytes += TblFileHeader.Offset;
+    WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(&BufferPtr[NumBytes], RegRecPtr->Size - NumBytes, Crc,
+                                                CFE_MISSION_ES_DEFAULT_CRC);
+
+    OS_close(FileDescriptor);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_LoadInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType, const void *SrcDataPtr)
+{
+    int32                       Status;
+    CFE_ES_AppId_t              ThisAppId;
+    CFE_TBL_LoadBuff_t *        WorkingBufferPtr;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_RegistryRec_t *     RegRecPtr;
+    char                        AppName[OS_MAX_API_NAME] = {"UNKNOWN"};
+    bool                        FirstTime                = false;
+
+    if (SrcDataPtr == NULL)
+    {
+        return CFE_TBL_BAD_ARGUMENT;
+    }
+
+    /* Verify access rights and get a valid Application ID for calling App */
+    Status = CFE_TBL_ValidateAccess(TblHandle, &ThisAppId);
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_HANDLE_ACCESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                   CFE_TBL_Global.TableTaskAppId, "%s: No access to Tbl Handle=%d", AppName,
+                                   (int)TblHandle);
+
+        return Status;
+    }
+
+    AccessDescPtr = &CFE_TBL_Global.Handles[TblHandle];
+    RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
+
+    /* Translate AppID of caller into App Name */
+    CFE_ES_GetAppName(AppName, ThisAppId, sizeof(AppName));
+
+    /* Initialize return pointer to NULL */
+    WorkingBufferPtr = NULL;
+
+    /* Check to see if this is a dump only table */
+    if (RegRecPtr->DumpOnly)
+    {
+        if ((!RegRecPtr->UserDefAddr) || (RegRecPtr->TableLoadedOnce))
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_LOADING_A_DUMP_ONLY_ERR_EID, CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_Global.TableTaskAppId, "%s: Attempted to load Dump Only Tbl '%s'",
+                                       AppName, RegRecPtr->Name);
+
+            return CFE_TBL_ERR_DUMP_ONLY;
+        }
+
+        /* The Application is allowed to call Load once when the address  */
+        /* of the dump only table is being defined by the application.    */
+        RegRecPtr->Buffers[0].BufferPtr = (void *)SrcDataPtr;
+        RegRecPtr->TableLoadedOnce      = true;
+
+        snprintf(RegRecPtr->Buffers[0].DataSource, sizeof(RegRecPtr->Buffers[0].DataSource), "Addr 0x%08lX",
+                 (unsigned long)SrcDataPtr);
+        RegRecPtr->Buffers[0].FileCreateTimeSecs    = 0;
+        RegRecPtr->Buffers[0].FileCreateTimeSubSecs = 0;
+
+        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_SUCCESS_INF_EID, CFE_EVS_EventType_DEBUG, CFE_TBL_Global.TableTaskAppId,
+                                   "Successfully loaded '%s' from '%s'", RegRecPtr->Name,
+                                   RegRecPtr->Buffers[0].DataSource);
+
+        return CFE_SUCCESS;
+    }
+
+    /* Loads by an Application are not allowed if a table load is already in progress */
+    if (RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_IN_PROGRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                   CFE_TBL_Global.TableTaskAppId, "%s: Load already in progress for '%s'", AppName,
+                                   RegRecPtr->Name);
+
+        return CFE_TBL_ERR_LOAD_IN_PROGRESS;
+    }
+
+    /* Obtain a working buffer (either the table's dedicated buffer or one of the shared buffers) */
+    Status = CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, true);
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_NO_WORK_BUFFERS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                   CFE_TBL_Global.TableTaskAppId, "%s: Failed to get Working Buffer (Stat=%u)", AppName,
+                                   (unsigned int)Status);
+
+        return Status;
+    }
+
+    /* Perform appropriate update to working buffer */
+    /* Determine whether the load is to occur from a file or from a block of memory */
+    switch (SrcType)
+    {
+        case CFE_TBL_SRC_FILE:
+            /* Load the data from the file into the specified buffer */
+            Status = CFE_TBL_LoadFromFile(AppName, WorkingBufferPtr, RegRecPtr, (const char *)SrcDataPtr);
+
+            if ((Status == CFE_TBL_WARN_PARTIAL_LOAD) && (!RegRecPtr->TableLoadedOnce))
+            {
+                /* Uninitialized tables cannot be loaded with partial table loads */
+                /* Partial loads can only occur on previously loaded tables.      */
+                CFE_EVS_SendEventWithAppID(CFE_TBL_PARTIAL_LOAD_ERR_EID, CFE_EVS_EventType_ERROR,
+                                           CFE_TBL_Global.TableTaskAppId,
+                                           "%s: Attempted to load from partial Tbl '%s' from '%s' (Stat=%u)", AppName,
+                                           RegRecPtr->Name, (const char *)SrcDataPtr, (unsigned int)Status);
+
+                Status = CFE_TBL_ERR_PARTIAL_LOAD;
+            }
+
+            break;
+        case CFE_TBL_SRC_ADDRESS:
+            /* When the source is a block of memory, it is assumed to be a complete load */
+            CFE_TBL_PrefillWorkingBuffer(WorkingBufferPtr, RegRecPtr, 0, RegRecPtr->Size);
+            memcpy(WorkingBufferPtr->BufferPtr, (uint8 *)SrcDataPtr, RegRecPtr->Size);
+
+            snprintf(WorkingBufferPtr->DataSource, sizeof(WorkingBufferPtr->DataSource), "Addr 0x%08lX",
+                     (unsigned long)SrcDataPtr);
+            WorkingBufferPtr->FileCreateTimeSecs    = 0;
+            WorkingBufferPtr->FileCreateTimeSubSecs = 0;
+
+            /* Compute the CRC on the specified table buffer */
+            WorkingBufferPtr->Crc =
+                CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+            break;
+        default:
+            CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_TYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_Global.TableTaskAppId,
+                                       "%s: Attempted to load from illegal source type=%d", AppName, (int)SrcType);
+
+            Status = CFE_TBL_ERR_ILLEGAL_SRC_TYPE;
+    }
+
+    /* An image identical to the active contents was validated when it became active, */
+    /* so there is nothing left to validate, activate or notify users about.           */
+    if ((Status >= CFE_SUCCESS) && CFE_TBL_IsLoadUnchanged(WorkingBufferPtr, RegRecPtr))
+    {
+        CFE_TBL_DiscardUnchangedLoad(WorkingBufferPtr, RegRecPtr);
+
+        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_UNCHANGED_INF_EID, CFE_EVS_EventType_DEBUG,
+                                   CFE_TBL_Global.TableTaskAppId, "'%s' from '%s' matches active contents, not reloaded",
+                                   RegRecPtr->Name, RegRecPtr->LastFileLoaded);
+
+        return CFE_SUCCESS;
+    }
+
+    /* If the data was successfully loaded, then validate its contents */
+    if ((Status >= CFE_SUCCESS) && (RegRecPtr->ValidationFuncPtr != NULL))
+    {
+        Status = (RegRecPtr->ValidationFuncPtr)(WorkingBufferPtr->BufferPtr);
+
+        if (Status > CFE_SUCCESS)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_VAL_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
+                                       "%s: Validation func return code invalid (Stat=%u) for '%s'", AppName,
+                                       (unsigned int)Status, RegRecPtr->Name);
+
+            Status = -1;
+        }
+
+        if (Status < 0)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID, CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_Global.TableTaskAppId,
+                                       "%s: Validation func reports table invalid (Stat=%u) for '%s'", AppName,
+                                       (unsigned int)Status, RegRecPtr->Name);
+
+            /* Zero out the buffer to remove any bad data */
+            memset(WorkingBufferPtr->BufferPtr, 0, RegRecPtr->Size);
+
+            /* The buffer now differs from the active contents everywhere */
+            RegRecPtr->DirtyOffset   = 0;
+            RegRecPtr->DirtyNumBytes = RegRecPtr->Size;
+        }
+    }
+
+    /* Perform the table update to complete the load */
+    if (Status < CFE_SUCCESS)
+    {
+        /* The load has had a problem, free the working buffer for another attempt */
+        if ((!RegRecPtr->DoubleBuffered) && (RegRecPtr->TableLoadedOnce == true))
+        {
+            /* For single buffered tables, freeing entails resetting flag */
+            CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Taken = false;
+        }
+
+        /* For double buffered tables, freeing buffer is simple */
+        RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+
+        return Status;
+    }
+
+    FirstTime = !RegRecPtr->TableLoadedOnce;
+
+    /* If this is not the first load, then the data must be moved from the inactive buffer      */
+    /* to the active buffer to complete the load.  First loads are done directly to the active. */
+    if (!FirstTime)
+    {
+        /* Force the table update */
+        RegRecPtr->LoadPending = true;
+
+        Status = CFE_TBL_UpdateInternal(TblHandle, RegRecPtr, AccessDescPtr);
+
+        /* An update that could not be completed now is left for the owner to retry */
+        if (RegRecPtr->LoadPending)
+        {
+            CFE_TBL_MarkPendingWork(RegRecPtr, CFE_TBL_PENDING_UPDATE);
+        }
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_UPDATE_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
+                                       "%s: Failed to update '%s' (Stat=%u)", AppName, RegRecPtr->Name,
+                                       (unsigned int)Status);
+        }
+    }
+    else
+    {
+        /* On initial loads, make sure registry is given file/address of data source */
+        strncpy(RegRecPtr->LastFileLoaded, WorkingBufferPtr->DataSource, sizeof(RegRecPtr->LastFileLoaded) - 1);
+        RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 1] = '\0';
+
+        CFE_TBL_NotifyTblUsersOfUpdate(RegRecPtr);
+
+        /* If the table is a critical table, update the appropriate CDS with the new data */
+        if (RegRecPtr->CriticalTable == true)
+        {
+            CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
+        }
+
+        Status = CFE_SUCCESS;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* The first time a table is loaded, the event message is DEBUG */
+        /* to help eliminate a flood of events during a startup         */
+        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_SUCCESS_INF_EID,
+                                   FirstTime ? CFE_EVS_EventType_DEBUG : CFE_EVS_EventType_INFORMATION,
+                                   CFE_TBL_Global.TableTaskAppId, "Successfully loaded '%s' from '%s'", RegRecPtr->Name,
+                                   RegRecPtr->LastFileLoaded);
+
+        /* Save the index of the table for housekeeping telemetry */
+        CFE_TBL_Global.LastTblUpdated = AccessDescPtr->RegIndex;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *RegRecPtr,
+                             CFE_TBL_AccessDescriptor_t *AccessDescPtr)
+{
+    int32 Status       = CFE_SUCCESS;
+    int32 PoolStatus;
+    void *NewBufferPtr = NULL;
+
+    if ((!RegRecPtr->LoadPending) || (RegRecPtr->LoadInProgress == CFE_TBL_NO_LOAD_IN_PROGRESS))
+    {
+        /* Question: Should calling CFE_TBL_Update on a table with no load pending */
+        /* be considered an error?  Currently assuming it is not an error.         */
+        Status = CFE_TBL_INFO_NO_UPDATE_PENDING;
+    }
+    else if (RegRecPtr->AsyncValidateIndex != CFE_TBL_NO_VALIDATION_PENDING)
+    {
+        /* The buffer a validation worker is reading cannot change roles until it is done */
+        Status = CFE_TBL_INFO_TABLE_LOCKED;
+
+        CFE_ES_WriteToSysLog("%s: Unable to update Handle=%d while it is being validated\n", __func__, TblHandle);
+    }
+    else
+    {
+        if (RegRecPtr->DoubleBuffered)
+        {
+            /* To update a double buffered table only requires a pointer swap */
+            RegRecPtr->ActiveBufferIndex = (uint8)RegRecPtr->LoadInProgress;
+
+            /* Source description in buffer should already have been updated by either */
+            /* the LoadFromFile function or the Load function (when a memory load).    */
+            /* However, we need to copy it into active registry area */
+            strncpy(RegRecPtr->LastFileLoaded, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].DataSource,
+                    sizeof(RegRecPtr->LastFileLoaded) - 1);
+            RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 1] = '\0';
+
+            CFE_TBL_NotifyTblUsersOfUpdate(RegRecPtr);
+
+            /* If the table is a critical table, update the appropriate CDS with the new data */
+            if (RegRecPtr->CriticalTable == true)
+            {
+                CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
+            }
+        }
+        else
+        {
+            /* Release the buffer retired by a previous update if its readers have let go of it */
+            CFE_TBL_ReclaimRetiredBuffer(RegRecPtr);
+
+            /* Readers pin the active buffer without the registry lock, so a reader may take it at  */
+            /* any moment and it is never written while published.  The new contents always go into */
+            /* a fresh buffer that replaces the active one, which is retired until the last reader   */
+            /* pinned to it releases it.  Only one retired buffer is kept per table, so the update   */
+            /* waits while a previous one is still held, or while the pool has no room for the copy. */
+            if (RegRecPtr->Buffers[0].BufferPtr != CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr)
+            {
+                if (RegRecPtr->RetiredBufferPtr == NULL)
+                {
+                    PoolStatus = CFE_ES_GetPoolBuf(&NewBufferPtr, CFE_TBL_Global.Buf.PoolHdl, RegRecPtr->Size);
+                    if (PoolStatus < 0)
+                    {
+                        NewBufferPtr = NULL;
+                    }
+                }
+
+                if (NewBufferPtr == NULL)
+                {
+                    Status = CFE_TBL_INFO_TABLE_LOCKED;
+
+                    CFE_ES_WriteToSysLog("%s: Unable to publish update of locked table Handle=%d\n", __func__,
+                                         TblHandle);
+                }
+            }
+
+            if (Status == CFE_SUCCESS)
+            {
+                if (NewBufferPtr != NULL)
+                {
+                    memcpy(NewBufferPtr, CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr,
+                           RegRecPtr->Size);
+
+                    /* Swap in the new buffer; the epoch advances when users are notified below */
+                    CFE_TBL_LockRegistry();
+                    RegRecPtr->RetiredBufferPtr     = RegRecPtr->Buffers[0].BufferPtr;
+                    RegRecPtr->RetiredEpoch         = RegRecPtr->ActiveEpoch;
+                    RegRecPtr->Buffers[0].BufferPtr = NewBufferPtr;
+                    CFE_TBL_UnlockRegistry();
+                }
+
+                /* Save source description with active buffer */
+                strncpy(RegRecPtr->Buffers[0].DataSource,
+                        CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].DataSource,
+                        sizeof(RegRecPtr->Buffers[0].DataSource) - 1);
+                RegRecPtr->Buffers[0].DataSource[sizeof(RegRecPtr->Buffers[0].DataSource) - 1] = 0;
+                strncpy(RegRecPtr->LastFileLoaded, CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].DataSource,
+                        sizeof(RegRecPtr->LastFileLoaded) - 1);
+                RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 1] = 0;
+
+                /* Save the file creation time from the loaded file into the Table Registry */
+                RegRecPtr->Buffers[0].FileCreateTimeSecs =
+                    CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].FileCreateTimeSecs;
+                RegRecPtr->Buffers[0].FileCreateTimeSubSecs =
+                    CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].FileCreateTimeSubSecs;
+
+                /* Save the previously computed CRC into the new buffer */
+                RegRecPtr->Buffers[0].Crc = CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Crc;
+
+                /* Free the working buffer */
+                CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Taken = false;
+
+                CFE_TBL_NotifyTblUsersOfUpdate(RegRecPtr);
+
+                /* The old buffer goes back to the pool at once if no reader had it pinned */
+                CFE_TBL_ReclaimRetiredBuffer(RegRecPtr);
+
+                /* If the table is a critical table, update the appropriate CDS with the new data */
+                if (RegRecPtr->CriticalTable == true)
+                {
+                    CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
+                }
+            }
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_NotifyTblUsersOfUpdate(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    CFE_TBL_Handle_t AccessIterator;
+    uint32           Epoch;
+
+    /* Reset Load in Progress Values */
+    RegRecPtr->LoadInProgress   = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    RegRecPtr->TimeOfLastUpdate = CFE_TIME_GetTime();
+
+    /* Clear notification of pending load (as well as NO LOAD) and notify everyone of update */
+    RegRecPtr->LoadPending     = false;
+    RegRecPtr->TableLoadedOnce = true;
+
+    /* Advance the publication epoch so readers that pin from now on are distinguished */
+    /* from those that may still be holding the previously active buffer.  Only the   */
+    /* owner updates a table, so no other task advances this epoch at the same time.   */
+    Epoch = RegRecPtr->ActiveEpoch + 1;
+    if (Epoch == CFE_TBL_NO_EPOCH_PINNED)
+    {
+        ++Epoch;
+    }
+    CFE_TBL_EPOCH_STORE(RegRecPtr->ActiveEpoch, Epoch);
+
+    /* Readers that pinned the previous epoch must be visible to any check for pins from here on */
+    CFE_TBL_EPOCH_FENCE();
+
+    AccessIterator = RegRecPtr->HeadOfAccessList;
+    while (AccessIterator != CFE_TBL_END_OF_LIST)
+    {
+        CFE_TBL_Global.Handles[AccessIterator].Updated = true;
+
+        AccessIterator = CFE_TBL_Global.Handles[AccessIterator].NextLink;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_TBL_IsEpochPinned(CFE_TBL_RegistryRec_t *RegRecPtr, uint32 Epoch)
+{
+    CFE_TBL_Handle_t AccessIterator;
+    uint32           PinnedEpoch;
+    bool             IsPinned = false;
+
+    AccessIterator = RegRecPtr->HeadOfAccessList;
+    while ((AccessIterator != CFE_TBL_END_OF_LIST) && (!IsPinned))
+    {
+        PinnedEpoch = CFE_TBL_EPOCH_LOAD(CFE_TBL_Global.Handles[AccessIterator].PinnedEpoch);
+
+        /* Signed difference keeps the comparison correct across epoch counter rollover */
+        IsPinned = ((PinnedEpoch != CFE_TBL_NO_EPOCH_PINNED) && ((int32)(PinnedEpoch - Epoch) <= 0));
+
+        AccessIterator = CFE_TBL_Global.Handles[AccessIterator].NextLink;
+    }
+
+    if (!IsPinned)
+    {
+        IsPinned = CFE_TBL_IsDumpPinned(RegRecPtr, Epoch);
+    }
+
+    return IsPinned;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_TBL_IsDumpPinned(const CFE_TBL_RegistryRec_t *RegRecPtr, uint32 Epoch)
+{
+    const CFE_TBL_DumpControl_t *DumpCtrlPtr;
+    uint32                       i;
+    bool                         IsPinned = false;
+
+    for (i = 0; (i < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS) && (!IsPinned); i++)
+    {
+        DumpCtrlPtr = &CFE_TBL_Global.DumpControlBlocks[i];
+
+        IsPinned = ((DumpCtrlPtr->State == CFE_TBL_DUMP_WRITING) && (DumpCtrlPtr->RegRecPtr == RegRecPtr) &&
+                    (DumpCtrlPtr->PinnedEpoch != CFE_TBL_NO_EPOCH_PINNED) &&
+                    ((int32)(DumpCtrlPtr->PinnedEpoch - Epoch) <= 0));
+    }
+
+    return IsPinned;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_TBL_IsBufferPinned(const CFE_TBL_RegistryRec_t *RegRecPtr, const void *BufferPtr)
+{
+    const CFE_TBL_DumpControl_t *DumpCtrlPtr;
+    CFE_TBL_Handle_t             AccessIterator;
+    uint32                       i;
+    bool                         IsPinned = false;
+
+    AccessIterator = RegRecPtr->HeadOfAccessList;
+    while ((AccessIterator != CFE_TBL_END_OF_LIST) && (!IsPinned))
+    {
+        IsPinned = ((CFE_TBL_EPOCH_LOAD(CFE_TBL_Global.Handles[AccessIterator].PinnedEpoch) !=
+                     CFE_TBL_NO_EPOCH_PINNED) &&
+                    (CFE_TBL_Global.Handles[AccessIterator].PinnedBufferPtr == BufferPtr));
+
+        AccessIterator = CFE_TBL_Global.Handles[AccessIterator].NextLink;
+    }
+
+    for (i = 0; (i < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS) && (!IsPinned); i++)
+    {
+        DumpCtrlPtr = &CFE_TBL_Global.DumpControlBlocks[i];
+
+        IsPinned = ((DumpCtrlPtr->State == CFE_TBL_DUMP_WRITING) && (DumpCtrlPtr->RegRecPtr == RegRecPtr) &&
+                    (DumpCtrlPtr->DumpDataPtr == BufferPtr));
+    }
+
+    return IsPinned;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_TBL_IsDumpBufferInUse(const CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    const CFE_TBL_DumpControl_t *DumpCtrlPtr;
+    uint32                       i;
+    bool                         IsInUse = false;
+
+    for (i = 0; (i < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS) && (!IsInUse); i++)
+    {
+        DumpCtrlPtr = &CFE_TBL_Global.DumpControlBlocks[i];
+
+        IsInUse = ((DumpCtrlPtr->State == CFE_TBL_DUMP_WRITING) && (DumpCtrlPtr->RegRecPtr == RegRecPtr) &&
+                   (DumpCtrlPtr->DumpBufferPtr != NULL));
+    }
+
+    return IsInUse;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_AbortDumps(const CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    CFE_TBL_DumpControl_t *DumpCtrlPtr;
+    uint32                 i;
+
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS; i++)
+    {
+        DumpCtrlPtr = &CFE_TBL_Global.DumpControlBlocks[i];
+
+        if ((DumpCtrlPtr->State == CFE_TBL_DUMP_WRITING) && (DumpCtrlPtr->RegRecPtr == RegRecPtr))
+        {
+            DumpCtrlPtr->Aborted       = true;
+            DumpCtrlPtr->DumpDataPtr   = NULL;
+            DumpCtrlPtr->DumpBufferPtr = NULL;
+            DumpCtrlPtr->RegRecPtr     = NULL;
+            DumpCtrlPtr->PinnedEpoch   = CFE_TBL_NO_EPOCH_PINNED;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_ReclaimRetiredBuffer(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    int32 Status;
+
+    if (RegRecPtr->RetiredBufferPtr != NULL)
+    {
+        CFE_TBL_LockRegistry();
+
+        /* Check again now that the registry is locked */
+        if ((RegRecPtr->RetiredBufferPtr != NULL) && (!CFE_TBL_IsEpochPinned(RegRecPtr, RegRecPtr->RetiredEpoch)))
+        {
+            Status = CFE_ES_PutPoolBuf(CFE_TBL_Global.Buf.PoolHdl, RegRecPtr->RetiredBufferPtr);
+            RegRecPtr->RetiredBufferPtr = NULL;
+
+            if (Status < 0)
+            {
+                CFE_ES_WriteToSysLog("%s: PutPoolBuf Fail Stat=0x%08X, Hndl=0x%08lX\n", __func__,
+                                     (unsigned int)Status, CFE_RESOURCEID_TO_ULONG(CFE_TBL_Global.Buf.PoolHdl));
+            }
+        }
+
+        CFE_TBL_UnlockRegistry();
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_SwapInSpareBuffer(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    int32  Status = CFE_SUCCESS;
+    uint8  InactiveBufferIndex;
+    uint32 i;
+    void * SpareBufferPtr;
+
+    InactiveBufferIndex = 1 - RegRecPtr->ActiveBufferIndex;
+
+    if (CFE_TBL_IsBufferPinned(RegRecPtr, RegRecPtr->Buffers[InactiveBufferIndex].BufferPtr))
+    {
+        /* Find an allocated spare that neither a reader nor a dump is still holding */
+        i = 0;
+        while ((i < CFE_TBL_NUM_SPARE_BUFFERS) &&
+               ((RegRecPtr->SpareBufferPtr[i] == NULL) ||
+                CFE_TBL_IsBufferPinned(RegRecPtr, RegRecPtr->SpareBufferPtr[i])))
+        {
+            i++;
+        }
+
+        if (i < CFE_TBL_NUM_SPARE_BUFFERS)
+        {
+            /* The inactive buffer becomes a spare until it is let go of */
+            SpareBufferPtr                                    = RegRecPtr->SpareBufferPtr[i];
+            RegRecPtr->SpareBufferPtr[i]                      = RegRecPtr->Buffers[InactiveBufferIndex].BufferPtr;
+            RegRecPtr->Buffers[InactiveBufferIndex].BufferPtr = SpareBufferPtr;
+
+            /* Nothing is known about how the old image in the spare differs from the active one */
+            RegRecPtr->DirtyOffset   = 0;
+            RegRecPtr->DirtyNumBytes = RegRecPtr->Size;
+        }
+        else
+        {
+            Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
+
+            CFE_ES_WriteToSysLog("%s: All buffers of '%s' are still in use\n", __func__, RegRecPtr->Name);
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_TBL_LoadBuff_t *CFE_TBL_GetInactiveBuffer(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    /* Identify whether the Inactive Buffer is a shared buffer or a dedicated one */
+    if (RegRecPtr->DoubleBuffered)
+    {
+        return &RegRecPtr->Buffers[(1U - RegRecPtr->ActiveBufferIndex)];
+    }
+
+    /* For single buffered tables, the index to the inactive buffer is kept in 'LoadInProgress' */
+    if (RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS)
+    {
+        return &CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress];
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_GetLoadRangeInternal(const CFE_TBL_RegistryRec_t *RegRecPtr, size_t *OffsetPtr, size_t *NumBytesPtr)
+{
+    int32 Status = CFE_SUCCESS;
+
+    if (RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS)
     {
-        /* CFE_TBL_ReadHeaders() generates its own events */
-
-        OS_close(FileDescriptor);
-        return Status;
+        /* The dirty range covers everything loaded into the inactive buffer so far */
+        *OffsetPtr   = RegRecPtr->DirtyOffset;
+        *NumBytesPtr = RegRecPtr->DirtyNumBytes;
     }
-
-    /* Verify that the specified file has compatible data for specified table */
-    if (strcmp(RegRecPtr->Name, TblFileHeader.TableName) != 0)
+    else
     {
-        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_TBLNAME_MISMATCH_ERR_EID, CFE_EVS_EventType_ERROR,
-                                   CFE_TBL_Global.TableTaskAppId, "%s: Table name mismatch (exp=%s, tblfilhdr=%s)",
-                                   AppName, RegRecPtr->Name, TblFileHeader.TableName);
+        /* Without a pending load, the whole table is what would be validated */
+        *OffsetPtr   = 0;
+        *NumBytesPtr = RegRecPtr->Size;
 
-        OS_close(FileDescriptor);
-        return CFE_TBL_ERR_FILE_FOR_WRONG_TABLE;
+        Status = CFE_TBL_INFO_NO_UPDATE_PENDING;
     }
 
-    if ((TblFileHeader.Offset + TblFileHeader.NumBytes) > RegRecPtr->Size)
-    {
-        CFE_EVS_SendEventWithAppID(
-            CFE_TBL_LOAD_EXCEEDS_SIZE_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
-            "%s: File reports size larger than expected (file=%lu, exp=%lu)", AppName,
-            (long unsigned int)(TblFileHeader.Offset + TblFileHeader.NumBytes), (long unsigned int)RegRecPtr->Size);
+    return Status;
+}
 
-        OS_close(FileDescriptor);
-        return CFE_TBL_ERR_FILE_TOO_LARGE;
-    }
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_ValidateInactiveBuffer(CFE_TBL_RegistryRec_t *RegRecPtr, const CFE_TBL_LoadBuff_t *InactiveBufPtr,
+                                     const char *AppName)
+{
+    int32 Status;
 
-    /* Any Table load that starts beyond the first byte is a "partial load" */
-    /* But a file that starts with the first byte and ends before filling   */
-    /* the whole table is just considered "short".                          */
-    if (TblFileHeader.Offset > 0)
+    if (InactiveBufPtr != NULL)
     {
-        Status = CFE_TBL_WARN_PARTIAL_LOAD;
+        /* Call the Application's Validation function for the Inactive Buffer */
+        Status = (RegRecPtr->ValidationFuncPtr)(InactiveBufPtr->BufferPtr);
     }
-    else if (TblFileHeader.NumBytes < RegRecPtr->Size)
+    else
     {
-        Status = CFE_TBL_WARN_SHORT_FILE;
+        /* The load was completed or aborted since the request was made */
+        Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
     }
 
-    OsStatus =
-        OS_read(FileDescriptor, ((uint8 *)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset, TblFileHeader.NumBytes);
-    if (OsStatus >= OS_SUCCESS)
+    if (Status == CFE_SUCCESS)
     {
-        NumBytes = OsStatus; /* status code conversion (size) */
+        CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                   CFE_TBL_Global.TableTaskAppId, "%s validation successful for Inactive '%s'",
+                                   AppName, RegRecPtr->Name);
     }
     else
     {
-        NumBytes = 0;
+        CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID, CFE_EVS_EventType_ERROR,
+                                   CFE_TBL_Global.TableTaskAppId,
+                                   "%s validation failed for Inactive '%s', Status=0x%08X", AppName,
+                                   RegRecPtr->Name, (unsigned int)Status);
+
+        if (Status > CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: App(%lu) Validation func return code invalid (Stat=0x%08X) for '%s'\n",
+                                 __func__, CFE_RESOURCEID_TO_ULONG(CFE_TBL_Global.TableTaskAppId),
+                                 (unsigned int)Status, RegRecPtr->Name);
+        }
     }
 
-    if (NumBytes != TblFileHeader.NumBytes)
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_CompleteValidation(CFE_TBL_LoadBuff_t *InactiveBufPtr, int32 ValIndex, int32 Status)
+{
+    /* Allow buffer to be activated after passing validation */
+    if (InactiveBufPtr != NULL && Status == CFE_SUCCESS)
     {
-        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_INCOMPLETE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                   CFE_TBL_Global.TableTaskAppId, "%s: File load incomplete (exp=%lu, read=%lu)",
-                                   AppName, (long unsigned int)TblFileHeader.NumBytes, (long unsigned int)NumBytes);
+        CFE_TBL_EPOCH_STORE(InactiveBufPtr->Validated, true);
+    }
 
-        OS_close(FileDescriptor);
-        return CFE_TBL_ERR_LOAD_INCOMPLETE;
+    /* Save the result of the Validation function for the Table Services Task */
+    CFE_TBL_EPOCH_STORE(CFE_TBL_Global.ValidationResults[ValIndex].Result, Status);
+
+    /* Once validation is complete, set flags to indicate response is ready (release orders the result first) */
+    CFE_TBL_EPOCH_STORE(CFE_TBL_Global.ValidationResults[ValIndex].State, CFE_TBL_VALIDATION_PERFORMED);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_StartValidationWorkers(void)
+{
+    int32           Status;
+    int32           OsStatus;
+    uint32          i;
+    CFE_ES_TaskId_t TaskId;
+    char            TaskName[OS_MAX_API_NAME];
+
+    if (CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS == 0)
+    {
+        /* All tables are validated by their owners */
+        return CFE_SUCCESS;
     }
 
-    /* Check to see if the file is too large (ie - more data than header claims) */
-    OsStatus = OS_read(FileDescriptor, &ExtraByte, 1);
-    if (OsStatus >= OS_SUCCESS)
+    /* Each queued request holds a validation result record, so the queue can never overflow */
+    OsStatus = OS_QueueCreate(&CFE_TBL_Global.ValidationQueue, CFE_TBL_VALIDATION_QUEUE_NAME,
+                              CFE_PLATFORM_TBL_MAX_NUM_VALIDATIONS, sizeof(int16), 0);
+    if (OsStatus != OS_SUCCESS)
     {
-        NumBytes = OsStatus; /* status code conversion (size) */
+        CFE_ES_WriteToSysLog("%s: Failed to create validation queue: %ld\n", __func__, (long)OsStatus);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
     }
-    else
+
+    OsStatus = OS_BinSemCreate(&CFE_TBL_Global.ValidationDoneSem, CFE_TBL_VALIDATION_SEM_NAME, 0, 0);
+    if (OsStatus != OS_SUCCESS)
     {
-        NumBytes = 0;
+        CFE_ES_WriteToSysLog("%s: Failed to create validation semaphore: %ld\n", __func__, (long)OsStatus);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
     }
 
-    /* If successfully read another byte, then file must have too much data */
-    if (NumBytes == 1)
+    for (i = 0; i < CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS; i++)
     {
-        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TOO_BIG_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
-                                   "%s: File load too long (file length > %lu)", AppName,
-                                   (long unsigned int)TblFileHeader.NumBytes);
+        snprintf(TaskName, sizeof(TaskName), CFE_TBL_VALIDATION_TASK_NAME, (unsigned int)i);
 
-        OS_close(FileDescriptor);
-        return CFE_TBL_ERR_FILE_TOO_LARGE;
+        Status = CFE_ES_CreateChildTask(&TaskId, TaskName, CFE_TBL_ValidationWorkerMain, CFE_ES_TASK_STACK_ALLOCATE,
+                                        CFE_PLATFORM_TBL_VALIDATION_WORKER_STACK_SIZE,
+                                        CFE_PLATFORM_TBL_VALIDATION_WORKER_PRIORITY, 0);
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Failed to create validation worker %u: 0x%08X\n", __func__, (unsigned int)i,
+                                 (unsigned int)Status);
+            return Status;
+        }
     }
 
-    strncpy(WorkingBufferPtr->DataSource, Filename, sizeof(WorkingBufferPtr->DataSource) - 1);
-    WorkingBufferPtr->DataSource[sizeof(WorkingBufferPtr->DataSource) - 1] = '\0';
+    return CFE_SUCCESS;
+}
 
-    /* Save file creation time for later storage into Registry */
-    WorkingBufferPtr->FileCreateTimeSecs    = StdFileHeader.TimeSeconds;
-    WorkingBufferPtr->FileCreateTimeSubSecs = StdFileHeader.TimeSubSeconds;
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_ValidationWorkerMain(void)
+{
+    int32                  OsStatus;
+    int32                  Status;
+    int32                  ValIndex;
+    int16                  RegIndex;
+    size_t                 BytesCopied;
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+    CFE_TBL_LoadBuff_t *   InactiveBufPtr;
+    char                   AppName[OS_MAX_API_NAME];
+
+    while (true)
+    {
+        OsStatus = OS_QueueGet(CFE_TBL_Global.ValidationQueue, &RegIndex, sizeof(RegIndex), &BytesCopied, OS_PEND);
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Error reading validation queue: %ld\n", __func__, (long)OsStatus);
+            break;
+        }
 
-    /* Compute the CRC on the specified table buffer */
-    WorkingBufferPtr->Crc =
-        CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
+        RegRecPtr = &CFE_TBL_Global.Registry[RegIndex];
 
-    OS_close(FileDescriptor);
+        ValIndex = CFE_TBL_EPOCH_LOAD(RegRecPtr->AsyncValidateIndex);
+        if (ValIndex != CFE_TBL_NO_VALIDATION_PENDING)
+        {
+            InactiveBufPtr = CFE_TBL_EPOCH_LOAD(RegRecPtr->AsyncValidateBufPtr);
 
-    return Status;
+            strncpy(AppName, "UNKNOWN", sizeof(AppName));
+            CFE_ES_GetAppName(AppName, RegRecPtr->OwnerAppId, sizeof(AppName));
+
+            Status = CFE_TBL_ValidateInactiveBuffer(RegRecPtr, InactiveBufPtr, AppName);
+
+            /* A waiter that gave up on this validation has already reported it as failed */
+            CFE_TBL_LockRegistry();
+            if (CFE_TBL_EPOCH_LOAD(RegRecPtr->AsyncValidateIndex) == ValIndex)
+            {
+                CFE_TBL_CompleteValidation(InactiveBufPtr, ValIndex, Status);
+
+                /* The inactive buffer is no longer referenced once this is cleared */
+                CFE_TBL_EPOCH_STORE(RegRecPtr->AsyncValidateBufPtr, NULL);
+                CFE_TBL_EPOCH_STORE(RegRecPtr->AsyncValidateIndex, CFE_TBL_NO_VALIDATION_PENDING);
+            }
+            CFE_TBL_UnlockRegistry();
+
+            /* Wake up anyone waiting to release the table */
+            OS_BinSemGive(CFE_TBL_Global.ValidationDoneSem);
+        }
+    }
 }
 
 /*----------------------------------------------------------------
@@ -913,100 +2369,119 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *RegRecPtr,
-                             CFE_TBL_AccessDescriptor_t *AccessDescPtr)
+bool CFE_TBL_DispatchValidation(int16 RegIndex, int32 ValIndex)
 {
-    int32            Status = CFE_SUCCESS;
-    CFE_TBL_Handle_t AccessIterator;
-    bool             LockStatus = false;
+    int32                  OsStatus;
+    CFE_TBL_RegistryRec_t *RegRecPtr = &CFE_TBL_Global.Registry[RegIndex];
 
-    if ((!RegRecPtr->LoadPending) || (RegRecPtr->LoadInProgress == CFE_TBL_NO_LOAD_IN_PROGRESS))
+    CFE_TBL_LoadBuff_t *   InactiveBufPtr;
+
+    if (!RegRecPtr->AsyncValidation || !OS_ObjectIdDefined(CFE_TBL_Global.ValidationQueue))
     {
-        /* Question: Should calling CFE_TBL_Update on a table with no load pending */
-        /* be considered an error?  Currently assuming it is not an error.         */
-        Status = CFE_TBL_INFO_NO_UPDATE_PENDING;
+        return false;
     }
-    else
+
+    /* Pin the buffer now, the owner cannot load or activate another one until the worker is done */
+    InactiveBufPtr = CFE_TBL_GetInactiveBuffer(RegRecPtr);
+    if (InactiveBufPtr == NULL)
     {
-        if (RegRecPtr->DoubleBuffered)
-        {
-            /* To update a double buffered table only requires a pointer swap */
-            RegRecPtr->ActiveBufferIndex = (uint8)RegRecPtr->LoadInProgress;
+        return false;
+    }
 
-            /* Source description in buffer should already have been updated by either */
-            /* the LoadFromFile function or the Load function (when a memory load).    */
-            /* However, we need to copy it into active registry area */
-            strncpy(RegRecPtr->LastFileLoaded, RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].DataSource,
-                    sizeof(RegRecPtr->LastFileLoaded) - 1);
-            RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 1] = '\0';
+    /* The request is published (release) before it is queued for a worker */
+    CFE_TBL_EPOCH_STORE(RegRecPtr->AsyncValidateBufPtr, InactiveBufPtr);
+    CFE_TBL_EPOCH_STORE(RegRecPtr->AsyncValidateIndex, ValIndex);
 
-            CFE_TBL_NotifyTblUsersOfUpdate(RegRecPtr);
+    OsStatus = OS_QueuePut(CFE_TBL_Global.ValidationQueue, &RegIndex, sizeof(RegIndex), 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        /* Let the owner validate the table instead */
+        CFE_TBL_EPOCH_STORE(RegRecPtr->AsyncValidateBufPtr, NULL);
+        CFE_TBL_EPOCH_STORE(RegRecPtr->AsyncValidateIndex, CFE_TBL_NO_VALIDATION_PENDING);
 
-            /* If the table is a critical table, update the appropriate CDS with the new data */
-            if (RegRecPtr->CriticalTable == true)
-            {
-                CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
-            }
-        }
-        else
+        CFE_ES_WriteToSysLog("%s: Error queuing validation of '%s': %ld\n", __func__, RegRecPtr->Name,
+                             (long)OsStatus);
+        return false;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_WaitForAsyncValidation(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    int32  OsStatus;
+    int32  ValIndex;
+    uint32 WaitedMsec = 0;
+
+    /* Workers give the semaphore each time they finish a validation.  Another waiter may consume */
+    /* the give meant for this table, so the wait is bounded and the table checked again.         */
+    while (CFE_TBL_EPOCH_LOAD(RegRecPtr->AsyncValidateIndex) != CFE_TBL_NO_VALIDATION_PENDING)
+    {
+        if (WaitedMsec >= CFE_PLATFORM_TBL_VALIDATION_TIMEOUT_MSEC)
         {
-            /* Check to see if the Table is locked by anyone */
-            AccessIterator = RegRecPtr->HeadOfAccessList;
-            while (AccessIterator != CFE_TBL_END_OF_LIST)
+            /* Fail the request so the table can be released; the worker discards its late result */
+            CFE_TBL_LockRegistry();
+            ValIndex = CFE_TBL_EPOCH_LOAD(RegRecPtr->AsyncValidateIndex);
+            if (ValIndex != CFE_TBL_NO_VALIDATION_PENDING)
             {
-                LockStatus = (LockStatus || CFE_TBL_Global.Handles[AccessIterator].LockFlag);
+                CFE_TBL_CompleteValidation(NULL, ValIndex, CFE_TBL_ERR_VALIDATION_TIMEOUT);
 
-                AccessIterator = CFE_TBL_Global.Handles[AccessIterator].NextLink;
+                CFE_TBL_EPOCH_STORE(RegRecPtr->AsyncValidateBufPtr, NULL);
+                CFE_TBL_EPOCH_STORE(RegRecPtr->AsyncValidateIndex, CFE_TBL_NO_VALIDATION_PENDING);
             }
+            CFE_TBL_UnlockRegistry();
 
-            if (LockStatus)
+            if (ValIndex == CFE_TBL_NO_VALIDATION_PENDING)
             {
-                Status = CFE_TBL_INFO_TABLE_LOCKED;
-
-                CFE_ES_WriteToSysLog("%s: Unable to update locked table Handle=%d\n", __func__, TblHandle);
+                /* The worker finished just in time */
+                break;
             }
-            else
-            {
-                /* To update a single buffered table requires a memcpy from working buffer */
-                if (RegRecPtr->Buffers[0].BufferPtr != CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr)
-                {
-                    memcpy(RegRecPtr->Buffers[0].BufferPtr,
-                           CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr, RegRecPtr->Size);
-                }
 
-                /* Save source description with active buffer */
-                strncpy(RegRecPtr->Buffers[0].DataSource,
-                        CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].DataSource,
-                        sizeof(RegRecPtr->Buffers[0].DataSource) - 1);
-                RegRecPtr->Buffers[0].DataSource[sizeof(RegRecPtr->Buffers[0].DataSource) - 1] = 0;
-                strncpy(RegRecPtr->LastFileLoaded, CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].DataSource,
-                        sizeof(RegRecPtr->LastFileLoaded) - 1);
-                RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 1] = 0;
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_TIMEOUT_ERR_EID, CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_Global.TableTaskAppId,
+                                       "Validation of '%s' did not finish within %u msec, Status=0x%08X",
+                                       RegRecPtr->Name, (unsigned int)CFE_PLATFORM_TBL_VALIDATION_TIMEOUT_MSEC,
+                                       (unsigned int)CFE_TBL_ERR_VALIDATION_TIMEOUT);
 
-                /* Save the file creation time from the loaded file into the Table Registry */
-                RegRecPtr->Buffers[0].FileCreateTimeSecs =
-                    CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].FileCreateTimeSecs;
-                RegRecPtr->Buffers[0].FileCreateTimeSubSecs =
-                    CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].FileCreateTimeSubSecs;
+            return CFE_TBL_ERR_VALIDATION_TIMEOUT;
+        }
 
-                /* Save the previously computed CRC into the new buffer */
-                RegRecPtr->Buffers[0].Crc = CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Crc;
+        /* Only waits that ran their full length count towards the timeout */
+        OsStatus = OS_BinSemTimedWait(CFE_TBL_Global.ValidationDoneSem, CFE_TBL_VALIDATION_WAIT_MSEC);
+        if (OsStatus != OS_SUCCESS)
+        {
+            WaitedMsec += CFE_TBL_VALIDATION_WAIT_MSEC;
+        }
+    }
 
-                /* Free the working buffer */
-                CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Taken = false;
+    return CFE_SUCCESS;
+}
 
-                CFE_TBL_NotifyTblUsersOfUpdate(RegRecPtr);
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_MarkPendingWork(CFE_TBL_RegistryRec_t *RegRecPtr, uint32 PendingWork)
+{
+    uint32 AppIndex;
 
-                /* If the table is a critical table, update the appropriate CDS with the new data */
-                if (RegRecPtr->CriticalTable == true)
-                {
-                    CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
-                }
-            }
-        }
+    if (CFE_ES_AppID_ToIndex(RegRecPtr->OwnerAppId, &AppIndex) == CFE_SUCCESS &&
+        AppIndex < CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        /* Publishes the request after the table state describing it (release) */
+        CFE_TBL_LockRegistry();
+        CFE_TBL_EPOCH_STORE(CFE_TBL_Global.PendingWork[AppIndex],
+                            CFE_TBL_EPOCH_LOAD(CFE_TBL_Global.PendingWork[AppIndex]) | PendingWork);
+        CFE_TBL_UnlockRegistry();
     }
-
-    return Status;
 }
 
 /*----------------------------------------------------------------
@@ -1015,24 +2490,27 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_TBL_NotifyTblUsersOfUpdate(CFE_TBL_RegistryRec_t *RegRecPtr)
+uint32 CFE_TBL_GetPendingWork(const CFE_TBL_RegistryRec_t *RegRecPtr)
 {
-    CFE_TBL_Handle_t AccessIterator;
+    uint32 PendingWork = 0;
 
-    /* Reset Load in Progress Values */
-    RegRecPtr->LoadInProgress   = CFE_TBL_NO_LOAD_IN_PROGRESS;
-    RegRecPtr->TimeOfLastUpdate = CFE_TIME_GetTime();
+    if (RegRecPtr->LoadPending)
+    {
+        PendingWork |= CFE_TBL_PENDING_UPDATE;
+    }
 
-    /* Clear notification of pending load (as well as NO LOAD) and notify everyone of update */
-    RegRecPtr->LoadPending     = false;
-    RegRecPtr->TableLoadedOnce = true;
-    AccessIterator             = RegRecPtr->HeadOfAccessList;
-    while (AccessIterator != CFE_TBL_END_OF_LIST)
+    if ((RegRecPtr->ValidateActiveIndex != CFE_TBL_NO_VALIDATION_PENDING) ||
+        (RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING))
     {
-        CFE_TBL_Global.Handles[AccessIterator].Updated = true;
+        PendingWork |= CFE_TBL_PENDING_VALIDATE;
+    }
 
-        AccessIterator = CFE_TBL_Global.Handles[AccessIterator].NextLink;
+    if (RegRecPtr->DumpControlIndex != CFE_TBL_NO_DUMP_PENDING)
+    {
+        PendingWork |= CFE_TBL_PENDING_DUMP;
     }
+
+    return PendingWork;
 }
 
 /*----------------------------------------------------------------
@@ -1223,6 +2701,9 @@ void CFE_TBL_ByteSwapUint32(uint32 *Uint32ToSwapPtr)
 int32 CFE_TBL_CleanUpApp(CFE_ES_AppId_t AppId)
 {
     uint32                      i;
+    uint32                      AppIndex;
+    CFE_TBL_Handle_t            TblHandle;
+    CFE_TBL_Handle_t            NextHandle;
     CFE_TBL_RegistryRec_t *     RegRecPtr     = NULL;
     CFE_TBL_AccessDescriptor_t *AccessDescPtr = NULL;
 
@@ -1231,7 +2712,9 @@ int32 CFE_TBL_CleanUpApp(CFE_ES_AppId_t AppId)
     for (i = 0; i < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS; i++)
     {
         /* Check to see if the table to be dumped is owned by the App to be deleted */
+        /* Dumps already being written are detached when the table buffers are released */
         if ((CFE_TBL_Global.DumpControlBlocks[i].State != CFE_TBL_DUMP_FREE) &&
+            (CFE_TBL_Global.DumpControlBlocks[i].State != CFE_TBL_DUMP_WRITING) &&
             CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.DumpControlBlocks[i].RegRecPtr->OwnerAppId, AppId))
         {
             /* If so, then remove the dump request */
@@ -1239,16 +2722,31 @@ int32 CFE_TBL_CleanUpApp(CFE_ES_AppId_t AppId)
         }
     }
 
-    /* Scan Access Descriptors to determine if the Application had access to any tables */
-    for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_HANDLES; i++)
+    /* An Application that does not resolve to an index cannot hold any handles */
+    if (CFE_ES_AppID_ToIndex(AppId, &AppIndex) != CFE_SUCCESS || AppIndex >= CFE_PLATFORM_ES_MAX_APPLICATIONS)
+    {
+        return CFE_SUCCESS;
+    }
+
+    /* Forget any requests that the Application never got around to servicing */
+    CFE_TBL_LockRegistry();
+    CFE_TBL_EPOCH_STORE(CFE_TBL_Global.PendingWork[AppIndex], 0);
+    CFE_TBL_UnlockRegistry();
+
+    /* Walk the Access Descriptors held by the Application */
+    TblHandle = CFE_TBL_Global.Index.AppHandleHead[AppIndex];
+    for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_HANDLES && TblHandle != CFE_TBL_END_OF_LIST; i++)
     {
+        /* Removing the access link takes the handle off the list */
+        NextHandle = CFE_TBL_Global.Index.AppNextHandle[TblHandle];
+
         /* Check to see if the Handle belongs to the Application being deleted */
-        if (CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Handles[i].AppId, AppId) &&
-            CFE_TBL_Global.Handles[i].UsedFlag == true)
+        if (CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Handles[TblHandle].AppId, AppId) &&
+            CFE_TBL_Global.Handles[TblHandle].UsedFlag == true)
         {
             /* Delete the handle (and the table, if the App owned it) */
             /* Get a pointer to the relevant Access Descriptor */
-            AccessDescPtr = &CFE_TBL_Global.Handles[i];
+            AccessDescPtr = &CFE_TBL_Global.Handles[TblHandle];
 
             /* Get a pointer to the relevant entry in the registry */
             RegRecPtr = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
@@ -1256,6 +2754,9 @@ int32 CFE_TBL_CleanUpApp(CFE_ES_AppId_t AppId)
             /* Determine if the Application owned this particular table */
             if (CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, AppId))
             {
+                /* A worker may still be running the owner's validation function on the inactive buffer */
+                CFE_TBL_WaitForAsyncValidation(RegRecPtr);
+
                 /* Mark table as free, although, technically, it isn't free until the */
                 /* linked list of Access Descriptors has no links in it.              */
                 /* NOTE: Allocated memory is freed when all Access Links have been    */
@@ -1264,16 +2765,19 @@ int32 CFE_TBL_CleanUpApp(CFE_ES_AppId_t AppId)
                 RegRecPtr->OwnerAppId = CFE_TBL_NOT_OWNED;
 
                 /* Remove Table Name */
+                CFE_TBL_RemoveFromNameIndex(AccessDescPtr->RegIndex);
                 RegRecPtr->Name[0] = '\0';
             }
 
             /* Remove the Access Descriptor Link from linked list */
             /* NOTE: If this removes the last access link, then   */
             /*       memory buffers are set free as well.         */
-            CFE_TBL_RemoveAccessLink(i);
+            CFE_TBL_RemoveAccessLink(TblHandle);
 
-            CFE_TBL_Global.Handles[i].AppId = CFE_TBL_NOT_OWNED;
+            CFE_TBL_Global.Handles[TblHandle].AppId = CFE_TBL_NOT_OWNED;
         }
+
+        TblHandle = NextHandle;
     }
 
     return CFE_SUCCESS;
@@ -48,6 +48,33 @@
 #define CFE_TBL_NOT_FOUND   (-1)
 #define CFE_TBL_END_OF_LIST (CFE_TBL_Handle_t)0xFFFF
 
+/*
+** Accesses to the publication epochs
+**
+** Readers pin an epoch in CFE_TBL_GetAddressInternal() without taking the registry
+** lock, so the pins and the active epoch are accessed with atomic loads and stores.
+** An update publishes the new buffer before it advances the epoch (release), and a
+** reader loads the epoch before the buffer (acquire).  Each side also issues a full
+** fence between its own store and its load of the other side's variable, so either
+** the reader sees the new epoch and pins again, or the update sees the pin before
+** it frees the retired buffer.
+**
+** The per-application pending work masks use the same accessors: they are changed
+** under the registry lock, but CFE_TBL_ManageAll() polls them without it.
+**
+** Without the GNU atomic builtins these are plain volatile accesses, which are only
+** sufficient on single processor targets.
+*/
+#if defined(__GNUC__)
+#define CFE_TBL_EPOCH_LOAD(Var)       __atomic_load_n(&(Var), __ATOMIC_ACQUIRE)
+#define CFE_TBL_EPOCH_STORE(Var, Val) __atomic_store_n(&(Var), (Val), __ATOMIC_RELEASE)
+#define CFE_TBL_EPOCH_FENCE()         __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#else
+#define CFE_TBL_EPOCH_LOAD(Var)       (Var)
+#define CFE_TBL_EPOCH_STORE(Var, Val) ((Var) = (Val))
+#define CFE_TBL_EPOCH_FENCE()         ((void)0)
+#endif
+
 /*****************************  Function Prototypes   **********************************/
 
 /*---------------------------------------------------------------------------------------*/
@@ -237,6 +264,126 @@ int16 CFE_TBL_FindFreeRegistryEntry(void);
 */
 CFE_TBL_Handle_t CFE_TBL_FindFreeHandle(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Computes the name index bucket for a table name
+**
+** \par Description
+**        Hashes the given processor specific table name into one of the
+**        #CFE_PLATFORM_TBL_MAX_NUM_TABLES buckets of the registry name index.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in]  TblName Pointer to character string containing processor specific name of table.
+**
+** \return Bucket number of the table name
+*/
+uint32 CFE_TBL_NameIndexBucket(const char *TblName);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Takes a Table Registry entry off the free list
+**
+** \par Description
+**        Removes the given entry from the free entry list and adds it to the
+**        registry name index.  Called once the entry has been given a name and owner.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked.
+**
+** \param[in]  RegIndx Index into Table Registry of entry being claimed.
+*/
+void CFE_TBL_ClaimRegistryEntry(int16 RegIndx);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Removes a Table Registry entry from the name index
+**
+** \par Description
+**        Called when a table loses its owner, before its name is cleared.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked.
+**
+** \param[in]  RegIndx Index into Table Registry of entry being unregistered.
+*/
+void CFE_TBL_RemoveFromNameIndex(int16 RegIndx);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Returns a Table Registry entry to the free list
+**
+** \par Description
+**        Called once a table has neither an owner nor any Access Descriptors.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked.
+**
+** \param[in]  RegIndx Index into Table Registry of entry being freed.
+*/
+void CFE_TBL_ReleaseRegistryEntry(int16 RegIndx);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Takes an Access Descriptor off the free list
+**
+** \par Description
+**        Removes the given Access Descriptor from the free handle list and adds it
+**        to the list of handles held by the application named in the descriptor.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked and the
+**        descriptor's AppId has been filled in.
+**
+** \param[in]  TblHandle Handle of Access Descriptor being claimed.
+*/
+void CFE_TBL_ClaimHandle(CFE_TBL_Handle_t TblHandle);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Returns an Access Descriptor to the free list
+**
+** \par Description
+**        Removes the given Access Descriptor from its application's handle list
+**        and adds it to the free handle list.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked and the
+**        descriptor's AppId has not yet been cleared.
+**
+** \param[in]  TblHandle Handle of Access Descriptor being released.
+*/
+void CFE_TBL_ReleaseHandle(CFE_TBL_Handle_t TblHandle);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Removes an Access Descriptor from its application's handle list
+**
+** \par Description
+**        Does nothing if the descriptor is not on a list.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked.
+**
+** \param[in]  TblHandle Handle of Access Descriptor being unlinked.
+*/
+void CFE_TBL_UnlinkAppHandle(CFE_TBL_Handle_t TblHandle);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Rebuilds the registry free lists, name index and per-application handle lists
+**
+** \par Description
+**        Derives #CFE_TBL_Global_t::Index from the current contents of the
+**        Table Registry and the Access Descriptor array.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked or that
+**        Table Services is still initializing.
+*/
+void CFE_TBL_RebuildRegistryIndex(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Creates a Full Table name from application name and table name
@@ -303,6 +450,9 @@ int32 CFE_TBL_UnlockRegistry(void);
 ** \par Assumptions, External Events, and Notes:
 **        -# This function assumes the TblHandle and MinBufferSize values
 **           are legitimate.
+**        -# A newly obtained working buffer does not hold the active table
+**           contents; loaders must call #CFE_TBL_PrefillWorkingBuffer before
+**           loading anything less than the entire table.
 **
 ** \param[in, out]  WorkingBufferPtr  Pointer to variable that will contain the
 **                                    address of the first byte of the working buffer. *WorkingBufferPtr is the address
@@ -322,6 +472,76 @@ int32 CFE_TBL_UnlockRegistry(void);
 int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr,
                                bool CalledByApp);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Copies the active table contents into the parts of a working buffer not being loaded
+**
+** \par Description
+**        Working buffers are not initialized with the active table contents when they
+**        are obtained.  Before data is loaded into a working buffer, this function copies
+**        the active contents into the part of the table's dirty range (the range in which
+**        the working buffer may differ from the active buffer) that the load does not
+**        cover, so that a partial load only replaces the bytes it covers.  For double
+**        buffered tables the dirty range is only as large as the previous loads, so a
+**        small patch costs a small copy.  The copy is only performed the first time the
+**        working buffer is loaded; subsequent partial loads into the same working buffer
+**        build on its current contents and grow the dirty range to cover them.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.  In particular, Offset + NumBytes must not exceed the table size.
+**
+** \param[in, out]  WorkingBufferPtr  Pointer to the working buffer about to be loaded
+**
+** \param[in, out]  RegRecPtr  Pointer to Table Registry Entry for table being loaded
+**
+** \param[in]  Offset         Offset into the table of the first byte being loaded
+**
+** \param[in]  NumBytes       Number of bytes being loaded
+*/
+void CFE_TBL_PrefillWorkingBuffer(CFE_TBL_LoadBuff_t *WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr, size_t Offset,
+                                  size_t NumBytes);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Determines whether a loaded working buffer matches the active table contents
+**
+** \par Description
+**        Compares the image loaded into a working buffer against the table's active
+**        contents.  The CRCs of the two images are compared first, and only when they
+**        match are the bytes within the table's dirty range compared to confirm it.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The working buffer must hold a complete table image (i.e. - it has been
+**           prefilled with #CFE_TBL_PrefillWorkingBuffer and its CRC computed).
+**
+** \param[in]  WorkingBufferPtr  Pointer to the loaded working buffer
+**
+** \param[in]  RegRecPtr         Pointer to Table Registry Entry for table being loaded
+**
+** \retval true  if the table was registered with #CFE_TBL_OPT_RELOAD_IF_CHANGED, has been loaded before
+**               and the working buffer is identical to the active buffer
+** \retval false otherwise
+*/
+bool CFE_TBL_IsLoadUnchanged(const CFE_TBL_LoadBuff_t *WorkingBufferPtr, const CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Completes a load whose image is identical to the active table contents
+**
+** \par Description
+**        Releases the working buffer without validating or activating it, and
+**        records the source of the loaded image as the source of the active contents.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# #CFE_TBL_IsLoadUnchanged must have returned true for the working buffer.
+**
+** \param[in]  WorkingBufferPtr  Pointer to the loaded working buffer
+**
+** \param[in, out]  RegRecPtr    Pointer to Table Registry Entry for table being loaded
+*/
+void CFE_TBL_DiscardUnchangedLoad(CFE_TBL_LoadBuff_t *WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Loads a table buffer with data from a specified file
@@ -365,6 +585,27 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
 int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr,
                            const char *Filename);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Loads the contents of a table from a file or memory block
+**
+** \par Description
+**        Implements #CFE_TBL_Load, which wraps it so that every outcome
+**        of the load, including early rejections, is seen by the trace.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in]  TblHandle   Handle of the table to be loaded.
+**
+** \param[in]  SrcType     Flag indicating whether SrcDataPtr is a file name or memory address.
+**
+** \param[in]  SrcDataPtr  Pointer to the file name or the memory block holding the new contents.
+**
+** \return Execution status, see #CFE_TBL_Load
+*/
+int32 CFE_TBL_LoadInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType, const void *SrcDataPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Updates the active table buffer with contents of inactive buffer
@@ -378,6 +619,12 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
 ** \par Assumptions, External Events, and Notes:
 **        -# All parameters are assumed to be verified before function
 **           is called.
+**        -# The active buffer of a single buffered table is never written in place,
+**           since readers may pin it at any time.  The new contents are published in
+**           a newly allocated buffer and the old one is retired until it is released
+**           (see #CFE_TBL_ReclaimRetiredBuffer).  The update is left pending, and
+**           #CFE_TBL_INFO_TABLE_LOCKED returned, while a previously retired buffer is
+**           still pinned or no buffer can be allocated.
 **
 ** \param[in]  TblHandle      Handle of Table to be updated.
 **
@@ -386,6 +633,8 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
 ** \param[in]  AccessDescPtr  Pointer to appropriate access descriptor for table-application interface
 **
 ** \retval #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_INFO_NO_UPDATE_PENDING    \copydoc CFE_TBL_INFO_NO_UPDATE_PENDING
+** \retval #CFE_TBL_INFO_TABLE_LOCKED         \copydoc CFE_TBL_INFO_TABLE_LOCKED
 */
 int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *RegRecPtr,
                              CFE_TBL_AccessDescriptor_t *AccessDescPtr);
@@ -406,6 +655,345 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
 */
 void CFE_TBL_NotifyTblUsersOfUpdate(CFE_TBL_RegistryRec_t *RegRecPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Determines whether any reader still holds a table buffer published at or before an epoch
+**
+** \par Description
+**        Scans the access descriptors linked to the table and reports whether any
+**        of them has pinned a publication epoch that is no newer than the specified
+**        epoch, i.e. whether a reader may still be accessing the buffer that was
+**        active during that epoch.  Background table dumps count as readers, see
+**        #CFE_TBL_IsDumpPinned.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for table to be checked
+**
+** \param[in]  Epoch          Publication epoch of the buffer of interest
+**
+** \return true if a reader has pinned the epoch or an older one, false otherwise
+*/
+bool CFE_TBL_IsEpochPinned(CFE_TBL_RegistryRec_t *RegRecPtr, uint32 Epoch);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Determines whether a table dump is still copying a buffer
+**
+** \par Description
+**        Scans the dump control blocks for dumps of the specified table that are
+**        copying the table data out of a table buffer and reports whether any of
+**        them pinned an epoch that is no newer than the specified epoch.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**        -# The registry mutex is assumed to be held by the caller.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for table to be checked
+**
+** \param[in]  Epoch          Publication epoch of the buffer of interest
+**
+** \return true if a dump is reading the buffer of the epoch or an older one, false otherwise
+*/
+bool CFE_TBL_IsDumpPinned(const CFE_TBL_RegistryRec_t *RegRecPtr, uint32 Epoch);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Determines whether any reader holds a particular table buffer
+**
+** \par Description
+**        Scans the access descriptors linked to the table and the background
+**        table dumps for one that is still reading the specified buffer.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for table to be checked
+**
+** \param[in]  BufferPtr      Table buffer of interest
+**
+** \return true if a reader or table dump holds the buffer, false otherwise
+*/
+bool CFE_TBL_IsBufferPinned(const CFE_TBL_RegistryRec_t *RegRecPtr, const void *BufferPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Determines whether a Dump Only table's captured data is still being written
+**
+** \par Description
+**        Reports whether a background dump of the specified table is still
+**        writing the copy held in a shared working buffer, in which case the
+**        buffer may not be handed out for another dump.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for table to be checked
+**
+** \return true if the table's dump buffer is in use, false otherwise
+*/
+bool CFE_TBL_IsDumpBufferInUse(const CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Detaches all background dumps from a table whose buffers are about to be released
+**
+** \par Description
+**        Marks every dump of the specified table that is being written to file as
+**        aborted and clears its data pointer so the background file writer stops
+**        reading the table buffers.  The dump file is closed and reported by the
+**        background file writer as usual.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**        -# The registry mutex is assumed to be held by the caller.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for table being released
+*/
+void CFE_TBL_AbortDumps(const CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Returns a retired table buffer to the memory pool once it is no longer pinned
+**
+** \par Description
+**        When an update of a single buffered table had to be published in a new
+**        buffer because readers were accessing the active one, the old buffer is
+**        retired rather than freed.  This function frees the retired buffer once
+**        no reader holds the epoch in which it was active.  It does nothing if there
+**        is no retired buffer or if it is still in use.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**        -# This function takes the registry mutex and must not be called while it is held.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for table whose retired buffer is to be reclaimed
+*/
+void CFE_TBL_ReclaimRetiredBuffer(CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Makes the inactive buffer of a multi-buffered table free for loading
+**
+** \par Description
+**        If a reader or a table dump is still using the inactive buffer, the
+**        buffer is exchanged for a spare buffer that none of them holds any more.
+**        The exchanged buffer becomes a spare that is reused once it has been
+**        released.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked.
+**
+** \param[in]  RegRecPtr Pointer to Registry Record of a multi-buffered table.
+**
+** \retval #CFE_SUCCESS                 \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_ERR_NO_BUFFER_AVAIL \copydoc CFE_TBL_ERR_NO_BUFFER_AVAIL
+*/
+int32 CFE_TBL_SwapInSpareBuffer(CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Locates the inactive buffer of a table
+**
+** \par Description
+**        Returns the dedicated inactive buffer of a double buffered table, or the shared
+**        working buffer holding the load in progress of a single buffered table.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for the table
+**
+** \return Pointer to the inactive buffer, or NULL if a single buffered table has no load in progress
+*/
+CFE_TBL_LoadBuff_t *CFE_TBL_GetInactiveBuffer(CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Reports the range of a table changed by its pending load
+**
+** \par Description
+**        Reports the dirty range of the load in progress, or the whole table when no
+**        load is in progress.  This performs no access checks of its own, so it may
+**        be used from any context once the caller has been validated.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for the table
+** \param[out] OffsetPtr      Byte offset of the first changed byte
+** \param[out] NumBytesPtr    Number of bytes changed
+**
+** \retval #CFE_SUCCESS                    \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_INFO_NO_UPDATE_PENDING \copydoc CFE_TBL_INFO_NO_UPDATE_PENDING
+*/
+int32 CFE_TBL_GetLoadRangeInternal(const CFE_TBL_RegistryRec_t *RegRecPtr, size_t *OffsetPtr, size_t *NumBytesPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Calls a table's validation function on its inactive buffer
+**
+** \par Description
+**        Validates the inactive buffer of a table with the owner's validation function
+**        and reports the outcome with an event message.  This is shared by #CFE_TBL_Validate
+**        and the validation worker tasks, which post the result with #CFE_TBL_CompleteValidation.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**        -# A NULL buffer (the load was completed or aborted since the request was made)
+**           is reported as a failed validation.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for table to be validated
+**
+** \param[in]  InactiveBufPtr Pointer to the buffer to be validated, see #CFE_TBL_GetInactiveBuffer
+**
+** \param[in]  AppName        Name of the owning application, used in event messages
+**
+** \return Status returned by the validation function, or #CFE_TBL_ERR_NO_BUFFER_AVAIL
+*/
+int32 CFE_TBL_ValidateInactiveBuffer(CFE_TBL_RegistryRec_t *RegRecPtr, const CFE_TBL_LoadBuff_t *InactiveBufPtr,
+                                     const char *AppName);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Posts the result of a validation of an inactive buffer
+**
+** \par Description
+**        Marks the buffer as validated when it passed and posts the result to the given
+**        validation result record for the Table Services task to report.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The result is stored before the record is marked as performed (release), so
+**           the Table Services task never reports a stale result.
+**
+** \param[in]  InactiveBufPtr Pointer to the validated buffer, may be NULL
+**
+** \param[in]  ValIndex       Index of the validation result record for this request
+**
+** \param[in]  Status         Result of the validation
+*/
+void CFE_TBL_CompleteValidation(CFE_TBL_LoadBuff_t *InactiveBufPtr, int32 ValIndex, int32 Status);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Starts the table validation worker tasks
+**
+** \par Description
+**        Creates the validation request queue and the #CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS
+**        child tasks that service it.  Nothing is created when the platform configures no workers.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Called once by the Table Services task during initialization.
+**
+** \return #CFE_SUCCESS or the error from creating the queue or a task
+*/
+int32 CFE_TBL_StartValidationWorkers(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Entry point of the table validation worker tasks
+**
+** \par Description
+**        Waits for registry indices on the validation queue and validates the inactive
+**        buffer of each table with #CFE_TBL_ValidateInactiveBuffer.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Only returns if the validation queue can no longer be read.
+*/
+void CFE_TBL_ValidationWorkerMain(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Hands a validation request on an inactive buffer to a worker task
+**
+** \par Description
+**        Queues the request for a validation worker when the table was registered with
+**        #CFE_TBL_OPT_VALIDATE_ASYNC and workers are running.  The inactive buffer is
+**        pinned when the request is queued; until the worker is done with it, loads of
+**        the table get #CFE_TBL_ERR_NO_BUFFER_AVAIL and updates #CFE_TBL_INFO_TABLE_LOCKED.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Called by the Table Services task only.
+**
+** \param[in]  RegIndex       Index of the Table Registry Entry for the table to be validated
+**
+** \param[in]  ValIndex       Index of the validation result record for this request
+**
+** \return true if a worker will perform the validation, false if the owner must
+*/
+bool CFE_TBL_DispatchValidation(int16 RegIndex, int32 ValIndex);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Waits until no validation worker is using a table
+**
+** \par Description
+**        Returns once any validation of the table's inactive buffer that was handed to a
+**        worker task has finished, so the buffers and the validation function can be released.
+**        Blocks on the semaphore the workers give when they finish a validation.
+**
+**        If the worker does not finish within #CFE_PLATFORM_TBL_VALIDATION_TIMEOUT_MSEC,
+**        the validation is failed with #CFE_TBL_ERR_VALIDATION_TIMEOUT and an event message.
+**        The worker discards its result when it eventually finishes.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Must not be called while holding the registry mutex.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for table about to be released
+**
+** \retval #CFE_SUCCESS                    \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_ERR_VALIDATION_TIMEOUT \copydoc CFE_TBL_ERR_VALIDATION_TIMEOUT
+*/
+int32 CFE_TBL_WaitForAsyncValidation(CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Flags a table request for the owning application to service
+**
+** \par Description
+**        Sets the given bits in the pending work mask of the application that owns
+**        the table so that the next call to #CFE_TBL_ManageAll by that application
+**        processes the table.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**        -# This function takes the registry mutex and must not be called while it is held.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for table with a pending request
+**
+** \param[in]  PendingWork    Mask of CFE_TBL_PENDING_* bits describing the request
+*/
+void CFE_TBL_MarkPendingWork(CFE_TBL_RegistryRec_t *RegRecPtr, uint32 PendingWork);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Returns the requests currently pending on a table
+**
+** \par Description
+**        Converts the pending load, validation and dump state of a registry entry
+**        into a mask of CFE_TBL_PENDING_* bits.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for table to be checked
+**
+** \return Mask of CFE_TBL_PENDING_* bits, zero when nothing is pending
+*/
+uint32 CFE_TBL_GetPendingWork(const CFE_TBL_RegistryRec_t *RegRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Reads Table File Headers
@@ -560,6 +1148,16 @@ void CFE_TBL_DumpRegistryEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event,
                                       size_t BlockSize, size_t Position);
 bool CFE_TBL_DumpRegistryGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
 
+/*
+ * Internal helper functions for Table image dumps
+ *
+ * These callbacks are used with the FS background write request API
+ * and are implemented per that specification.
+ */
+void CFE_TBL_DumpTableEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
+                                   size_t BlockSize, size_t Position);
+bool CFE_TBL_DumpTableGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
 /*
 ** Globals specific to the TBL module
 */
@@ -38,6 +38,7 @@
 #include "cfe_perfids.h"
 
 #include "cfe_tbl_core_internal.h"
+#include "cfe_core_trace.h"
 
 #include "cfe_tbl_eventids.h"
 #include "cfe_tbl_msg.h"
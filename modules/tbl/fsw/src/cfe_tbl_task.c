@@ -159,6 +159,17 @@ int32 CFE_TBL_TaskInit(void)
         return Status;
     }
 
+    /*
+    ** Start the workers that validate tables on behalf of their owners
+    */
+    Status = CFE_TBL_StartValidationWorkers();
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Error starting validation workers:RC=0x%08X\n", __func__, (unsigned int)Status);
+        return Status;
+    }
+
     /*
     ** Task startup event message
     */
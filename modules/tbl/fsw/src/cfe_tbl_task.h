@@ -48,6 +48,14 @@
 #define CFE_TBL_MUT_WORK_VALUE 0             /**< \brief Initial Value of Working Buffer Assignment Mutex */
 /** \} */
 
+/** \name Table Validation Worker Characteristics */
+/**  \{ */
+#define CFE_TBL_VALIDATION_QUEUE_NAME "TBL_VAL_Q"   /**< \brief Name of queue feeding the validation workers */
+#define CFE_TBL_VALIDATION_TASK_NAME  "TBL_VAL_%u"  /**< \brief Format of validation worker task names */
+#define CFE_TBL_VALIDATION_SEM_NAME   "TBL_VAL_SEM" /**< \brief Name of semaphore given when a validation finishes */
+#define CFE_TBL_VALIDATION_WAIT_MSEC  100           /**< \brief Longest wait for a finished validation */
+/** \} */
+
 /** \name Table Services Task Pipe Characteristics */
 /**  \{ */
 #define CFE_TBL_TASK_PIPE_NAME  "TBL_CMD_PIPE" /**< \brief Name of TBL Task Command Pipe */
@@ -61,6 +69,13 @@
 */
 #define CFE_TBL_NO_LOAD_IN_PROGRESS (-1)
 
+/** \brief Number of spare buffers of a multi-buffered table */
+/**
+**  The active and inactive buffers of a multi-buffered table are held in
+**  #CFE_TBL_RegistryRec_t::Buffers like those of any double buffered table.
+*/
+#define CFE_TBL_NUM_SPARE_BUFFERS (CFE_PLATFORM_TBL_MULTI_BUFFER_DEPTH - 2)
+
 /** \brief Value indicating when no Validation is Pending */
 /**
 **  This macro is used to indicate no Validation is Pending by assigning it to
@@ -75,6 +90,25 @@
 */
 #define CFE_TBL_NO_DUMP_PENDING (-1)
 
+/** \brief Value indicating when an Access Descriptor has not pinned a table buffer */
+/**
+**  This macro is used to indicate the reader is not accessing table data by assigning it to
+**  #CFE_TBL_AccessDescriptor_t::PinnedEpoch.  Publication epochs skip this value.
+**  Pins and the active epoch are read and written with CFE_TBL_EPOCH_LOAD() and
+**  CFE_TBL_EPOCH_STORE() wherever other tasks may access them without the registry lock.
+*/
+#define CFE_TBL_NO_EPOCH_PINNED 0
+
+/** \brief Bits of the per-application pending work mask */
+/**
+**  These bits are set in #CFE_TBL_Global_t::PendingWork for the application owning a
+**  table when a request is made that the owner must service with #CFE_TBL_ManageAll.
+**  The mask is only accessed with CFE_TBL_EPOCH_LOAD() and CFE_TBL_EPOCH_STORE().
+*/
+#define CFE_TBL_PENDING_UPDATE   0x01
+#define CFE_TBL_PENDING_VALIDATE 0x02
+#define CFE_TBL_PENDING_DUMP     0x04
+
 /************************  Internal Structure Definitions  *****************************/
 
 /*******************************************************************************/
@@ -92,9 +126,10 @@ typedef enum
  */
 typedef enum
 {
-    CFE_TBL_DUMP_FREE = 0, /**< \brief Dump Request Block is Free */
-    CFE_TBL_DUMP_PENDING,  /**< \brief Dump Request Block waiting for Application */
-    CFE_TBL_DUMP_PERFORMED /**< \brief Dump Request Block processed by Application */
+    CFE_TBL_DUMP_FREE = 0,  /**< \brief Dump Request Block is Free */
+    CFE_TBL_DUMP_PENDING,   /**< \brief Dump Request Block waiting for Application */
+    CFE_TBL_DUMP_PERFORMED, /**< \brief Dump Request Block processed by Application */
+    CFE_TBL_DUMP_WRITING    /**< \brief Dump Request Block being written to file by the background file writer */
 } CFE_TBL_DumpState_t;
 
 /*******************************************************************************/
@@ -138,6 +173,7 @@ typedef struct
     uint32 Crc;                   /**< \brief Last calculated CRC for this buffer's contents */
     bool   Taken;                 /**< \brief Flag indicating whether buffer is in use */
     bool   Validated;             /**< \brief Flag indicating whether the buffer has been successfully validated */
+    bool   Prefilled;             /**< \brief Flag indicating whether the parts not being loaded hold active data */
     char   DataSource[OS_MAX_PATH_LEN]; /**< \brief Source of data put into buffer (filename or memory address) */
 } CFE_TBL_LoadBuff_t;
 
@@ -155,8 +191,11 @@ typedef struct
     int16            RegIndex;    /**< \brief Index into Table Registry (a.k.a. - Global Table #) */
     CFE_TBL_Handle_t PrevLink;    /**< \brief Index of previous access descriptor in linked list */
     CFE_TBL_Handle_t NextLink;    /**< \brief Index of next access descriptor in linked list */
+    volatile uint32  PinnedEpoch; /**< \brief Publication epoch of the buffer being accessed by this thread,
+                                               #CFE_TBL_NO_EPOCH_PINNED when not accessing table data */
+    void *volatile   PinnedBufferPtr; /**< \brief Buffer being accessed by this thread, valid while
+                                                   PinnedEpoch is set */
     bool             UsedFlag;    /**< \brief Indicates whether this descriptor is being used or not  */
-    bool             LockFlag;    /**< \brief Indicates whether thread is currently accessing table data */
     bool             Updated;     /**< \brief Indicates table has been updated since last GetAddress call */
     uint8            BufferIndex; /**< \brief Index of buffer currently being used */
 } CFE_TBL_AccessDescriptor_t;
@@ -174,12 +213,20 @@ typedef struct
     CFE_SB_MsgId_t     NotificationMsgId; /**< \brief Message ID of an associated management notification message */
     uint32             NotificationParam; /**< \brief Parameter of an associated management notification message */
     CFE_TBL_LoadBuff_t Buffers[2];        /**< \brief Active and Inactive Buffer Pointers */
+    size_t             DirtyOffset;       /**< \brief Start of range where working buffer may differ from active */
+    size_t             DirtyNumBytes;     /**< \brief Length of range where working buffer may differ from active */
+    volatile uint32    ActiveEpoch;       /**< \brief Publication epoch, advanced each time the active buffer changes */
+    void *             RetiredBufferPtr;  /**< \brief Previous active buffer still pinned by readers, or NULL */
+    uint32             RetiredEpoch;      /**< \brief Last publication epoch in which the retired buffer was active */
+    void *SpareBufferPtr[CFE_TBL_NUM_SPARE_BUFFERS]; /**< \brief Spare buffers of a multi-buffered table */
     CFE_TBL_CallbackFuncPtr_t ValidationFuncPtr; /**< \brief Ptr to Owner App's function that validates tbl contents */
     CFE_TIME_SysTime_t        TimeOfLastUpdate;  /**< \brief Time when Table was last updated */
     CFE_TBL_Handle_t          HeadOfAccessList;  /**< \brief Index into Handles Array that starts Access Linked List */
     int32              LoadInProgress;      /**< \brief Flag identifies inactive buffer and whether load in progress */
     int32              ValidateActiveIndex; /**< \brief Index to Validation Request on Active Table Result data */
     int32              ValidateInactiveIndex; /**< \brief Index to Validation Request on Inactive Table Result data */
+    volatile int32     AsyncValidateIndex;    /**< \brief Index to Validation Request being handled by a worker task */
+    CFE_TBL_LoadBuff_t *volatile AsyncValidateBufPtr; /**< \brief Buffer being validated by a worker task */
     int32              DumpControlIndex;      /**< \brief Index to Dump Control Block */
     CFE_ES_CDSHandle_t CDSHandle;             /**< \brief Handle to Critical Data Store for Critical Tables */
     CFE_MSG_FcnCode_t  NotificationCC;  /**< \brief Command Code of an associated management notification message */
@@ -188,7 +235,10 @@ typedef struct
     bool               LoadPending;     /**< \brief Flag indicating an inactive buffer is ready to be copied */
     bool               DumpOnly;        /**< \brief Flag indicating Table is NOT to be loaded */
     bool               DoubleBuffered;  /**< \brief Flag indicating Table has a dedicated inactive buffer */
+    bool               MultiBuffered;   /**< \brief Flag indicating Table also has spare buffers */
     bool               UserDefAddr;     /**< \brief Flag indicating Table address was defined by Owner Application */
+    bool               AsyncValidation; /**< \brief Flag indicating inactive buffer may be validated by a worker task */
+    bool               ReloadIfChanged; /**< \brief Flag indicating loads matching the active contents are skipped */
     bool               NotifyByMsg;     /**< \brief Flag indicating Table Services should notify owning App via message
                                                     when table requires management */
     uint8 ActiveBufferIndex;            /**< \brief Index identifying which buffer is the active buffer */
@@ -216,15 +266,27 @@ typedef struct
 /*******************************************************************************/
 /**   \brief Dump Control Block
 **
-**    This structure holds the data associated with a dump request.
+**    This structure holds the data associated with a dump request.  The background
+**    file writer reads the table buffer in place, which stays pinned until the
+**    dump is done.  Dump Only tables are written from a copy captured by their owner.
 */
 typedef struct
 {
+    CFE_FS_FileWriteMetaData_t FileWrite; /**< FS state data - must be first */
+
     CFE_TBL_DumpState_t    State;         /**< \brief Current state of this block of data */
     size_t                 Size;          /**< \brief Number of bytes to be dumped */
     CFE_TBL_LoadBuff_t *   DumpBufferPtr; /**< \brief Address where dumped data is to be stored temporarily */
     CFE_TBL_RegistryRec_t *RegRecPtr;     /**< \brief Ptr to dumped table's registry record */
     char                   TableName[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Name of Table being Dumped */
+
+    void *             DumpDataPtr;   /**< \brief Data being written, NULL if the table went away during the dump */
+    size_t             Position;      /**< \brief Number of bytes of table data handed to the file writer */
+    uint32             PinnedEpoch;   /**< \brief Publication epoch of the table buffer being written,
+                                                 #CFE_TBL_NO_EPOCH_PINNED when the data is a private copy */
+    bool               FileExisted;   /**< \brief Set true if the file already existed at the time of request */
+    bool               Aborted;       /**< \brief Set true if the table went away before the dump completed */
+    CFE_TBL_File_Hdr_t TblFileHeader; /**< \brief Table image header, already in file byte order */
 } CFE_TBL_DumpControl_t;
 
 /*******************************************************************************/
@@ -251,6 +313,7 @@ typedef struct
     char               LastFileLoaded[OS_MAX_PATH_LEN]; /**< \brief Filename of last file loaded into table */
     char               OwnerAppName[OS_MAX_API_NAME];   /**< \brief Application Name of App that Registered Table */
     bool               CriticalTable;                   /**< \brief Identifies whether table is Critical or Not */
+    bool               MultiBuffered;                   /**< \brief Flag indicating Table also has spare buffers */
 } CFE_TBL_RegDumpRec_t;
 
 /*******************************************************************************/
@@ -266,6 +329,31 @@ typedef struct
     CFE_TBL_RegDumpRec_t DumpRecord;  /**< Current record buffer (reused each entry) */
 } CFE_TBL_RegDumpStateInfo_t;
 
+/*******************************************************************************/
+/**   \brief Table Registry Index
+**
+**    Lists that make the registry lifecycle operations independent of the size
+**    of the Table Registry and Access Descriptor arrays: free lists of registry
+**    entries and access descriptors, a hash index of owned registry entries by
+**    table name, and a list of the access descriptors held by each application.
+**    The lists are kept outside of the records themselves so that resetting a
+**    record does not break them.
+*/
+typedef struct
+{
+    int16 FreeEntryHead; /**< \brief First free Table Registry entry, #CFE_TBL_NOT_FOUND if none */
+    int16 NextFreeEntry[CFE_PLATFORM_TBL_MAX_NUM_TABLES]; /**< \brief Next free entry after each free entry */
+    int16 NameBucketHead[CFE_PLATFORM_TBL_MAX_NUM_TABLES]; /**< \brief First owned entry in each name hash bucket */
+    int16 NextInBucket[CFE_PLATFORM_TBL_MAX_NUM_TABLES];   /**< \brief Next owned entry in the same hash bucket */
+
+    CFE_TBL_Handle_t FreeHandleHead; /**< \brief First free Access Descriptor, #CFE_TBL_END_OF_LIST if none */
+    CFE_TBL_Handle_t NextFreeHandle[CFE_PLATFORM_TBL_MAX_NUM_HANDLES]; /**< \brief Next free Access Descriptor */
+    CFE_TBL_Handle_t
+        AppHandleHead[CFE_PLATFORM_ES_MAX_APPLICATIONS]; /**< \brief First Access Descriptor held by each application */
+    CFE_TBL_Handle_t AppNextHandle[CFE_PLATFORM_TBL_MAX_NUM_HANDLES]; /**< \brief Next descriptor of the same app */
+    CFE_TBL_Handle_t AppPrevHandle[CFE_PLATFORM_TBL_MAX_NUM_HANDLES]; /**< \brief Previous descriptor of the same app */
+} CFE_TBL_RegistryIndex_t;
+
 /*******************************************************************************/
 /**   \brief Table Task Global Data
 **
@@ -312,12 +400,15 @@ typedef struct
 
     int16  HkTlmTblRegIndex; /**< \brief Index of table registry entry to be telemetered with Housekeeping */
     uint16 ValidationCounter;
+    char   LastFileDumped[OS_MAX_PATH_LEN]; /**< \brief Last file written by a dump, protected by the registry mutex */
 
     /*
     ** Registry Access Mutex and Load Buffer Semaphores
     */
     osal_id_t          RegistryMutex; /**< \brief Mutex that controls access to Table Registry */
     osal_id_t          WorkBufMutex;  /**< \brief Mutex that controls assignment of Working Buffers */
+    osal_id_t          ValidationQueue; /**< \brief Queue of Registry indices waiting for a validation worker */
+    osal_id_t          ValidationDoneSem; /**< \brief Semaphore given each time a validation worker finishes */
     CFE_ES_CDSHandle_t CritRegHandle; /**< \brief Handle to Critical Table Registry in CDS */
     CFE_TBL_LoadBuff_t LoadBuffs[CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS]; /**< \brief Working table buffers shared by
                                                                               single buffered tables */
@@ -327,13 +418,16 @@ typedef struct
     */
     CFE_TBL_AccessDescriptor_t Handles[CFE_PLATFORM_TBL_MAX_NUM_HANDLES]; /**< \brief Array of Access Descriptors */
     CFE_TBL_RegistryRec_t      Registry[CFE_PLATFORM_TBL_MAX_NUM_TABLES]; /**< \brief Array of Table Registry Records */
+    CFE_TBL_RegistryIndex_t    Index; /**< \brief Free lists and lookup index of the registry arrays */
     CFE_TBL_CritRegRec_t
                         CritReg[CFE_PLATFORM_TBL_MAX_CRITICAL_TABLES]; /**< \brief Array of Critical Table Registry Records */
     CFE_TBL_BufParams_t Buf; /**< \brief Parameters associated with Table Task's Memory Pool */
     CFE_TBL_ValidationResult_t
                           ValidationResults[CFE_PLATFORM_TBL_MAX_NUM_VALIDATIONS]; /**< \brief Array of Table Validation Requests */
-    CFE_TBL_DumpControl_t DumpControlBlocks[CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS]; /**< \brief Array of Dump-Only
+    CFE_TBL_DumpControl_t DumpControlBlocks[CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS]; /**< \brief Array of Table
                                                                                          Dump Control Blocks */
+    volatile uint32
+        PendingWork[CFE_PLATFORM_ES_MAX_APPLICATIONS]; /**< \brief Per-application mask of pending table requests */
 
     /*
      * Registry dump state info (background job)
@@ -44,11 +44,8 @@
 int32 CFE_TBL_HousekeepingCmd(const CFE_MSG_CommandHeader_t *data)
 {
     int32                  Status;
-    int32                  OsStatus;
     uint32                 i;
     CFE_TBL_DumpControl_t *DumpCtrlPtr;
-    CFE_TIME_SysTime_t     DumpTime;
-    osal_id_t              FileDescriptor;
 
     /*
     ** Collect housekeeping data from Table Services
@@ -88,44 +85,14 @@ int32 CFE_TBL_HousekeepingCmd(const CFE_MSG_CommandHeader_t *data)
         if (CFE_TBL_Global.DumpControlBlocks[i].State == CFE_TBL_DUMP_PERFORMED)
         {
             DumpCtrlPtr = &CFE_TBL_Global.DumpControlBlocks[i];
-            Status      = CFE_TBL_DumpToFile(DumpCtrlPtr->DumpBufferPtr->DataSource, DumpCtrlPtr->TableName,
-                                        DumpCtrlPtr->DumpBufferPtr->BufferPtr, DumpCtrlPtr->Size);
-
-            /* If dump file was successfully written, update the file header so that the timestamp */
-            /* is the time of the actual capturing of the data, NOT the time when it was written to the file */
-            if (Status == CFE_TBL_INC_CMD_CTR)
-            {
-                DumpTime.Seconds    = DumpCtrlPtr->DumpBufferPtr->FileCreateTimeSecs;
-                DumpTime.Subseconds = DumpCtrlPtr->DumpBufferPtr->FileCreateTimeSubSecs;
-
-                OsStatus = OS_OpenCreate(&FileDescriptor, DumpCtrlPtr->DumpBufferPtr->DataSource, OS_FILE_FLAG_NONE,
-                                         OS_READ_WRITE);
-
-                if (OsStatus == OS_SUCCESS)
-                {
-                    Status = CFE_FS_SetTimestamp(FileDescriptor, DumpTime);
-
-                    if (Status != CFE_SUCCESS)
-                    {
-                        CFE_ES_WriteToSysLog("%s: Unable to update timestamp in dump file '%s'\n", __func__,
-                                             DumpCtrlPtr->DumpBufferPtr->DataSource);
-                    }
 
-                    OS_close(FileDescriptor);
-                }
-                else
-                {
-                    CFE_ES_WriteToSysLog("%s: Unable to open dump file '%s' to update timestamp\n", __func__,
-                                         DumpCtrlPtr->DumpBufferPtr->DataSource);
-                }
-            }
-
-            /* Free the shared working buffer */
-            CFE_TBL_Global.LoadBuffs[DumpCtrlPtr->RegRecPtr->LoadInProgress].Taken = false;
-            DumpCtrlPtr->RegRecPtr->LoadInProgress                                 = CFE_TBL_NO_LOAD_IN_PROGRESS;
+            /* Hand the captured copy over to the background file writer, which frees the */
+            /* shared working buffer and the Dump Control Block once the file is written  */
+            DumpCtrlPtr->DumpDataPtr = DumpCtrlPtr->DumpBufferPtr->BufferPtr;
+            DumpCtrlPtr->PinnedEpoch = CFE_TBL_NO_EPOCH_PINNED;
+            DumpCtrlPtr->State       = CFE_TBL_DUMP_WRITING;
 
-            /* Free the Dump Control Block for later use */
-            DumpCtrlPtr->State = CFE_TBL_DUMP_FREE;
+            CFE_TBL_StartDumpToFile(DumpCtrlPtr, DumpCtrlPtr->DumpBufferPtr->DataSource);
         }
     }
 
@@ -181,7 +148,7 @@ void CFE_TBL_GetHkData(void)
     i = 0;
     while ((i < CFE_PLATFORM_TBL_MAX_NUM_VALIDATIONS) && (ValPtr == NULL))
     {
-        if (CFE_TBL_Global.ValidationResults[i].State == CFE_TBL_VALIDATION_PERFORMED)
+        if (CFE_TBL_EPOCH_LOAD(CFE_TBL_Global.ValidationResults[i].State) == CFE_TBL_VALIDATION_PERFORMED)
         {
             ValPtr = &CFE_TBL_Global.ValidationResults[i];
         }
@@ -224,6 +191,13 @@ void CFE_TBL_GetHkData(void)
     CFE_TBL_Global.HkPacket.Payload.FailedValCounter  = CFE_TBL_Global.FailedValCounter;
     CFE_TBL_Global.HkPacket.Payload.NumValRequests    = CFE_TBL_Global.NumValRequests;
 
+    /* Dumps complete in the background file writer, which records the file name under the registry lock */
+    CFE_TBL_LockRegistry();
+    CFE_SB_MessageStringSet(CFE_TBL_Global.HkPacket.Payload.LastFileDumped, CFE_TBL_Global.LastFileDumped,
+                            sizeof(CFE_TBL_Global.HkPacket.Payload.LastFileDumped),
+                            sizeof(CFE_TBL_Global.LastFileDumped));
+    CFE_TBL_UnlockRegistry();
+
     /* Validate the index of the last table updated before using it */
     if ((CFE_TBL_Global.LastTblUpdated >= 0) && (CFE_TBL_Global.LastTblUpdated < CFE_PLATFORM_TBL_MAX_NUM_TABLES))
     {
@@ -395,6 +369,12 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_LoadCmd_t *data)
                                       "Attempted to load table '%s' while previous load is still pending",
                                       TblFileHeader.TableName);
                 }
+                else if (RegRecPtr->AsyncValidateIndex != CFE_TBL_NO_VALIDATION_PENDING)
+                {
+                    CFE_EVS_SendEvent(CFE_TBL_LOADING_PENDING_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Attempted to load table '%s' while previous load is being validated",
+                                      TblFileHeader.TableName);
+                }
                 else
                 {
                     /* Make sure of the following:                                               */
@@ -410,6 +390,10 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_LoadCmd_t *data)
 
                         if (Status == CFE_SUCCESS)
                         {
+                            /* Fill in the parts of the table not covered by the file from the active buffer */
+                            CFE_TBL_PrefillWorkingBuffer(WorkingBufferPtr, RegRecPtr, TblFileHeader.Offset,
+                                                         TblFileHeader.NumBytes);
+
                             /* Copy data from file into working buffer */
                             OsStatus =
                                 OS_read(FileDescriptor, ((uint8 *)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset,
@@ -538,6 +522,7 @@ int32 CFE_TBL_DumpCmd(const CFE_TBL_DumpCmd_t *data)
     CFE_TBL_LoadBuff_t *             WorkingBufferPtr;
     int32                            DumpIndex;
     int32                            Status;
+    uint32                           Epoch;
     CFE_TBL_DumpControl_t *          DumpCtrlPtr;
 
     /* Make sure all strings are null terminated before attempting to process them */
@@ -591,67 +576,113 @@ int32 CFE_TBL_DumpCmd(const CFE_TBL_DumpCmd_t *data)
         /* If we have located the data to be dumped, then proceed with creating the file and dumping the data */
         if (DumpDataAddr != NULL)
         {
-            /* If this is not a dump only table, then we can perform the dump immediately */
-            if (!RegRecPtr->DumpOnly)
+            /* A shared load buffer is released or reused by the load it belongs to, so it cannot be */
+            /* held for the duration of a background dump                                             */
+            if ((!RegRecPtr->DumpOnly) && (CmdPtr->ActiveTableFlag == CFE_TBL_BufferSelect_INACTIVE) &&
+                (!RegRecPtr->DoubleBuffered))
+            {
+                CFE_EVS_SendEvent(CFE_TBL_NO_INACTIVE_BUFFER_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Inactive Buffer of single buffered Table '%s' cannot be dumped", TableName);
+            }
+            /* Make sure a dump of a Dump Only table is not already in progress */
+            else if (RegRecPtr->DumpOnly && ((RegRecPtr->DumpControlIndex != CFE_TBL_NO_DUMP_PENDING) ||
+                                             CFE_TBL_IsDumpBufferInUse(RegRecPtr)))
             {
-                ReturnCode = CFE_TBL_DumpToFile(DumpFilename, TableName, DumpDataAddr, RegRecPtr->Size);
+                CFE_EVS_SendEvent(CFE_TBL_DUMP_PENDING_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "A dump for '%s' is already pending", TableName);
             }
-            else /* Dump Only tables need to synchronize their dumps with the owner's execution */
+            else
             {
-                /* Make sure a dump is not already in progress */
-                if (RegRecPtr->DumpControlIndex == CFE_TBL_NO_DUMP_PENDING)
+                /* Find a free Dump Control Block */
+                DumpIndex = 0;
+                while ((DumpIndex < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS) &&
+                       ((CFE_TBL_Global.DumpControlBlocks[DumpIndex].State != CFE_TBL_DUMP_FREE) ||
+                        CFE_FS_BackgroundFileDumpIsPending(&CFE_TBL_Global.DumpControlBlocks[DumpIndex].FileWrite)))
                 {
-                    /* Find a free Dump Control Block */
-                    DumpIndex = 0;
-                    while ((DumpIndex < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS) &&
-                           (CFE_TBL_Global.DumpControlBlocks[DumpIndex].State != CFE_TBL_DUMP_FREE))
+                    DumpIndex++;
+                }
+
+                if (DumpIndex >= CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS)
+                {
+                    CFE_EVS_SendEvent(CFE_TBL_TOO_MANY_DUMPS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Too many Table Dumps have been requested");
+                }
+                else if (!RegRecPtr->DumpOnly)
+                {
+                    /* The table buffer is written in place; pinning its epoch keeps it from being */
+                    /* reused until the background file writer releases the Dump Control Block    */
+                    DumpCtrlPtr                = &CFE_TBL_Global.DumpControlBlocks[DumpIndex];
+                    DumpCtrlPtr->RegRecPtr     = RegRecPtr;
+                    DumpCtrlPtr->DumpBufferPtr = NULL;
+                    DumpCtrlPtr->Size          = RegRecPtr->Size;
+                    memcpy(DumpCtrlPtr->TableName, TableName, CFE_TBL_MAX_FULL_NAME_LEN);
+
+                    CFE_TBL_LockRegistry();
+
+                    if (CmdPtr->ActiveTableFlag == CFE_TBL_BufferSelect_ACTIVE)
                     {
-                        DumpIndex++;
+                        /* Same protocol as the readers: retry until no update was published meanwhile */
+                        do
+                        {
+                            Epoch                    = CFE_TBL_EPOCH_LOAD(RegRecPtr->ActiveEpoch);
+                            DumpCtrlPtr->PinnedEpoch = Epoch;
+                            DumpCtrlPtr->State       = CFE_TBL_DUMP_WRITING;
+                            DumpCtrlPtr->DumpDataPtr = RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr;
+                            CFE_TBL_EPOCH_FENCE();
+                        } while (Epoch != CFE_TBL_EPOCH_LOAD(RegRecPtr->ActiveEpoch));
                     }
-
-                    if (DumpIndex < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS)
+                    else
                     {
-                        /* Allocate a shared memory buffer for storing the data to be dumped */
-                        Status = CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, false);
-
-                        if (Status == CFE_SUCCESS)
+                        /* The inactive buffer of a double buffered table was active in the previous epoch. */
+                        /* The pin also keeps a load in progress from writing to it until the dump is done. */
+                        Epoch = RegRecPtr->ActiveEpoch - 1;
+                        if (Epoch == CFE_TBL_NO_EPOCH_PINNED)
                         {
-                            DumpCtrlPtr            = &CFE_TBL_Global.DumpControlBlocks[DumpIndex];
-                            DumpCtrlPtr->State     = CFE_TBL_DUMP_PENDING;
-                            DumpCtrlPtr->RegRecPtr = RegRecPtr;
+                            Epoch--;
+                        }
 
-                            /* Save the name of the desired dump filename, table name and size for later */
-                            DumpCtrlPtr->DumpBufferPtr = WorkingBufferPtr;
-                            memcpy(DumpCtrlPtr->DumpBufferPtr->DataSource, DumpFilename, OS_MAX_PATH_LEN);
-                            memcpy(DumpCtrlPtr->TableName, TableName, CFE_TBL_MAX_FULL_NAME_LEN);
-                            DumpCtrlPtr->Size = RegRecPtr->Size;
+                        DumpCtrlPtr->PinnedEpoch = Epoch;
+                        DumpCtrlPtr->State       = CFE_TBL_DUMP_WRITING;
+                        DumpCtrlPtr->DumpDataPtr = RegRecPtr->Buffers[(1U - RegRecPtr->ActiveBufferIndex)].BufferPtr;
+                    }
 
-                            /* Notify the owning application that a dump is pending */
-                            RegRecPtr->DumpControlIndex = DumpIndex;
+                    CFE_TBL_UnlockRegistry();
 
-                            /* If application requested notification by message, then do so */
-                            CFE_TBL_SendNotificationMsg(RegRecPtr);
+                    ReturnCode = CFE_TBL_StartDumpToFile(DumpCtrlPtr, DumpFilename);
+                }
+                else /* Dump Only tables need to synchronize their dumps with the owner's execution */
+                {
+                    /* Allocate a shared memory buffer for storing the data to be dumped */
+                    Status = CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, false);
 
-                            /* Consider the command completed successfully */
-                            ReturnCode = CFE_TBL_INC_CMD_CTR;
-                        }
-                        else
-                        {
-                            CFE_EVS_SendEvent(CFE_TBL_NO_WORK_BUFFERS_ERR_EID, CFE_EVS_EventType_ERROR,
-                                              "No working buffers available for table '%s'", TableName);
-                        }
+                    if (Status == CFE_SUCCESS)
+                    {
+                        DumpCtrlPtr            = &CFE_TBL_Global.DumpControlBlocks[DumpIndex];
+                        DumpCtrlPtr->State     = CFE_TBL_DUMP_PENDING;
+                        DumpCtrlPtr->RegRecPtr = RegRecPtr;
+
+                        /* Save the name of the desired dump filename, table name and size for later */
+                        DumpCtrlPtr->DumpBufferPtr = WorkingBufferPtr;
+                        memcpy(DumpCtrlPtr->DumpBufferPtr->DataSource, DumpFilename, OS_MAX_PATH_LEN);
+                        memcpy(DumpCtrlPtr->TableName, TableName, CFE_TBL_MAX_FULL_NAME_LEN);
+                        DumpCtrlPtr->Size = RegRecPtr->Size;
+
+                        /* Notify the owning application that a dump is pending */
+                        RegRecPtr->DumpControlIndex = DumpIndex;
+                        CFE_TBL_MarkPendingWork(RegRecPtr, CFE_TBL_PENDING_DUMP);
+
+                        /* If application requested notification by message, then do so */
+                        CFE_TBL_SendNotificationMsg(RegRecPtr);
+
+                        /* Consider the command completed successfully */
+                        ReturnCode = CFE_TBL_INC_CMD_CTR;
                     }
                     else
                     {
-                        CFE_EVS_SendEvent(CFE_TBL_TOO_MANY_DUMPS_ERR_EID, CFE_EVS_EventType_ERROR,
-                                          "Too many Dump Only Table Dumps have been requested");
+                        CFE_EVS_SendEvent(CFE_TBL_NO_WORK_BUFFERS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "No working buffers available for table '%s'", TableName);
                     }
                 }
-                else
-                {
-                    CFE_EVS_SendEvent(CFE_TBL_DUMP_PENDING_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "A dump for '%s' is already pending", TableName);
-                }
             }
         }
     }
@@ -670,122 +701,291 @@ int32 CFE_TBL_DumpCmd(const CFE_TBL_DumpCmd_t *data)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile(const char *DumpFilename, const char *TableName, const void *DumpDataAddr,
-                                        size_t TblSizeInBytes)
+void CFE_TBL_InitDumpFileHeader(CFE_TBL_File_Hdr_t *TblFileHeaderPtr, const char *TableName, size_t TblSizeInBytes)
 {
-    CFE_TBL_CmdProcRet_t ReturnCode      = CFE_TBL_INC_ERR_CTR; /* Assume failure */
-    bool                 FileExistedPrev = false;
-    CFE_FS_Header_t      StdFileHeader;
-    CFE_TBL_File_Hdr_t   TblFileHeader;
-    osal_id_t            FileDescriptor = OS_OBJECT_ID_UNDEFINED;
-    int32                Status;
-    int32                OsStatus;
-    int32                EndianCheck = 0x01020304;
+    int32 EndianCheck = 0x01020304;
 
     /* Clear Header of any garbage before copying content */
-    memset(&TblFileHeader, 0, sizeof(CFE_TBL_File_Hdr_t));
+    memset(TblFileHeaderPtr, 0, sizeof(CFE_TBL_File_Hdr_t));
 
-    /* Check to see if the dump file already exists */
-    OsStatus = OS_OpenCreate(&FileDescriptor, DumpFilename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    strncpy(TblFileHeaderPtr->TableName, TableName, sizeof(TblFileHeaderPtr->TableName) - 1);
+    TblFileHeaderPtr->TableName[sizeof(TblFileHeaderPtr->TableName) - 1] = 0;
+    TblFileHeaderPtr->Offset                                             = 0;
+    TblFileHeaderPtr->NumBytes                                           = TblSizeInBytes;
+    TblFileHeaderPtr->Reserved                                           = 0;
 
-    if (OsStatus == OS_SUCCESS)
+    /* Determine if this is a little endian processor */
+    if ((*(char *)&EndianCheck) == 0x04)
     {
-        FileExistedPrev = true;
-        OS_close(FileDescriptor);
+        /* If this is a little endian processor, then byte swap the header to a big endian format */
+        /* to maintain the cFE Header standards */
+        CFE_TBL_ByteSwapTblHeader(TblFileHeaderPtr);
     }
+}
 
-    /* Create a new dump file, overwriting anything that may have existed previously */
-    OsStatus = OS_OpenCreate(&FileDescriptor, DumpFilename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_TBL_CmdProcRet_t CFE_TBL_StartDumpToFile(CFE_TBL_DumpControl_t *DumpCtrlPtr, const char *DumpFilename)
+{
+    CFE_TBL_CmdProcRet_t ReturnCode = CFE_TBL_INC_ERR_CTR; /* Assume failure */
+    int32                Status;
+    os_fstat_t           FileStat;
 
-    if (OsStatus == OS_SUCCESS)
+    /* Start from a clean request so that no settings of a previous dump carry over */
+    memset(&DumpCtrlPtr->FileWrite, 0, sizeof(DumpCtrlPtr->FileWrite));
+
+    DumpCtrlPtr->FileWrite.FileSubType = CFE_FS_SubType_TBL_IMG;
+    snprintf(DumpCtrlPtr->FileWrite.Description, sizeof(DumpCtrlPtr->FileWrite.Description), "Table Dump Image");
+    DumpCtrlPtr->FileWrite.Compress = CFE_PLATFORM_TBL_COMPRESS_FILE_DUMPS;
+
+    DumpCtrlPtr->FileWrite.GetData = CFE_TBL_DumpTableGetter;
+    DumpCtrlPtr->FileWrite.OnEvent = CFE_TBL_DumpTableEventHandler;
+
+    strncpy(DumpCtrlPtr->FileWrite.FileName, DumpFilename, sizeof(DumpCtrlPtr->FileWrite.FileName) - 1);
+    DumpCtrlPtr->FileWrite.FileName[sizeof(DumpCtrlPtr->FileWrite.FileName) - 1] = 0;
+
+    CFE_TBL_InitDumpFileHeader(&DumpCtrlPtr->TblFileHeader, DumpCtrlPtr->TableName, DumpCtrlPtr->Size);
+    DumpCtrlPtr->Position = 0;
+
+    /*
+     * Check if the file exists already, since TBL services issues a different
+     * event ID if it is overwriting a file vs. creating a new file.
+     */
+    DumpCtrlPtr->FileExisted = (OS_stat(DumpCtrlPtr->FileWrite.FileName, &FileStat) == OS_SUCCESS);
+
+    Status = CFE_FS_BackgroundFileDumpRequest(&DumpCtrlPtr->FileWrite);
+    if (Status == CFE_SUCCESS)
+    {
+        /* Increment the TBL generic command counter (successfully queued for background job) */
+        ReturnCode = CFE_TBL_INC_CMD_CTR;
+    }
+    else
     {
-        /* Initialize the standard cFE File Header for the Dump File */
-        CFE_FS_InitHeader(&StdFileHeader, "Table Dump Image", CFE_FS_SubType_TBL_IMG);
+        CFE_EVS_SendEvent(CFE_TBL_CREATING_DUMP_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Unable to queue dump of Table '%s' to '%s', Status=0x%08X", DumpCtrlPtr->TableName,
+                          DumpCtrlPtr->FileWrite.FileName, (unsigned int)Status);
+
+        CFE_TBL_ReleaseDumpControl(DumpCtrlPtr);
+    }
 
-        /* Output the Standard cFE File Header to the Dump File */
-        Status = CFE_FS_WriteHeader(FileDescriptor, &StdFileHeader);
+    return ReturnCode;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_ReleaseDumpControl(CFE_TBL_DumpControl_t *DumpCtrlPtr)
+{
+    CFE_TBL_RegistryRec_t *RegRecPtr;
 
-        if (Status == sizeof(CFE_FS_Header_t))
+    CFE_TBL_LockRegistry();
+
+    RegRecPtr = DumpCtrlPtr->RegRecPtr;
+
+    /* Free the shared working buffer holding the data of a Dump Only table */
+    if ((RegRecPtr != NULL) && (DumpCtrlPtr->DumpBufferPtr != NULL))
+    {
+        DumpCtrlPtr->DumpBufferPtr->Taken = false;
+        RegRecPtr->LoadInProgress         = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    }
+
+    DumpCtrlPtr->DumpDataPtr   = NULL;
+    DumpCtrlPtr->DumpBufferPtr = NULL;
+    DumpCtrlPtr->RegRecPtr     = NULL;
+    DumpCtrlPtr->PinnedEpoch   = CFE_TBL_NO_EPOCH_PINNED;
+    DumpCtrlPtr->Aborted       = false;
+
+    /* Free the Dump Control Block for later use */
+    DumpCtrlPtr->State = CFE_TBL_DUMP_FREE;
+
+    CFE_TBL_UnlockRegistry();
+
+    /* An update published during the dump may have retired the buffer that was written */
+    if (RegRecPtr != NULL)
+    {
+        CFE_TBL_ReclaimRetiredBuffer(RegRecPtr);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_TBL_DumpTableGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_TBL_DumpControl_t *DumpCtrlPtr = (CFE_TBL_DumpControl_t *)Meta;
+    size_t                 ChunkSize   = 0;
+    bool                   IsEOF;
+
+    /* The Table Image Header is the first record */
+    if (RecordNum == 0)
+    {
+        *Buffer  = &DumpCtrlPtr->TblFileHeader;
+        *BufSize = sizeof(DumpCtrlPtr->TblFileHeader);
+
+        return false;
+    }
+
+    /* The data pointer is cleared if the table goes away during the dump */
+    CFE_TBL_LockRegistry();
+
+    if (DumpCtrlPtr->DumpDataPtr != NULL)
+    {
+        ChunkSize = DumpCtrlPtr->Size - DumpCtrlPtr->Position;
+        if (ChunkSize > CFE_PLATFORM_TBL_DUMP_CHUNK_SIZE)
         {
-            /* Initialize the Table Image Header for the Dump File */
-            strncpy(TblFileHeader.TableName, TableName, sizeof(TblFileHeader.TableName) - 1);
-            TblFileHeader.TableName[sizeof(TblFileHeader.TableName) - 1] = 0;
-            TblFileHeader.Offset                                         = 0;
-            TblFileHeader.NumBytes                                       = TblSizeInBytes;
-            TblFileHeader.Reserved                                       = 0;
-
-            /* Determine if this is a little endian processor */
-            if ((*(char *)&EndianCheck) == 0x04)
+            ChunkSize = CFE_PLATFORM_TBL_DUMP_CHUNK_SIZE;
+        }
+
+        *Buffer = (uint8 *)DumpCtrlPtr->DumpDataPtr + DumpCtrlPtr->Position;
+        DumpCtrlPtr->Position += ChunkSize;
+    }
+    else
+    {
+        *Buffer = NULL;
+    }
+
+    IsEOF = ((DumpCtrlPtr->DumpDataPtr == NULL) || (DumpCtrlPtr->Position >= DumpCtrlPtr->Size));
+
+    CFE_TBL_UnlockRegistry();
+
+    *BufSize = ChunkSize;
+
+    return IsEOF;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_DumpTableEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
+                                   size_t BlockSize, size_t Position)
+{
+    CFE_TBL_DumpControl_t *DumpCtrlPtr = (CFE_TBL_DumpControl_t *)Meta;
+    CFE_TIME_SysTime_t     DumpTime;
+    osal_id_t              FileDescriptor;
+    int32                  OsStatus;
+    bool                   IsDone = true;
+
+    /*
+     * Note that this runs in the context of ES background task (file writer background job)
+     * It does NOT run in the context of the CFE_TBL app task.
+     *
+     * Events should use CFE_EVS_SendEventWithAppID() rather than CFE_EVS_SendEvent()
+     * to get proper association with TBL task.
+     */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            if (DumpCtrlPtr->Aborted)
             {
-                /* If this is a little endian processor, then byte swap the header to a big endian format */
-                /* to maintain the cFE Header standards */
-                /* NOTE: FOR THE REMAINDER OF THIS FUNCTION, THE CONTENTS OF THE HEADER IS UNREADABLE BY */
-                /*       THIS PROCESSOR!  THE DATA WOULD NEED TO BE SWAPPED BACK BEFORE READING.         */
-                CFE_TBL_ByteSwapTblHeader(&TblFileHeader);
+                CFE_EVS_SendEventWithAppID(CFE_TBL_WRITE_TBL_IMG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                           CFE_TBL_Global.TableTaskAppId,
+                                           "Error writing Tbl image to '%s', Table '%s' was removed",
+                                           DumpCtrlPtr->FileWrite.FileName, DumpCtrlPtr->TableName);
+                break;
             }
 
-            /* Output the Table Image Header to the Dump File */
-            OsStatus = OS_write(FileDescriptor, &TblFileHeader, sizeof(CFE_TBL_File_Hdr_t));
-
-            /* Make sure the header was output completely */
-            if ((long)OsStatus == sizeof(CFE_TBL_File_Hdr_t))
+            /* A Dump Only table's data was captured earlier.  Update the file header so that the timestamp */
+            /* is the time of the actual capturing of the data, NOT the time when it was written to the file */
+            if (DumpCtrlPtr->DumpBufferPtr != NULL)
             {
-                /* Output the requested data to the dump file */
-                /* Output the active table image data to the dump file */
-                OsStatus = OS_write(FileDescriptor, DumpDataAddr, TblSizeInBytes);
+                DumpTime.Seconds    = DumpCtrlPtr->DumpBufferPtr->FileCreateTimeSecs;
+                DumpTime.Subseconds = DumpCtrlPtr->DumpBufferPtr->FileCreateTimeSubSecs;
 
-                if ((long)OsStatus == TblSizeInBytes)
+                OsStatus = OS_OpenCreate(&FileDescriptor, DumpCtrlPtr->FileWrite.FileName, OS_FILE_FLAG_NONE,
+                                         OS_READ_WRITE);
+
+                if (OsStatus == OS_SUCCESS)
                 {
-                    if (FileExistedPrev)
+                    if (CFE_FS_SetTimestamp(FileDescriptor, DumpTime) != CFE_SUCCESS)
                     {
-                        CFE_EVS_SendEvent(CFE_TBL_OVERWRITE_DUMP_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                          "Successfully overwrote '%s' with Table '%s'", DumpFilename, TableName);
-                    }
-                    else
-                    {
-                        CFE_EVS_SendEvent(CFE_TBL_WRITE_DUMP_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                          "Successfully dumped Table '%s' to '%s'", TableName, DumpFilename);
+                        CFE_ES_WriteToSysLog("%s: Unable to update timestamp in dump file '%s'\n", __func__,
+                                             DumpCtrlPtr->FileWrite.FileName);
                     }
 
-                    /* Save file information statistics for housekeeping telemetry */
-                    strncpy(CFE_TBL_Global.HkPacket.Payload.LastFileDumped, DumpFilename,
-                            sizeof(CFE_TBL_Global.HkPacket.Payload.LastFileDumped) - 1);
-                    CFE_TBL_Global.HkPacket.Payload
-                        .LastFileDumped[sizeof(CFE_TBL_Global.HkPacket.Payload.LastFileDumped) - 1] = 0;
-
-                    /* Increment Successful Command Counter */
-                    ReturnCode = CFE_TBL_INC_CMD_CTR;
+                    OS_close(FileDescriptor);
                 }
                 else
                 {
-                    CFE_EVS_SendEvent(CFE_TBL_WRITE_TBL_IMG_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "Error writing Tbl image to '%s', Status=%ld", DumpFilename, (long)OsStatus);
+                    CFE_ES_WriteToSysLog("%s: Unable to open dump file '%s' to update timestamp\n", __func__,
+                                         DumpCtrlPtr->FileWrite.FileName);
                 }
             }
+
+            if (DumpCtrlPtr->FileExisted)
+            {
+                CFE_EVS_SendEventWithAppID(CFE_TBL_OVERWRITE_DUMP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                           CFE_TBL_Global.TableTaskAppId, "Successfully overwrote '%s' with Table '%s'",
+                                           DumpCtrlPtr->FileWrite.FileName, DumpCtrlPtr->TableName);
+            }
             else
             {
-                CFE_EVS_SendEvent(CFE_TBL_WRITE_TBL_HDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Error writing Tbl image File Header to '%s', Status=%ld", DumpFilename,
-                                  (long)OsStatus);
+                CFE_EVS_SendEventWithAppID(CFE_TBL_WRITE_DUMP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                           CFE_TBL_Global.TableTaskAppId, "Successfully dumped Table '%s' to '%s'",
+                                           DumpCtrlPtr->TableName, DumpCtrlPtr->FileWrite.FileName);
             }
-        }
-        else
-        {
-            CFE_EVS_SendEvent(CFE_TBL_WRITE_CFE_HDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Error writing cFE File Header to '%s', Status=0x%08X", DumpFilename,
-                              (unsigned int)Status);
-        }
 
-        /* We are done outputting data to the dump file.  Close it. */
-        OS_close(FileDescriptor);
+            /* Save file information statistics for housekeeping telemetry, which the TBL task reports */
+            CFE_TBL_LockRegistry();
+            strncpy(CFE_TBL_Global.LastFileDumped, DumpCtrlPtr->FileWrite.FileName,
+                    sizeof(CFE_TBL_Global.LastFileDumped) - 1);
+            CFE_TBL_Global.LastFileDumped[sizeof(CFE_TBL_Global.LastFileDumped) - 1] = 0;
+            CFE_TBL_UnlockRegistry();
+            break;
+
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            if (RecordNum == 0)
+            {
+                CFE_EVS_SendEventWithAppID(CFE_TBL_WRITE_TBL_HDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                                           CFE_TBL_Global.TableTaskAppId,
+                                           "Error writing Tbl image File Header to '%s', Status=0x%08X",
+                                           DumpCtrlPtr->FileWrite.FileName, (unsigned int)Status);
+            }
+            else
+            {
+                CFE_EVS_SendEventWithAppID(CFE_TBL_WRITE_TBL_IMG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                           CFE_TBL_Global.TableTaskAppId,
+                                           "Error writing Tbl image to '%s', Status=0x%08X",
+                                           DumpCtrlPtr->FileWrite.FileName, (unsigned int)Status);
+            }
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+            CFE_EVS_SendEventWithAppID(CFE_TBL_WRITE_CFE_HDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_Global.TableTaskAppId,
+                                       "Error writing cFE File Header to '%s', Status=0x%08X",
+                                       DumpCtrlPtr->FileWrite.FileName, (unsigned int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEventWithAppID(CFE_TBL_CREATING_DUMP_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_Global.TableTaskAppId, "Error creating dump file '%s', Status=0x%08X",
+                                       DumpCtrlPtr->FileWrite.FileName, (unsigned int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            IsDone = false;
+            break;
     }
-    else
+
+    /* Every terminal event ends the dump, so the table buffer is no longer needed */
+    if (IsDone)
     {
-        CFE_EVS_SendEvent(CFE_TBL_CREATING_DUMP_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Error creating dump file '%s', Status=%ld", DumpFilename, (long)OsStatus);
+        CFE_TBL_ReleaseDumpControl(DumpCtrlPtr);
     }
-
-    return ReturnCode;
 }
 
 /*----------------------------------------------------------------
@@ -804,6 +1004,7 @@ int32 CFE_TBL_ValidateCmd(const CFE_TBL_ValidateCmd_t *data)
     char                                 TableName[CFE_TBL_MAX_FULL_NAME_LEN];
     uint32                               CrcOfTable;
     int32                                ValIndex;
+    bool                                 OwnerValidates = true;
 
     /* Make sure all strings are null terminated before attempting to process them */
     CFE_SB_MessageStringGet(TableName, (char *)CmdPtr->TableName, NULL, sizeof(TableName), sizeof(CmdPtr->TableName));
@@ -882,17 +1083,32 @@ int32 CFE_TBL_ValidateCmd(const CFE_TBL_ValidateCmd_t *data)
                     {
                         RegRecPtr->ValidateActiveIndex = ValIndex;
                     }
+                    else if (CFE_TBL_DispatchValidation(RegIndex, ValIndex))
+                    {
+                        /* A validation worker performs the request, so the owner is not involved */
+                        OwnerValidates = false;
+                    }
                     else
                     {
                         RegRecPtr->ValidateInactiveIndex = ValIndex;
                     }
 
-                    /* If application requested notification by message, then do so */
-                    if (CFE_TBL_SendNotificationMsg(RegRecPtr) == CFE_SUCCESS)
+                    if (OwnerValidates)
+                    {
+                        CFE_TBL_MarkPendingWork(RegRecPtr, CFE_TBL_PENDING_VALIDATE);
+
+                        /* If application requested notification by message, then do so */
+                        if (CFE_TBL_SendNotificationMsg(RegRecPtr) == CFE_SUCCESS)
+                        {
+                            /* Notify ground that validation request has been made */
+                            CFE_EVS_SendEvent(CFE_TBL_VAL_REQ_MADE_INF_EID, CFE_EVS_EventType_DEBUG,
+                                              "Tbl Services issued validation request for '%s'", TableName);
+                        }
+                    }
+                    else
                     {
-                        /* Notify ground that validation request has been made */
                         CFE_EVS_SendEvent(CFE_TBL_VAL_REQ_MADE_INF_EID, CFE_EVS_EventType_DEBUG,
-                                          "Tbl Services issued validation request for '%s'", TableName);
+                                          "Tbl Services queued validation request for '%s'", TableName);
                     }
 
                     /* Maintain statistic on number of validation requests given to applications */
@@ -965,16 +1181,18 @@ int32 CFE_TBL_ActivateCmd(const CFE_TBL_ActivateCmd_t *data)
             /* Determine if the inactive buffer has been successfully validated or not */
             if (RegRecPtr->DoubleBuffered)
             {
-                ValidationStatus = RegRecPtr->Buffers[(1U - RegRecPtr->ActiveBufferIndex)].Validated;
+                ValidationStatus =
+                    CFE_TBL_EPOCH_LOAD(RegRecPtr->Buffers[(1U - RegRecPtr->ActiveBufferIndex)].Validated);
             }
             else
             {
-                ValidationStatus = CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Validated;
+                ValidationStatus = CFE_TBL_EPOCH_LOAD(CFE_TBL_Global.LoadBuffs[RegRecPtr->LoadInProgress].Validated);
             }
 
             if (ValidationStatus == true)
             {
                 CFE_TBL_Global.Registry[RegIndex].LoadPending = true;
+                CFE_TBL_MarkPendingWork(RegRecPtr, CFE_TBL_PENDING_UPDATE);
 
                 /* If application requested notification by message, then do so */
                 if (CFE_TBL_SendNotificationMsg(RegRecPtr) == CFE_SUCCESS)
@@ -1048,6 +1266,7 @@ bool CFE_TBL_DumpRegistryGetter(void *Meta, uint32 RecordNum, void **Buffer, siz
             StatePtr->DumpRecord.LoadPending      = RegRecPtr->LoadPending;
             StatePtr->DumpRecord.DumpOnly         = RegRecPtr->DumpOnly;
             StatePtr->DumpRecord.DoubleBuffered   = RegRecPtr->DoubleBuffered;
+            StatePtr->DumpRecord.MultiBuffered    = RegRecPtr->MultiBuffered;
             StatePtr->DumpRecord.FileCreateTimeSecs =
                 RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].FileCreateTimeSecs;
             StatePtr->DumpRecord.FileCreateTimeSubSecs =
@@ -1150,15 +1369,18 @@ void CFE_TBL_DumpRegistryEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event,
             {
                 CFE_EVS_SendEventWithAppID(CFE_TBL_OVERWRITE_REG_DUMP_INF_EID, CFE_EVS_EventType_DEBUG,
                                            CFE_TBL_Global.TableTaskAppId,
-                                           "Successfully overwrote '%s' with Table Registry:Size=%d,Entries=%d",
-                                           StatePtr->FileWrite.FileName, (int)Position, (int)RecordNum);
+                                           "Successfully overwrote '%s' with Table Registry:"
+                                           "Size=%d,Entries=%d,Rate=%lu B/s",
+                                           StatePtr->FileWrite.FileName, (int)Position, (int)RecordNum,
+                                           (unsigned long)StatePtr->FileWrite.BytesPerSecond);
             }
             else
             {
                 CFE_EVS_SendEventWithAppID(CFE_TBL_WRITE_REG_DUMP_INF_EID, CFE_EVS_EventType_DEBUG,
                                            CFE_TBL_Global.TableTaskAppId,
-                                           "Successfully dumped Table Registry to '%s':Size=%d,Entries=%d",
-                                           StatePtr->FileWrite.FileName, (int)Position, (int)RecordNum);
+                                           "Successfully dumped Table Registry to '%s':Size=%d,Entries=%d,Rate=%lu B/s",
+                                           StatePtr->FileWrite.FileName, (int)Position, (int)RecordNum,
+                                           (unsigned long)StatePtr->FileWrite.BytesPerSecond);
             }
             break;
 
@@ -1207,12 +1429,16 @@ int32 CFE_TBL_DumpRegistryCmd(const CFE_TBL_DumpRegistryCmd_t *data)
     /* If a reg dump was already pending, do not overwrite the current request */
     if (!CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
     {
+        /* Reset the entire state object (just for good measure, ensure no stale data) */
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
         /*
          * Fill out the remainder of meta data.
          * This data is currently the same for every request
          */
         StatePtr->FileWrite.FileSubType = CFE_FS_SubType_TBL_REG;
         snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), "Table Registry");
+        StatePtr->FileWrite.Compress = CFE_PLATFORM_TBL_COMPRESS_FILE_DUMPS;
 
         StatePtr->FileWrite.GetData = CFE_TBL_DumpRegistryGetter;
         StatePtr->FileWrite.OnEvent = CFE_TBL_DumpRegistryEventHandler;
@@ -1405,10 +1631,19 @@ int32 CFE_TBL_AbortLoadCmd(const CFE_TBL_AbortLoadCmd_t *data)
         /* so we must ensure the table is not a dump-only table, otherwise, we would be aborting a dump */
         if ((RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS) && (!RegRecPtr->DumpOnly))
         {
-            CFE_TBL_AbortLoad(RegRecPtr);
+            /* The working buffer cannot be released while a worker is validating it */
+            if (RegRecPtr->AsyncValidateIndex != CFE_TBL_NO_VALIDATION_PENDING)
+            {
+                CFE_EVS_SendEvent(CFE_TBL_LOAD_ABORT_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Cannot abort load of '%s' while it is being validated", TableName);
+            }
+            else
+            {
+                CFE_TBL_AbortLoad(RegRecPtr);
 
-            /* Increment Successful Command Counter */
-            ReturnCode = CFE_TBL_INC_CMD_CTR;
+                /* Increment Successful Command Counter */
+                ReturnCode = CFE_TBL_INC_CMD_CTR;
+            }
         }
         else
         {
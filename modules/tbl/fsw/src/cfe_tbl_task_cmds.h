@@ -300,30 +300,68 @@ int32 CFE_TBL_AbortLoadCmd(const CFE_TBL_AbortLoadCmd_t *data);
 
 /*---------------------------------------------------------------------------------------*/
 /**
-** \brief Output block of data to file with standard cFE Table Image Headers
+** \brief Initializes the cFE Table Image Header of a dump file
 **
 ** \par Description
-**        Writes the specified block of data in memory to the specified file
-**        with the standard cFE File and cFE Table Image Headers.
+**        Fills in the Table Image Header that precedes the table data in a
+**        dump file and converts it to the big endian file byte order.
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**        -# The contents of the header are unreadable by a little endian
+**           processor once this function returns.
+**
+** \param[out] TblFileHeaderPtr Pointer to header to be initialized
+**
+** \param[in]  TableName        Name of table being dumped to a file
+**
+** \param[in]  TblSizeInBytes   Size of block of data to be written to the file
+*/
+void CFE_TBL_InitDumpFileHeader(CFE_TBL_File_Hdr_t *TblFileHeaderPtr, const char *TableName, size_t TblSizeInBytes);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Queues a table dump with the background file writer
 **
-** \param[in] DumpFilename    Character string containing the full path of the file
-**                            to which the contents of the table are to be written
+** \par Description
+**        Submits the dump described by the specified Dump Control Block to the
+**        FS background file writer, which writes the table data to the file in
+**        chunks of #CFE_PLATFORM_TBL_DUMP_CHUNK_SIZE bytes from
+**        #CFE_TBL_DumpControl_t::DumpDataPtr.  If the request cannot be queued,
+**        the Dump Control Block is released.
 **
-** \param[in] TableName       Name of table being dumped to a file
+** \par Assumptions, External Events, and Notes:
+**        -# The Dump Control Block is assumed to be in the #CFE_TBL_DUMP_WRITING
+**           state with its table name, size and data pointer filled in.
+**        -# The data pointer is assumed to refer to table data that no one writes
+**           while the dump is in progress, either a table buffer kept from reuse by
+**           #CFE_TBL_DumpControl_t::PinnedEpoch or the captured copy of a Dump Only table.
 **
-** \param[in] DumpDataAddr    Address of data buffer whose contents are to be written
-**                            to the specified file
+** \param[in, out] DumpCtrlPtr Pointer to Dump Control Block of dump to be written
 **
-** \param[in] TblSizeInBytes  Size of block of data to be written to the file
+** \param[in] DumpFilename     Character string containing the full path of the file
+**                             to which the contents of the table are to be written
 **
 ** \retval #CFE_TBL_INC_ERR_CTR  \copydoc CFE_TBL_INC_ERR_CTR
 ** \retval #CFE_TBL_INC_CMD_CTR  \copydoc CFE_TBL_INC_CMD_CTR
 */
-CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile(const char *DumpFilename, const char *TableName, const void *DumpDataAddr,
-                                        size_t TblSizeInBytes);
+CFE_TBL_CmdProcRet_t CFE_TBL_StartDumpToFile(CFE_TBL_DumpControl_t *DumpCtrlPtr, const char *DumpFilename);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Frees a Dump Control Block once its dump has been written
+**
+** \par Description
+**        Releases the shared working buffer holding the copy of a dump-only
+**        table, or unpins the table buffer that was written in place and returns
+**        any buffer an update retired meanwhile to the pool.  The Dump Control
+**        Block is then returned to the free state.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function takes the registry mutex and must not be called while it is held.
+**
+** \param[in, out] DumpCtrlPtr Pointer to Dump Control Block to be released
+*/
+void CFE_TBL_ReleaseDumpControl(CFE_TBL_DumpControl_t *DumpCtrlPtr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
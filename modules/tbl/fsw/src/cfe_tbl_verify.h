@@ -39,6 +39,26 @@
 #error Shared buffers and table of size CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE cannot be greater than memory pool size of CFE_PLATFORM_TBL_BUF_MEMORY_BYTES!
 #endif
 
+#if CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE <= 0
+#error CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE must be greater than zero
+#endif
+
+#if CFE_PLATFORM_TBL_DUMP_CHUNK_SIZE <= 0
+#error CFE_PLATFORM_TBL_DUMP_CHUNK_SIZE must be greater than zero
+#endif
+
+#if CFE_PLATFORM_TBL_MULTI_BUFFER_DEPTH < 3
+#error CFE_PLATFORM_TBL_MULTI_BUFFER_DEPTH must be at least 3
+#endif
+
+#if CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS < 0
+#error CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS cannot be negative
+#endif
+
+#if CFE_PLATFORM_TBL_VALIDATION_TIMEOUT_MSEC <= 0
+#error CFE_PLATFORM_TBL_VALIDATION_TIMEOUT_MSEC must be greater than zero
+#endif
+
 #if CFE_PLATFORM_TBL_MAX_NUM_HANDLES < CFE_PLATFORM_TBL_MAX_NUM_TABLES
 #error CFE_PLATFORM_TBL_MAX_NUM_HANDLES cannot be set less than CFE_PLATFORM_TBL_MAX_NUM_TABLES!
 #endif
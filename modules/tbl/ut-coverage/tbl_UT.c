@@ -98,6 +98,38 @@ void UT_TBL_SetupHeader(CFE_TBL_File_Hdr_t *TblFileHeader, size_t Offset, size_t
     }
 }
 
+/*
+** Handler that hands a registry index to a validation worker
+*/
+static void UT_TBL_ValidationQueueGetHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void *  data        = UT_Hook_GetArgValueByName(Context, "data", void *);
+    size_t *size_copied = UT_Hook_GetArgValueByName(Context, "size_copied", size_t *);
+    int32   status;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        memcpy(data, UserObj, sizeof(int16));
+        *size_copied = sizeof(int16);
+
+        status = OS_SUCCESS;
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+}
+
+/*
+** Hook that finishes an outstanding worker validation while the caller waits for it
+*/
+static int32 UT_TBL_FinishAsyncValidationHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                              const UT_StubContext_t *Context)
+{
+    CFE_TBL_RegistryRec_t *RegRecPtr = UserObj;
+
+    RegRecPtr->AsyncValidateIndex = CFE_TBL_NO_VALIDATION_PENDING;
+
+    return StubRetcode;
+}
+
 /*
 ** Functions
 */
@@ -119,7 +151,6 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_TBL_TlmRegCmd);
     UT_ADD_TEST(Test_CFE_TBL_AbortLoadCmd);
     UT_ADD_TEST(Test_CFE_TBL_ActivateCmd);
-    UT_ADD_TEST(Test_CFE_TBL_DumpToFile);
     UT_ADD_TEST(Test_CFE_TBL_ResetCmd);
     UT_ADD_TEST(Test_CFE_TBL_ValidateCmd);
     UT_ADD_TEST(Test_CFE_TBL_NoopCmd);
@@ -129,6 +160,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_TBL_DumpCmd);
     UT_ADD_TEST(Test_CFE_TBL_LoadCmd);
     UT_ADD_TEST(Test_CFE_TBL_HousekeepingCmd);
+    UT_ADD_TEST(Test_CFE_TBL_BackgroundDump);
 
     /* cfe_tbl_api.c and cfe_tbl_internal.c functions */
     UT_ADD_TEST(Test_CFE_TBL_ApiInit);
@@ -143,14 +175,21 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_TBL_ReleaseAddresses);
     UT_ADD_TEST(Test_CFE_TBL_Validate);
     UT_ADD_TEST(Test_CFE_TBL_Manage);
+    UT_ADD_TEST(Test_CFE_TBL_ManageAll);
     UT_ADD_TEST(Test_CFE_TBL_DumpToBuffer);
     UT_ADD_TEST(Test_CFE_TBL_Update);
     UT_ADD_TEST(Test_CFE_TBL_GetStatus);
     UT_ADD_TEST(Test_CFE_TBL_GetInfo);
+    UT_ADD_TEST(Test_CFE_TBL_GetLoadRange);
     UT_ADD_TEST(Test_CFE_TBL_TblMod);
 
     /* Miscellaneous cfe_tbl_internal.c tests */
     UT_ADD_TEST(Test_CFE_TBL_Internal);
+    UT_ADD_TEST(Test_CFE_TBL_PrefillWorkingBuffer);
+    UT_ADD_TEST(Test_CFE_TBL_ValidationWorkers);
+    UT_ADD_TEST(Test_CFE_TBL_ReloadIfChanged);
+    UT_ADD_TEST(Test_CFE_TBL_RegistryIndex);
+    UT_ADD_TEST(Test_CFE_TBL_MultiBuffer);
 }
 
 /*
@@ -165,6 +204,8 @@ void UT_InitializeTableRegistryNames()
         snprintf(CFE_TBL_Global.Registry[i].Name, CFE_TBL_MAX_FULL_NAME_LEN, "%d", i);
         CFE_TBL_Global.Registry[i].OwnerAppId = UT_TBL_APPID_2;
     }
+
+    CFE_TBL_RebuildRegistryIndex();
 }
 
 /*
@@ -187,7 +228,7 @@ void UT_ResetTableRegistry(void)
         CFE_TBL_Global.Handles[i].PrevLink    = CFE_TBL_END_OF_LIST;
         CFE_TBL_Global.Handles[i].NextLink    = CFE_TBL_END_OF_LIST;
         CFE_TBL_Global.Handles[i].UsedFlag    = false;
-        CFE_TBL_Global.Handles[i].LockFlag    = false;
+        CFE_TBL_Global.Handles[i].PinnedEpoch = CFE_TBL_NO_EPOCH_PINNED;
         CFE_TBL_Global.Handles[i].Updated     = false;
         CFE_TBL_Global.Handles[i].BufferIndex = 0;
     }
@@ -202,11 +243,14 @@ void UT_ResetTableRegistry(void)
         CFE_TBL_Global.ValidationResults[i].TableName[0] = '\0';
     }
 
-    /* Initialize the dump-only table dump control blocks */
+    /* Initialize the table dump control blocks */
     for (i = 0; i < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS; i++)
     {
         CFE_TBL_Global.DumpControlBlocks[i].State         = CFE_TBL_DUMP_FREE;
         CFE_TBL_Global.DumpControlBlocks[i].DumpBufferPtr = NULL;
+        CFE_TBL_Global.DumpControlBlocks[i].RegRecPtr     = NULL;
+        CFE_TBL_Global.DumpControlBlocks[i].DumpDataPtr   = NULL;
+        CFE_TBL_Global.DumpControlBlocks[i].PinnedEpoch   = CFE_TBL_NO_EPOCH_PINNED;
         CFE_TBL_Global.DumpControlBlocks[i].Size          = 0;
         CFE_TBL_Global.DumpControlBlocks[i].TableName[0]  = '\0';
 
@@ -217,6 +261,8 @@ void UT_ResetTableRegistry(void)
     CFE_TBL_Global.ValidationCounter = 0;
     CFE_TBL_Global.HkTlmTblRegIndex  = CFE_TBL_NOT_FOUND;
     CFE_TBL_Global.LastTblUpdated    = CFE_TBL_NOT_FOUND;
+
+    CFE_TBL_RebuildRegistryIndex();
 }
 
 /*
@@ -598,50 +644,6 @@ void Test_CFE_TBL_ActivateCmd(void)
     CFE_TBL_Global.Registry[0].DumpOnly       = dump;
 }
 
-/*
-** Test the write table data to a file function
-*/
-void Test_CFE_TBL_DumpToFile(void)
-{
-    uint32 TblSizeInBytes = 9;
-
-    UtPrintf("Begin Test Dump to File");
-
-    /* Test with an error creating the dump file */
-    UT_InitData();
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
-    UtAssert_INT32_EQ(CFE_TBL_DumpToFile("filename", "tablename", "dumpaddress", TblSizeInBytes), CFE_TBL_INC_ERR_CTR);
-
-    /* Test with an error writing the cFE file header */
-    UT_InitData();
-    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeader), 1, sizeof(CFE_FS_Header_t) - 1);
-    UtAssert_INT32_EQ(CFE_TBL_DumpToFile("filename", "tablename", "dumpaddress", TblSizeInBytes), CFE_TBL_INC_ERR_CTR);
-
-    /* Test with an error writing the table file header */
-    UT_InitData();
-
-    /* Set the count for the FSWriteHdrRtn return code variable to a large
-     * enough value to pass through every time
-     */
-    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeader), 6, sizeof(CFE_FS_Header_t));
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, sizeof(CFE_TBL_File_Hdr_t) - 1);
-    UtAssert_INT32_EQ(CFE_TBL_DumpToFile("filename", "tablename", "dumpaddress", TblSizeInBytes), CFE_TBL_INC_ERR_CTR);
-
-    /* Test with an error writing the table to a file */
-    UT_InitData();
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, TblSizeInBytes - 1);
-    UtAssert_INT32_EQ(CFE_TBL_DumpToFile("filename", "tablename", "dumpaddress", TblSizeInBytes), CFE_TBL_INC_ERR_CTR);
-
-    /* Test successful file creation and data dumped */
-    UT_InitData();
-    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
-    UtAssert_INT32_EQ(CFE_TBL_DumpToFile("filename", "tablename", "dumpaddress", TblSizeInBytes), CFE_TBL_INC_CMD_CTR);
-
-    /* Test where file already exists so data is overwritten */
-    UT_InitData();
-    UtAssert_INT32_EQ(CFE_TBL_DumpToFile("filename", "tablename", "dumpaddress", TblSizeInBytes), CFE_TBL_INC_CMD_CTR);
-}
-
 /*
 ** Test the processing reset counters command message function
 */
@@ -957,11 +959,13 @@ void Test_CFE_TBL_DumpRegCmd(void)
     CFE_TBL_Global.Registry[1].OwnerAppId       = CFE_TBL_NOT_OWNED;
     CFE_TBL_Global.Registry[0].LoadInProgress   = CFE_TBL_NO_LOAD_IN_PROGRESS + 1;
     CFE_TBL_Global.Registry[0].DoubleBuffered   = true;
+    CFE_TBL_Global.Registry[0].MultiBuffered    = true;
     LocalBuf                                    = NULL;
     LocalSize                                   = 0;
     UtAssert_BOOL_FALSE(CFE_TBL_DumpRegistryGetter(&CFE_TBL_Global.RegDumpState, 0, &LocalBuf, &LocalSize));
     UtAssert_NOT_NULL(LocalBuf);
     UtAssert_NONZERO(LocalSize);
+    UtAssert_BOOL_TRUE(CFE_TBL_Global.RegDumpState.DumpRecord.MultiBuffered);
 
     /* Same but not double buffered */
     UT_InitData();
@@ -970,11 +974,13 @@ void Test_CFE_TBL_DumpRegCmd(void)
     CFE_TBL_Global.Registry[1].OwnerAppId       = CFE_TBL_NOT_OWNED;
     CFE_TBL_Global.Registry[0].LoadInProgress   = CFE_TBL_NO_LOAD_IN_PROGRESS + 1;
     CFE_TBL_Global.Registry[0].DoubleBuffered   = false;
+    CFE_TBL_Global.Registry[0].MultiBuffered    = false;
     LocalBuf                                    = NULL;
     LocalSize                                   = 0;
     UtAssert_BOOL_FALSE(CFE_TBL_DumpRegistryGetter(&CFE_TBL_Global.RegDumpState, 0, &LocalBuf, &LocalSize));
     UtAssert_NOT_NULL(LocalBuf);
     UtAssert_NONZERO(LocalSize);
+    UtAssert_BOOL_FALSE(CFE_TBL_Global.RegDumpState.DumpRecord.MultiBuffered);
 
     /* Hit last entry, no load in progress */
     CFE_TBL_Global.Registry[CFE_PLATFORM_TBL_MAX_NUM_TABLES - 1].OwnerAppId       = CFE_TBL_NOT_OWNED;
@@ -1009,12 +1015,13 @@ void Test_CFE_TBL_DumpRegCmd(void)
 */
 void Test_CFE_TBL_DumpCmd(void)
 {
-    int                i, k, u;
-    uint8              Buff;
-    uint8 *            BuffPtr = &Buff;
-    CFE_TBL_LoadBuff_t Load    = {0};
-    CFE_TBL_DumpCmd_t  DumpCmd;
-    CFE_ES_AppId_t     AppID;
+    int                 i, k, u;
+    uint8               Buff;
+    uint8 *             BuffPtr = &Buff;
+    CFE_TBL_LoadBuff_t  Load    = {0};
+    CFE_TBL_LoadBuff_t *WorkingBufferPtr;
+    CFE_TBL_DumpCmd_t   DumpCmd;
+    CFE_ES_AppId_t      AppID;
 
     CFE_ES_GetAppID(&AppID);
 
@@ -1035,6 +1042,7 @@ void Test_CFE_TBL_DumpCmd(void)
     strncpy(CFE_TBL_Global.Registry[2].Name, "DumpCmdTest", sizeof(CFE_TBL_Global.Registry[2].Name) - 1);
     CFE_TBL_Global.Registry[2].Name[sizeof(CFE_TBL_Global.Registry[2].Name) - 1] = '\0';
     CFE_TBL_Global.Registry[2].OwnerAppId                                        = AppID;
+    CFE_TBL_RebuildRegistryIndex();
     strncpy(DumpCmd.Payload.TableName, CFE_TBL_Global.Registry[2].Name, sizeof(DumpCmd.Payload.TableName) - 1);
     DumpCmd.Payload.TableName[sizeof(DumpCmd.Payload.TableName) - 1] = '\0';
     DumpCmd.Payload.ActiveTableFlag                                  = CFE_TBL_BufferSelect_ACTIVE;
@@ -1100,8 +1108,8 @@ void Test_CFE_TBL_DumpCmd(void)
     CFE_TBL_Global.Registry[2].DumpControlIndex = CFE_TBL_NO_DUMP_PENDING + 1;
     UtAssert_INT32_EQ(CFE_TBL_DumpCmd(&DumpCmd), CFE_TBL_INC_ERR_CTR);
 
-    /* Test with an inactive buffer, single-buffered, pointer created, is a
-     * dump only table
+    /* Test with an inactive buffer, single-buffered, pointer created, not a
+     * dump only table; the shared load buffer cannot be held for a background dump
      */
     UT_InitData();
     CFE_TBL_Global.Registry[2].DoubleBuffered                                     = false;
@@ -1111,7 +1119,9 @@ void Test_CFE_TBL_DumpCmd(void)
     strncpy(DumpCmd.Payload.DumpFilename, CFE_TBL_Global.Registry[2].LastFileLoaded,
             sizeof(DumpCmd.Payload.DumpFilename) - 1);
     DumpCmd.Payload.DumpFilename[sizeof(DumpCmd.Payload.DumpFilename) - 1] = '\0';
-    UtAssert_INT32_EQ(CFE_TBL_DumpCmd(&DumpCmd), CFE_TBL_INC_CMD_CTR);
+    UtAssert_INT32_EQ(CFE_TBL_DumpCmd(&DumpCmd), CFE_TBL_INC_ERR_CTR);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_NO_INACTIVE_BUFFER_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
 
     /* Test with an inactive buffer, single-buffered: No inactive buffer for
      * table due to load in progress
@@ -1132,6 +1142,103 @@ void Test_CFE_TBL_DumpCmd(void)
     UT_InitData();
     DumpCmd.Payload.ActiveTableFlag = CFE_TBL_BufferSelect_ACTIVE + 1;
     UtAssert_INT32_EQ(CFE_TBL_DumpCmd(&DumpCmd), CFE_TBL_INC_ERR_CTR);
+
+    /* Test with an active buffer of a table that is not dump only; the
+     * background file writer reads the buffer in place, which stays pinned
+     */
+    UT_InitData();
+    for (k = 0; k < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS; k++)
+    {
+        CFE_TBL_Global.DumpControlBlocks[k].State = CFE_TBL_DUMP_FREE;
+    }
+
+    Buff                                        = 0x5A;
+    DumpCmd.Payload.ActiveTableFlag             = CFE_TBL_BufferSelect_ACTIVE;
+    CFE_TBL_Global.Registry[2].Size             = sizeof(Buff);
+    CFE_TBL_Global.Registry[2].HeadOfAccessList = CFE_TBL_END_OF_LIST;
+    CFE_TBL_Global.Registry[2].ActiveEpoch      = 5;
+    UtAssert_INT32_EQ(CFE_TBL_DumpCmd(&DumpCmd), CFE_TBL_INC_CMD_CTR);
+    UtAssert_INT32_EQ(CFE_TBL_Global.DumpControlBlocks[0].State, CFE_TBL_DUMP_WRITING);
+    UtAssert_ADDRESS_EQ(CFE_TBL_Global.DumpControlBlocks[0].DumpDataPtr, BuffPtr);
+    UtAssert_UINT32_EQ(CFE_TBL_Global.DumpControlBlocks[0].PinnedEpoch, 5);
+    UtAssert_BOOL_TRUE(CFE_TBL_IsDumpPinned(&CFE_TBL_Global.Registry[2], 5));
+    UtAssert_BOOL_TRUE(CFE_TBL_IsBufferPinned(&CFE_TBL_Global.Registry[2], BuffPtr));
+    UtAssert_NULL(CFE_TBL_Global.DumpControlBlocks[0].DumpBufferPtr);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 0);
+    UtAssert_UINT32_EQ(CFE_TBL_Global.DumpControlBlocks[0].FileWrite.Compress, CFE_PLATFORM_TBL_COMPRESS_FILE_DUMPS);
+
+    /* Test with every free dump control block still in use by the background file writer */
+    UT_InitData();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UtAssert_INT32_EQ(CFE_TBL_DumpCmd(&DumpCmd), CFE_TBL_INC_ERR_CTR);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_TOO_MANY_DUMPS_ERR_EID);
+
+    /* A buffer retired by an update during the dump goes back to the pool once the dump is done */
+    UT_InitData();
+    CFE_TBL_Global.Registry[2].RetiredBufferPtr = &Buff;
+    CFE_TBL_Global.Registry[2].RetiredEpoch     = 5;
+    CFE_TBL_Global.Registry[2].ActiveEpoch      = 6;
+    CFE_TBL_ReclaimRetiredBuffer(&CFE_TBL_Global.Registry[2]);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    CFE_TBL_ReleaseDumpControl(&CFE_TBL_Global.DumpControlBlocks[0]);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+    UtAssert_NULL(CFE_TBL_Global.Registry[2].RetiredBufferPtr);
+    UtAssert_INT32_EQ(CFE_TBL_Global.DumpControlBlocks[0].State, CFE_TBL_DUMP_FREE);
+    UtAssert_BOOL_FALSE(CFE_TBL_IsDumpPinned(&CFE_TBL_Global.Registry[2], 5));
+
+    /* Test with an inactive buffer, double-buffered; the buffer that was
+     * active in the previous epoch is pinned, skipping the reserved epoch
+     */
+    UT_InitData();
+    DumpCmd.Payload.ActiveTableFlag           = CFE_TBL_BufferSelect_INACTIVE;
+    CFE_TBL_Global.Registry[2].DoubleBuffered = true;
+    CFE_TBL_Global.Registry[2].LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    CFE_TBL_Global.Registry[2].ActiveEpoch    = CFE_TBL_NO_EPOCH_PINNED + 1;
+    UtAssert_INT32_EQ(CFE_TBL_DumpCmd(&DumpCmd), CFE_TBL_INC_CMD_CTR);
+    UtAssert_UINT32_EQ(*(uint8 *)CFE_TBL_Global.DumpControlBlocks[0].DumpDataPtr, 0x5A);
+    UtAssert_BOOL_TRUE(CFE_TBL_IsDumpPinned(&CFE_TBL_Global.Registry[2], CFE_TBL_NO_EPOCH_PINNED));
+    CFE_TBL_ReleaseDumpControl(&CFE_TBL_Global.DumpControlBlocks[0]);
+    UtAssert_BOOL_FALSE(CFE_TBL_IsDumpPinned(&CFE_TBL_Global.Registry[2], CFE_TBL_NO_EPOCH_PINNED));
+
+    /* Test with an inactive buffer, double-buffered, load in progress; the
+     * dump is queued and the load cannot continue until the dump is done
+     */
+    UT_InitData();
+    CFE_TBL_Global.Registry[2].LoadInProgress     = 1 - CFE_TBL_Global.Registry[2].ActiveBufferIndex;
+    CFE_TBL_Global.Registry[2].AsyncValidateIndex = CFE_TBL_NO_VALIDATION_PENDING;
+    UtAssert_INT32_EQ(CFE_TBL_DumpCmd(&DumpCmd), CFE_TBL_INC_CMD_CTR);
+    UtAssert_INT32_EQ(CFE_TBL_Global.DumpControlBlocks[0].State, CFE_TBL_DUMP_WRITING);
+    UtAssert_INT32_EQ(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, &CFE_TBL_Global.Registry[2], false),
+                      CFE_TBL_ERR_NO_BUFFER_AVAIL);
+    UtAssert_NULL(WorkingBufferPtr);
+    CFE_TBL_ReleaseDumpControl(&CFE_TBL_Global.DumpControlBlocks[0]);
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, &CFE_TBL_Global.Registry[2], false));
+    UtAssert_ADDRESS_EQ(WorkingBufferPtr,
+                        &CFE_TBL_Global.Registry[2].Buffers[1 - CFE_TBL_Global.Registry[2].ActiveBufferIndex]);
+
+    /* Test response to the background file writer rejecting the request */
+    UT_InitData();
+    CFE_TBL_Global.Registry[2].LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpRequest), CFE_STATUS_REQUEST_ALREADY_PENDING);
+    UtAssert_INT32_EQ(CFE_TBL_DumpCmd(&DumpCmd), CFE_TBL_INC_ERR_CTR);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_CREATING_DUMP_FILE_ERR_EID);
+    UtAssert_INT32_EQ(CFE_TBL_Global.DumpControlBlocks[0].State, CFE_TBL_DUMP_FREE);
+
+    /* Test with a dump only table whose previous dump is still being written */
+    UT_InitData();
+    CFE_TBL_Global.Registry[2].DumpOnly             = true;
+    CFE_TBL_Global.Registry[2].DoubleBuffered       = false;
+    CFE_TBL_Global.Registry[2].DumpControlIndex     = CFE_TBL_NO_DUMP_PENDING;
+    CFE_TBL_Global.DumpControlBlocks[1].State         = CFE_TBL_DUMP_WRITING;
+    CFE_TBL_Global.DumpControlBlocks[1].RegRecPtr     = &CFE_TBL_Global.Registry[2];
+    CFE_TBL_Global.DumpControlBlocks[1].DumpBufferPtr = &Load;
+    DumpCmd.Payload.ActiveTableFlag                   = CFE_TBL_BufferSelect_ACTIVE;
+    UtAssert_INT32_EQ(CFE_TBL_DumpCmd(&DumpCmd), CFE_TBL_INC_ERR_CTR);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_DUMP_PENDING_ERR_EID);
+    CFE_TBL_Global.DumpControlBlocks[1].State         = CFE_TBL_DUMP_FREE;
+    CFE_TBL_Global.DumpControlBlocks[1].RegRecPtr     = NULL;
+    CFE_TBL_Global.DumpControlBlocks[1].DumpBufferPtr = NULL;
+    CFE_TBL_Global.Registry[2].DumpOnly               = false;
 }
 
 /*
@@ -1182,6 +1289,7 @@ void Test_CFE_TBL_LoadCmd(void)
 
     /* The rest of the tests will use registry 0, note empty name matches */
     CFE_TBL_Global.Registry[0].OwnerAppId = AppID;
+    CFE_TBL_RebuildRegistryIndex();
 
     /* Test attempt to load a dump only table */
     UT_InitData();
@@ -1318,10 +1426,9 @@ void Test_CFE_TBL_HousekeepingCmd(void)
 
     UtPrintf("Begin Test Housekeeping Command");
 
-    /* Test response to inability to update timestamp in dump file + inability
-     * to send Hk packet
-     */
+    /* Test starting the write of a performed dump + inability to send Hk packet */
     UT_InitData();
+    memset(&RegRecPtr, 0, sizeof(RegRecPtr));
     strncpy(CFE_TBL_Global.DumpControlBlocks[0].TableName, "housekeepingtest",
             sizeof(CFE_TBL_Global.DumpControlBlocks[0].TableName) - 1);
     CFE_TBL_Global.DumpControlBlocks[0].TableName[sizeof(CFE_TBL_Global.DumpControlBlocks[0].TableName) - 1] = '\0';
@@ -1348,39 +1455,202 @@ void Test_CFE_TBL_HousekeepingCmd(void)
     CFE_TBL_Global.HkTlmTblRegIndex = CFE_TBL_NOT_FOUND + 1;
     UtAssert_INT32_EQ(CFE_TBL_HousekeepingCmd(NULL), CFE_TBL_DONT_INC_CTR);
 
+    /* The captured data is handed to the background file writer */
+    UtAssert_INT32_EQ(CFE_TBL_Global.DumpControlBlocks[0].State, CFE_TBL_DUMP_WRITING);
+    UtAssert_ADDRESS_EQ(CFE_TBL_Global.DumpControlBlocks[0].DumpDataPtr, BuffPtr);
+    UtAssert_StrCmp(CFE_TBL_Global.DumpControlBlocks[0].FileWrite.FileName, "hkSource", "FileName (%s)",
+                    CFE_TBL_Global.DumpControlBlocks[0].FileWrite.FileName);
+    UtAssert_BOOL_TRUE(DumpBuffPtr->Taken);
+
+    /* Test response to the background file writer rejecting the request */
+    UT_InitData();
+    CFE_TBL_Global.DumpControlBlocks[0].State = CFE_TBL_DUMP_PERFORMED;
+    CFE_TBL_Global.HkTlmTblRegIndex           = CFE_TBL_NOT_FOUND;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpRequest), CFE_STATUS_REQUEST_ALREADY_PENDING);
+    UtAssert_INT32_EQ(CFE_TBL_HousekeepingCmd(NULL), CFE_TBL_DONT_INC_CTR);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_CREATING_DUMP_FILE_ERR_EID);
+    UtAssert_INT32_EQ(CFE_TBL_Global.DumpControlBlocks[0].State, CFE_TBL_DUMP_FREE);
+    UtAssert_BOOL_FALSE(DumpBuffPtr->Taken);
+    UtAssert_INT32_EQ(RegRecPtr.LoadInProgress, CFE_TBL_NO_LOAD_IN_PROGRESS);
+
     for (i = 1; i < CFE_PLATFORM_TBL_MAX_SIMULTANEOUS_LOADS; i++)
     {
-        CFE_TBL_Global.DumpControlBlocks[i].State = CFE_TBL_DUMP_PENDING;
+        CFE_TBL_Global.DumpControlBlocks[i].State = CFE_TBL_DUMP_FREE;
     }
+}
 
-    RegRecPtr.LoadInProgress                      = LoadInProg;
-    CFE_TBL_Global.DumpControlBlocks[0].RegRecPtr = &RegRecPtr;
+/*
+** Test the background file writer callbacks used for table dumps
+*/
+void Test_CFE_TBL_BackgroundDump(void)
+{
+    CFE_TBL_DumpControl_t *DumpCtrlPtr = &CFE_TBL_Global.DumpControlBlocks[0];
+    CFE_TBL_RegistryRec_t *RegRecPtr   = &CFE_TBL_Global.Registry[0];
+    CFE_TBL_LoadBuff_t     DumpBuff;
+    CFE_TBL_LoadBuff_t *   WorkingBufferPtr;
+    uint8                  TblData[CFE_PLATFORM_TBL_DUMP_CHUNK_SIZE + 10];
+    void *                 LocalBuf;
+    size_t                 LocalSize;
+
+    UtPrintf("Begin Test Background Dump");
 
-    /* Test response to inability to open dump file */
     UT_InitData();
-    CFE_TBL_Global.DumpControlBlocks[0].State = CFE_TBL_DUMP_PERFORMED;
-    CFE_TBL_Global.HkTlmTblRegIndex           = CFE_TBL_NOT_FOUND + 1;
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
-    UtAssert_INT32_EQ(CFE_TBL_HousekeepingCmd(NULL), CFE_TBL_DONT_INC_CTR);
+    UT_ResetTableRegistry();
+    memset(TblData, 0xA5, sizeof(TblData));
+
+    /* Queue a dump of the active buffer, pinned in epoch 3; nothing is kept from an earlier request */
+    DumpCtrlPtr->FileWrite.Priority = CFE_FS_FileWritePriority_AUTOMATIC;
+    strncpy(DumpCtrlPtr->TableName, "ut_cfe_tbl.BgDump", sizeof(DumpCtrlPtr->TableName) - 1);
+    DumpCtrlPtr->RegRecPtr     = RegRecPtr;
+    DumpCtrlPtr->DumpBufferPtr = NULL;
+    DumpCtrlPtr->Size          = sizeof(TblData);
+    DumpCtrlPtr->DumpDataPtr   = TblData;
+    DumpCtrlPtr->PinnedEpoch   = 3;
+    DumpCtrlPtr->State         = CFE_TBL_DUMP_WRITING;
+    UtAssert_INT32_EQ(CFE_TBL_StartDumpToFile(DumpCtrlPtr, "/ram/bgdump.tbl"), CFE_TBL_INC_CMD_CTR);
+    UtAssert_StrCmp(DumpCtrlPtr->FileWrite.FileName, "/ram/bgdump.tbl", "FileName (%s)",
+                    DumpCtrlPtr->FileWrite.FileName);
+    UtAssert_BOOL_TRUE(DumpCtrlPtr->FileExisted);
+    UtAssert_UINT32_EQ(DumpCtrlPtr->FileWrite.Priority, CFE_FS_FileWritePriority_GROUND);
+    UtAssert_UINT32_EQ(DumpCtrlPtr->FileWrite.Compress, CFE_PLATFORM_TBL_COMPRESS_FILE_DUMPS);
+
+    /* The pinned buffer is reported as in use for its epoch and later ones only */
+    UtAssert_BOOL_TRUE(CFE_TBL_IsDumpPinned(RegRecPtr, 3));
+    UtAssert_BOOL_TRUE(CFE_TBL_IsEpochPinned(RegRecPtr, 4));
+    UtAssert_BOOL_FALSE(CFE_TBL_IsDumpPinned(RegRecPtr, 2));
+    UtAssert_BOOL_FALSE(CFE_TBL_IsDumpPinned(&CFE_TBL_Global.Registry[1], 3));
+
+    /* A double buffered table cannot load into the buffer being dumped */
+    RegRecPtr->DoubleBuffered  = true;
+    RegRecPtr->TableLoadedOnce = true;
+    RegRecPtr->ActiveEpoch     = 4;
+    UtAssert_INT32_EQ(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, false), CFE_TBL_ERR_NO_BUFFER_AVAIL);
+    UtAssert_INT32_EQ(RegRecPtr->LoadInProgress, CFE_TBL_NO_LOAD_IN_PROGRESS);
+
+    /* The header comes first, then the table data in chunks straight from the buffer */
+    UtAssert_BOOL_FALSE(CFE_TBL_DumpTableGetter(DumpCtrlPtr, 0, &LocalBuf, &LocalSize));
+    UtAssert_ADDRESS_EQ(LocalBuf, &DumpCtrlPtr->TblFileHeader);
+    UtAssert_UINT32_EQ(LocalSize, sizeof(CFE_TBL_File_Hdr_t));
+    UtAssert_BOOL_FALSE(CFE_TBL_DumpTableGetter(DumpCtrlPtr, 1, &LocalBuf, &LocalSize));
+    UtAssert_ADDRESS_EQ(LocalBuf, TblData);
+    UtAssert_UINT32_EQ(LocalSize, CFE_PLATFORM_TBL_DUMP_CHUNK_SIZE);
+    UtAssert_BOOL_TRUE(CFE_TBL_DumpTableGetter(DumpCtrlPtr, 2, &LocalBuf, &LocalSize));
+    UtAssert_ADDRESS_EQ(LocalBuf, &TblData[CFE_PLATFORM_TBL_DUMP_CHUNK_SIZE]);
+    UtAssert_UINT32_EQ(LocalSize, 10);
+
+    /* Completion reports the dump and unpins the buffer */
+    UT_ClearEventHistory();
+    CFE_TBL_DumpTableEventHandler(DumpCtrlPtr, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 3, 0, 0);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_OVERWRITE_DUMP_INF_EID);
+    UtAssert_StrCmp(CFE_TBL_Global.LastFileDumped, "/ram/bgdump.tbl", "LastFileDumped (%s)",
+                    CFE_TBL_Global.LastFileDumped);
+
+    /* The file name is reported by the next housekeeping request in the TBL task */
+    CFE_TBL_GetHkData();
+    UtAssert_StrCmp(CFE_TBL_Global.HkPacket.Payload.LastFileDumped, "/ram/bgdump.tbl", "LastFileDumped (%s)",
+                    CFE_TBL_Global.HkPacket.Payload.LastFileDumped);
+    UtAssert_INT32_EQ(DumpCtrlPtr->State, CFE_TBL_DUMP_FREE);
+    UtAssert_BOOL_FALSE(CFE_TBL_IsDumpPinned(RegRecPtr, 3));
+    UtAssert_INT32_EQ(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, false), CFE_SUCCESS);
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
 
-    /* Test response to an invalid table and a dump file create failure */
+    /* A new file is reported as such */
+    UT_InitData();
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_ERROR);
+    DumpCtrlPtr->RegRecPtr   = RegRecPtr;
+    DumpCtrlPtr->DumpDataPtr = TblData;
+    DumpCtrlPtr->State       = CFE_TBL_DUMP_WRITING;
+    UtAssert_INT32_EQ(CFE_TBL_StartDumpToFile(DumpCtrlPtr, "/ram/bgdump.tbl"), CFE_TBL_INC_CMD_CTR);
+    CFE_TBL_DumpTableEventHandler(DumpCtrlPtr, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 3, 0, 0);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_WRITE_DUMP_INF_EID);
+
+    /* Removing the table during the dump stops the data and reports the dump as failed */
+    UT_InitData();
+    DumpCtrlPtr->RegRecPtr   = RegRecPtr;
+    DumpCtrlPtr->DumpDataPtr = TblData;
+    DumpCtrlPtr->PinnedEpoch = 3;
+    DumpCtrlPtr->State       = CFE_TBL_DUMP_WRITING;
+    UtAssert_INT32_EQ(CFE_TBL_StartDumpToFile(DumpCtrlPtr, "/ram/bgdump.tbl"), CFE_TBL_INC_CMD_CTR);
+    CFE_TBL_AbortDumps(RegRecPtr);
+    UtAssert_BOOL_FALSE(CFE_TBL_IsDumpPinned(RegRecPtr, 3));
+    UtAssert_BOOL_TRUE(CFE_TBL_DumpTableGetter(DumpCtrlPtr, 1, &LocalBuf, &LocalSize));
+    UtAssert_NULL(LocalBuf);
+    UtAssert_ZERO(LocalSize);
+    CFE_TBL_DumpTableEventHandler(DumpCtrlPtr, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 1, 0, 0);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_WRITE_TBL_IMG_ERR_EID);
+    UtAssert_INT32_EQ(DumpCtrlPtr->State, CFE_TBL_DUMP_FREE);
+
+    /* A Dump Only table's captured copy gets the capture time and is freed when written */
+    UT_InitData();
+    memset(&DumpBuff, 0, sizeof(DumpBuff));
+    DumpBuff.Taken                 = true;
+    DumpBuff.BufferPtr             = TblData;
+    DumpBuff.FileCreateTimeSecs    = 1234;
+    DumpCtrlPtr->RegRecPtr         = RegRecPtr;
+    DumpCtrlPtr->DumpBufferPtr     = &DumpBuff;
+    DumpCtrlPtr->DumpDataPtr       = TblData;
+    DumpCtrlPtr->PinnedEpoch       = CFE_TBL_NO_EPOCH_PINNED;
+    DumpCtrlPtr->State             = CFE_TBL_DUMP_WRITING;
+    RegRecPtr->LoadInProgress      = 1;
+    UtAssert_INT32_EQ(CFE_TBL_StartDumpToFile(DumpCtrlPtr, "/ram/dumponly.tbl"), CFE_TBL_INC_CMD_CTR);
+    UtAssert_BOOL_TRUE(CFE_TBL_IsDumpBufferInUse(RegRecPtr));
+    UtAssert_BOOL_FALSE(CFE_TBL_IsDumpPinned(RegRecPtr, 3));
+    CFE_TBL_DumpTableEventHandler(DumpCtrlPtr, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 3, 0, 0);
+    UtAssert_STUB_COUNT(CFE_FS_SetTimestamp, 1);
+    UtAssert_BOOL_FALSE(DumpBuff.Taken);
+    UtAssert_INT32_EQ(RegRecPtr->LoadInProgress, CFE_TBL_NO_LOAD_IN_PROGRESS);
+    UtAssert_BOOL_FALSE(CFE_TBL_IsDumpBufferInUse(RegRecPtr));
+
+    /* Failures to update the timestamp of the dump file are only logged */
     UT_InitData();
-    CFE_TBL_Global.HkTlmTblRegIndex           = CFE_TBL_NOT_FOUND;
-    CFE_TBL_Global.DumpControlBlocks[0].State = CFE_TBL_DUMP_PERFORMED;
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
-    UtAssert_INT32_EQ(CFE_TBL_HousekeepingCmd(NULL), CFE_TBL_DONT_INC_CTR);
+    DumpBuff.Taken             = true;
+    DumpCtrlPtr->RegRecPtr     = RegRecPtr;
+    DumpCtrlPtr->DumpBufferPtr = &DumpBuff;
+    DumpCtrlPtr->State         = CFE_TBL_DUMP_WRITING;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_SetTimestamp), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    CFE_TBL_DumpTableEventHandler(DumpCtrlPtr, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 3, 0, 0);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_OVERWRITE_DUMP_INF_EID);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
 
-    /* Test response to a file time stamp failure */
     UT_InitData();
-    CFE_TBL_Global.DumpControlBlocks[0].State = CFE_TBL_DUMP_PERFORMED;
-    UT_SetDeferredRetcode(UT_KEY(CFE_FS_SetTimestamp), 1, OS_SUCCESS - 1);
-    UtAssert_INT32_EQ(CFE_TBL_HousekeepingCmd(NULL), CFE_TBL_DONT_INC_CTR);
+    DumpBuff.Taken             = true;
+    DumpCtrlPtr->RegRecPtr     = RegRecPtr;
+    DumpCtrlPtr->DumpBufferPtr = &DumpBuff;
+    DumpCtrlPtr->State         = CFE_TBL_DUMP_WRITING;
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+    CFE_TBL_DumpTableEventHandler(DumpCtrlPtr, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 3, 0, 0);
+    UtAssert_STUB_COUNT(CFE_FS_SetTimestamp, 0);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
 
-    /* Test response to OS_OpenCreate failure */
+    /* Check the error event generators; every terminal event frees the block */
     UT_InitData();
-    CFE_TBL_Global.DumpControlBlocks[0].State = CFE_TBL_DUMP_PERFORMED;
-    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 3, -1);
-    UtAssert_INT32_EQ(CFE_TBL_HousekeepingCmd(NULL), CFE_TBL_DONT_INC_CTR);
+    DumpCtrlPtr->State = CFE_TBL_DUMP_WRITING;
+    CFE_TBL_DumpTableEventHandler(DumpCtrlPtr, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, OS_ERROR, 0, 0, 0);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_WRITE_TBL_HDR_ERR_EID);
+    UtAssert_INT32_EQ(DumpCtrlPtr->State, CFE_TBL_DUMP_FREE);
+
+    UT_ClearEventHistory();
+    DumpCtrlPtr->State = CFE_TBL_DUMP_WRITING;
+    CFE_TBL_DumpTableEventHandler(DumpCtrlPtr, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, OS_ERROR, 2, 0, 0);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_WRITE_TBL_IMG_ERR_EID);
+
+    UT_ClearEventHistory();
+    DumpCtrlPtr->State = CFE_TBL_DUMP_WRITING;
+    CFE_TBL_DumpTableEventHandler(DumpCtrlPtr, CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR, OS_ERROR, 0, 0, 0);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_WRITE_CFE_HDR_ERR_EID);
+
+    UT_ClearEventHistory();
+    DumpCtrlPtr->State = CFE_TBL_DUMP_WRITING;
+    CFE_TBL_DumpTableEventHandler(DumpCtrlPtr, CFE_FS_FileWriteEvent_CREATE_ERROR, OS_ERROR, 0, 0, 0);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_CREATING_DUMP_FILE_ERR_EID);
+
+    UT_ClearEventHistory();
+    DumpCtrlPtr->State = CFE_TBL_DUMP_WRITING;
+    CFE_TBL_DumpTableEventHandler(DumpCtrlPtr, CFE_FS_FileWriteEvent_UNDEFINED, OS_ERROR, 0, 0, 0);
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_INT32_EQ(DumpCtrlPtr->State, CFE_TBL_DUMP_WRITING);
+
+    UT_ResetTableRegistry();
 }
 
 /*
@@ -2176,6 +2446,22 @@ void Test_CFE_TBL_Load(void)
     CFE_UtAssert_EVENTSENT(CFE_TBL_VALIDATION_ERR_EID);
     CFE_UtAssert_EVENTCOUNT(1);
 
+    /* Test that a partial load of a double buffered table that fails validation
+     * leaves the whole (zeroed) inactive buffer marked as differing from the active one
+     */
+    UT_InitData();
+    strncpy(TblFileHeader.TableName, "ut_cfe_tbl.UT_Table2x", sizeof(TblFileHeader.TableName) - 1);
+    TblFileHeader.TableName[sizeof(TblFileHeader.TableName) - 1] = '\0';
+    UT_TBL_SetupHeader(&TblFileHeader, 1, 2);
+    UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+    UT_SetDeferredRetcode(UT_KEY(Test_CFE_TBL_ValidationFunc), 1, -1);
+    UtAssert_INT32_EQ(CFE_TBL_Load(App1TblHandle2, CFE_TBL_SRC_FILE, "TblSrcFileName.dat"), -1);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_VALIDATION_ERR_EID);
+    UtAssert_UINT32_EQ(RegRecPtr->DirtyOffset, 0);
+    UtAssert_UINT32_EQ(RegRecPtr->DirtyNumBytes, sizeof(UT_Table1_t));
+
     /* Test failure of validation function on table load using a positive
      * return code
      */
@@ -2240,17 +2526,33 @@ void Test_CFE_TBL_Load(void)
     UtAssert_INT32_EQ(CFE_TBL_GetAddress(&App2TblPtr, App2TblHandle1), CFE_TBL_INFO_UPDATED);
     CFE_UtAssert_EVENTCOUNT(0);
 
-    /* c. Perform test */
+    /* c. Perform test (no memory available to publish a new buffer) */
     UT_InitData();
     UT_SetAppID(UT_TBL_APPID_1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
     UtAssert_INT32_EQ(CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TestTable1), CFE_TBL_INFO_TABLE_LOCKED);
     CFE_UtAssert_EVENTCOUNT(1);
 
-    /* d. Test cleanup */
+    /* Test completing the pending update while the table is still pinned by a
+     * reader; the update is published in a new buffer and the reader's buffer
+     * is retired
+     */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_1);
+    AccessDescPtr = &CFE_TBL_Global.Handles[App1TblHandle1];
+    RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
+    CFE_UtAssert_SUCCESS(CFE_TBL_Update(App1TblHandle1));
+    CFE_UtAssert_EVENTSENT(CFE_TBL_UPDATE_SUCCESS_INF_EID);
+    UtAssert_ADDRESS_EQ(RegRecPtr->RetiredBufferPtr, App2TblPtr);
+    UtAssert_True(RegRecPtr->Buffers[0].BufferPtr != App2TblPtr, "Active buffer replaced while pinned");
+
+    /* d. Test cleanup; releasing the last pin reclaims the retired buffer */
     UT_InitData();
     UT_SetAppID(UT_TBL_APPID_2);
-    CFE_UtAssert_SUCCESS(CFE_TBL_ReleaseAddress(App2TblHandle1));
+    UtAssert_INT32_EQ(CFE_TBL_ReleaseAddress(App2TblHandle1), CFE_TBL_INFO_UPDATED);
     CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_NULL(RegRecPtr->RetiredBufferPtr);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
 }
 
 /*
@@ -2725,6 +3027,7 @@ void Test_CFE_TBL_Manage(void)
 
     /* Configure table for update */
     RegRecPtr->LoadPending = true;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
     UtAssert_INT32_EQ(CFE_TBL_Manage(App1TblHandle1), CFE_TBL_INFO_TABLE_LOCKED);
     CFE_UtAssert_EVENTCOUNT(0);
 
@@ -2765,7 +3068,7 @@ void Test_CFE_TBL_Manage(void)
     CFE_TBL_Global.Handles[AccessIterator].AppId       = UT_TBL_APPID_2;
     RegRecPtr->HeadOfAccessList                        = AccessIterator;
     CFE_TBL_Global.Handles[AccessIterator].BufferIndex = 1;
-    CFE_TBL_Global.Handles[AccessIterator].LockFlag    = true;
+    CFE_TBL_Global.Handles[AccessIterator].PinnedEpoch = RegRecPtr->ActiveEpoch;
 
     /* Attempt to "load" image into inactive buffer for table */
     RegIndex  = CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table2");
@@ -2774,7 +3077,7 @@ void Test_CFE_TBL_Manage(void)
 
     /* Reset the table information for subsequent tests */
     CFE_TBL_Global.Handles[AccessIterator].BufferIndex = 1;
-    CFE_TBL_Global.Handles[AccessIterator].LockFlag    = false;
+    CFE_TBL_Global.Handles[AccessIterator].PinnedEpoch = CFE_TBL_NO_EPOCH_PINNED;
 
     /* Successfully "load" image into inactive buffer for table */
     CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, false));
@@ -2885,6 +3188,91 @@ void Test_CFE_TBL_Manage(void)
     CFE_UtAssert_EVENTCOUNT(0);
 }
 
+/*
+** Test function for managing all of an application's tables at once
+*/
+void Test_CFE_TBL_ManageAll(void)
+{
+    CFE_TBL_Handle_t       App3TblHandle;
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+    CFE_TBL_LoadBuff_t *   WorkingBufferPtr;
+    UT_Table1_t            TestTable1;
+    uint32                 AppIndex;
+
+    memset(&TestTable1, 0, sizeof(TestTable1));
+
+    UtPrintf("Begin Test Manage All");
+
+    /* Test setup - register and load a table for an application that owns no other tables */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_3);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&App3TblHandle, "UT_ManageAll", sizeof(UT_Table1_t), CFE_TBL_OPT_DEFAULT,
+                                          Test_CFE_TBL_ValidationFunc));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(App3TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    RegRecPtr = &CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[App3TblHandle].RegIndex];
+    CFE_ES_AppID_ToIndex(UT_TBL_APPID_3, &AppIndex);
+    CFE_TBL_Global.PendingWork[AppIndex] = 0;
+
+    /* Test response to an invalid application ID */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_TBL_ManageAll(UT_TBL_APPID_3), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Test that nothing is locked or scanned when no request is pending */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_3);
+    CFE_UtAssert_SUCCESS(CFE_TBL_ManageAll(UT_TBL_APPID_3));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test that a request that could not be serviced is kept for the next call */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_2);
+    CFE_TBL_Global.ValidationResults[0].State  = CFE_TBL_VALIDATION_PENDING;
+    CFE_TBL_Global.ValidationResults[0].Result = 1;
+    RegRecPtr->ValidateActiveIndex             = 0;
+    CFE_TBL_MarkPendingWork(RegRecPtr, CFE_TBL_PENDING_VALIDATE);
+    UtAssert_UINT32_EQ(CFE_TBL_Global.PendingWork[AppIndex], CFE_TBL_PENDING_VALIDATE);
+    UtAssert_INT32_EQ(CFE_TBL_ManageAll(UT_TBL_APPID_3), CFE_TBL_ERR_NO_ACCESS);
+    UtAssert_UINT32_EQ(CFE_TBL_Global.PendingWork[AppIndex], CFE_TBL_PENDING_VALIDATE);
+
+    /* Test servicing the retained validation request */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_3);
+    UT_SetDeferredRetcode(UT_KEY(Test_CFE_TBL_ValidationFunc), 1, CFE_SUCCESS);
+    CFE_UtAssert_SUCCESS(CFE_TBL_ManageAll(UT_TBL_APPID_3));
+    CFE_UtAssert_EVENTSENT(CFE_TBL_VALIDATION_INF_EID);
+    UtAssert_INT32_EQ(CFE_TBL_Global.ValidationResults[0].Result, 0);
+    UtAssert_INT32_EQ(RegRecPtr->ValidateActiveIndex, CFE_TBL_NO_VALIDATION_PENDING);
+    UtAssert_UINT32_EQ(CFE_TBL_Global.PendingWork[AppIndex], 0);
+    CFE_TBL_Global.ValidationResults[0].State = CFE_TBL_VALIDATION_FREE;
+
+    /* Test servicing an update request */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_3);
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, false));
+    RegRecPtr->LoadPending = true;
+    CFE_TBL_MarkPendingWork(RegRecPtr, CFE_TBL_PENDING_UPDATE);
+    UtAssert_INT32_EQ(CFE_TBL_ManageAll(UT_TBL_APPID_3), CFE_TBL_INFO_UPDATED);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_UPDATE_SUCCESS_INF_EID);
+    UtAssert_BOOL_FALSE(RegRecPtr->LoadPending);
+    UtAssert_UINT32_EQ(CFE_TBL_Global.PendingWork[AppIndex], 0);
+
+    /* Test that a stale request bit is cleared without servicing any table */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_3);
+    CFE_TBL_MarkPendingWork(RegRecPtr, CFE_TBL_PENDING_DUMP);
+    CFE_UtAssert_SUCCESS(CFE_TBL_ManageAll(UT_TBL_APPID_3));
+    UtAssert_UINT32_EQ(CFE_TBL_Global.PendingWork[AppIndex], 0);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test that cleaning up the application discards its pending requests */
+    UT_InitData();
+    CFE_TBL_MarkPendingWork(RegRecPtr, CFE_TBL_PENDING_DUMP);
+    CFE_UtAssert_SUCCESS(CFE_TBL_CleanUpApp(UT_TBL_APPID_3));
+    UtAssert_UINT32_EQ(CFE_TBL_Global.PendingWork[AppIndex], 0);
+}
+
 /*
 ** Test function for dumping to a buffer
 */
@@ -3019,6 +3407,73 @@ void Test_CFE_TBL_GetInfo(void)
     CFE_UtAssert_EVENTCOUNT(0);
 }
 
+/*
+** Test function that returns the range changed by a pending table load
+*/
+void Test_CFE_TBL_GetLoadRange(void)
+{
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+    size_t                 Offset;
+    size_t                 NumBytes;
+
+    UtPrintf("Begin Test Get Load Range");
+
+    RegRecPtr = &CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[App1TblHandle1].RegIndex];
+
+    /* Test response to null output pointers */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_TBL_GetLoadRange(App1TblHandle1, NULL, &NumBytes), CFE_TBL_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TBL_GetLoadRange(App1TblHandle1, &Offset, NULL), CFE_TBL_BAD_ARGUMENT);
+
+    /* Test response to an application that is not allowed to see the table */
+    UT_InitData();
+    UT_SetAppID(CFE_ES_APPID_UNDEFINED);
+    UtAssert_INT32_EQ(CFE_TBL_GetLoadRange(App1TblHandle1, &Offset, &NumBytes), CFE_TBL_ERR_NO_ACCESS);
+
+    /* Test that the entire table is reported when no load is in progress */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_1);
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    UtAssert_INT32_EQ(CFE_TBL_GetLoadRange(App1TblHandle1, &Offset, &NumBytes), CFE_TBL_INFO_NO_UPDATE_PENDING);
+    UtAssert_UINT32_EQ(Offset, 0);
+    UtAssert_UINT32_EQ(NumBytes, RegRecPtr->Size);
+
+    /* Test that the dirty range is reported while a load is in progress */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_1);
+    RegRecPtr->LoadInProgress = 0;
+    RegRecPtr->DirtyOffset    = 1;
+    RegRecPtr->DirtyNumBytes  = 2;
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetLoadRange(App1TblHandle1, &Offset, &NumBytes));
+    UtAssert_UINT32_EQ(Offset, 1);
+    UtAssert_UINT32_EQ(NumBytes, 2);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test that a validation function running in a validation worker may query the range */
+    UT_InitData();
+    CFE_TBL_Global.TableTaskAppId = UT_TBL_APPID_10;
+    UT_SetAppID(UT_TBL_APPID_10);
+    RegRecPtr->AsyncValidateIndex = 0;
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetLoadRange(App1TblHandle1, &Offset, &NumBytes));
+    UtAssert_UINT32_EQ(Offset, 1);
+    UtAssert_UINT32_EQ(NumBytes, 2);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
+    RegRecPtr->AsyncValidateIndex = CFE_TBL_NO_VALIDATION_PENDING;
+    UT_SetAppID(UT_TBL_APPID_1);
+
+    /* Test the range helper directly, which performs no access checks */
+    UT_InitData();
+    UT_SetAppID(CFE_ES_APPID_UNDEFINED);
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetLoadRangeInternal(RegRecPtr, &Offset, &NumBytes));
+    UtAssert_UINT32_EQ(Offset, 1);
+    UtAssert_UINT32_EQ(NumBytes, 2);
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    UtAssert_INT32_EQ(CFE_TBL_GetLoadRangeInternal(RegRecPtr, &Offset, &NumBytes), CFE_TBL_INFO_NO_UPDATE_PENDING);
+    UtAssert_UINT32_EQ(Offset, 0);
+    UtAssert_UINT32_EQ(NumBytes, RegRecPtr->Size);
+    UT_SetAppID(UT_TBL_APPID_1);
+}
+
 /*
 ** Test function that loads a specified table with data from the
 ** specified source
@@ -3204,6 +3659,7 @@ void Test_CFE_TBL_Internal(void)
     CFE_TBL_File_Hdr_t          TblFileHeader;
     osal_id_t                   FileDescriptor;
     void *                      TblPtr;
+    void *                      OldBufferPtr;
 
     UtPrintf("Begin Test Internal");
 
@@ -3227,6 +3683,7 @@ void Test_CFE_TBL_Internal(void)
     RegRecPtr->Name[sizeof(RegRecPtr->Name) - 1] = '\0';
     RegRecPtr->TableLoadedOnce                   = false;
     RegRecPtr->LoadInProgress                    = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    CFE_TBL_RebuildRegistryIndex();
     CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, true));
     CFE_UtAssert_EVENTCOUNT(0);
     UtAssert_ADDRESS_EQ(WorkingBufferPtr, &RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex]);
@@ -3783,6 +4240,7 @@ void Test_CFE_TBL_Internal(void)
     UT_InitData();
     CFE_TBL_Global.Registry[0].OwnerAppId       = CFE_TBL_NOT_OWNED;
     CFE_TBL_Global.Registry[0].HeadOfAccessList = CFE_TBL_END_OF_LIST + 1;
+    CFE_TBL_RebuildRegistryIndex();
     UtAssert_INT32_EQ(CFE_TBL_FindFreeRegistryEntry(), 1);
     CFE_UtAssert_EVENTCOUNT(0);
 
@@ -3832,8 +4290,9 @@ void Test_CFE_TBL_Internal(void)
     CFE_UtAssert_SUCCESS(CFE_TBL_UpdateInternal(App1TblHandle2, RegRecPtr, AccessDescPtr));
     CFE_UtAssert_EVENTCOUNT(0);
 
-    /* Test CFE_TBL_UpdateInternal single buffer memcpy when
-     * source and dest are not equal
+    /* Test CFE_TBL_UpdateInternal single buffer update when source and dest are
+     * not equal; the contents are published in a new buffer even though nothing
+     * is pinned, and the old buffer goes straight back to the pool
      */
     UT_InitData();
     AccessDescPtr             = &CFE_TBL_Global.Handles[App1TblHandle2];
@@ -3841,8 +4300,25 @@ void Test_CFE_TBL_Internal(void)
     RegRecPtr->LoadPending    = true;
     RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS + 1;
     RegRecPtr->DoubleBuffered = false;
+    OldBufferPtr              = RegRecPtr->Buffers[0].BufferPtr;
     CFE_UtAssert_SUCCESS(CFE_TBL_UpdateInternal(App1TblHandle2, RegRecPtr, AccessDescPtr));
     CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_True(RegRecPtr->Buffers[0].BufferPtr != OldBufferPtr, "Active buffer replaced");
+    UtAssert_NULL(RegRecPtr->RetiredBufferPtr);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+
+    /* Test that the update waits, rather than writing the active buffer in place,
+     * when no buffer can be allocated to publish it in
+     */
+    UT_InitData();
+    RegRecPtr->LoadPending    = true;
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS + 1;
+    OldBufferPtr              = RegRecPtr->Buffers[0].BufferPtr;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_TBL_UpdateInternal(App1TblHandle2, RegRecPtr, AccessDescPtr), CFE_TBL_INFO_TABLE_LOCKED);
+    UtAssert_ADDRESS_EQ(RegRecPtr->Buffers[0].BufferPtr, OldBufferPtr);
+    UtAssert_BOOL_TRUE(RegRecPtr->LoadPending);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
 
     /* Test CFE_TBL_UpdateInternal with overlapping memcopy (bug) */
     UT_InitData();
@@ -3869,6 +4345,7 @@ void Test_CFE_TBL_Internal(void)
     CFE_TBL_Global.DumpControlBlocks[3].RegRecPtr = &CFE_TBL_Global.Registry[0];
     CFE_TBL_Global.Handles[1].AppId               = UT_TBL_APPID_1;
     CFE_TBL_Global.Handles[1].UsedFlag            = false;
+    CFE_TBL_RebuildRegistryIndex();
     CFE_UtAssert_SUCCESS(CFE_TBL_CleanUpApp(UT_TBL_APPID_1));
     UtAssert_INT32_EQ(CFE_TBL_Global.DumpControlBlocks[3].State, CFE_TBL_DUMP_PENDING);
     CFE_UtAssert_RESOURCEID_EQ(RegRecPtr->OwnerAppId, UT_TBL_APPID_2);
@@ -3934,6 +4411,580 @@ void Test_CFE_TBL_Internal(void)
 #endif
 }
 
+/*
+** Test copying active table contents into a partially loaded working buffer
+*/
+void Test_CFE_TBL_PrefillWorkingBuffer(void)
+{
+    CFE_TBL_RegistryRec_t RegRec;
+    CFE_TBL_LoadBuff_t    WorkingBuffer;
+    uint8                 ActiveData[8]   = {0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7};
+    uint8                 ExpectedData[8] = {0xA0, 0xA1, 0x55, 0x55, 0x55, 0xA5, 0xA6, 0xA7};
+    uint8                 WorkingData[8];
+
+    UtPrintf("Begin Test Prefill Working Buffer");
+
+    memset(&RegRec, 0, sizeof(RegRec));
+    memset(&WorkingBuffer, 0, sizeof(WorkingBuffer));
+    RegRec.Size                 = sizeof(ActiveData);
+    RegRec.Buffers[0].BufferPtr = ActiveData;
+    WorkingBuffer.BufferPtr     = WorkingData;
+
+    /* Test that only the bytes outside of the region being loaded are copied */
+    UT_InitData();
+    memset(WorkingData, 0x55, sizeof(WorkingData));
+    WorkingBuffer.Prefilled = false;
+    RegRec.DirtyOffset      = 0;
+    RegRec.DirtyNumBytes    = sizeof(ActiveData);
+    UtAssert_VOIDCALL(CFE_TBL_PrefillWorkingBuffer(&WorkingBuffer, &RegRec, 2, 3));
+    UtAssert_MemCmp(WorkingData, ExpectedData, sizeof(WorkingData), "Working buffer holds active data outside load");
+    UtAssert_BOOL_TRUE(WorkingBuffer.Prefilled);
+    UtAssert_UINT32_EQ(RegRec.DirtyOffset, 2);
+    UtAssert_UINT32_EQ(RegRec.DirtyNumBytes, 3);
+
+    /* Test that a working buffer that was already prefilled is left alone and the dirty range grows */
+    UT_InitData();
+    memset(WorkingData, 0x55, sizeof(WorkingData));
+    UtAssert_VOIDCALL(CFE_TBL_PrefillWorkingBuffer(&WorkingBuffer, &RegRec, 0, 1));
+    UtAssert_UINT32_EQ(WorkingData[7], 0x55);
+    UtAssert_UINT32_EQ(RegRec.DirtyOffset, 0);
+    UtAssert_UINT32_EQ(RegRec.DirtyNumBytes, 5);
+
+    /* Test that only the dirty range is copied when it is smaller than the table */
+    UT_InitData();
+    memset(WorkingData, 0x55, sizeof(WorkingData));
+    WorkingBuffer.Prefilled = false;
+    RegRec.DirtyOffset      = 6;
+    RegRec.DirtyNumBytes    = 1;
+    UtAssert_VOIDCALL(CFE_TBL_PrefillWorkingBuffer(&WorkingBuffer, &RegRec, 2, 3));
+    UtAssert_UINT32_EQ(WorkingData[0], 0x55);
+    UtAssert_UINT32_EQ(WorkingData[6], 0xA6);
+    UtAssert_UINT32_EQ(WorkingData[7], 0x55);
+
+    /* Test a dirty range that ends ahead of the region being loaded */
+    UT_InitData();
+    memset(WorkingData, 0x55, sizeof(WorkingData));
+    WorkingBuffer.Prefilled = false;
+    RegRec.DirtyOffset      = 0;
+    RegRec.DirtyNumBytes    = 1;
+    UtAssert_VOIDCALL(CFE_TBL_PrefillWorkingBuffer(&WorkingBuffer, &RegRec, 4, 2));
+    UtAssert_UINT32_EQ(WorkingData[0], 0xA0);
+    UtAssert_UINT32_EQ(WorkingData[1], 0x55);
+
+    /* Test that a full table load copies nothing */
+    UT_InitData();
+    memset(WorkingData, 0x55, sizeof(WorkingData));
+    WorkingBuffer.Prefilled = false;
+    RegRec.DirtyOffset      = 0;
+    RegRec.DirtyNumBytes    = sizeof(ActiveData);
+    UtAssert_VOIDCALL(CFE_TBL_PrefillWorkingBuffer(&WorkingBuffer, &RegRec, 0, sizeof(WorkingData)));
+    UtAssert_UINT32_EQ(WorkingData[0], 0x55);
+    UtAssert_UINT32_EQ(WorkingData[7], 0x55);
+    UtAssert_BOOL_TRUE(WorkingBuffer.Prefilled);
+
+    /* Test that loading straight into the active buffer copies nothing */
+    UT_InitData();
+    WorkingBuffer.Prefilled = false;
+    WorkingBuffer.BufferPtr = ActiveData;
+    RegRec.DirtyOffset      = 0;
+    RegRec.DirtyNumBytes    = sizeof(ActiveData);
+    UtAssert_VOIDCALL(CFE_TBL_PrefillWorkingBuffer(&WorkingBuffer, &RegRec, 2, 3));
+    UtAssert_BOOL_TRUE(WorkingBuffer.Prefilled);
+    UtAssert_UINT32_EQ(RegRec.DirtyNumBytes, sizeof(ActiveData));
+    WorkingBuffer.BufferPtr = WorkingData;
+
+    /* Test growing an empty dirty range */
+    UT_InitData();
+    RegRec.DirtyOffset   = 0;
+    RegRec.DirtyNumBytes = 0;
+    UtAssert_VOIDCALL(CFE_TBL_PrefillWorkingBuffer(&WorkingBuffer, &RegRec, 3, 2));
+    UtAssert_UINT32_EQ(RegRec.DirtyOffset, 3);
+    UtAssert_UINT32_EQ(RegRec.DirtyNumBytes, 2);
+}
+
+/*
+** Test function for validating tables on the validation worker tasks
+*/
+void Test_CFE_TBL_ValidationWorkers(void)
+{
+    CFE_TBL_Handle_t       TblHandle;
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+    int16                  RegIndex;
+    CFE_TBL_ValidateCmd_t  ValidateCmd;
+    CFE_TBL_AbortLoadCmd_t AbortLdCmd;
+    CFE_TBL_LoadBuff_t *   WorkingBufferPtr;
+    uint8                  ActiveBufferIndex;
+
+    UtPrintf("Begin Test Validation Workers");
+
+    /* Test starting the number of workers configured for the platform */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_StartValidationWorkers());
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, CFE_PLATFORM_TBL_NUM_VALIDATION_WORKERS);
+
+    /* Test response to an error creating the semaphore signaling finished validations */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_TBL_StartValidationWorkers(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    /* Test setup - register a table that allows validation on a worker */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_1);
+    UT_ResetTableRegistry();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&TblHandle, "UT_AsyncVal", sizeof(UT_Table1_t),
+                                          CFE_TBL_OPT_DBL_BUFFER | CFE_TBL_OPT_VALIDATE_ASYNC,
+                                          Test_CFE_TBL_ValidationFunc));
+    RegIndex  = CFE_TBL_Global.Handles[TblHandle].RegIndex;
+    RegRecPtr = &CFE_TBL_Global.Registry[RegIndex];
+    UtAssert_BOOL_TRUE(RegRecPtr->AsyncValidation);
+    UtAssert_INT32_EQ(RegRecPtr->AsyncValidateIndex, CFE_TBL_NO_VALIDATION_PENDING);
+
+    /* Test that requests stay with the owner when no workers are running */
+    UT_InitData();
+    CFE_TBL_Global.ValidationQueue = OS_OBJECT_ID_UNDEFINED;
+    UtAssert_BOOL_FALSE(CFE_TBL_DispatchValidation(RegIndex, 0));
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+
+    /* Test that requests stay with the owner of a table that did not opt in */
+    UT_InitData();
+    CFE_TBL_Global.ValidationQueue = OS_ObjectIdFromInteger(1);
+    RegRecPtr->AsyncValidation     = false;
+    UtAssert_BOOL_FALSE(CFE_TBL_DispatchValidation(RegIndex, 0));
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+    RegRecPtr->AsyncValidation = true;
+
+    /* Test response to an error queuing the request */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+    UtAssert_BOOL_FALSE(CFE_TBL_DispatchValidation(RegIndex, 0));
+    UtAssert_INT32_EQ(RegRecPtr->AsyncValidateIndex, CFE_TBL_NO_VALIDATION_PENDING);
+
+    /* Test handing a validation command on the inactive buffer to a worker */
+    UT_InitData();
+    memset(&ValidateCmd, 0, sizeof(ValidateCmd));
+    strncpy(ValidateCmd.Payload.TableName, "ut_cfe_tbl.UT_AsyncVal", sizeof(ValidateCmd.Payload.TableName) - 1);
+    ValidateCmd.Payload.ActiveTableFlag = CFE_TBL_BufferSelect_INACTIVE;
+    UtAssert_INT32_EQ(CFE_TBL_ValidateCmd(&ValidateCmd), CFE_TBL_INC_CMD_CTR);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_VAL_REQ_MADE_INF_EID);
+    UtAssert_STUB_COUNT(OS_QueuePut, 1);
+    UtAssert_INT32_EQ(RegRecPtr->ValidateInactiveIndex, CFE_TBL_NO_VALIDATION_PENDING);
+    UtAssert_INT32_EQ(RegRecPtr->AsyncValidateIndex, 0);
+    UtAssert_ADDRESS_EQ(RegRecPtr->AsyncValidateBufPtr, &RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex]);
+
+    /* Test that the owner can neither load nor activate another buffer while a worker is validating */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, true), CFE_TBL_ERR_NO_BUFFER_AVAIL);
+    UtAssert_NULL(WorkingBufferPtr);
+    RegRecPtr->LoadPending    = true;
+    RegRecPtr->LoadInProgress = 1 - RegRecPtr->ActiveBufferIndex;
+    ActiveBufferIndex         = RegRecPtr->ActiveBufferIndex;
+    UtAssert_INT32_EQ(CFE_TBL_UpdateInternal(TblHandle, RegRecPtr, &CFE_TBL_Global.Handles[TblHandle]),
+                      CFE_TBL_INFO_TABLE_LOCKED);
+    UtAssert_UINT32_EQ(RegRecPtr->ActiveBufferIndex, ActiveBufferIndex);
+    UtAssert_BOOL_TRUE(RegRecPtr->LoadPending);
+    RegRecPtr->LoadPending    = false;
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+
+    /* Test that the working buffer is kept while a worker is validating it */
+    UT_InitData();
+    memset(&AbortLdCmd, 0, sizeof(AbortLdCmd));
+    strncpy(AbortLdCmd.Payload.TableName, "ut_cfe_tbl.UT_AsyncVal", sizeof(AbortLdCmd.Payload.TableName) - 1);
+    RegRecPtr->LoadInProgress = 1;
+    UtAssert_INT32_EQ(CFE_TBL_AbortLoadCmd(&AbortLdCmd), CFE_TBL_INC_ERR_CTR);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_LOAD_ABORT_ERR_EID);
+    UtAssert_INT32_EQ(RegRecPtr->LoadInProgress, 1);
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+
+    /* Test a worker performing the queued validation */
+    UT_InitData();
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), UT_TBL_ValidationQueueGetHandler, &RegIndex);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 2, OS_QUEUE_EMPTY);
+    UT_SetDeferredRetcode(UT_KEY(Test_CFE_TBL_ValidationFunc), 1, CFE_SUCCESS);
+    UtAssert_VOIDCALL(CFE_TBL_ValidationWorkerMain());
+    CFE_UtAssert_EVENTSENT(CFE_TBL_VALIDATION_INF_EID);
+    UtAssert_BOOL_TRUE(RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].Validated);
+    UtAssert_INT32_EQ(CFE_TBL_Global.ValidationResults[0].State, CFE_TBL_VALIDATION_PERFORMED);
+    UtAssert_INT32_EQ(RegRecPtr->AsyncValidateIndex, CFE_TBL_NO_VALIDATION_PENDING);
+    UtAssert_NULL(RegRecPtr->AsyncValidateBufPtr);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /* Test a worker reporting a request whose buffer was released as a failed validation */
+    UT_InitData();
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), UT_TBL_ValidationQueueGetHandler, &RegIndex);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 2, OS_QUEUE_EMPTY);
+    CFE_TBL_Global.ValidationResults[0].State = CFE_TBL_VALIDATION_PENDING;
+    RegRecPtr->AsyncValidateIndex             = 0;
+    RegRecPtr->AsyncValidateBufPtr            = NULL;
+    UtAssert_VOIDCALL(CFE_TBL_ValidationWorkerMain());
+    UtAssert_STUB_COUNT(Test_CFE_TBL_ValidationFunc, 0);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_VALIDATION_ERR_EID);
+    UtAssert_INT32_EQ(CFE_TBL_Global.ValidationResults[0].Result, CFE_TBL_ERR_NO_BUFFER_AVAIL);
+    UtAssert_INT32_EQ(RegRecPtr->AsyncValidateIndex, CFE_TBL_NO_VALIDATION_PENDING);
+
+    /* Test that a single buffered table with no load in progress has nothing to hand to a worker */
+    UT_InitData();
+    RegRecPtr->DoubleBuffered = false;
+    UtAssert_NULL(CFE_TBL_GetInactiveBuffer(RegRecPtr));
+    UtAssert_BOOL_FALSE(CFE_TBL_DispatchValidation(RegIndex, 0));
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+    RegRecPtr->DoubleBuffered = true;
+
+    /* Test a worker skipping a request that is no longer outstanding */
+    UT_InitData();
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), UT_TBL_ValidationQueueGetHandler, &RegIndex);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 2, OS_QUEUE_EMPTY);
+    UtAssert_VOIDCALL(CFE_TBL_ValidationWorkerMain());
+    UtAssert_STUB_COUNT(Test_CFE_TBL_ValidationFunc, 0);
+    CFE_UtAssert_EVENTCOUNT(0);
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), NULL, NULL);
+
+    /* Test a worker discarding the result of a validation that a waiter already failed */
+    UT_InitData();
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), UT_TBL_ValidationQueueGetHandler, &RegIndex);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 2, OS_QUEUE_EMPTY);
+    UT_SetHookFunction(UT_KEY(Test_CFE_TBL_ValidationFunc), UT_TBL_FinishAsyncValidationHook, RegRecPtr);
+    CFE_TBL_Global.ValidationResults[0].State                      = CFE_TBL_VALIDATION_PENDING;
+    RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].Validated = false;
+    RegRecPtr->AsyncValidateIndex                                  = 0;
+    RegRecPtr->AsyncValidateBufPtr = &RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex];
+    UtAssert_VOIDCALL(CFE_TBL_ValidationWorkerMain());
+    UtAssert_STUB_COUNT(Test_CFE_TBL_ValidationFunc, 1);
+    UtAssert_BOOL_FALSE(RegRecPtr->Buffers[1 - RegRecPtr->ActiveBufferIndex].Validated);
+    UtAssert_INT32_EQ(CFE_TBL_Global.ValidationResults[0].State, CFE_TBL_VALIDATION_PENDING);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UT_SetHookFunction(UT_KEY(Test_CFE_TBL_ValidationFunc), NULL, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), NULL, NULL);
+    RegRecPtr->AsyncValidateBufPtr = NULL;
+
+    /* Test waiting for a worker that has finished with the table */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_WaitForAsyncValidation(RegRecPtr));
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 0);
+
+    /* Test waiting for a worker that is still validating the table */
+    UT_InitData();
+    RegRecPtr->AsyncValidateIndex = 0;
+    UT_SetHookFunction(UT_KEY(OS_BinSemTimedWait), UT_TBL_FinishAsyncValidationHook, RegRecPtr);
+    CFE_UtAssert_SUCCESS(CFE_TBL_WaitForAsyncValidation(RegRecPtr));
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 1);
+    UT_SetHookFunction(UT_KEY(OS_BinSemTimedWait), NULL, NULL);
+
+    /* Test giving up on a worker that does not finish validating the table */
+    UT_InitData();
+    UT_SetDefaultReturnValue(UT_KEY(OS_BinSemTimedWait), OS_SEM_TIMEOUT);
+    CFE_TBL_Global.ValidationResults[0].State = CFE_TBL_VALIDATION_PENDING;
+    RegRecPtr->AsyncValidateIndex             = 0;
+    UtAssert_INT32_EQ(CFE_TBL_WaitForAsyncValidation(RegRecPtr), CFE_TBL_ERR_VALIDATION_TIMEOUT);
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, CFE_PLATFORM_TBL_VALIDATION_TIMEOUT_MSEC / CFE_TBL_VALIDATION_WAIT_MSEC);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_VALIDATION_TIMEOUT_ERR_EID);
+    UtAssert_INT32_EQ(CFE_TBL_Global.ValidationResults[0].Result, CFE_TBL_ERR_VALIDATION_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_TBL_Global.ValidationResults[0].State, CFE_TBL_VALIDATION_PERFORMED);
+    UtAssert_INT32_EQ(RegRecPtr->AsyncValidateIndex, CFE_TBL_NO_VALIDATION_PENDING);
+
+    /* Test a worker that finishes just as the wait times out */
+    UT_InitData();
+    UT_SetDefaultReturnValue(UT_KEY(OS_BinSemTimedWait), OS_SEM_TIMEOUT);
+    RegRecPtr->AsyncValidateIndex = 0;
+    UT_SetHookFunction(UT_KEY(OS_MutSemTake), UT_TBL_FinishAsyncValidationHook, RegRecPtr);
+    CFE_UtAssert_SUCCESS(CFE_TBL_WaitForAsyncValidation(RegRecPtr));
+    CFE_UtAssert_EVENTNOTSENT(CFE_TBL_VALIDATION_TIMEOUT_ERR_EID);
+    UT_SetHookFunction(UT_KEY(OS_MutSemTake), NULL, NULL);
+
+    CFE_TBL_Global.ValidationQueue            = OS_OBJECT_ID_UNDEFINED;
+    CFE_TBL_Global.ValidationResults[0].State = CFE_TBL_VALIDATION_FREE;
+}
+
+/*
+** Test function for skipping loads that match the active table contents
+*/
+void Test_CFE_TBL_ReloadIfChanged(void)
+{
+    CFE_TBL_Handle_t       SnglTblHandle;
+    CFE_TBL_Handle_t       DblTblHandle;
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+    UT_Table1_t            TestTable1;
+    UT_Table1_t            TestTable2;
+    char                   ExpectedSource[OS_MAX_PATH_LEN];
+
+    memset(&TestTable1, 0, sizeof(TestTable1));
+    memset(&TestTable2, 0, sizeof(TestTable2));
+
+    UtPrintf("Begin Test Reload If Changed");
+
+    /* Test setup - register and perform the initial load of a single buffered table */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_1);
+    UT_ResetTableRegistry();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&SnglTblHandle, "UT_Table1", sizeof(UT_Table1_t),
+                                          CFE_TBL_OPT_DEFAULT | CFE_TBL_OPT_RELOAD_IF_CHANGED,
+                                          Test_CFE_TBL_ValidationFunc));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(SnglTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    RegRecPtr = &CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[SnglTblHandle].RegIndex];
+    UtAssert_BOOL_TRUE(RegRecPtr->ReloadIfChanged);
+
+    /* Test that loading the active contents again is neither validated nor activated */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(SnglTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    CFE_UtAssert_EVENTSENT(CFE_TBL_LOAD_UNCHANGED_INF_EID);
+    CFE_UtAssert_EVENTNOTSENT(CFE_TBL_LOAD_SUCCESS_INF_EID);
+    CFE_UtAssert_EVENTCOUNT(1);
+    UtAssert_STUB_COUNT(Test_CFE_TBL_ValidationFunc, 0);
+    UtAssert_INT32_EQ(RegRecPtr->LoadInProgress, CFE_TBL_NO_LOAD_IN_PROGRESS);
+
+    /* Test that contents which differ from the active contents are loaded
+     * even when their CRC matches
+     */
+    UT_InitData();
+    TestTable1.TblElement1 = 1;
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(SnglTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    CFE_UtAssert_EVENTSENT(CFE_TBL_LOAD_SUCCESS_INF_EID);
+    CFE_UtAssert_EVENTNOTSENT(CFE_TBL_LOAD_UNCHANGED_INF_EID);
+    UtAssert_STUB_COUNT(Test_CFE_TBL_ValidationFunc, 1);
+
+    /* Test that contents whose CRC differs are loaded without comparing them */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(SnglTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    CFE_UtAssert_EVENTSENT(CFE_TBL_LOAD_SUCCESS_INF_EID);
+    UtAssert_STUB_COUNT(Test_CFE_TBL_ValidationFunc, 1);
+
+    /* Test setup - register and perform the initial load of a double buffered table */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&DblTblHandle, "UT_Table2", sizeof(UT_Table1_t),
+                                          CFE_TBL_OPT_DBL_BUFFER | CFE_TBL_OPT_RELOAD_IF_CHANGED,
+                                          Test_CFE_TBL_ValidationFunc));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(DblTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable2));
+    RegRecPtr = &CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[DblTblHandle].RegIndex];
+
+    /* Test that identical contents from a new source are credited to the
+     * active buffer and leave the inactive buffer clean
+     */
+    UT_InitData();
+    memset(&TestTable1, 0, sizeof(TestTable1));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(DblTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    CFE_UtAssert_EVENTSENT(CFE_TBL_LOAD_UNCHANGED_INF_EID);
+    UtAssert_STUB_COUNT(Test_CFE_TBL_ValidationFunc, 0);
+    UtAssert_INT32_EQ(RegRecPtr->LoadInProgress, CFE_TBL_NO_LOAD_IN_PROGRESS);
+    UtAssert_UINT32_EQ(RegRecPtr->DirtyNumBytes, 0);
+    snprintf(ExpectedSource, sizeof(ExpectedSource), "Addr 0x%08lX", (unsigned long)&TestTable1);
+    UtAssert_StrCmp(RegRecPtr->LastFileLoaded, ExpectedSource, "LastFileLoaded (%s)", RegRecPtr->LastFileLoaded);
+    UtAssert_StrCmp(RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].DataSource, ExpectedSource,
+                    "Active DataSource (%s)", RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].DataSource);
+
+    /* Test that a table registered without the option is always reloaded */
+    UT_InitData();
+    RegRecPtr->ReloadIfChanged = false;
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(DblTblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    CFE_UtAssert_EVENTSENT(CFE_TBL_LOAD_SUCCESS_INF_EID);
+    UtAssert_STUB_COUNT(Test_CFE_TBL_ValidationFunc, 1);
+}
+
+/*
+** Test multi-buffered tables
+*/
+void Test_CFE_TBL_MultiBuffer(void)
+{
+    CFE_TBL_Handle_t       App1TblHandle;
+    CFE_TBL_Handle_t       App2TblHandle;
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+    UT_Table1_t            TestTable;
+    void *                 App1TblPtr;
+    void *                 App2TblPtr;
+    void *                 SpareBufferPtr;
+    CFE_TBL_RegistryRec_t  RegRec;
+    uint8                  Buffers[3][sizeof(UT_Table1_t)];
+    uint32                 i;
+
+    memset(&TestTable, 0, sizeof(TestTable));
+
+    UtPrintf("Begin Test Multi-Buffered Tables");
+
+    /* Test that a dump only table cannot be multi-buffered */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_1);
+    UT_ResetTableRegistry();
+    UtAssert_INT32_EQ(CFE_TBL_Register(&App1TblHandle, "UT_Table1", sizeof(UT_Table1_t),
+                                       CFE_TBL_OPT_MULTI_BUFFER | CFE_TBL_OPT_DUMP_ONLY, NULL),
+                      CFE_TBL_ERR_INVALID_OPTIONS);
+
+    /* Test response to a failure allocating a spare buffer */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 3, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(
+        CFE_TBL_Register(&App1TblHandle, "UT_Table1", sizeof(UT_Table1_t), CFE_TBL_OPT_MULTI_BUFFER, NULL),
+        CFE_ES_ERR_MEM_BLOCK_SIZE);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_REGISTER_ERR_EID);
+
+    /* Test successful registration and initial load of a multi-buffered table */
+    UT_InitData();
+    UT_ResetTableRegistry();
+    CFE_UtAssert_SUCCESS(
+        CFE_TBL_Register(&App1TblHandle, "UT_Table1", sizeof(UT_Table1_t), CFE_TBL_OPT_MULTI_BUFFER, NULL));
+    RegRecPtr = &CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[App1TblHandle].RegIndex];
+    UtAssert_BOOL_TRUE(RegRecPtr->DoubleBuffered);
+    UtAssert_BOOL_TRUE(RegRecPtr->MultiBuffered);
+    UtAssert_NOT_NULL(RegRecPtr->SpareBufferPtr[0]);
+    SpareBufferPtr = RegRecPtr->SpareBufferPtr[0];
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(App1TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable));
+
+    /* Test that loads continue while a reader holds on to an old image */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_TBL_GetAddress(&App1TblPtr, App1TblHandle), CFE_TBL_INFO_UPDATED);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(App1TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(App1TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable));
+    UtAssert_ADDRESS_EQ(RegRecPtr->SpareBufferPtr[0], App1TblPtr);
+    UtAssert_ADDRESS_EQ(RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr, SpareBufferPtr);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(App1TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(App1TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable));
+    UtAssert_ADDRESS_EQ(RegRecPtr->SpareBufferPtr[0], App1TblPtr);
+
+    /* Test that a load fails once every buffer but the active one is held */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_2);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Share(&App2TblHandle, "ut_cfe_tbl.UT_Table1"));
+    UtAssert_INT32_EQ(CFE_TBL_GetAddress(&App2TblPtr, App2TblHandle), CFE_TBL_INFO_UPDATED);
+    UT_SetAppID(UT_TBL_APPID_1);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(App1TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable));
+    UtAssert_INT32_EQ(CFE_TBL_Load(App1TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable), CFE_TBL_ERR_NO_BUFFER_AVAIL);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_NO_WORK_BUFFERS_ERR_EID);
+
+    /* Test that a released image is recycled as a spare */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_ReleaseAddress(App1TblHandle));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(App1TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable));
+    UtAssert_ADDRESS_EQ(RegRecPtr->SpareBufferPtr[0], App2TblPtr);
+    UtAssert_ADDRESS_EQ(RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr, App1TblPtr);
+
+    /* Test that the spare buffers are released with the table */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_2);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(App2TblHandle));
+    UT_SetAppID(UT_TBL_APPID_1);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(App1TblHandle));
+    UtAssert_NULL(RegRecPtr->SpareBufferPtr[0]);
+
+    /* Test that spare slots that hold no buffer are skipped when the inactive buffer is held */
+    UT_InitData();
+    memset(&RegRec, 0, sizeof(RegRec));
+    RegRec.Size                               = sizeof(UT_Table1_t);
+    RegRec.ActiveBufferIndex                  = 0;
+    RegRec.Buffers[0].BufferPtr               = Buffers[0];
+    RegRec.Buffers[1].BufferPtr               = Buffers[1];
+    RegRec.HeadOfAccessList                   = 0;
+    CFE_TBL_Global.Handles[0].PinnedEpoch     = 1;
+    CFE_TBL_Global.Handles[0].PinnedBufferPtr = Buffers[1];
+    CFE_TBL_Global.Handles[0].NextLink        = CFE_TBL_END_OF_LIST;
+    for (i = 0; i < CFE_TBL_NUM_SPARE_BUFFERS; i++)
+    {
+        RegRec.SpareBufferPtr[i] = NULL;
+    }
+    UtAssert_INT32_EQ(CFE_TBL_SwapInSpareBuffer(&RegRec), CFE_TBL_ERR_NO_BUFFER_AVAIL);
+    UtAssert_ADDRESS_EQ(RegRec.Buffers[1].BufferPtr, Buffers[1]);
+    RegRec.SpareBufferPtr[CFE_TBL_NUM_SPARE_BUFFERS - 1] = Buffers[2];
+    CFE_UtAssert_SUCCESS(CFE_TBL_SwapInSpareBuffer(&RegRec));
+    UtAssert_ADDRESS_EQ(RegRec.Buffers[1].BufferPtr, Buffers[2]);
+    UtAssert_ADDRESS_EQ(RegRec.SpareBufferPtr[CFE_TBL_NUM_SPARE_BUFFERS - 1], Buffers[1]);
+
+    UT_ResetTableRegistry();
+}
+
+/*
+** Test the registry free lists, name index and per-application handle lists
+*/
+void Test_CFE_TBL_RegistryIndex(void)
+{
+    CFE_TBL_Handle_t App1TblHandle1;
+    CFE_TBL_Handle_t App1TblHandle2;
+    CFE_TBL_Handle_t App1TblHandle3;
+    CFE_TBL_Handle_t App2TblHandle1;
+    int16            RegIndx1;
+    int16            RegIndx2;
+    uint32           App1Index;
+    uint32           App2Index;
+
+    UtPrintf("Begin Test Registry Index");
+
+    CFE_ES_AppID_ToIndex(UT_TBL_APPID_1, &App1Index);
+    CFE_ES_AppID_ToIndex(UT_TBL_APPID_2, &App2Index);
+
+    /* Test that the name index buckets are stable and in range */
+    UtAssert_UINT32_EQ(CFE_TBL_NameIndexBucket("ut_cfe_tbl.UT_Table1"),
+                       CFE_TBL_NameIndexBucket("ut_cfe_tbl.UT_Table1"));
+    UtAssert_UINT32_LT(CFE_TBL_NameIndexBucket("ut_cfe_tbl.UT_Table1"), CFE_PLATFORM_TBL_MAX_NUM_TABLES);
+
+    /* Test setup - register two tables for one application */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_1);
+    UT_ResetTableRegistry();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&App1TblHandle1, "UT_Table1", sizeof(UT_Table1_t), CFE_TBL_OPT_DEFAULT,
+                                          Test_CFE_TBL_ValidationFunc));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&App1TblHandle2, "UT_Table2", sizeof(UT_Table1_t), CFE_TBL_OPT_DEFAULT,
+                                          Test_CFE_TBL_ValidationFunc));
+    RegIndx1 = CFE_TBL_Global.Handles[App1TblHandle1].RegIndex;
+    RegIndx2 = CFE_TBL_Global.Handles[App1TblHandle2].RegIndex;
+
+    /* Test that registered tables are found by name and their handles are listed for the application */
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table1"), RegIndx1);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table2"), RegIndx2);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table3"), CFE_TBL_NOT_FOUND);
+    UtAssert_INT32_EQ(CFE_TBL_Global.Index.AppHandleHead[App1Index], App1TblHandle2);
+    UtAssert_INT32_EQ(CFE_TBL_Global.Index.AppNextHandle[App1TblHandle2], App1TblHandle1);
+    UtAssert_INT32_EQ(CFE_TBL_Global.Index.AppNextHandle[App1TblHandle1], CFE_TBL_END_OF_LIST);
+
+    /* Test that unregistering returns the entry and handle to the front of the free lists */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(App1TblHandle1));
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table1"), CFE_TBL_NOT_FOUND);
+    UtAssert_INT32_EQ(CFE_TBL_Global.Index.FreeEntryHead, RegIndx1);
+    UtAssert_INT32_EQ(CFE_TBL_Global.Index.FreeHandleHead, App1TblHandle1);
+    UtAssert_INT32_EQ(CFE_TBL_Global.Index.AppHandleHead[App1Index], App1TblHandle2);
+    UtAssert_INT32_EQ(CFE_TBL_Global.Index.AppNextHandle[App1TblHandle2], CFE_TBL_END_OF_LIST);
+
+    /* Test that the freed entry and handle are reused first */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&App1TblHandle3, "UT_Table3", sizeof(UT_Table1_t), CFE_TBL_OPT_DEFAULT,
+                                          Test_CFE_TBL_ValidationFunc));
+    UtAssert_INT32_EQ(App1TblHandle3, App1TblHandle1);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table3"), RegIndx1);
+
+    /* Test that cleaning up one application leaves the entries still shared by another */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_2);
+    CFE_UtAssert_SUCCESS(CFE_TBL_Share(&App2TblHandle1, "ut_cfe_tbl.UT_Table2"));
+    UtAssert_INT32_EQ(CFE_TBL_Global.Index.AppHandleHead[App2Index], App2TblHandle1);
+    CFE_UtAssert_SUCCESS(CFE_TBL_CleanUpApp(UT_TBL_APPID_1));
+    UtAssert_INT32_EQ(CFE_TBL_Global.Index.AppHandleHead[App1Index], CFE_TBL_END_OF_LIST);
+    UtAssert_INT32_EQ(CFE_TBL_Global.Index.FreeEntryHead, RegIndx1);
+    UtAssert_INT32_EQ(CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table2"), CFE_TBL_NOT_FOUND);
+
+    /* Test that the last application to let go of a table frees its entry */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_CleanUpApp(UT_TBL_APPID_2));
+    UtAssert_INT32_EQ(CFE_TBL_Global.Index.AppHandleHead[App2Index], CFE_TBL_END_OF_LIST);
+    UtAssert_INT32_EQ(CFE_TBL_Global.Index.FreeEntryHead, RegIndx2);
+
+    /* Test that entries taken without going through the free list are skipped */
+    UT_InitData();
+    CFE_TBL_Global.Registry[RegIndx2].OwnerAppId = UT_TBL_APPID_3;
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeRegistryEntry(), RegIndx1);
+    CFE_TBL_Global.Handles[CFE_TBL_Global.Index.FreeHandleHead].UsedFlag = true;
+    UtAssert_INT32_NEQ(CFE_TBL_FindFreeHandle(), CFE_TBL_END_OF_LIST);
+    UtAssert_BOOL_FALSE(CFE_TBL_Global.Handles[CFE_TBL_FindFreeHandle()].UsedFlag);
+
+    /* Test that the registry and handles are still searched when the free lists are empty */
+    UT_InitData();
+    UT_ResetTableRegistry();
+    CFE_TBL_Global.Registry[0].OwnerAppId = UT_TBL_APPID_3;
+    CFE_TBL_Global.Handles[0].UsedFlag    = true;
+    CFE_TBL_Global.Index.FreeEntryHead    = CFE_TBL_NOT_FOUND;
+    CFE_TBL_Global.Index.FreeHandleHead   = CFE_TBL_END_OF_LIST;
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeRegistryEntry(), 1);
+    UtAssert_INT32_EQ(CFE_TBL_FindFreeHandle(), 1);
+
+    UT_ResetTableRegistry();
+}
+
 /*
 ** Test function executed when the contents of a table need to be validated
 */
@@ -199,21 +199,6 @@ void Test_CFE_TBL_AbortLoadCmd(void);
 ******************************************************************************/
 void Test_CFE_TBL_ActivateCmd(void);
 
-/*****************************************************************************/
-/**
-** \brief Test the write table data to a file function
-**
-** \par Description
-**        This function tests the write table data to a file function.
-**
-** \par Assumptions, External Events, and Notes:
-**        None
-**
-** \returns
-**        This function does not return a value.
-******************************************************************************/
-void Test_CFE_TBL_DumpToFile(void);
-
 /*****************************************************************************/
 /**
 ** \brief Test the processing reset counters command message function
@@ -361,6 +346,23 @@ void Test_CFE_TBL_LoadCmd(void);
 ******************************************************************************/
 void Test_CFE_TBL_HousekeepingCmd(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the background file writer callbacks used for table dumps
+**
+** \par Description
+**        This function tests queueing a table dump with the background file
+**        writer, the data getter and event callbacks, and the pinning of the
+**        table buffer being dumped.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_BackgroundDump(void);
+
 /*****************************************************************************/
 /**
 ** \brief Prepare for test table API functions
@@ -563,6 +565,22 @@ void Test_CFE_TBL_Validate(void);
 ******************************************************************************/
 void Test_CFE_TBL_Manage(void);
 
+/*****************************************************************************/
+/**
+** \brief Test function for managing all of an application's tables at once
+**
+** \par Description
+**        This function tests the function for servicing the pending requests
+**        on all of the tables owned by an application.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_ManageAll(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function for dumping to a buffer
@@ -629,6 +647,22 @@ void Test_CFE_TBL_GetStatus(void);
 ******************************************************************************/
 void Test_CFE_TBL_GetInfo(void);
 
+/*****************************************************************************/
+/**
+** \brief Test function that returns the range changed by a pending load
+**
+** \par Description
+**        This function tests the function that returns the range of a table
+**        changed by a pending load.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_GetLoadRange(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function that loads a specified table with data from the
@@ -661,6 +695,91 @@ void Test_CFE_TBL_TblMod(void);
 ******************************************************************************/
 void Test_CFE_TBL_Internal(void);
 
+/*****************************************************************************/
+/**
+** \brief Test copying active table contents into a partially loaded
+**        working buffer
+**
+** \par Description
+**        This function tests that only the parts of the table not covered
+**        by a load are copied into the working buffer, and only once.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_PrefillWorkingBuffer(void);
+
+/*****************************************************************************/
+/**
+** \brief Test function for validating tables on the validation worker tasks
+**
+** \par Description
+**        This function tests handing validation requests to the Table
+**        Services validation worker tasks and their processing.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_ValidationWorkers(void);
+
+/*****************************************************************************/
+/**
+** \brief Test function for skipping loads that match the active table contents
+**
+** \par Description
+**        This function tests that loads of tables registered with
+**        #CFE_TBL_OPT_RELOAD_IF_CHANGED are skipped only when the loaded
+**        image is identical to the active table contents.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_ReloadIfChanged(void);
+
+/*****************************************************************************/
+/**
+** \brief Test function for the table registry free lists and name index
+**
+** \par Description
+**        This function tests that registry entries and handles are recycled
+**        through their free lists, that tables are found through the name
+**        index, and that application cleanup walks only the application's
+**        own handles.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_RegistryIndex(void);
+
+/*****************************************************************************/
+/**
+** \brief Test function for multi-buffered tables
+**
+** \par Description
+**        This function tests that tables registered with
+**        #CFE_TBL_OPT_MULTI_BUFFER keep accepting loads while readers hold
+**        older images, and that released images are recycled.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_MultiBuffer(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function executed when the contents of a table need to be
@@ -84,6 +84,10 @@
 **       - Local 1 Hz Interrupt Counter (\TIME_1HZISRCNT)
 **       - Local 1 Hz Task Counter (\TIME_1HZTASKCNT)
 **       - Reference Time Version Counter (\TIME_VERSIONCNT)
+**       and clears the tone interval statistics (\TIME_TONEINTCNT and related)
+**       and the tone to data latch histogram (\TIME_TONEHIST) within the Time
+**       Services \link CFE_TIME_ToneStatsTlm_t Tone Statistics Telemetry \endlink.
+**       The local clock drift estimate (\TIME_DRIFTRATE) is not reset.
 **
 **  \cfecmdmnemonic \TIME_RESETCTRS
 **
@@ -117,7 +121,9 @@
 **       containing various data values not included in the normal Time
 **       Service housekeeping message.  The command requests only a single
 **       copy of the diagnostic message.  Refer to #CFE_TIME_DiagnosticTlm_t for
-**       a description of the Time Service diagnostic message contents.
+**       a description of the Time Service diagnostic message contents.  A
+**       single copy of the tone statistics message (#CFE_TIME_ToneStatsTlm_t)
+**       is sent along with it.
 **
 **  \cfecmdmnemonic \TIME_REQUESTDIAG
 **
@@ -129,6 +135,7 @@
 **       following telemetry:
 **       - \b \c \TIME_CMDPC - command execution counter will increment
 **       - Sequence Counter for #CFE_TIME_DiagnosticTlm_t will increment
+**       - Sequence Counter for #CFE_TIME_ToneStatsTlm_t will increment
 **       - The #CFE_TIME_DIAG_EID debug event message will be generated
 **
 **  \par Error Conditions
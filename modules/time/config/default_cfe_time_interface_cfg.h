@@ -113,6 +113,21 @@
 #define CFE_MISSION_TIME_MIN_ELAPSED 0
 #define CFE_MISSION_TIME_MAX_ELAPSED 200000
 
+/**
+**  \cfetimecfg Tone to Data Latch Histogram Size
+**
+**  \par Description:
+**      Number of bins in the histogram of the local clock delta between the
+**      tone signal and the matching time at the tone data packet, reported in
+**      the tone statistics packet.  Bin 0 counts deltas below one micro-second
+**      and bin N counts deltas of 2^(N-1) to 2^N - 1 micro-seconds, with the
+**      last bin also counting every larger delta.
+**
+**  \par Limits
+**       2 to 32 decimal
+*/
+#define CFE_MISSION_TIME_TONE_HIST_BINS 20
+
 /**
 **  \cfetimecfg Default Time Values
 **
@@ -204,6 +204,73 @@
 */
 #define CFE_PLATFORM_TIME_CFG_LATCH_FLY 8
 
+/**
+**  \cfetimecfg Define TIME Drift Correction
+**
+**  \par Description:
+**       When true, a time server estimates the drift rate of its local clock
+**       from the measured interval between valid tone signals and, while it is
+**       flywheeling, cancels that drift by applying an equal and opposite 1Hz
+**       STCF adjustment.  TIME owns the 1Hz adjustment while the correction is
+**       active and clears it again when the tone is reacquired, so a commanded
+**       1Hz adjustment made during flywheel is superseded.
+**
+**  \par Limits
+**       Must be false unless #CFE_PLATFORM_TIME_CFG_SERVER is true.
+*/
+#define CFE_PLATFORM_TIME_CFG_DRIFT_CORRECTION false
+
+/**
+**  \cfetimecfg Define TIME Minor Frame Rate
+**
+**  \par Description:
+**       Defines the number of minor frames in each one second major frame of the
+**       TIME minor frame scheduler.  Applications register with
+**       #CFE_TIME_RegisterFrameSem or #CFE_TIME_RegisterFrameMsg for a rate that
+**       divides this value and a phase within the resulting period, and are
+**       released at their minor frames as measured from the local clock latched
+**       at the most recent tone.
+**
+**  \par Limits
+**       This value may be zero, in which case the minor frame scheduler is not
+**       started.  Otherwise it must be no more than 1000, and the PSP must provide
+**       the "cFS-Master" OSAL time base used to drive it.
+*/
+#define CFE_PLATFORM_TIME_MINOR_FRAME_RATE 0
+
+/**
+**  \cfetimecfg Define TIME Timer Pool and Timer Wheel Sizes
+**
+**  \par Description:
+**       Defines the number of timers that applications may have started at once
+**       with #CFE_TIME_StartTimer and #CFE_TIME_StartTimerMsg, and the number of
+**       slots in the timer wheel that holds them.  The timer wheel advances one
+**       slot per minor frame, so a timer is only looked at by the minor frame
+**       child task in the minor frames that are a multiple of the number of slots
+**       away from its deadline.
+**
+**  \par Limits
+**       The number of timers must be between 1 and 65534.  The number of slots must
+**       be a power of two between 1 and 4096.  Timers are only available while the
+**       minor frame scheduler is running, see #CFE_PLATFORM_TIME_MINOR_FRAME_RATE.
+*/
+#define CFE_PLATFORM_TIME_MAX_TIMERS        128
+#define CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS 64
+
+/**
+**  \cfetimecfg Define TIME Synchronization Callback Registry Size
+**
+**  \par Description:
+**       Defines the number of time synchronization callbacks that may be registered
+**       at once with #CFE_TIME_RegisterSynchCallback and #CFE_TIME_RegisterSynchCallbackEx,
+**       shared by all applications.  An application may hold several of them.
+**
+**  \par Limits
+**       This value must be between 1 and 65534.  Every registered callback is looked at
+**       on each tone signal, so it should not be much larger than needed.
+*/
+#define CFE_PLATFORM_TIME_MAX_SYNCH_CALLBACKS 64
+
 /**
 **  \cfetimecfg Define TIME Task Priorities
 **
@@ -211,6 +278,8 @@
 **       Defines the cFE_TIME Task priority.
 **       Defines the cFE_TIME Tone Task priority.
 **       Defines the cFE_TIME 1HZ Task priority.
+**       Defines the cFE_TIME Minor Frame Task priority.
+**       Defines the cFE_TIME Synch Callback Task priority.
 **
 **  \par Limits
 **       There is a lower limit of zero and an upper limit of 255 on these
@@ -220,6 +289,8 @@
 #define CFE_PLATFORM_TIME_START_TASK_PRIORITY 60
 #define CFE_PLATFORM_TIME_TONE_TASK_PRIORITY  25
 #define CFE_PLATFORM_TIME_1HZ_TASK_PRIORITY   25
+#define CFE_PLATFORM_TIME_FRAME_TASK_PRIORITY 25
+#define CFE_PLATFORM_TIME_SYNCH_TASK_PRIORITY 40
 
 /**
 **  \cfetimecfg Define TIME Task Stack Sizes
@@ -228,6 +299,8 @@
 **       Defines the cFE_TIME Main Task Stack Size
 **       Defines the cFE_TIME Tone Task Stack Size
 **       Defines the cFE_TIME 1HZ Task Stack Size
+**       Defines the cFE_TIME Minor Frame Task Stack Size
+**       Defines the cFE_TIME Synch Callback Task Stack Size
 **
 **  \par Limits
 **       There is a lower limit of 2048 on these configuration parameters.  There
@@ -239,5 +312,7 @@
 #define CFE_PLATFORM_TIME_START_TASK_STACK_SIZE CFE_PLATFORM_ES_DEFAULT_STACK_SIZE
 #define CFE_PLATFORM_TIME_TONE_TASK_STACK_SIZE  4096
 #define CFE_PLATFORM_TIME_1HZ_TASK_STACK_SIZE   8192
+#define CFE_PLATFORM_TIME_FRAME_TASK_STACK_SIZE 4096
+#define CFE_PLATFORM_TIME_SYNCH_TASK_STACK_SIZE 8192
 
 #endif
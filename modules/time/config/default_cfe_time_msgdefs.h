@@ -333,4 +333,40 @@ typedef struct CFE_TIME_DiagnosticTlm_Payload
                                        \brief Data Store status (preserved across processor reset) */
 } CFE_TIME_DiagnosticTlm_Payload_t;
 
+/*************************************************************************/
+
+/**
+**  \cfetimetlm Time Services Tone Statistics Packet
+**/
+typedef struct CFE_TIME_ToneStatsTlm_Payload
+{
+    /*
+     ** Interval between valid tone signals, measured with the local clock...
+     */
+    uint32 ToneIntervalCount;  /**< \cfetlmmnemonic \TIME_TONEINTCNT
+                                    \brief Tone intervals measured since last counter reset */
+    uint32 ToneIntervalMin;    /**< \cfetlmmnemonic \TIME_TONEINTMIN
+                                    \brief Shortest tone interval (micro-seconds) */
+    uint32 ToneIntervalMax;    /**< \cfetlmmnemonic \TIME_TONEINTMAX
+                                    \brief Longest tone interval (micro-seconds) */
+    uint32 ToneIntervalMean;   /**< \cfetlmmnemonic \TIME_TONEINTMEAN
+                                    \brief Mean tone interval (micro-seconds) */
+    uint32 ToneIntervalStdDev; /**< \cfetlmmnemonic \TIME_TONEINTSDEV
+                                    \brief Standard deviation of the tone interval (micro-seconds) */
+
+    /*
+     ** Local clock drift relative to the tone...
+     */
+    int32 DriftRate;              /**< \cfetlmmnemonic \TIME_DRIFTRATE
+                                       \brief Estimated local clock drift (parts per billion, positive is fast) */
+    uint32 DriftCorrectionActive; /**< \cfetlmmnemonic \TIME_DRIFTCORR
+                                       \brief Drift is being cancelled by the 1Hz STCF adjustment */
+
+    /*
+     ** Local clock delta between tone signal and time at the tone data packet...
+     */
+    uint32 ToneLatchHistogram[CFE_MISSION_TIME_TONE_HIST_BINS]; /**< \cfetlmmnemonic \TIME_TONEHIST
+                                                                     \brief Tone to data latch delta, log2 micro-second bins */
+} CFE_TIME_ToneStatsTlm_Payload_t;
+
 #endif
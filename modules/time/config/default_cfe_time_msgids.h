@@ -45,5 +45,6 @@
 */
 #define CFE_TIME_HK_TLM_MID   CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_TIME_HK_TLM_MSG   /* 0x0805 */
 #define CFE_TIME_DIAG_TLM_MID CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_TIME_DIAG_TLM_MSG /* 0x0806 */
+#define CFE_TIME_TONE_TLM_MID CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_TIME_TONE_TLM_MSG /* 0x0807 */
 
 #endif
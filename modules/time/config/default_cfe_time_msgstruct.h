@@ -201,4 +201,10 @@ typedef struct CFE_TIME_DiagnosticTlm
     CFE_TIME_DiagnosticTlm_Payload_t Payload;         /**< \brief Telemetry payload */
 } CFE_TIME_DiagnosticTlm_t;
 
+typedef struct CFE_TIME_ToneStatsTlm
+{
+    CFE_MSG_TelemetryHeader_t       TelemetryHeader; /**< \brief Telemetry header */
+    CFE_TIME_ToneStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_TIME_ToneStatsTlm_t;
+
 #endif
@@ -60,5 +60,6 @@
 */
 #define CFE_MISSION_TIME_HK_TLM_MSG   5
 #define CFE_MISSION_TIME_DIAG_TLM_MSG 6
+#define CFE_MISSION_TIME_TONE_TLM_MSG 7
 
 #endif
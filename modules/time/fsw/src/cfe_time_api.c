@@ -34,6 +34,29 @@
 
 #include <string.h>
 
+/*
+** Days from Jan 1 of the epoch year to Jan 1 of the epoch year plus N...
+**
+** The leap year count is a constant expression of the configured epoch, so
+** the table below is built entirely at compile time.  It covers every year
+** that can be reached from the epoch with 32 bits of seconds.
+*/
+#define CFE_TIME_LEAP_YEARS_THRU(Year) (((Year) / 4) - ((Year) / 100) + ((Year) / 400))
+#define CFE_TIME_DAYS_BEFORE_YEAR(N)                                                  \
+    ((365 * (N)) + CFE_TIME_LEAP_YEARS_THRU(CFE_MISSION_TIME_EPOCH_YEAR + (N)-1) - \
+     CFE_TIME_LEAP_YEARS_THRU(CFE_MISSION_TIME_EPOCH_YEAR - 1))
+#define CFE_TIME_DAYS_BEFORE_YEAR_4(N)                                                                   \
+    CFE_TIME_DAYS_BEFORE_YEAR(N), CFE_TIME_DAYS_BEFORE_YEAR((N) + 1), CFE_TIME_DAYS_BEFORE_YEAR((N) + 2), \
+        CFE_TIME_DAYS_BEFORE_YEAR((N) + 3)
+#define CFE_TIME_DAYS_BEFORE_YEAR_16(N)                                                          \
+    CFE_TIME_DAYS_BEFORE_YEAR_4(N), CFE_TIME_DAYS_BEFORE_YEAR_4((N) + 4),                        \
+        CFE_TIME_DAYS_BEFORE_YEAR_4((N) + 8), CFE_TIME_DAYS_BEFORE_YEAR_4((N) + 12)
+
+static const uint32 CFE_TIME_DaysBeforeYear[] = {
+    CFE_TIME_DAYS_BEFORE_YEAR_16(0),   CFE_TIME_DAYS_BEFORE_YEAR_16(16),  CFE_TIME_DAYS_BEFORE_YEAR_16(32),
+    CFE_TIME_DAYS_BEFORE_YEAR_16(48),  CFE_TIME_DAYS_BEFORE_YEAR_16(64),  CFE_TIME_DAYS_BEFORE_YEAR_16(80),
+    CFE_TIME_DAYS_BEFORE_YEAR_16(96),  CFE_TIME_DAYS_BEFORE_YEAR_16(112), CFE_TIME_DAYS_BEFORE_YEAR_16(128)};
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -65,25 +88,10 @@ CFE_TIME_SysTime_t CFE_TIME_GetTime(void)
  *-----------------------------------------------------------------*/
 CFE_TIME_SysTime_t CFE_TIME_GetTAI(void)
 {
-    CFE_TIME_Reference_t Reference;
-    CFE_TIME_SysTime_t   tai;
-
-    /* Zero out the Reference variable because we pass it into
-     * a function before using it
-     * */
-    memset(&Reference, 0, sizeof(CFE_TIME_Reference_t));
-
-    /*
-    ** Get reference time values (local time, time at tone, etc.)...
-    */
-    CFE_TIME_GetReference(&Reference);
-
     /*
-    ** Calculate current TAI...
+    ** Map the local clock directly onto TAI...
     */
-    tai = CFE_TIME_CalculateTAI(&Reference);
-
-    return tai;
+    return CFE_TIME_GetMappedTime(CFE_TIME_MAP_TAI);
 }
 
 /*----------------------------------------------------------------
@@ -94,24 +102,10 @@ CFE_TIME_SysTime_t CFE_TIME_GetTAI(void)
  *-----------------------------------------------------------------*/
 CFE_TIME_SysTime_t CFE_TIME_GetUTC(void)
 {
-    CFE_TIME_Reference_t Reference;
-    CFE_TIME_SysTime_t   utc;
-
-    /* Zero out the Reference variable because we pass it into
-     * a function before using it
-     * */
-    memset(&Reference, 0, sizeof(CFE_TIME_Reference_t));
     /*
-    ** Get reference time values (local time, time at tone, etc.)...
+    ** Map the local clock directly onto UTC...
     */
-    CFE_TIME_GetReference(&Reference);
-
-    /*
-    ** Calculate current UTC...
-    */
-    utc = CFE_TIME_CalculateUTC(&Reference);
-
-    return utc;
+    return CFE_TIME_GetMappedTime(CFE_TIME_MAP_UTC);
 }
 
 /*----------------------------------------------------------------
@@ -334,19 +328,10 @@ CFE_TIME_SysTime_t CFE_TIME_GetSTCF(void)
  *-----------------------------------------------------------------*/
 CFE_TIME_SysTime_t CFE_TIME_GetMET(void)
 {
-    CFE_TIME_Reference_t Reference;
-
-    /* Zero out the Reference variable because we pass it into
-     * a function before using it
-     */
-    memset(&Reference, 0, sizeof(CFE_TIME_Reference_t));
-
     /*
-    ** Get reference time values (local time, time at tone, etc.)...
+    ** Map the local clock directly onto MET...
     */
-    CFE_TIME_GetReference(&Reference);
-
-    return Reference.CurrentMET;
+    return CFE_TIME_GetMappedTime(CFE_TIME_MAP_MET);
 }
 
 /*----------------------------------------------------------------
@@ -357,19 +342,7 @@ CFE_TIME_SysTime_t CFE_TIME_GetMET(void)
  *-----------------------------------------------------------------*/
 uint32 CFE_TIME_GetMETseconds(void)
 {
-    CFE_TIME_Reference_t Reference;
-
-    /* Zero out the Reference variable because we pass it into
-     * a function before using it
-     * */
-    memset(&Reference, 0, sizeof(CFE_TIME_Reference_t));
-
-    /*
-    ** Get reference time values (local time, time at tone, etc.)...
-    */
-    CFE_TIME_GetReference(&Reference);
-
-    return Reference.CurrentMET.Seconds;
+    return CFE_TIME_GetMappedTime(CFE_TIME_MAP_MET).Seconds;
 }
 
 /*----------------------------------------------------------------
@@ -380,19 +353,7 @@ uint32 CFE_TIME_GetMETseconds(void)
  *-----------------------------------------------------------------*/
 uint32 CFE_TIME_GetMETsubsecs(void)
 {
-    CFE_TIME_Reference_t Reference;
-
-    /* Zero out the Reference variable because we pass it into
-     * a function before using it
-     * */
-    memset(&Reference, 0, sizeof(CFE_TIME_Reference_t));
-
-    /*
-    ** Get reference time values (local time, time at tone, etc.)...
-    */
-    CFE_TIME_GetReference(&Reference);
-
-    return Reference.CurrentMET.Subseconds;
+    return CFE_TIME_GetMappedTime(CFE_TIME_MAP_MET).Subseconds;
 }
 
 /*----------------------------------------------------------------
@@ -403,23 +364,10 @@ uint32 CFE_TIME_GetMETsubsecs(void)
  *-----------------------------------------------------------------*/
 CFE_TIME_SysTime_t CFE_TIME_Add(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Time2)
 {
-    CFE_TIME_SysTime_t Result;
-
-    Result.Subseconds = Time1.Subseconds + Time2.Subseconds;
-
     /*
-    ** Check for sub-seconds roll-over
+    ** Packed, the subseconds carry into the seconds without any roll-over check
     */
-    if (Result.Subseconds < Time1.Subseconds)
-    {
-        Result.Seconds = (Time1.Seconds + Time2.Seconds) + 1;
-    }
-    else
-    {
-        Result.Seconds = Time1.Seconds + Time2.Seconds;
-    }
-
-    return Result;
+    return CFE_TIME_Unpack(CFE_TIME_PackedAdd(CFE_TIME_Pack(Time1), CFE_TIME_Pack(Time2)));
 }
 
 /*----------------------------------------------------------------
@@ -430,20 +378,10 @@ CFE_TIME_SysTime_t CFE_TIME_Add(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Tim
  *-----------------------------------------------------------------*/
 CFE_TIME_SysTime_t CFE_TIME_Subtract(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Time2)
 {
-    CFE_TIME_SysTime_t Result;
-
-    Result.Subseconds = Time1.Subseconds - Time2.Subseconds;
-
-    if (Result.Subseconds > Time1.Subseconds)
-    {
-        Result.Seconds = (Time1.Seconds - Time2.Seconds) - 1;
-    }
-    else
-    {
-        Result.Seconds = Time1.Seconds - Time2.Seconds;
-    }
-
-    return Result;
+    /*
+    ** Packed, the subseconds borrow from the seconds without any roll-under check
+    */
+    return CFE_TIME_Unpack(CFE_TIME_PackedSubtract(CFE_TIME_Pack(Time1), CFE_TIME_Pack(Time2)));
 }
 
 /*----------------------------------------------------------------
@@ -514,16 +452,12 @@ CFE_TIME_Compare_t CFE_TIME_Compare(CFE_TIME_SysTime_t TimeA, CFE_TIME_SysTime_t
  *-----------------------------------------------------------------*/
 uint32 CFE_TIME_Sub2MicroSecs(uint32 SubSeconds)
 {
-    OS_time_t tm;
-
     /*
-    ** Convert using the OSAL method.  Note that there
-    ** is no range check here because any uint32 value is valid,
-    ** and OSAL will handle and properly convert any input.
+    ** A single multiply and shift, no range check is needed because
+    ** any uint32 value is valid and converts to less than one second.
+    ** This truncates the same way the OSAL conversion does.
     */
-    tm = OS_TimeAssembleFromSubseconds(0, SubSeconds);
-
-    return OS_TimeGetMicrosecondsPart(tm);
+    return (uint32)CFE_TIME_PackedToMicroSecs(SubSeconds);
 }
 
 /*----------------------------------------------------------------
@@ -557,6 +491,113 @@ uint32 CFE_TIME_Micro2SubSecs(uint32 MicroSeconds)
     return SubSeconds;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_GetConversionRef(CFE_TIME_ConversionRef_t *Ref)
+{
+    CFE_TIME_Reference_t Reference;
+
+    if (Ref == NULL)
+    {
+        return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    /* Zero out the Reference variable because we pass it into
+     * a function before using it
+     * */
+    memset(&Reference, 0, sizeof(CFE_TIME_Reference_t));
+
+    /*
+    ** Get reference time values (local time, time at tone, etc.)...
+    */
+    CFE_TIME_GetReference(&Reference);
+
+    Ref->STCF        = Reference.AtToneSTCF;
+    Ref->LeapSeconds = Reference.AtToneLeapSeconds;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_ConvertMETArray(const CFE_TIME_ConversionRef_t *Ref, uint32 Target,
+                                      const CFE_TIME_SysTime_t *METTimes, CFE_TIME_SysTime_t *Times, uint32 Count)
+{
+    CFE_TIME_Packed_t Offset;
+    CFE_TIME_Packed_t LeapSecs;
+    uint32            i;
+
+    if (Ref == NULL || METTimes == NULL || Times == NULL)
+    {
+        return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    /* TAI = MET + STCF, UTC = TAI - Leap Seconds */
+    Offset   = CFE_TIME_Pack(Ref->STCF);
+    LeapSecs = (CFE_TIME_Packed_t)(uint32)Ref->LeapSeconds << 32;
+
+    switch (Target)
+    {
+        case CFE_TIME_CONVERT_TO_SC:
+#if (CFE_MISSION_TIME_CFG_DEFAULT_TAI != true)
+            Offset = CFE_TIME_PackedSubtract(Offset, LeapSecs);
+#endif
+            break;
+
+        case CFE_TIME_CONVERT_TO_TAI:
+            break;
+
+        case CFE_TIME_CONVERT_TO_UTC:
+            Offset = CFE_TIME_PackedSubtract(Offset, LeapSecs);
+            break;
+
+        default:
+            return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    /*
+    ** Each element is read before it is written, so this works in place,
+    ** and the loop body has no branches so that it can be vectorized...
+    */
+    for (i = 0; i < Count; ++i)
+    {
+        Times[i] = CFE_TIME_Unpack(CFE_TIME_PackedAdd(CFE_TIME_Pack(METTimes[i]), Offset));
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_Sub2MicroSecsArray(const uint32 *SubSeconds, uint32 *MicroSeconds, uint32 Count)
+{
+    uint32 i;
+
+    if (SubSeconds == NULL || MicroSeconds == NULL)
+    {
+        return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    for (i = 0; i < Count; ++i)
+    {
+        MicroSeconds[i] = (uint32)CFE_TIME_PackedToMicroSecs(SubSeconds[i]);
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -571,9 +612,7 @@ void CFE_TIME_Print(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
     uint32 NumberOfMinutes;
     uint32 NumberOfSeconds;
     uint32 NumberOfMicros;
-    uint32 DaysInThisYear;
-
-    bool StillCountingYears = true;
+    uint32 DayCache;
 
     if (PrintBuffer == NULL)
     {
@@ -614,55 +653,37 @@ void CFE_TIME_Print(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
     NumberOfDays  = (NumberOfHours / 24) + (CFE_MISSION_TIME_EPOCH_DAY - 1);
     NumberOfHours = (NumberOfHours % 24);
 
-    NumberOfYears = CFE_MISSION_TIME_EPOCH_YEAR;
-
     /*
-    ** Convert total number of days into years and remainder days...
+    ** Time stamps tend to arrive in bursts from the same day, so check
+    **    the day converted by the previous call before using the table...
     */
-    while (StillCountingYears)
+    DayCache = CFE_TIME_Global.PrintDayCache;
+
+    if ((DayCache >> CFE_TIME_PRINT_CACHE_DAY_SHIFT) == (NumberOfDays + 1))
+    {
+        NumberOfYears = DayCache & CFE_TIME_PRINT_CACHE_YEAR_MASK;
+    }
+    else
     {
         /*
-        ** Set number of days in this year (leap year?)...
+        ** Every year has at least 365 days, so this is never less than the
+        **    actual year and is at most one year ahead of it...
         */
-        DaysInThisYear = 365;
-
-        if ((NumberOfYears % 4) == 0)
+        NumberOfYears = NumberOfDays / 365;
+        while (CFE_TIME_DaysBeforeYear[NumberOfYears] > NumberOfDays)
         {
-            if ((NumberOfYears % 100) != 0)
-            {
-                DaysInThisYear = 366;
-            }
-            else if ((NumberOfYears % 400) == 0)
-            {
-                DaysInThisYear = 366;
-            }
-            else
-            {
-                /* Do Nothing. Non-leap year. */
-            }
+            NumberOfYears--;
         }
 
-        /*
-        ** When we have less than a years worth of days, we're done...
-        */
-        if (NumberOfDays < DaysInThisYear)
-        {
-            StillCountingYears = false;
-        }
-        else
-        {
-            /*
-            ** Add a year and remove the number of days in that year...
-            */
-            NumberOfYears++;
-            NumberOfDays -= DaysInThisYear;
-        }
+        CFE_TIME_Global.PrintDayCache = ((NumberOfDays + 1) << CFE_TIME_PRINT_CACHE_DAY_SHIFT) | NumberOfYears;
     }
 
     /*
     ** Unlike hours and minutes, days are displayed as Jan 1 = day 1...
     */
+    NumberOfDays -= CFE_TIME_DaysBeforeYear[NumberOfYears];
     NumberOfDays++;
+    NumberOfYears += CFE_MISSION_TIME_EPOCH_YEAR;
 
     /*
     ** After computing microseconds, convert to 5 digits from 6 digits...
@@ -731,32 +752,87 @@ void CFE_TIME_ExternalTone(void)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_TIME_RegisterSynchCallback(CFE_TIME_SynchCallbackPtr_t CallbackFuncPtr)
 {
-    int32          Status;
-    CFE_ES_AppId_t AppId;
-    uint32         AppIndex;
+    CFE_TIME_SynchCallbackId_t SynchCallbackId;
 
-    if (CallbackFuncPtr == NULL)
+    return CFE_TIME_RegisterSynchCallbackEx(&SynchCallbackId, CallbackFuncPtr, 1, CFE_TIME_SYNCH_INLINE);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_RegisterSynchCallbackEx(CFE_TIME_SynchCallbackId_t *IdPtr,
+                                              CFE_TIME_SynchCallbackPtr_t CallbackFuncPtr, uint32 RateDivisor,
+                                              uint32 Options)
+{
+    int32                             Status;
+    CFE_ES_AppId_t                    AppId;
+    uint32                            Index;
+    CFE_TIME_SynchCallbackRegEntry_t *Entry;
+
+    if ((IdPtr == NULL) || (CallbackFuncPtr == NULL) || (RateDivisor == 0) ||
+        ((Options & ~CFE_TIME_SYNCH_DEFERRED) != 0))
     {
         return CFE_TIME_BAD_ARGUMENT;
     }
 
+    *IdPtr = CFE_TIME_SYNCHCALLBACKID_UNDEFINED;
+
     Status = CFE_ES_GetAppID(&AppId);
     if (Status == CFE_SUCCESS)
     {
-        Status = CFE_ES_AppID_ToIndex(AppId, &AppIndex);
+        CFE_TIME_LockSynchCallbacks();
 
-        if (Status == CFE_SUCCESS)
+        Entry = NULL;
+        for (Index = 0; Index < (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0]));
+             ++Index)
         {
-            if (AppIndex >= (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])) ||
-                CFE_TIME_Global.SynchCallback[AppIndex].Ptr != NULL)
+            if (CFE_TIME_Global.SynchCallback[Index].Ptr == NULL)
             {
-                Status = CFE_TIME_TOO_MANY_SYNCH_CALLBACKS;
+                Entry = &CFE_TIME_Global.SynchCallback[Index];
+                break;
             }
-            else
+        }
+
+        if (Entry == NULL)
+        {
+            Status = CFE_TIME_TOO_MANY_SYNCH_CALLBACKS;
+        }
+        else
+        {
+            ++Entry->Serial;
+            Entry->AppId = AppId;
+
+            memset(&Entry->Stats, 0, sizeof(Entry->Stats));
+            Entry->Stats.RateDivisor = RateDivisor;
+            Entry->Stats.Options     = Options;
+            Entry->RateDivisor       = RateDivisor;
+            Entry->Options           = Options;
+            Entry->Countdown         = 0;
+            Entry->Pending           = false;
+
+            /*
+            ** Publish the callback last, once the rest of the entry is set...
+            */
+            Entry->Ptr = CallbackFuncPtr;
+
+            /*
+            ** The low half of the ID is one more than the registry index, the high half the serial...
+            */
+            *IdPtr = ((CFE_TIME_SynchCallbackId_t)Entry->Serial << 16) | (Index + 1);
+
+            /*
+            ** The TIME main task starts the synch task on its next 1Hz command...
+            */
+            if ((Options & CFE_TIME_SYNCH_DEFERRED) != 0 && !CFE_RESOURCEID_TEST_DEFINED(CFE_TIME_Global.SynchTaskID))
             {
-                CFE_TIME_Global.SynchCallback[AppIndex].Ptr = CallbackFuncPtr;
+                CFE_TIME_Global.SynchTaskNeeded = true;
             }
         }
+
+        CFE_TIME_UnlockSynchCallbacks();
     }
 
     return Status;
@@ -770,15 +846,148 @@ CFE_Status_t CFE_TIME_RegisterSynchCallback(CFE_TIME_SynchCallbackPtr_t Callback
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_TIME_UnregisterSynchCallback(CFE_TIME_SynchCallbackPtr_t CallbackFuncPtr)
 {
-    int32          Status;
-    CFE_ES_AppId_t AppId;
-    uint32         AppIndex;
+    int32                             Status;
+    CFE_ES_AppId_t                    AppId;
+    uint32                            i;
+    CFE_TIME_SynchCallbackRegEntry_t *Entry;
 
     if (CallbackFuncPtr == NULL)
     {
         return CFE_TIME_BAD_ARGUMENT;
     }
 
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_TIME_CALLBACK_NOT_REGISTERED;
+
+        CFE_TIME_LockSynchCallbacks();
+
+        for (i = 0; i < (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])); ++i)
+        {
+            Entry = &CFE_TIME_Global.SynchCallback[i];
+
+            if (Entry->Ptr == CallbackFuncPtr && CFE_RESOURCEID_TEST_EQUAL(Entry->AppId, AppId))
+            {
+                Entry->Ptr = NULL;
+                Status     = CFE_SUCCESS;
+                break;
+            }
+        }
+
+        CFE_TIME_UnlockSynchCallbacks();
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_UnregisterSynchCallbackById(CFE_TIME_SynchCallbackId_t SynchCallbackId)
+{
+    int32                             Status;
+    CFE_ES_AppId_t                    AppId;
+    CFE_TIME_SynchCallbackRegEntry_t *Entry;
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_TIME_LockSynchCallbacks();
+
+        Entry = CFE_TIME_LocateSynchCallback(SynchCallbackId);
+        if (Entry == NULL || !CFE_RESOURCEID_TEST_EQUAL(Entry->AppId, AppId))
+        {
+            Status = CFE_TIME_CALLBACK_NOT_REGISTERED;
+        }
+        else
+        {
+            Entry->Ptr = NULL;
+        }
+
+        CFE_TIME_UnlockSynchCallbacks();
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_RegisterFrameSem(uint32 RateHz, uint32 Phase, osal_id_t SemId)
+{
+    int32                 Status;
+    CFE_TIME_FrameSlot_t *Slot;
+
+    if (!OS_ObjectIdDefined(SemId))
+    {
+        return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    Status = CFE_TIME_ClaimFrameSlot(RateHz, Phase, &Slot);
+    if (Status == CFE_SUCCESS)
+    {
+        Slot->SendMsg = false;
+        Slot->SemId   = SemId;
+
+        /*
+        ** Activate last, the scheduler may look at the slot at any time...
+        */
+        Slot->Active = true;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_RegisterFrameMsg(uint32 RateHz, uint32 Phase, CFE_SB_MsgId_t MsgId)
+{
+    int32                 Status;
+    CFE_TIME_FrameSlot_t *Slot;
+
+    if (!CFE_SB_IsValidMsgId(MsgId))
+    {
+        return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    Status = CFE_TIME_ClaimFrameSlot(RateHz, Phase, &Slot);
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_MSG_Init(CFE_MSG_PTR(Slot->WakeupCmd), MsgId, sizeof(Slot->WakeupCmd));
+        Slot->SendMsg = true;
+
+        /*
+        ** Activate last, the scheduler may look at the slot at any time...
+        */
+        Slot->Active = true;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_UnregisterFrameSlot(void)
+{
+    int32          Status;
+    CFE_ES_AppId_t AppId;
+    uint32         AppIndex;
+
     Status = CFE_ES_GetAppID(&AppId);
     if (Status == CFE_SUCCESS)
     {
@@ -786,14 +995,14 @@ CFE_Status_t CFE_TIME_UnregisterSynchCallback(CFE_TIME_SynchCallbackPtr_t Callba
 
         if (Status == CFE_SUCCESS)
         {
-            if (AppIndex >= (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])) ||
-                CFE_TIME_Global.SynchCallback[AppIndex].Ptr != CallbackFuncPtr)
+            if (AppIndex >= (sizeof(CFE_TIME_Global.FrameSlot) / sizeof(CFE_TIME_Global.FrameSlot[0])) ||
+                !CFE_TIME_Global.FrameSlot[AppIndex].Active)
             {
                 Status = CFE_TIME_CALLBACK_NOT_REGISTERED;
             }
             else
             {
-                CFE_TIME_Global.SynchCallback[AppIndex].Ptr = NULL;
+                CFE_TIME_Global.FrameSlot[AppIndex].Active = false;
             }
         }
     }
@@ -801,6 +1010,148 @@ CFE_Status_t CFE_TIME_UnregisterSynchCallback(CFE_TIME_SynchCallbackPtr_t Callba
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_GetSynchCallbackStats(CFE_TIME_SynchCallbackId_t     SynchCallbackId,
+                                            CFE_TIME_SynchCallbackStats_t *Stats)
+{
+    int32                             Status;
+    CFE_TIME_SynchCallbackRegEntry_t *Entry;
+
+    if (Stats == NULL)
+    {
+        return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    Entry = CFE_TIME_LocateSynchCallback(SynchCallbackId);
+    if (Entry == NULL)
+    {
+        Status = CFE_TIME_CALLBACK_NOT_REGISTERED;
+    }
+    else
+    {
+        *Stats = Entry->Stats;
+        Status = CFE_SUCCESS;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_GetFrameSlotStats(CFE_ES_AppId_t AppId, CFE_TIME_FrameSlotStats_t *Stats)
+{
+    int32  Status;
+    uint32 AppIndex;
+
+    if (Stats == NULL)
+    {
+        return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    Status = CFE_ES_AppID_ToIndex(AppId, &AppIndex);
+    if (Status == CFE_SUCCESS)
+    {
+        if (AppIndex >= (sizeof(CFE_TIME_Global.FrameSlot) / sizeof(CFE_TIME_Global.FrameSlot[0])) ||
+            !CFE_TIME_Global.FrameSlot[AppIndex].Active)
+        {
+            Status = CFE_TIME_CALLBACK_NOT_REGISTERED;
+        }
+        else
+        {
+            *Stats = CFE_TIME_Global.FrameSlot[AppIndex].Stats;
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_StartTimer(CFE_TIME_TimerId_t *TimerIdPtr, uint32 DeadlineType, CFE_TIME_SysTime_t Deadline,
+                                 CFE_TIME_SysTime_t Interval, CFE_TIME_TimerCallbackPtr_t CallbackPtr, void *Arg)
+{
+    if (CallbackPtr == NULL)
+    {
+        return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    return CFE_TIME_ArmTimer(TimerIdPtr, DeadlineType, Deadline, Interval, CallbackPtr, Arg, NULL);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_StartTimerMsg(CFE_TIME_TimerId_t *TimerIdPtr, uint32 DeadlineType, CFE_TIME_SysTime_t Deadline,
+                                    CFE_TIME_SysTime_t Interval, CFE_SB_MsgId_t MsgId)
+{
+    CFE_MSG_CommandHeader_t WakeupCmd;
+
+    if (!CFE_SB_IsValidMsgId(MsgId))
+    {
+        return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    CFE_MSG_Init(CFE_MSG_PTR(WakeupCmd), MsgId, sizeof(WakeupCmd));
+
+    return CFE_TIME_ArmTimer(TimerIdPtr, DeadlineType, Deadline, Interval, NULL, NULL, &WakeupCmd);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TIME_CancelTimer(CFE_TIME_TimerId_t TimerId)
+{
+    int32             Status;
+    uint32            Index;
+    CFE_TIME_Timer_t *Timer;
+
+    /*
+    ** The low half of the ID is one more than the pool index, the high half the serial...
+    */
+    Index = (TimerId & 0xFFFF) - 1;
+    if (CFE_TIME_Global.TimerCount == 0 || Index >= CFE_PLATFORM_TIME_MAX_TIMERS)
+    {
+        return CFE_TIME_TIMER_NOT_ACTIVE;
+    }
+
+    CFE_TIME_LockTimers();
+
+    Timer = &CFE_TIME_Global.Timer[Index];
+    if (Timer->State == CFE_TIME_TIMER_STATE_FREE || Timer->Serial != (uint16)(TimerId >> 16))
+    {
+        Status = CFE_TIME_TIMER_NOT_ACTIVE;
+    }
+    else
+    {
+        CFE_TIME_UnlinkTimer((uint16)Index);
+        CFE_TIME_FreeTimer((uint16)Index);
+        Status = CFE_SUCCESS;
+    }
+
+    CFE_TIME_UnlockTimers();
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
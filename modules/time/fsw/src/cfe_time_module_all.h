@@ -38,6 +38,7 @@
 #include "cfe_perfids.h"
 
 #include "cfe_time_core_internal.h"
+#include "cfe_core_trace.h"
 
 #include "cfe_time_msg.h"
 #include "cfe_time_eventids.h"
@@ -169,6 +169,56 @@ int32 CFE_TIME_TaskInit(void)
         return Status;
     }
 
+    /*
+    ** Minor frame scheduler child task sends the released wakeup messages...
+    */
+    if (CFE_TIME_Global.MinorFrameRate != 0)
+    {
+        OsStatus = OS_BinSemCreate(&CFE_TIME_Global.FrameSemaphore, CFE_TIME_SEM_FRAME_NAME, CFE_TIME_SEM_VALUE,
+                                   CFE_TIME_SEM_OPTIONS);
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Error creating minor frame semaphore:RC=%ld\n", __func__, (long)OsStatus);
+            return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+
+        OsStatus = OS_MutSemCreate(&CFE_TIME_Global.TimerMutex, CFE_TIME_MUT_TIMER_NAME, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Error creating timer mutex:RC=%ld\n", __func__, (long)OsStatus);
+            return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+
+        Status = CFE_ES_CreateChildTask(&CFE_TIME_Global.FrameTaskID, CFE_TIME_TASK_FRAME_NAME, CFE_TIME_FrameTask,
+                                        CFE_TIME_TASK_STACK_PTR, CFE_PLATFORM_TIME_FRAME_TASK_STACK_SIZE,
+                                        CFE_PLATFORM_TIME_FRAME_TASK_PRIORITY, CFE_TIME_TASK_FLAGS);
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Error creating minor frame child task:RC=0x%08X\n", __func__,
+                                 (unsigned int)Status);
+            return Status;
+        }
+    }
+
+    /*
+    ** Synch callback child task makes the deferred synch callback calls,
+    **    it is only created once a deferred callback is registered...
+    */
+    OsStatus = OS_BinSemCreate(&CFE_TIME_Global.SynchSemaphore, CFE_TIME_SEM_SYNCH_NAME, CFE_TIME_SEM_VALUE,
+                               CFE_TIME_SEM_OPTIONS);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Error creating synch callback semaphore:RC=%ld\n", __func__, (long)OsStatus);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    OsStatus = OS_MutSemCreate(&CFE_TIME_Global.SynchMutex, CFE_TIME_MUT_SYNCH_NAME, 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Error creating synch callback mutex:RC=%ld\n", __func__, (long)OsStatus);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
     Status = CFE_SB_CreatePipe(&CFE_TIME_Global.CmdPipe, CFE_TIME_TASK_PIPE_DEPTH, CFE_TIME_TASK_PIPE_NAME);
     if (Status != CFE_SUCCESS)
     {
@@ -302,6 +352,29 @@ int32 CFE_TIME_TaskInit(void)
         }
     }
 
+    /*
+    ** The minor frame scheduler is driven from the same time base.  Without
+    **    it, stop the scheduler so that registrations are rejected rather
+    **    than never released...
+    */
+    if (CFE_TIME_Global.MinorFrameRate != 0)
+    {
+        if (OsStatus == OS_SUCCESS)
+        {
+            OsStatus = OS_TimerAdd(&TimerId, "cFS-MinorFrame", TimeBaseId, CFE_TIME_MinorFrameTimerCallback, NULL);
+        }
+        if (OsStatus == OS_SUCCESS)
+        {
+            OsStatus = OS_TimerSet(TimerId, 1000000 / CFE_TIME_Global.MinorFrameRate,
+                                   1000000 / CFE_TIME_Global.MinorFrameRate);
+        }
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Minor frame scheduler not started:RC=%ld\n", __func__, (long)OsStatus);
+            CFE_TIME_Global.MinorFrameRate = 0;
+        }
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -399,6 +472,15 @@ int32 CFE_TIME_OneHzCmd(const CFE_TIME_1HzCmd_t *data)
      */
     CFE_TIME_Local1HzStateMachine();
 
+    /*
+    ** Child tasks can only be created by the main task of an app, so the
+    **    synch task is started here rather than by the registering app...
+    */
+    if (CFE_TIME_Global.SynchTaskNeeded)
+    {
+        CFE_TIME_StartSynchTask();
+    }
+
 #if (CFE_MISSION_TIME_CFG_FAKE_TONE == true)
     /*
     ** Fake the call-back from the "real" h/w ISR...
@@ -413,6 +495,40 @@ int32 CFE_TIME_OneHzCmd(const CFE_TIME_1HzCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TIME_StartSynchTask(void)
+{
+    int32 Status;
+
+    /*
+    ** Clear the request first, a failure is only retried by the next
+    **    deferred registration rather than on every 1Hz command...
+    */
+    CFE_TIME_Global.SynchTaskNeeded = false;
+
+    if (CFE_RESOURCEID_TEST_DEFINED(CFE_TIME_Global.SynchTaskID))
+    {
+        return CFE_SUCCESS;
+    }
+
+    Status = CFE_ES_CreateChildTask(&CFE_TIME_Global.SynchTaskID, CFE_TIME_TASK_SYNCH_NAME, CFE_TIME_SynchTask,
+                                    CFE_TIME_TASK_STACK_PTR, CFE_PLATFORM_TIME_SYNCH_TASK_STACK_SIZE,
+                                    CFE_PLATFORM_TIME_SYNCH_TASK_PRIORITY, CFE_TIME_TASK_FLAGS);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_TIME_Global.SynchTaskID = CFE_ES_TASKID_UNDEFINED;
+        CFE_ES_WriteToSysLog("%s: Error creating synch callback child task:RC=0x%08X\n", __func__,
+                             (unsigned int)Status);
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -458,6 +574,8 @@ int32 CFE_TIME_NoopCmd(const CFE_TIME_NoopCmd_t *data)
  *-----------------------------------------------------------------*/
 int32 CFE_TIME_ResetCountersCmd(const CFE_TIME_ResetCountersCmd_t *data)
 {
+    uint32 i;
+
     CFE_TIME_Global.CommandCounter      = 0;
     CFE_TIME_Global.CommandErrorCounter = 0;
 
@@ -483,6 +601,27 @@ int32 CFE_TIME_ResetCountersCmd(const CFE_TIME_ResetCountersCmd_t *data)
     CFE_TIME_Global.InternalCount = 0;
     CFE_TIME_Global.ExternalCount = 0;
 
+    CFE_TIME_Global.MinorFrameCounter     = 0;
+    CFE_TIME_Global.MinorFrameSkipCounter = 0;
+
+    for (i = 0; i < (sizeof(CFE_TIME_Global.FrameSlot) / sizeof(CFE_TIME_Global.FrameSlot[0])); ++i)
+    {
+        CFE_TIME_Global.FrameSlot[i].Stats.ReleaseCount     = 0;
+        CFE_TIME_Global.FrameSlot[i].Stats.OverrunCount     = 0;
+        CFE_TIME_Global.FrameSlot[i].Stats.LastJitterMicros = 0;
+        CFE_TIME_Global.FrameSlot[i].Stats.MaxJitterMicros  = 0;
+    }
+
+    for (i = 0; i < (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])); ++i)
+    {
+        CFE_TIME_Global.SynchCallback[i].Stats.CallCount      = 0;
+        CFE_TIME_Global.SynchCallback[i].Stats.OverrunCount   = 0;
+        CFE_TIME_Global.SynchCallback[i].Stats.LastExecMicros = 0;
+        CFE_TIME_Global.SynchCallback[i].Stats.MaxExecMicros  = 0;
+    }
+
+    CFE_TIME_ResetToneStats();
+
     CFE_EVS_SendEvent(CFE_TIME_RESET_EID, CFE_EVS_EventType_DEBUG, "Reset Counters command");
 
     return CFE_SUCCESS;
@@ -509,6 +648,14 @@ int32 CFE_TIME_SendDiagnosticTlm(const CFE_TIME_SendDiagnosticCmd_t *data)
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_TIME_Global.DiagPacket.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_TIME_Global.DiagPacket.TelemetryHeader), true);
 
+    /*
+    ** Send tone statistics telemetry packet along with it...
+    */
+    CFE_TIME_GetToneStatsData();
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_TIME_Global.ToneStatsPacket.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_TIME_Global.ToneStatsPacket.TelemetryHeader), true);
+
     CFE_EVS_SendEvent(CFE_TIME_DIAG_EID, CFE_EVS_EventType_DEBUG, "Request diagnostics command");
 
     return CFE_SUCCESS;
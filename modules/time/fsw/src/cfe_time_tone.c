@@ -693,6 +693,8 @@ void CFE_TIME_ToneVerify(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Time2)
     if (result == CFE_TIME_EQUAL)
     {
         CFE_TIME_Global.ToneMatchErrorCounter++;
+
+        CFE_TRACE_POINT(TIME_TONE_REJECT, 0, 0);
     }
     else
     {
@@ -700,6 +702,8 @@ void CFE_TIME_ToneVerify(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Time2)
         if (result == CFE_TIME_EQUAL)
         {
             CFE_TIME_Global.ToneMatchErrorCounter++;
+
+            CFE_TRACE_POINT(TIME_TONE_REJECT, 0, 0);
         }
         else
         {
@@ -723,6 +727,8 @@ void CFE_TIME_ToneVerify(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Time2)
                 elapsed = CFE_TIME_Subtract(Time2, Time1);
             }
 
+            CFE_TIME_RecordToneLatchDelta(elapsed);
+
             /*
             ** Ensure that time between packet and tone is within limits...
             */
@@ -733,11 +739,15 @@ void CFE_TIME_ToneVerify(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Time2)
                 ** Maintain count of tone vs data packet mis-matches...
                 */
                 CFE_TIME_Global.ToneMatchErrorCounter++;
+
+                CFE_TRACE_POINT(TIME_TONE_REJECT, elapsed.Seconds, elapsed.Subseconds);
             }
             else
             {
                 CFE_TIME_Global.ToneMatchCounter++;
 
+                CFE_TRACE_POINT(TIME_TONE_ACCEPT, elapsed.Seconds, elapsed.Subseconds);
+
                 /*
                 ** Skip tone packet update if commanded into "flywheel" mode...
                 */
@@ -1007,11 +1017,21 @@ void CFE_TIME_Tone1HzISR(void)
         */
         CFE_TIME_Global.ToneIntCounter++;
 
+        /*
+        ** Tone interval statistics and local clock drift estimate...
+        */
+        CFE_TIME_RecordToneInterval(Elapsed);
+
         /* Since the tone occurred ~1 seconds after the previous one, we
         ** can mark this tone as 'good'
         */
         CFE_TIME_Global.IsToneGood = true;
 
+        /*
+        ** Only valid tones realign the minor frame scheduler...
+        */
+        CFE_TIME_Global.AcceptedToneLatch = ToneSignalLatch;
+
 /*
 ** Maintain virtual MET as count of valid tone signal interrupts...
 **   (not set to zero by reset command)
@@ -1114,6 +1134,142 @@ void CFE_TIME_Tone1HzTask(void)
     */
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_RecordToneInterval(CFE_TIME_SysTime_t Interval)
+{
+    CFE_TIME_ToneStats_t *Stats = &CFE_TIME_Global.ToneStats;
+    uint32                Micros;
+    int32                 DevMicros;
+    int64                 DevNanos;
+    uint32                Depth;
+
+    /*
+    ** Interval statistics, as deviations from one second...
+    */
+    Micros    = (Interval.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Interval.Subseconds);
+    DevMicros = (int32)Micros - 1000000;
+
+    if (Stats->IntervalCount == 0)
+    {
+        Stats->IntervalMin = Micros;
+        Stats->IntervalMax = Micros;
+    }
+    else if (Micros < Stats->IntervalMin)
+    {
+        Stats->IntervalMin = Micros;
+    }
+    else if (Micros > Stats->IntervalMax)
+    {
+        Stats->IntervalMax = Micros;
+    }
+
+    Stats->IntervalCount++;
+    Stats->IntervalDevSum += DevMicros;
+    Stats->IntervalDevSumSq += (uint64)((int64)DevMicros * DevMicros);
+
+    /*
+    ** Drift estimate, taken from the sub-seconds for a finer resolution
+    **    (nano-seconds of deviation per second are parts per billion)...
+    */
+    DevNanos = (((int64)Interval.Seconds - 1) * 1000000000) +
+               (int64)(((uint64)Interval.Subseconds * 1000000000) >> 32);
+
+    Depth = Stats->DriftSamples + 1;
+    if (Depth > CFE_TIME_DRIFT_AVERAGE_DEPTH)
+    {
+        Depth = CFE_TIME_DRIFT_AVERAGE_DEPTH;
+    }
+
+    Stats->DriftRate += (int32)((DevNanos - Stats->DriftRate) / (int64)Depth);
+    Stats->DriftSamples++;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_RecordToneLatchDelta(CFE_TIME_SysTime_t Delta)
+{
+    uint32 Micros;
+    uint32 Bin;
+
+    /*
+    ** Bin N holds deltas of 2^(N-1) to 2^N - 1 micro-seconds...
+    */
+    Bin = CFE_MISSION_TIME_TONE_HIST_BINS - 1;
+
+    if (Delta.Seconds == 0)
+    {
+        Micros = CFE_TIME_Sub2MicroSecs(Delta.Subseconds);
+        Bin    = 0;
+
+        while ((Micros != 0) && (Bin < (CFE_MISSION_TIME_TONE_HIST_BINS - 1)))
+        {
+            Micros >>= 1;
+            Bin++;
+        }
+    }
+
+    CFE_TIME_Global.ToneStats.ToneLatchHistogram[Bin]++;
+}
+
+#if (CFE_PLATFORM_TIME_CFG_DRIFT_CORRECTION == true)
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_UpdateDriftCorrection(int16 ClockFlyState)
+{
+    CFE_TIME_ToneStats_t *Stats = &CFE_TIME_Global.ToneStats;
+    uint64                Magnitude;
+
+    if (ClockFlyState == CFE_TIME_FlywheelState_IS_FLY)
+    {
+        if (!Stats->DriftCorrectionActive && (Stats->DriftSamples >= CFE_TIME_DRIFT_MIN_SAMPLES))
+        {
+            /*
+            ** A fast local clock runs ahead of the tone, so take the
+            **    drift back out of the STCF every second (and vice versa)...
+            */
+            if (Stats->DriftRate < 0)
+            {
+                Magnitude             = (uint64)(-(int64)Stats->DriftRate);
+                Stats->DriftDirection = CFE_TIME_AdjustDirection_ADD;
+            }
+            else
+            {
+                Magnitude             = (uint64)Stats->DriftRate;
+                Stats->DriftDirection = CFE_TIME_AdjustDirection_SUBTRACT;
+            }
+
+            Stats->DriftAdjust.Seconds    = 0;
+            Stats->DriftAdjust.Subseconds = (uint32)((Magnitude << 32) / 1000000000);
+
+            Stats->DriftCorrectionActive = true;
+        }
+    }
+    else if (Stats->DriftCorrectionActive)
+    {
+        /*
+        ** Tone is back, so the clock no longer needs to be corrected...
+        */
+        Stats->DriftAdjust.Seconds    = 0;
+        Stats->DriftAdjust.Subseconds = 0;
+
+        Stats->DriftCorrectionActive = false;
+    }
+}
+#endif /* CFE_PLATFORM_TIME_CFG_DRIFT_CORRECTION */
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1137,7 +1293,8 @@ void CFE_TIME_Local1HzStateMachine(void)
 ** Apply 1Hz adjustment to STCF...
 */
 #if (CFE_PLATFORM_TIME_CFG_SERVER == true)
-    if ((CFE_TIME_Global.OneHzAdjust.Seconds != 0) || (CFE_TIME_Global.OneHzAdjust.Subseconds != 0))
+    if ((CFE_TIME_Global.OneHzAdjust.Seconds != 0) || (CFE_TIME_Global.OneHzAdjust.Subseconds != 0) ||
+        (CFE_TIME_Global.ToneStats.DriftAdjust.Seconds != 0) || (CFE_TIME_Global.ToneStats.DriftAdjust.Subseconds != 0))
     {
         CFE_TIME_SysTime_t NewSTCF;
         NextState = CFE_TIME_StartReferenceUpdate();
@@ -1151,6 +1308,18 @@ void CFE_TIME_Local1HzStateMachine(void)
             NewSTCF = CFE_TIME_Subtract(NextState->AtToneSTCF, CFE_TIME_Global.OneHzAdjust);
         }
 
+        /*
+        ** Drift correction is a separate term, so it never disturbs the commanded adjustment...
+        */
+        if (CFE_TIME_Global.ToneStats.DriftDirection == CFE_TIME_AdjustDirection_ADD)
+        {
+            NewSTCF = CFE_TIME_Add(NewSTCF, CFE_TIME_Global.ToneStats.DriftAdjust);
+        }
+        else
+        {
+            NewSTCF = CFE_TIME_Subtract(NewSTCF, CFE_TIME_Global.ToneStats.DriftAdjust);
+        }
+
         NextState->AtToneSTCF = NewSTCF;
 
         /*
@@ -1225,6 +1394,13 @@ void CFE_TIME_Local1HzStateMachine(void)
         }
     }
 
+#if (CFE_PLATFORM_TIME_CFG_DRIFT_CORRECTION == true)
+    /*
+    ** Cancel the local clock drift while flywheeling (applied from the next 1Hz)...
+    */
+    CFE_TIME_UpdateDriftCorrection(Reference.ClockFlyState);
+#endif
+
     /* Exit performance monitoring */
     CFE_ES_PerfLogExit(CFE_MISSION_TIME_LOCAL1HZISR_PERF_ID);
 }
@@ -1309,25 +1485,390 @@ void CFE_TIME_Local1HzTask(void)
  *-----------------------------------------------------------------*/
 void CFE_TIME_NotifyTimeSynchApps(void)
 {
-    uint32                      i;
-    CFE_TIME_SynchCallbackPtr_t Func;
+    uint32                            i;
+    CFE_TIME_SynchCallbackRegEntry_t *Entry;
+    CFE_TIME_SynchCallbackPtr_t       Func;
+    bool                              WakeSynchTask;
 
     /*
     ** Notify applications that have requested tone synchronization
     */
     if (CFE_TIME_Global.IsToneGood)
     {
+        WakeSynchTask = false;
+
         for (i = 0; i < (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])); ++i)
         {
+            Entry = &CFE_TIME_Global.SynchCallback[i];
+
             /* IMPORTANT:
              * Read the global pointer only once, since a thread could be unregistering
              * the same pointer in parallel with this action.
              */
-            Func = CFE_TIME_Global.SynchCallback[i].Ptr;
-            if (Func != NULL)
+            Func = Entry->Ptr;
+            if (Func == NULL)
             {
-                Func();
+                continue;
             }
+
+            /*
+            ** Only every RateDivisor'th tone signal is passed on...
+            */
+            if (Entry->Countdown > 1)
+            {
+                --Entry->Countdown;
+                continue;
+            }
+            Entry->Countdown = Entry->RateDivisor;
+
+            if ((Entry->Options & CFE_TIME_SYNCH_DEFERRED) == 0)
+            {
+                CFE_TIME_CallSynchCallback(Entry, Func);
+            }
+            else if (Entry->Pending)
+            {
+                /*
+                ** Previous call has not been made yet, do not queue another...
+                */
+                ++Entry->Stats.OverrunCount;
+            }
+            else
+            {
+                Entry->Pending = true;
+                WakeSynchTask  = true;
+            }
+        }
+
+        /*
+        ** If the synch task is not started yet the semaphore stays
+        **    given, and the released calls are made once it starts...
+        */
+        if (WakeSynchTask)
+        {
+            OS_BinSemGive(CFE_TIME_Global.SynchSemaphore);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_CallSynchCallback(CFE_TIME_SynchCallbackRegEntry_t *Entry, CFE_TIME_SynchCallbackPtr_t Func)
+{
+    CFE_TIME_SysTime_t StartLatch;
+    CFE_TIME_SysTime_t EndLatch;
+    CFE_TIME_SysTime_t Elapsed;
+    uint32             Micros;
+
+    StartLatch = CFE_TIME_LatchClock();
+    Func();
+    EndLatch = CFE_TIME_LatchClock();
+
+    if (CFE_TIME_Compare(EndLatch, StartLatch) == CFE_TIME_A_LT_B)
+    {
+        /*
+        ** Local clock has rolled over...
+        */
+        Elapsed = CFE_TIME_Subtract(CFE_TIME_Global.MaxLocalClock, StartLatch);
+        Elapsed = CFE_TIME_Add(Elapsed, EndLatch);
+    }
+    else
+    {
+        Elapsed = CFE_TIME_Subtract(EndLatch, StartLatch);
+    }
+
+    /*
+    ** Execution time saturates at the largest value that can be reported...
+    */
+    if (Elapsed.Seconds >= (0xFFFFFFFF / 1000000))
+    {
+        Micros = 0xFFFFFFFF;
+    }
+    else
+    {
+        Micros = (Elapsed.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Elapsed.Subseconds);
+    }
+
+    ++Entry->Stats.CallCount;
+    Entry->Stats.LastExecMicros = Micros;
+    if (Micros > Entry->Stats.MaxExecMicros)
+    {
+        Entry->Stats.MaxExecMicros = Micros;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_SynchTask(void)
+{
+    int32                             OsStatus;
+    uint32                            i;
+    CFE_TIME_SynchCallbackRegEntry_t *Entry;
+    CFE_TIME_SynchCallbackPtr_t       Func;
+
+    while (true)
+    {
+        /* Increment the Main task Execution Counter */
+        CFE_ES_IncrementTaskCounter();
+
+        /*
+        ** Pend on semaphore given by the tone signal (above)...
+        */
+        OsStatus = OS_BinSemTake(CFE_TIME_Global.SynchSemaphore);
+        if (OsStatus != OS_SUCCESS)
+        {
+            break;
+        }
+
+        for (i = 0; i < (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])); ++i)
+        {
+            Entry = &CFE_TIME_Global.SynchCallback[i];
+
+            if (Entry->Pending)
+            {
+                /*
+                ** Clear before calling, so that a release during the
+                **    call is made on the next wake-up rather than lost...
+                */
+                Entry->Pending = false;
+
+                /* The callback may have been unregistered since its release */
+                Func = Entry->Ptr;
+                if (Func != NULL)
+                {
+                    CFE_TIME_CallSynchCallback(Entry, Func);
+                }
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_MinorFrameTimerCallback(osal_id_t TimerId, void *Arg)
+{
+    CFE_TIME_MinorFrameISR();
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_MinorFrameISR(void)
+{
+    volatile CFE_TIME_SysTime_t *ToneLatchPtr = &CFE_TIME_Global.AcceptedToneLatch;
+    CFE_TIME_Packed_t            ToneLatch;
+    CFE_TIME_Packed_t            SinceTone;
+    CFE_TIME_Packed_t            FrameLength;
+    CFE_TIME_Packed_t            FrameStart;
+    uint32                       Rate;
+    uint32                       CurrentFrame;
+    uint32                       Frame;
+    bool                         WakeTask;
+
+    Rate = CFE_TIME_Global.MinorFrameRate;
+    if (Rate == 0)
+    {
+        return;
+    }
+
+    /*
+    ** The tone ISR can update the latch at any time, so read it
+    **    until two reads agree...
+    */
+    do
+    {
+        ToneLatch = CFE_TIME_Pack(*ToneLatchPtr);
+    } while (ToneLatch != CFE_TIME_Pack(*ToneLatchPtr));
+
+    /*
+    ** Minor frames restart from zero at each new valid tone...
+    */
+    if (ToneLatch != CFE_TIME_Global.MinorFrameToneLatch)
+    {
+        CFE_TIME_Global.MinorFrameToneLatch = ToneLatch;
+        CFE_TIME_Global.NextMinorFrame      = 0;
+    }
+
+    SinceTone = CFE_TIME_Pack(CFE_TIME_LatchClock());
+    if (CFE_TIME_PackedCompare(SinceTone, ToneLatch) == CFE_TIME_A_LT_B)
+    {
+        /*
+        ** Local clock has rolled over...
+        */
+        SinceTone = CFE_TIME_PackedAdd(SinceTone, CFE_TIME_Pack(CFE_TIME_Global.MaxLocalClock));
+    }
+    SinceTone = CFE_TIME_PackedSubtract(SinceTone, ToneLatch);
+
+    /*
+    ** A timer tick that lands slightly before a frame boundary counts as
+    **    that frame, otherwise a timer running a little fast against the
+    **    tone would release every frame one tick late...
+    */
+    FrameStart   = CFE_TIME_PackedAdd(SinceTone, 0x40000000 / Rate);
+    CurrentFrame = ((uint32)(FrameStart >> 32) * Rate) + (uint32)(((FrameStart & 0xFFFFFFFF) * Rate) >> 32);
+
+    if (CurrentFrame < CFE_TIME_Global.NextMinorFrame)
+    {
+        return;
+    }
+
+    /*
+    ** Frames missed by a late tick are released now, but never more than
+    **    one major frame's worth...
+    */
+    if ((CurrentFrame - CFE_TIME_Global.NextMinorFrame) >= Rate)
+    {
+        CFE_TIME_Global.MinorFrameSkipCounter += CurrentFrame - CFE_TIME_Global.NextMinorFrame - Rate + 1;
+        CFE_TIME_Global.NextMinorFrame = CurrentFrame - Rate + 1;
+    }
+
+    FrameLength = (((CFE_TIME_Packed_t)1) << 32) / Rate;
+    WakeTask    = false;
+
+    for (Frame = CFE_TIME_Global.NextMinorFrame; Frame <= CurrentFrame; ++Frame)
+    {
+        FrameStart = Frame * FrameLength;
+        if (CFE_TIME_PackedCompare(SinceTone, FrameStart) == CFE_TIME_A_LT_B)
+        {
+            FrameStart = CFE_TIME_PackedSubtract(FrameStart, SinceTone);
+        }
+        else
+        {
+            FrameStart = CFE_TIME_PackedSubtract(SinceTone, FrameStart);
+        }
+
+        if (CFE_TIME_ReleaseFrameSlots(Frame % Rate, (uint32)CFE_TIME_PackedToMicroSecs(FrameStart)))
+        {
+            WakeTask = true;
+        }
+
+        CFE_TIME_Global.MinorFrameCounter++;
+    }
+
+    CFE_TIME_Global.NextMinorFrame = CurrentFrame + 1;
+
+    /*
+    ** Wake the minor frame task to send the wakeup messages and
+    **    advance the timer wheel...
+    */
+    if (WakeTask || CFE_TIME_Global.TimerCount != 0)
+    {
+        OS_BinSemGive(CFE_TIME_Global.FrameSemaphore);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_TIME_ReleaseFrameSlots(uint32 MinorFrame, uint32 JitterMicros)
+{
+    uint32                i;
+    CFE_TIME_FrameSlot_t *Slot;
+    OS_bin_sem_prop_t     SemProp;
+    bool                  MsgReleased = false;
+
+    for (i = 0; i < (sizeof(CFE_TIME_Global.FrameSlot) / sizeof(CFE_TIME_Global.FrameSlot[0])); ++i)
+    {
+        Slot = &CFE_TIME_Global.FrameSlot[i];
+
+        if (!Slot->Active || (MinorFrame % Slot->Period) != Slot->Stats.Phase)
+        {
+            continue;
+        }
+
+        if (Slot->SendMsg)
+        {
+            if (Slot->MsgPending)
+            {
+                Slot->Stats.OverrunCount++;
+            }
+
+            Slot->MsgPending = true;
+            MsgReleased      = true;
+        }
+        else
+        {
+            /*
+            ** A semaphore that is still full has not been taken since the
+            **    previous release...
+            */
+            memset(&SemProp, 0, sizeof(SemProp));
+            if (OS_BinSemGetInfo(Slot->SemId, &SemProp) == OS_SUCCESS && SemProp.value > 0)
+            {
+                Slot->Stats.OverrunCount++;
+            }
+
+            OS_BinSemGive(Slot->SemId);
+        }
+
+        Slot->Stats.ReleaseCount++;
+        Slot->Stats.LastJitterMicros = JitterMicros;
+        if (JitterMicros > Slot->Stats.MaxJitterMicros)
+        {
+            Slot->Stats.MaxJitterMicros = JitterMicros;
+        }
+    }
+
+    return MsgReleased;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_FrameTask(void)
+{
+    int32                 OsStatus;
+    uint32                i;
+    CFE_TIME_FrameSlot_t *Slot;
+
+    while (true)
+    {
+        /* Increment the Main task Execution Counter */
+        CFE_ES_IncrementTaskCounter();
+
+        /*
+        ** Pend on the minor frame semaphore (given by the scheduler)...
+        */
+        OsStatus = OS_BinSemTake(CFE_TIME_Global.FrameSemaphore);
+        if (OsStatus != OS_SUCCESS)
+        {
+            break;
+        }
+
+        for (i = 0; i < (sizeof(CFE_TIME_Global.FrameSlot) / sizeof(CFE_TIME_Global.FrameSlot[0])); ++i)
+        {
+            Slot = &CFE_TIME_Global.FrameSlot[i];
+
+            if (Slot->Active && Slot->MsgPending)
+            {
+                Slot->MsgPending = false;
+                CFE_SB_TransmitMsg(CFE_MSG_PTR(Slot->WakeupCmd), true);
+            }
+        }
+
+        if (CFE_TIME_Global.TimerCount != 0)
+        {
+            CFE_TIME_AdvanceTimerWheel();
         }
     }
 }
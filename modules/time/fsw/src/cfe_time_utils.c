@@ -286,6 +286,12 @@ void CFE_TIME_InitData(void)
     */
     CFE_TIME_Global.VirtualMET = RefState->AtToneMET.Seconds;
 
+    /*
+    ** Minor frame scheduler (stopped again by task init if it cannot run)...
+    */
+    CFE_TIME_Global.MinorFrameRate = CFE_PLATFORM_TIME_MINOR_FRAME_RATE;
+    CFE_TIME_InitTimers();
+
     /*
     ** Time window verification values...
     */
@@ -326,6 +332,12 @@ void CFE_TIME_InitData(void)
     CFE_MSG_Init(CFE_MSG_PTR(CFE_TIME_Global.DiagPacket.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_TIME_DIAG_TLM_MID),
                  sizeof(CFE_TIME_Global.DiagPacket));
 
+    /*
+    ** Initialize tone statistics packet (clear user data area)...
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_TIME_Global.ToneStatsPacket.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_TIME_TONE_TLM_MID), sizeof(CFE_TIME_Global.ToneStatsPacket));
+
     /*
     ** Initialize "time at the tone" signal command packet...
     */
@@ -528,6 +540,109 @@ void CFE_TIME_GetDiagData(void)
     CFE_TIME_Global.DiagPacket.Payload.DataStoreStatus = CFE_TIME_Global.DataStoreStatus;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_GetToneStatsData(void)
+{
+    const CFE_TIME_ToneStats_t *     Stats   = &CFE_TIME_Global.ToneStats;
+    CFE_TIME_ToneStatsTlm_Payload_t *Payload = &CFE_TIME_Global.ToneStatsPacket.Payload;
+    int64                            MeanDev;
+    uint64                           Variance;
+    uint64                           Root;
+    uint64                           Bit;
+
+    /*
+    ** Tone interval statistics (subject to reset command)...
+    */
+    Payload->ToneIntervalCount = Stats->IntervalCount;
+
+    if (Stats->IntervalCount == 0)
+    {
+        Payload->ToneIntervalMin    = 0;
+        Payload->ToneIntervalMax    = 0;
+        Payload->ToneIntervalMean   = 0;
+        Payload->ToneIntervalStdDev = 0;
+    }
+    else
+    {
+        /*
+        ** Deviations are accumulated relative to one second, which keeps
+        **    the sum of squares well inside 64 bits...
+        */
+        MeanDev  = Stats->IntervalDevSum / (int64)Stats->IntervalCount;
+        Variance = Stats->IntervalDevSumSq / Stats->IntervalCount;
+
+        if (Variance > (uint64)(MeanDev * MeanDev))
+        {
+            Variance -= (uint64)(MeanDev * MeanDev);
+        }
+        else
+        {
+            Variance = 0;
+        }
+
+        /*
+        ** Integer square root, one result bit at a time...
+        */
+        Root = 0;
+        Bit  = (uint64)1 << 62;
+        while (Bit > Variance)
+        {
+            Bit >>= 2;
+        }
+        while (Bit != 0)
+        {
+            if (Variance >= (Root + Bit))
+            {
+                Variance -= Root + Bit;
+                Root = (Root >> 1) + Bit;
+            }
+            else
+            {
+                Root >>= 1;
+            }
+            Bit >>= 2;
+        }
+
+        Payload->ToneIntervalMin    = Stats->IntervalMin;
+        Payload->ToneIntervalMax    = Stats->IntervalMax;
+        Payload->ToneIntervalMean   = (uint32)(1000000 + MeanDev);
+        Payload->ToneIntervalStdDev = (uint32)Root;
+    }
+
+    /*
+    ** Local clock drift (not subject to reset command)...
+    */
+    Payload->DriftRate             = Stats->DriftRate;
+    Payload->DriftCorrectionActive = Stats->DriftCorrectionActive;
+
+    /*
+    ** Tone to data latch delta histogram (subject to reset command)...
+    */
+    memcpy(Payload->ToneLatchHistogram, Stats->ToneLatchHistogram, sizeof(Payload->ToneLatchHistogram));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_ResetToneStats(void)
+{
+    CFE_TIME_Global.ToneStats.IntervalCount    = 0;
+    CFE_TIME_Global.ToneStats.IntervalMin      = 0;
+    CFE_TIME_Global.ToneStats.IntervalMax      = 0;
+    CFE_TIME_Global.ToneStats.IntervalDevSum   = 0;
+    CFE_TIME_Global.ToneStats.IntervalDevSumSq = 0;
+
+    memset(CFE_TIME_Global.ToneStats.ToneLatchHistogram, 0, sizeof(CFE_TIME_Global.ToneStats.ToneLatchHistogram));
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -654,6 +769,108 @@ void CFE_TIME_GetReference(CFE_TIME_Reference_t *Reference)
     Reference->CurrentMET = CurrentMET;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_SetReferenceMapping(volatile CFE_TIME_ReferenceState_t *NextState)
+{
+    CFE_TIME_Packed_t METOffset;
+    CFE_TIME_Packed_t TAIOffset;
+
+    /*
+    ** MET = local clock - latch at tone + MET at tone [+ or - delay], and all of
+    ** packed time arithmetic wraps the same way as the time arithmetic API does,
+    ** so everything but the local clock folds into a single offset...
+    */
+    METOffset = CFE_TIME_PackedSubtract(CFE_TIME_Pack(NextState->AtToneMET), CFE_TIME_Pack(NextState->AtToneLatch));
+
+#if (CFE_PLATFORM_TIME_CFG_CLIENT == true)
+    if (NextState->DelayDirection == CFE_TIME_AdjustDirection_ADD)
+    {
+        METOffset = CFE_TIME_PackedAdd(METOffset, CFE_TIME_Pack(NextState->AtToneDelay));
+    }
+    else
+    {
+        METOffset = CFE_TIME_PackedSubtract(METOffset, CFE_TIME_Pack(NextState->AtToneDelay));
+    }
+#endif
+
+    TAIOffset = CFE_TIME_PackedAdd(METOffset, CFE_TIME_Pack(NextState->AtToneSTCF));
+
+    NextState->AtToneLatchPacked           = CFE_TIME_Pack(NextState->AtToneLatch);
+    NextState->MapOffset[CFE_TIME_MAP_MET] = METOffset;
+    NextState->MapOffset[CFE_TIME_MAP_TAI] = TAIOffset;
+    NextState->MapOffset[CFE_TIME_MAP_UTC] =
+        CFE_TIME_PackedSubtract(TAIOffset, (CFE_TIME_Packed_t)(int64)NextState->AtToneLeapSeconds << 32);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_TIME_SysTime_t CFE_TIME_GetMappedTime(uint32 MapIndex)
+{
+    CFE_TIME_Packed_t                   LocalClock;
+    CFE_TIME_Packed_t                   AtToneLatch;
+    CFE_TIME_Packed_t                   Offset;
+    uint32                              VersionCounter;
+    uint32                              RetryCount = 4;
+    volatile CFE_TIME_ReferenceState_t *RefState;
+
+    /*
+    ** Same versioned read as CFE_TIME_GetReference(), but of two values only...
+    */
+    while (true)
+    {
+        VersionCounter = CFE_TIME_Global.LastVersionCounter;
+        RefState       = &CFE_TIME_Global.ReferenceState[VersionCounter & CFE_TIME_REFERENCE_BUF_MASK];
+
+        LocalClock = CFE_TIME_Pack(CFE_TIME_LatchClock());
+
+        AtToneLatch = RefState->AtToneLatchPacked;
+        Offset      = RefState->MapOffset[MapIndex];
+
+        if (VersionCounter == RefState->StateVersion)
+        {
+            /* successful read */
+            break;
+        }
+
+        if (RetryCount == 0)
+        {
+            /* unsuccessful read */
+            break;
+        }
+
+        --RetryCount;
+    }
+
+    /*
+    ** As with CFE_TIME_GetReference(), an inconsistent reference yields zero time...
+    */
+    if (RetryCount == 0)
+    {
+        CFE_TIME_Global.GetReferenceFail = true;
+
+        return CFE_TIME_Unpack(0);
+    }
+
+    /*
+    ** Local clock has rolled over since last tone...
+    */
+    if (CFE_TIME_PackedCompare(LocalClock, AtToneLatch) == CFE_TIME_A_LT_B)
+    {
+        LocalClock = CFE_TIME_PackedAdd(LocalClock, CFE_TIME_Pack(CFE_TIME_Global.MaxLocalClock));
+    }
+
+    return CFE_TIME_Unpack(CFE_TIME_PackedAdd(LocalClock, Offset));
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1018,15 +1235,30 @@ int32 CFE_TIME_CleanUpApp(CFE_ES_AppId_t AppId)
 {
     int32  Status;
     uint32 AppIndex;
+    uint32 i;
+
+    CFE_TIME_CancelAppTimers(AppId);
+
+    CFE_TIME_LockSynchCallbacks();
+
+    for (i = 0; i < (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])); ++i)
+    {
+        if (CFE_RESOURCEID_TEST_EQUAL(CFE_TIME_Global.SynchCallback[i].AppId, AppId))
+        {
+            CFE_TIME_Global.SynchCallback[i].Ptr = NULL;
+        }
+    }
+
+    CFE_TIME_UnlockSynchCallbacks();
 
     Status = CFE_ES_AppID_ToIndex(AppId, &AppIndex);
     if (Status != CFE_SUCCESS)
     {
         /* Do nothing */
     }
-    else if (AppIndex < (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])))
+    else if (AppIndex < (sizeof(CFE_TIME_Global.FrameSlot) / sizeof(CFE_TIME_Global.FrameSlot[0])))
     {
-        CFE_TIME_Global.SynchCallback[AppIndex].Ptr = NULL;
+        CFE_TIME_Global.FrameSlot[AppIndex].Active = false;
     }
     else
     {
@@ -1035,3 +1267,553 @@ int32 CFE_TIME_CleanUpApp(CFE_ES_AppId_t AppId)
 
     return Status;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TIME_ClaimFrameSlot(uint32 RateHz, uint32 Phase, CFE_TIME_FrameSlot_t **SlotPtr)
+{
+    int32                 Status;
+    CFE_ES_AppId_t        AppId;
+    uint32                AppIndex;
+    uint32                Period;
+    CFE_TIME_FrameSlot_t *Slot;
+
+    if (CFE_TIME_Global.MinorFrameRate == 0)
+    {
+        return CFE_TIME_NOT_IMPLEMENTED;
+    }
+
+    /*
+    ** The rate must release a whole number of times per major frame...
+    */
+    if (RateHz == 0 || (CFE_TIME_Global.MinorFrameRate % RateHz) != 0)
+    {
+        return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    Period = CFE_TIME_Global.MinorFrameRate / RateHz;
+    if (Phase >= Period)
+    {
+        return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_ES_AppID_ToIndex(AppId, &AppIndex);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        if (AppIndex >= (sizeof(CFE_TIME_Global.FrameSlot) / sizeof(CFE_TIME_Global.FrameSlot[0])) ||
+            CFE_TIME_Global.FrameSlot[AppIndex].Active)
+        {
+            Status = CFE_TIME_TOO_MANY_SYNCH_CALLBACKS;
+        }
+        else
+        {
+            Slot = &CFE_TIME_Global.FrameSlot[AppIndex];
+
+            memset(&Slot->Stats, 0, sizeof(Slot->Stats));
+            Slot->Stats.RateHz = RateHz;
+            Slot->Stats.Phase  = Phase;
+            Slot->Period       = Period;
+            Slot->MsgPending   = false;
+
+            *SlotPtr = Slot;
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_LockSynchCallbacks(void)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_MutSemTake(CFE_TIME_Global.SynchMutex);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Error taking synch callback mutex:RC=%ld\n", __func__, (long)OsStatus);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_UnlockSynchCallbacks(void)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_MutSemGive(CFE_TIME_Global.SynchMutex);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Error giving synch callback mutex:RC=%ld\n", __func__, (long)OsStatus);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_TIME_SynchCallbackRegEntry_t *CFE_TIME_LocateSynchCallback(CFE_TIME_SynchCallbackId_t SynchCallbackId)
+{
+    uint32                            Index;
+    CFE_TIME_SynchCallbackRegEntry_t *Entry;
+
+    /*
+    ** The low half of the ID is one more than the registry index, the high half the serial...
+    */
+    Index = (SynchCallbackId & 0xFFFF) - 1;
+    if (Index >= CFE_PLATFORM_TIME_MAX_SYNCH_CALLBACKS)
+    {
+        return NULL;
+    }
+
+    Entry = &CFE_TIME_Global.SynchCallback[Index];
+    if (Entry->Ptr == NULL || Entry->Serial != (uint16)(SynchCallbackId >> 16))
+    {
+        return NULL;
+    }
+
+    return Entry;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_LockTimers(void)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_MutSemTake(CFE_TIME_Global.TimerMutex);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Error taking timer mutex:RC=%ld\n", __func__, (long)OsStatus);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_UnlockTimers(void)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_MutSemGive(CFE_TIME_Global.TimerMutex);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Error giving timer mutex:RC=%ld\n", __func__, (long)OsStatus);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_InitTimers(void)
+{
+    uint32 i;
+
+    for (i = 0; i < CFE_PLATFORM_TIME_MAX_TIMERS; ++i)
+    {
+        CFE_TIME_Global.Timer[i].State = CFE_TIME_TIMER_STATE_FREE;
+        CFE_TIME_Global.Timer[i].Next  = (uint16)(i + 1);
+    }
+    CFE_TIME_Global.Timer[CFE_PLATFORM_TIME_MAX_TIMERS - 1].Next = CFE_TIME_TIMER_NONE;
+
+    for (i = 0; i <= CFE_TIME_TIMER_EXPIRED_LIST; ++i)
+    {
+        CFE_TIME_Global.TimerList[i] = CFE_TIME_TIMER_NONE;
+    }
+
+    CFE_TIME_Global.FreeTimerHead     = 0;
+    CFE_TIME_Global.TimerCount        = 0;
+    CFE_TIME_Global.TimerWheelStarted = false;
+    CFE_TIME_Global.TimerWheelTick    = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint64 CFE_TIME_TimerTick(CFE_TIME_Packed_t Time, bool RoundUp)
+{
+    uint64 Rate     = CFE_TIME_Global.MinorFrameRate;
+    uint64 Fraction = (Time & 0xFFFFFFFF) * Rate;
+
+    if (RoundUp)
+    {
+        Fraction += 0xFFFFFFFF;
+    }
+
+    return ((Time >> 32) * Rate) + (Fraction >> 32);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_LinkTimer(uint16 Index, uint16 List)
+{
+    CFE_TIME_Timer_t *Timer = &CFE_TIME_Global.Timer[Index];
+
+    Timer->List = List;
+    Timer->Prev = CFE_TIME_TIMER_NONE;
+    Timer->Next = CFE_TIME_Global.TimerList[List];
+
+    if (Timer->Next != CFE_TIME_TIMER_NONE)
+    {
+        CFE_TIME_Global.Timer[Timer->Next].Prev = Index;
+    }
+
+    CFE_TIME_Global.TimerList[List] = Index;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_UnlinkTimer(uint16 Index)
+{
+    CFE_TIME_Timer_t *Timer = &CFE_TIME_Global.Timer[Index];
+
+    if (Timer->Prev == CFE_TIME_TIMER_NONE)
+    {
+        CFE_TIME_Global.TimerList[Timer->List] = Timer->Next;
+    }
+    else
+    {
+        CFE_TIME_Global.Timer[Timer->Prev].Next = Timer->Next;
+    }
+
+    if (Timer->Next != CFE_TIME_TIMER_NONE)
+    {
+        CFE_TIME_Global.Timer[Timer->Next].Prev = Timer->Prev;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_InsertTimer(uint16 Index)
+{
+    CFE_TIME_Timer_t *Timer = &CFE_TIME_Global.Timer[Index];
+    uint64            Tick;
+
+    /*
+    ** Timers expire at the start of the first tick at or after their deadline, and
+    **    one whose tick has already been processed goes in the next slot to be
+    **    processed rather than a whole revolution of the wheel later...
+    */
+    Tick = CFE_TIME_TimerTick(Timer->Deadline, true);
+    if (CFE_TIME_Global.TimerWheelStarted && Tick <= CFE_TIME_Global.TimerWheelTick)
+    {
+        Tick = CFE_TIME_Global.TimerWheelTick + 1;
+    }
+
+    Timer->State = CFE_TIME_TIMER_STATE_ARMED;
+    CFE_TIME_LinkTimer(Index, (uint16)(Tick & CFE_TIME_TIMER_WHEEL_MASK));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_FreeTimer(uint16 Index)
+{
+    CFE_TIME_Timer_t *Timer = &CFE_TIME_Global.Timer[Index];
+
+    Timer->State       = CFE_TIME_TIMER_STATE_FREE;
+    Timer->CallbackPtr = NULL;
+    Timer->Arg         = NULL;
+    Timer->Next        = CFE_TIME_Global.FreeTimerHead;
+
+    CFE_TIME_Global.FreeTimerHead = Index;
+    --CFE_TIME_Global.TimerCount;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TIME_ArmTimer(CFE_TIME_TimerId_t *TimerIdPtr, uint32 DeadlineType, CFE_TIME_SysTime_t Deadline,
+                        CFE_TIME_SysTime_t Interval, CFE_TIME_TimerCallbackPtr_t CallbackPtr, void *Arg,
+                        const CFE_MSG_CommandHeader_t *WakeupCmd)
+{
+    int32                    Status;
+    CFE_ES_AppId_t           AppId;
+    CFE_TIME_ConversionRef_t ConvRef;
+    CFE_TIME_SysTime_t       ZeroMET;
+    CFE_TIME_SysTime_t       SCOffset;
+    CFE_TIME_Packed_t        DeadlineMET;
+    uint16                   Index;
+    CFE_TIME_Timer_t        *Timer;
+
+    if (CFE_TIME_Global.MinorFrameRate == 0)
+    {
+        return CFE_TIME_NOT_IMPLEMENTED;
+    }
+
+    if (TimerIdPtr == NULL)
+    {
+        return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    /*
+    ** Deadlines are kept in MET...
+    */
+    switch (DeadlineType)
+    {
+        case CFE_TIME_TIMER_RELATIVE:
+            DeadlineMET = CFE_TIME_PackedAdd(CFE_TIME_Pack(CFE_TIME_GetMET()), CFE_TIME_Pack(Deadline));
+            break;
+
+        case CFE_TIME_TIMER_ABS_MET:
+            DeadlineMET = CFE_TIME_Pack(Deadline);
+            break;
+
+        case CFE_TIME_TIMER_ABS_SC:
+            /*
+            ** Converting an MET of zero yields the offset from MET to Spacecraft Time...
+            */
+            ZeroMET = CFE_TIME_Unpack(0);
+            CFE_TIME_GetConversionRef(&ConvRef);
+            CFE_TIME_ConvertMETArray(&ConvRef, CFE_TIME_CONVERT_TO_SC, &ZeroMET, &SCOffset, 1);
+            DeadlineMET = CFE_TIME_PackedSubtract(CFE_TIME_Pack(Deadline), CFE_TIME_Pack(SCOffset));
+            break;
+
+        default:
+            return CFE_TIME_BAD_ARGUMENT;
+    }
+
+    CFE_TIME_LockTimers();
+
+    Index = CFE_TIME_Global.FreeTimerHead;
+    if (Index == CFE_TIME_TIMER_NONE)
+    {
+        Status = CFE_TIME_TOO_MANY_TIMERS;
+    }
+    else
+    {
+        Timer = &CFE_TIME_Global.Timer[Index];
+
+        CFE_TIME_Global.FreeTimerHead = Timer->Next;
+        ++CFE_TIME_Global.TimerCount;
+
+        ++Timer->Serial;
+        Timer->AppId       = AppId;
+        Timer->Deadline    = DeadlineMET;
+        Timer->Interval    = CFE_TIME_Pack(Interval);
+        Timer->CallbackPtr = CallbackPtr;
+        Timer->Arg         = Arg;
+        if (CallbackPtr == NULL)
+        {
+            Timer->WakeupCmd = *WakeupCmd;
+        }
+
+        CFE_TIME_InsertTimer(Index);
+
+        *TimerIdPtr = ((CFE_TIME_TimerId_t)Timer->Serial << 16) | (Index + 1);
+    }
+
+    CFE_TIME_UnlockTimers();
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_AdvanceTimerWheel(void)
+{
+    CFE_TIME_Packed_t           Now;
+    uint64                      NowTick;
+    uint64                      Missed;
+    uint16                      Index;
+    uint16                      Next;
+    CFE_TIME_Timer_t           *Timer;
+    CFE_TIME_TimerId_t          TimerId;
+    CFE_TIME_TimerCallbackPtr_t CallbackPtr;
+    void                       *Arg;
+    CFE_MSG_CommandHeader_t     WakeupCmd;
+
+    Now     = CFE_TIME_Pack(CFE_TIME_GetMET());
+    NowTick = CFE_TIME_TimerTick(Now, false);
+
+    CFE_TIME_LockTimers();
+
+    /*
+    ** Every slot is swept once on the first advance, and when MET has jumped
+    **    ahead by more than a revolution of the wheel.  When MET has been set
+    **    back, timers simply stay in their slots until their deadlines...
+    */
+    if (!CFE_TIME_Global.TimerWheelStarted)
+    {
+        CFE_TIME_Global.TimerWheelStarted = true;
+        CFE_TIME_Global.TimerWheelTick    = NowTick - CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS;
+    }
+    else if (NowTick < CFE_TIME_Global.TimerWheelTick)
+    {
+        CFE_TIME_Global.TimerWheelTick = NowTick;
+    }
+    else if ((NowTick - CFE_TIME_Global.TimerWheelTick) > CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS)
+    {
+        CFE_TIME_Global.TimerWheelTick = NowTick - CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS;
+    }
+
+    /*
+    ** Slots hold timers due in later revolutions too, so check each deadline...
+    */
+    while (CFE_TIME_Global.TimerWheelTick != NowTick)
+    {
+        ++CFE_TIME_Global.TimerWheelTick;
+
+        Index = CFE_TIME_Global.TimerList[CFE_TIME_Global.TimerWheelTick & CFE_TIME_TIMER_WHEEL_MASK];
+        while (Index != CFE_TIME_TIMER_NONE)
+        {
+            Timer = &CFE_TIME_Global.Timer[Index];
+            Next  = Timer->Next;
+
+            if (CFE_TIME_TimerTick(Timer->Deadline, true) <= NowTick)
+            {
+                CFE_TIME_UnlinkTimer(Index);
+                Timer->State = CFE_TIME_TIMER_STATE_EXPIRED;
+                CFE_TIME_LinkTimer(Index, CFE_TIME_TIMER_EXPIRED_LIST);
+            }
+
+            Index = Next;
+        }
+    }
+
+    /*
+    ** Act on the expired timers one at a time, without holding the mutex
+    **    while calling out, so callbacks may start and cancel timers...
+    */
+    while (CFE_TIME_Global.TimerList[CFE_TIME_TIMER_EXPIRED_LIST] != CFE_TIME_TIMER_NONE)
+    {
+        Index = CFE_TIME_Global.TimerList[CFE_TIME_TIMER_EXPIRED_LIST];
+        Timer = &CFE_TIME_Global.Timer[Index];
+
+        CFE_TIME_UnlinkTimer(Index);
+
+        TimerId     = ((CFE_TIME_TimerId_t)Timer->Serial << 16) | (Index + 1);
+        CallbackPtr = Timer->CallbackPtr;
+        Arg         = Timer->Arg;
+        if (CallbackPtr == NULL)
+        {
+            WakeupCmd = Timer->WakeupCmd;
+        }
+
+        if (Timer->Interval == 0)
+        {
+            CFE_TIME_FreeTimer(Index);
+        }
+        else
+        {
+            /*
+            ** Periodic timers keep their phase, skipping any expiries missed...
+            */
+            Timer->Deadline = CFE_TIME_PackedAdd(Timer->Deadline, Timer->Interval);
+            if (CFE_TIME_PackedCompare(Timer->Deadline, Now) != CFE_TIME_A_GT_B)
+            {
+                Missed          = (CFE_TIME_PackedSubtract(Now, Timer->Deadline) / Timer->Interval) + 1;
+                Timer->Deadline = CFE_TIME_PackedAdd(Timer->Deadline, Missed * Timer->Interval);
+            }
+
+            CFE_TIME_InsertTimer(Index);
+        }
+
+        CFE_TIME_UnlockTimers();
+
+        if (CallbackPtr != NULL)
+        {
+            CallbackPtr(TimerId, Arg);
+        }
+        else
+        {
+            CFE_SB_TransmitMsg(CFE_MSG_PTR(WakeupCmd), true);
+        }
+
+        CFE_TIME_LockTimers();
+    }
+
+    CFE_TIME_UnlockTimers();
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TIME_CancelAppTimers(CFE_ES_AppId_t AppId)
+{
+    uint32            i;
+    CFE_TIME_Timer_t *Timer;
+
+    if (CFE_TIME_Global.TimerCount == 0)
+    {
+        return;
+    }
+
+    CFE_TIME_LockTimers();
+
+    for (i = 0; i < CFE_PLATFORM_TIME_MAX_TIMERS; ++i)
+    {
+        Timer = &CFE_TIME_Global.Timer[i];
+
+        if (Timer->State != CFE_TIME_TIMER_STATE_FREE && CFE_RESOURCEID_TEST_EQUAL(Timer->AppId, AppId))
+        {
+            CFE_TIME_UnlinkTimer((uint16)i);
+            CFE_TIME_FreeTimer((uint16)i);
+        }
+    }
+
+    CFE_TIME_UnlockTimers();
+}
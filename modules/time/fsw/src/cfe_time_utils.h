@@ -50,17 +50,35 @@
 ** Interrupt task definitions...
 */
 #define CFE_TIME_TASK_TONE_NAME "TIME_TONE_TASK"
-#define CFE_TIME_TASK_1HZ_NAME  "TIME_1HZ_TASK"
-#define CFE_TIME_TASK_STACK_PTR CFE_ES_TASK_STACK_ALLOCATE
-#define CFE_TIME_TASK_FLAGS     0
+#define CFE_TIME_TASK_1HZ_NAME   "TIME_1HZ_TASK"
+#define CFE_TIME_TASK_FRAME_NAME "TIME_FRAME_TASK"
+#define CFE_TIME_TASK_SYNCH_NAME "TIME_SYNCH_TASK"
+#define CFE_TIME_TASK_STACK_PTR  CFE_ES_TASK_STACK_ALLOCATE
+#define CFE_TIME_TASK_FLAGS      0
 
 /*
 ** Interrupt semaphore definitions...
 */
-#define CFE_TIME_SEM_TONE_NAME "TIME_TONE_SEM"
-#define CFE_TIME_SEM_1HZ_NAME  "TIME_1HZ_SEM"
-#define CFE_TIME_SEM_VALUE     0
-#define CFE_TIME_SEM_OPTIONS   0
+#define CFE_TIME_SEM_TONE_NAME  "TIME_TONE_SEM"
+#define CFE_TIME_SEM_1HZ_NAME   "TIME_1HZ_SEM"
+#define CFE_TIME_SEM_FRAME_NAME "TIME_FRAME_SEM"
+#define CFE_TIME_SEM_SYNCH_NAME "TIME_SYNCH_SEM"
+#define CFE_TIME_MUT_SYNCH_NAME "TIME_SYNCH_MUT"
+#define CFE_TIME_SEM_VALUE      0
+#define CFE_TIME_SEM_OPTIONS    0
+
+/*
+** Timer wheel definitions...
+**   (the expired list is kept after the wheel slots, in the same array of list heads)
+*/
+#define CFE_TIME_MUT_TIMER_NAME     "TIME_TIMER_MUT"
+#define CFE_TIME_TIMER_NONE         0xFFFF
+#define CFE_TIME_TIMER_WHEEL_MASK   (CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS - 1)
+#define CFE_TIME_TIMER_EXPIRED_LIST CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS
+
+#define CFE_TIME_TIMER_STATE_FREE    0 /* on the free list */
+#define CFE_TIME_TIMER_STATE_ARMED   1 /* in a timer wheel slot */
+#define CFE_TIME_TIMER_STATE_EXPIRED 2 /* on the expired list, waiting to be acted on */
 
 /*
 ** Main Task Pipe definitions...
@@ -97,6 +115,41 @@
 #define CFE_TIME_REFERENCE_BUF_DEPTH 4
 #define CFE_TIME_REFERENCE_BUF_MASK  (CFE_TIME_REFERENCE_BUF_DEPTH - 1)
 
+/*
+ * Time scales that are mapped directly from the local clock
+ *
+ * Each reference state carries a precomputed offset per time scale, so that
+ * the current time on that scale is the latched local clock plus the offset
+ * (see CFE_TIME_SetReferenceMapping() and CFE_TIME_GetMappedTime()).
+ */
+#define CFE_TIME_MAP_MET   0
+#define CFE_TIME_MAP_TAI   1
+#define CFE_TIME_MAP_UTC   2
+#define CFE_TIME_MAP_COUNT 3
+
+/*
+ * Calendar day cache used by CFE_TIME_Print()
+ *
+ * The last converted day is kept in a single 32 bit word so that it can be
+ * read and replaced without a lock: the upper half holds the day number
+ * (days since Jan 1 of the epoch year) plus one, so that zero means empty,
+ * and the lower half holds the year as an offset from the epoch year.
+ */
+#define CFE_TIME_PRINT_CACHE_DAY_SHIFT 16
+#define CFE_TIME_PRINT_CACHE_YEAR_MASK 0xFFFF
+
+/*
+ * Tone statistics
+ *
+ * The drift estimate is a running average of the deviation of each tone
+ * interval from one second, in nano-seconds (parts per billion).  It is a
+ * plain average over the first samples and then weights each new sample by
+ * 1/CFE_TIME_DRIFT_AVERAGE_DEPTH.  Drift correction is only applied once at
+ * least CFE_TIME_DRIFT_MIN_SAMPLES intervals have been averaged.
+ */
+#define CFE_TIME_DRIFT_AVERAGE_DEPTH 16
+#define CFE_TIME_DRIFT_MIN_SAMPLES   16
+
 /*************************************************************************/
 
 /*
@@ -119,12 +172,79 @@ typedef struct
 
 /*
 ** Time Synchronization Callback Registry Information
+**
+** Entries are claimed and released under the synch callback mutex, but the
+** callers of the callbacks never take it.  Ptr is written last when
+** registering, so a non-NULL Ptr means the other registration fields are
+** valid.  The countdown and pending flag are only changed by the callers
+** of the callback.
 */
 typedef struct
 {
-    volatile CFE_TIME_SynchCallbackPtr_t Ptr; /**< \brief Pointer to Callback function */
+    volatile CFE_TIME_SynchCallbackPtr_t Ptr;         /**< \brief Pointer to Callback function */
+    CFE_ES_AppId_t                       AppId;       /**< \brief Application that registered the callback */
+    uint16                               Serial;      /**< \brief Incremented at each registration, for unique IDs */
+    volatile uint32                      RateDivisor; /**< \brief Tone signals per call (0 or 1 for every one) */
+    volatile uint32                      Options;     /**< \brief CFE_TIME_SYNCH_INLINE or CFE_TIME_SYNCH_DEFERRED */
+    uint32                               Countdown;   /**< \brief Tone signals remaining until the next call */
+    volatile bool                        Pending;     /**< \brief Deferred call released but not yet made */
+    CFE_TIME_SynchCallbackStats_t        Stats;       /**< \brief Call and execution time statistics */
 } CFE_TIME_SynchCallbackRegEntry_t;
 
+/*
+** Minor Frame Scheduler Registry Information
+*/
+typedef struct
+{
+    volatile bool             Active;     /**< \brief Slot is registered and released by the scheduler */
+    bool                      SendMsg;    /**< \brief Release by wakeup message rather than semaphore */
+    volatile bool             MsgPending; /**< \brief Wakeup message released but not yet sent */
+    uint32                    Period;     /**< \brief Minor frames between releases */
+    osal_id_t                 SemId;      /**< \brief Semaphore given at each release */
+    CFE_MSG_CommandHeader_t   WakeupCmd;  /**< \brief Message sent at each release */
+    CFE_TIME_FrameSlotStats_t Stats;      /**< \brief Registration and release statistics */
+} CFE_TIME_FrameSlot_t;
+
+/*
+** Timer Pool Entry
+**   (linked into a timer wheel slot, the expired list or the free list by index)
+*/
+typedef struct
+{
+    uint16                      Next;        /**< \brief Next timer in the same list */
+    uint16                      Prev;        /**< \brief Previous timer in the same list */
+    uint16                      List;        /**< \brief Wheel slot or expired list holding the timer */
+    uint16                      Serial;      /**< \brief Incremented at each start, to make timer IDs unique */
+    uint8                       State;       /**< \brief CFE_TIME_TIMER_STATE_FREE, _ARMED or _EXPIRED */
+    CFE_ES_AppId_t              AppId;       /**< \brief Application that started the timer */
+    CFE_TIME_Packed_t           Deadline;    /**< \brief MET of the next expiry */
+    CFE_TIME_Packed_t           Interval;    /**< \brief Time between expiries, zero if one-shot */
+    CFE_TIME_TimerCallbackPtr_t CallbackPtr; /**< \brief Function to call, NULL to send the message instead */
+    void                       *Arg;         /**< \brief Argument for the callback function */
+    CFE_MSG_CommandHeader_t     WakeupCmd;   /**< \brief Message to send at each expiry */
+} CFE_TIME_Timer_t;
+
+/*
+** Tone interval, tone to data latch and local clock drift statistics...
+**   (drift estimate is not cleared by the reset counters command)
+*/
+typedef struct
+{
+    uint32 IntervalCount;    /**< \brief Valid tone intervals measured */
+    uint32 IntervalMin;      /**< \brief Shortest tone interval (micro-seconds) */
+    uint32 IntervalMax;      /**< \brief Longest tone interval (micro-seconds) */
+    int64  IntervalDevSum;   /**< \brief Sum of deviations from one second (micro-seconds) */
+    uint64 IntervalDevSumSq; /**< \brief Sum of squared deviations from one second */
+
+    uint32 ToneLatchHistogram[CFE_MISSION_TIME_TONE_HIST_BINS]; /**< \brief Tone to data latch delta, log2 bins */
+
+    uint32             DriftSamples;          /**< \brief Tone intervals in the drift estimate */
+    int32              DriftRate;             /**< \brief Local clock drift (parts per billion, positive is fast) */
+    bool               DriftCorrectionActive; /**< \brief Drift adjustment is being applied */
+    CFE_TIME_SysTime_t DriftAdjust;           /**< \brief STCF drift adjustment applied every 1Hz */
+    int16              DriftDirection;        /**< \brief Direction of the drift adjustment */
+} CFE_TIME_ToneStats_t;
+
 /*
 ** Data values used to compute time (in reference to "tone")...
 **
@@ -145,6 +265,13 @@ typedef struct
     CFE_TIME_SysTime_t AtToneSTCF;
     CFE_TIME_SysTime_t AtToneDelay;
     CFE_TIME_SysTime_t AtToneLatch;
+
+    /*
+    ** Linear mapping of the local clock onto each time scale, as 32.32 fixed
+    ** point values derived from the fields above whenever they are published
+    */
+    CFE_TIME_Packed_t AtToneLatchPacked;
+    CFE_TIME_Packed_t MapOffset[CFE_TIME_MAP_COUNT];
 } CFE_TIME_ReferenceState_t;
 
 /*************************************************************************/
@@ -165,6 +292,7 @@ typedef struct
     */
     CFE_TIME_HousekeepingTlm_t HkPacket;
     CFE_TIME_DiagnosticTlm_t   DiagPacket;
+    CFE_TIME_ToneStatsTlm_t    ToneStatsPacket;
 
     /*
     ** Task operational data (not reported in housekeeping)...
@@ -198,8 +326,9 @@ typedef struct
     /*
     ** Most recent local clock latch values...
     */
-    CFE_TIME_SysTime_t ToneSignalLatch; /* Latched at tone */
-    CFE_TIME_SysTime_t ToneDataLatch;   /* Latched at packet */
+    CFE_TIME_SysTime_t ToneSignalLatch;   /* Latched at tone */
+    CFE_TIME_SysTime_t ToneDataLatch;     /* Latched at packet */
+    CFE_TIME_SysTime_t AcceptedToneLatch; /* Latched at most recent valid tone */
 
     /*
     ** Miscellaneous counters...
@@ -256,6 +385,11 @@ typedef struct
     */
     bool GetReferenceFail;
 
+    /*
+    ** Last calendar day converted by CFE_TIME_Print() (see CFE_TIME_PRINT_CACHE_xxx)
+    */
+    volatile uint32 PrintDayCache;
+
     /*
     ** Local 1Hz wake-up command packet (not related to time at tone)...
     */
@@ -309,9 +443,44 @@ typedef struct
 
     /*
     ** Synchronization Callback Registry
-    ** One callback per app is allowed
+    ** Apps may register several callbacks, each found by its registration ID.
+    ** The synch task is only created once a deferred callback has been registered.
     */
-    CFE_TIME_SynchCallbackRegEntry_t SynchCallback[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+    CFE_TIME_SynchCallbackRegEntry_t SynchCallback[CFE_PLATFORM_TIME_MAX_SYNCH_CALLBACKS];
+    osal_id_t                        SynchMutex;
+    osal_id_t                        SynchSemaphore;
+    CFE_ES_TaskId_t                  SynchTaskID;
+    volatile bool                    SynchTaskNeeded;
+
+    /*
+    ** Tone jitter and local clock drift statistics...
+    */
+    CFE_TIME_ToneStats_t ToneStats;
+
+    /*
+    ** Minor frame scheduler, zero rate if not running...
+    **   (frames are counted from the local clock latched at the last valid tone)
+    */
+    uint32               MinorFrameRate;
+    uint32               NextMinorFrame;
+    CFE_TIME_Packed_t    MinorFrameToneLatch;
+    uint32               MinorFrameCounter;
+    uint32               MinorFrameSkipCounter;
+    osal_id_t            FrameSemaphore;
+    CFE_ES_TaskId_t      FrameTaskID;
+    CFE_TIME_FrameSlot_t FrameSlot[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+
+    /*
+    ** Timer wheel, advanced by the minor frame task and protected by the mutex...
+    **   (wheel ticks are minor frames of MET)
+    */
+    osal_id_t        TimerMutex;
+    volatile uint32  TimerCount;
+    uint16           FreeTimerHead;
+    bool             TimerWheelStarted;
+    uint64           TimerWheelTick;
+    uint16           TimerList[CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS + 1];
+    CFE_TIME_Timer_t Timer[CFE_PLATFORM_TIME_MAX_TIMERS];
 } CFE_TIME_Global_t;
 
 /*
@@ -355,6 +524,21 @@ void CFE_TIME_UpdateResetVars(const CFE_TIME_Reference_t *Reference);
  */
 void CFE_TIME_GetDiagData(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Report tone statistics data
+ */
+void CFE_TIME_GetToneStatsData(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Clear tone statistics
+ *
+ * Clears the interval statistics and the tone to data latch histogram, but
+ * keeps the drift estimate (and any correction based on it) in place.
+ */
+void CFE_TIME_ResetToneStats(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Report local housekeeping data
@@ -367,6 +551,19 @@ void CFE_TIME_GetHkData(const CFE_TIME_Reference_t *Reference);
  */
 void CFE_TIME_GetReference(CFE_TIME_Reference_t *Reference);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief get the current time on one of the mapped time scales
+ *
+ * This is the fast path for the current MET, TAI and UTC.  Rather than
+ * copying the full reference data and combining MET, STCF, leap seconds and
+ * delay on every call, it latches the local clock once and adds the offset
+ * that was precomputed for the time scale when the reference was published.
+ *
+ * @param MapIndex one of the CFE_TIME_MAP_xxx time scale values
+ */
+CFE_TIME_SysTime_t CFE_TIME_GetMappedTime(uint32 MapIndex);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief calculate TAI from reference data
@@ -524,6 +721,15 @@ int32 CFE_TIME_ToneSendTime(CFE_TIME_SysTime_t NewTime);
  */
 volatile CFE_TIME_ReferenceState_t *CFE_TIME_StartReferenceUpdate(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Compute the local clock mapping of a time reference update
+ *
+ * Derives the offsets used by CFE_TIME_GetMappedTime() from the "at tone"
+ * values of the reference state, before the state is published.
+ */
+void CFE_TIME_SetReferenceMapping(volatile CFE_TIME_ReferenceState_t *NextState);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Complete an update to the global time reference data
@@ -533,6 +739,7 @@ volatile CFE_TIME_ReferenceState_t *CFE_TIME_StartReferenceUpdate(void);
  */
 static inline void CFE_TIME_FinishReferenceUpdate(volatile CFE_TIME_ReferenceState_t *NextState)
 {
+    CFE_TIME_SetReferenceMapping(NextState);
     CFE_TIME_Global.LastVersionCounter = NextState->StateVersion;
 }
 
@@ -626,9 +833,59 @@ void CFE_TIME_Tone1HzTask(void);
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Call App Synch Callback Funcs
+ *
+ * Calls the inline callbacks that are due at this tone signal, and wakes
+ * the synch callback task for the deferred ones.
  */
 void CFE_TIME_NotifyTimeSynchApps(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Call one App Synch Callback Func
+ *
+ * Measures the execution time of the call with the local clock and updates
+ * the statistics of the registry entry.
+ *
+ * @param Entry registry entry of the callback
+ * @param Func  callback function, as read once from the entry
+ */
+void CFE_TIME_CallSynchCallback(CFE_TIME_SynchCallbackRegEntry_t *Entry, CFE_TIME_SynchCallbackPtr_t Func);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief  Synch callback task
+ *
+ * This task makes the deferred synch callback calls released by
+ * CFE_TIME_NotifyTimeSynchApps, so that they do not run in the tone
+ * signal context.
+ */
+void CFE_TIME_SynchTask(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Take the synch callback mutex
+ *
+ * Serializes claiming and releasing synch callback registry entries.  The
+ * callers of the callbacks do not take it.
+ */
+void CFE_TIME_LockSynchCallbacks(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Give the synch callback mutex
+ */
+void CFE_TIME_UnlockSynchCallbacks(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Find the registry entry of a synch callback registration
+ *
+ * @param SynchCallbackId registration identifier
+ *
+ * @returns pointer to the entry, or NULL if the identifier is not a current registration
+ */
+CFE_TIME_SynchCallbackRegEntry_t *CFE_TIME_LocateSynchCallback(CFE_TIME_SynchCallbackId_t SynchCallbackId);
+
 /*
 ** Function prototypes (local 1Hz interrupt)...
 */
@@ -658,6 +915,218 @@ void CFE_TIME_Local1HzStateMachine(void);
  */
 void CFE_TIME_Local1HzTimerCallback(osal_id_t TimerId, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Record the interval between two valid tone signals
+ *
+ * Updates the interval statistics and the local clock drift estimate.
+ *
+ * @param Interval local clock time between the tone signals (~1 second)
+ */
+void CFE_TIME_RecordToneInterval(CFE_TIME_SysTime_t Interval);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Record the local clock delta between tone signal and tone data
+ *
+ * @param Delta local clock time between the tone signal and the data packet
+ */
+void CFE_TIME_RecordToneLatchDelta(CFE_TIME_SysTime_t Delta);
+
+#if (CFE_PLATFORM_TIME_CFG_DRIFT_CORRECTION == true)
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Start or stop cancelling the local clock drift
+ *
+ * While flywheeling, and once enough tone intervals have been measured,
+ * sets the drift adjustment to cancel the estimated drift.  Clears it
+ * again once the clock is no longer flywheeling.  The drift adjustment is
+ * applied every 1Hz in addition to (and independent of) the commanded
+ * 1Hz STCF adjustment.
+ *
+ * @param ClockFlyState current flywheel state of the reference
+ */
+void CFE_TIME_UpdateDriftCorrection(int16 ClockFlyState);
+#endif
+
+/*
+** Function prototypes (minor frame scheduler)...
+*/
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Minor frame timer routine
+ *
+ * Works out which minor frames have started since the local clock was
+ * latched at the tone, and releases the slots registered for each of
+ * them that has not been released yet.
+ */
+void CFE_TIME_MinorFrameISR(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief  Minor frame callback routine
+ *
+ * This is a wrapper around CFE_TIME_MinorFrameISR that conforms to
+ * the prototype of an OSAL Timer callback routine.
+ */
+void CFE_TIME_MinorFrameTimerCallback(osal_id_t TimerId, void *Arg);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Release the slots registered for one minor frame
+ *
+ * Semaphores are given directly.  Wakeup messages are only marked as
+ * pending, since they must be sent from task context.
+ *
+ * @param MinorFrame   minor frame within the major frame
+ * @param JitterMicros distance of this release from the minor frame boundary
+ *
+ * @returns true if any wakeup message was marked as pending
+ */
+bool CFE_TIME_ReleaseFrameSlots(uint32 MinorFrame, uint32 JitterMicros);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief  Minor frame task
+ *
+ * This task sends the wakeup messages released by the minor frame
+ * scheduler, which cannot be sent from the timer context.
+ */
+void CFE_TIME_FrameTask(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Claim the minor frame slot of the calling application
+ *
+ * Validates the requested rate and phase and returns the slot of the
+ * calling application with its statistics reset, ready for the caller to
+ * fill in the release method and activate.
+ *
+ * @param RateHz  release rate, must divide the minor frame rate
+ * @param Phase   minor frame within the release period
+ * @param SlotPtr set to the claimed slot on success
+ */
+int32 CFE_TIME_ClaimFrameSlot(uint32 RateHz, uint32 Phase, CFE_TIME_FrameSlot_t **SlotPtr);
+
+/*
+** Function prototypes (timer wheel)...
+*/
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Take the timer mutex
+ *
+ * Protects the timer pool and the timer wheel.
+ */
+void CFE_TIME_LockTimers(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Give the timer mutex
+ */
+void CFE_TIME_UnlockTimers(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Initialize the timer pool and timer wheel
+ *
+ * Puts every timer on the free list and empties the wheel.
+ */
+void CFE_TIME_InitTimers(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Convert a MET to a timer wheel tick
+ *
+ * @param Time    MET to convert
+ * @param RoundUp true to round a time part way through a tick up to the next tick
+ *
+ * @returns the number of minor frames of MET
+ */
+uint64 CFE_TIME_TimerTick(CFE_TIME_Packed_t Time, bool RoundUp);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Add a timer to the timer wheel
+ *
+ * Places the timer in the wheel slot of its deadline, or in the next slot
+ * to be processed if its deadline has already passed.  Must be called with
+ * the timer mutex held.
+ *
+ * @param Index pool index of the timer
+ */
+void CFE_TIME_InsertTimer(uint16 Index);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Link a timer onto the head of a wheel slot or the expired list
+ *
+ * Must be called with the timer mutex held.
+ *
+ * @param Index pool index of the timer
+ * @param List  wheel slot, or CFE_TIME_TIMER_EXPIRED_LIST
+ */
+void CFE_TIME_LinkTimer(uint16 Index, uint16 List);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Unlink a timer from the wheel slot or expired list holding it
+ *
+ * Must be called with the timer mutex held.
+ *
+ * @param Index pool index of the timer
+ */
+void CFE_TIME_UnlinkTimer(uint16 Index);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Return an unlinked timer to the free list
+ *
+ * Must be called with the timer mutex held.
+ *
+ * @param Index pool index of the timer
+ */
+void CFE_TIME_FreeTimer(uint16 Index);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Start a timer that calls a function or sends a message
+ *
+ * Common implementation of the public API, converting the deadline to MET
+ * and adding the timer to the timer wheel.
+ *
+ * @param TimerIdPtr   set to the identifier of the new timer on success
+ * @param DeadlineType CFE_TIME_TIMER_RELATIVE, _ABS_MET or _ABS_SC
+ * @param Deadline     time of the first expiry
+ * @param Interval     time between expiries, zero for a one-shot timer
+ * @param CallbackPtr  function to call, NULL to send the message instead
+ * @param Arg          argument for the callback function
+ * @param WakeupCmd    message to send, if no callback function
+ */
+int32 CFE_TIME_ArmTimer(CFE_TIME_TimerId_t *TimerIdPtr, uint32 DeadlineType, CFE_TIME_SysTime_t Deadline,
+                        CFE_TIME_SysTime_t Interval, CFE_TIME_TimerCallbackPtr_t CallbackPtr, void *Arg,
+                        const CFE_MSG_CommandHeader_t *WakeupCmd);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Advance the timer wheel to the current MET
+ *
+ * Moves the timers whose deadlines have passed to the expired list, then
+ * acts on each one in turn, rearming periodic timers and freeing one-shot
+ * timers.  Callbacks are called and messages sent without the timer mutex
+ * held.  Called from the minor frame task.
+ */
+void CFE_TIME_AdvanceTimerWheel(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Cancel all timers started by an application
+ *
+ * @param AppId application being cleaned up
+ */
+void CFE_TIME_CancelAppTimers(CFE_ES_AppId_t AppId);
+
 /*
 ** Command handler for "HK request"...
 */
@@ -704,6 +1173,18 @@ int32 CFE_TIME_ToneDataCmd(const CFE_TIME_ToneDataCmd_t *data);
  */
 int32 CFE_TIME_OneHzCmd(const CFE_TIME_1HzCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief  Start the synch callback task
+ *
+ * Creates the task that makes the deferred synch callback calls, if it
+ * does not exist yet.  Must be called from the TIME main task, as only
+ * the main task of an app can create child tasks.
+ *
+ * @returns CFE_SUCCESS if the task exists, or the task creation status
+ */
+int32 CFE_TIME_StartSynchTask(void);
+
 #if (CFE_PLATFORM_TIME_CFG_SERVER == true)
 
 /*---------------------------------------------------------------------------------------*/
@@ -164,6 +164,16 @@
 #elif CFE_PLATFORM_TIME_1HZ_TASK_PRIORITY > 255
 #error CFE_PLATFORM_TIME_1HZ_TASK_PRIORITY must be less than or equal to 255
 #endif
+#if CFE_PLATFORM_TIME_FRAME_TASK_PRIORITY < 0
+#error CFE_PLATFORM_TIME_FRAME_TASK_PRIORITY must be greater than or equal to zero
+#elif CFE_PLATFORM_TIME_FRAME_TASK_PRIORITY > 255
+#error CFE_PLATFORM_TIME_FRAME_TASK_PRIORITY must be less than or equal to 255
+#endif
+#if CFE_PLATFORM_TIME_SYNCH_TASK_PRIORITY < 0
+#error CFE_PLATFORM_TIME_SYNCH_TASK_PRIORITY must be greater than or equal to zero
+#elif CFE_PLATFORM_TIME_SYNCH_TASK_PRIORITY > 255
+#error CFE_PLATFORM_TIME_SYNCH_TASK_PRIORITY must be less than or equal to 255
+#endif
 
 /*
 ** Validate task stack sizes...
@@ -180,6 +190,66 @@
 #error CFE_PLATFORM_TIME_1HZ_TASK_STACK_SIZE must be greater than or equal to 2048
 #endif
 
+#if CFE_PLATFORM_TIME_FRAME_TASK_STACK_SIZE < 2048
+#error CFE_PLATFORM_TIME_FRAME_TASK_STACK_SIZE must be greater than or equal to 2048
+#endif
+
+#if CFE_PLATFORM_TIME_SYNCH_TASK_STACK_SIZE < 2048
+#error CFE_PLATFORM_TIME_SYNCH_TASK_STACK_SIZE must be greater than or equal to 2048
+#endif
+
+/*
+** Validate minor frame rate...
+*/
+#if CFE_PLATFORM_TIME_MINOR_FRAME_RATE < 0
+#error CFE_PLATFORM_TIME_MINOR_FRAME_RATE must be greater than or equal to zero
+#elif CFE_PLATFORM_TIME_MINOR_FRAME_RATE > 1000
+#error CFE_PLATFORM_TIME_MINOR_FRAME_RATE must be less than or equal to 1000
+#endif
+
+/*
+** Validate synch callback registry size...
+**   (registration identifiers hold the entry index in 16 bits)
+*/
+#if CFE_PLATFORM_TIME_MAX_SYNCH_CALLBACKS < 1
+#error CFE_PLATFORM_TIME_MAX_SYNCH_CALLBACKS must be at least 1
+#elif CFE_PLATFORM_TIME_MAX_SYNCH_CALLBACKS > 65534
+#error CFE_PLATFORM_TIME_MAX_SYNCH_CALLBACKS must be less than or equal to 65534
+#endif
+
+/*
+** Validate timer pool and timer wheel sizes...
+*/
+#if CFE_PLATFORM_TIME_MAX_TIMERS < 1
+#error CFE_PLATFORM_TIME_MAX_TIMERS must be at least 1
+#elif CFE_PLATFORM_TIME_MAX_TIMERS > 65534
+#error CFE_PLATFORM_TIME_MAX_TIMERS must be less than or equal to 65534
+#endif
+
+#if CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS < 1
+#error CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS must be at least 1
+#elif CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS > 4096
+#error CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS must be less than or equal to 4096
+#elif (CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS & (CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS - 1)) != 0
+#error CFE_PLATFORM_TIME_TIMER_WHEEL_SLOTS must be a power of two
+#endif
+
+/*
+** Validate tone statistics histogram size...
+*/
+#if CFE_MISSION_TIME_TONE_HIST_BINS < 2
+#error CFE_MISSION_TIME_TONE_HIST_BINS must be at least 2
+#elif CFE_MISSION_TIME_TONE_HIST_BINS > 32
+#error CFE_MISSION_TIME_TONE_HIST_BINS must be less than or equal to 32
+#endif
+
+/*
+** Validate drift correction selection...
+*/
+#if (CFE_PLATFORM_TIME_CFG_DRIFT_CORRECTION == true) && (CFE_PLATFORM_TIME_CFG_SERVER != true)
+#error CFE_PLATFORM_TIME_CFG_DRIFT_CORRECTION requires CFE_PLATFORM_TIME_CFG_SERVER to be true!
+#endif
+
 /*************************************************************************/
 
 #endif /* CFE_TIME_VERIFY_H */
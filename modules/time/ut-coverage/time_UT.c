@@ -168,6 +168,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_TimeOp);
     UT_ADD_TEST(Test_ConvertTime);
     UT_ADD_TEST(Test_Print);
+    UT_ADD_TEST(Test_PrintCalendar);
     UT_ADD_TEST(Test_RegisterSyncCallbackTrue);
     UT_ADD_TEST(Test_ExternalTone);
     UT_ADD_TEST(Test_External);
@@ -175,9 +176,14 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_ResetArea);
     UT_ADD_TEST(Test_State);
     UT_ADD_TEST(Test_GetReference);
+    UT_ADD_TEST(Test_GetMappedTime);
     UT_ADD_TEST(Test_Tone);
     UT_ADD_TEST(Test_1Hz);
+    UT_ADD_TEST(Test_ToneStats);
     UT_ADD_TEST(Test_UnregisterSynchCallback);
+    UT_ADD_TEST(Test_SynchCallbackOptions);
+    UT_ADD_TEST(Test_FrameScheduler);
+    UT_ADD_TEST(Test_TimerWheel);
     UT_ADD_TEST(Test_CleanUpApp);
 }
 
@@ -384,6 +390,63 @@ void Test_Init(void)
     CFE_TIME_TaskInit();
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
     CFE_UtAssert_SYSLOG((TIME_SYSLOG_MSGS[4]));
+
+    /* Test response to failure creating the synch callback semaphore */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 3, -3);
+    UtAssert_INT32_EQ(CFE_TIME_TaskInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Test response to failure creating the synch callback mutex */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, -3);
+    UtAssert_INT32_EQ(CFE_TIME_TaskInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* The synch callback task is not created until a deferred callback is registered */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TIME_TaskInit());
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 2);
+
+    /* Test successful startup of the minor frame scheduler */
+    CFE_TIME_Global.MinorFrameRate = 10;
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TIME_TaskInit());
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 3);
+    UtAssert_STUB_COUNT(OS_TimerAdd, 2);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.MinorFrameRate, 10);
+
+    /* Test response to failure creating the minor frame semaphore */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 3, -3);
+    UtAssert_INT32_EQ(CFE_TIME_TaskInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Test response to failure creating the timer mutex */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, -3);
+    UtAssert_INT32_EQ(CFE_TIME_TaskInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Test response to failure creating the minor frame task */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 3, -4);
+    UtAssert_INT32_EQ(CFE_TIME_TaskInit(), -4);
+
+    /* Without a timer to drive it, the scheduler is stopped */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_TimerSet), 2, OS_ERROR);
+    CFE_UtAssert_SUCCESS(CFE_TIME_TaskInit());
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_ZERO(CFE_TIME_Global.MinorFrameRate);
+
+    CFE_TIME_Global.MinorFrameRate = 10;
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_TimerAdd), 2, OS_ERROR);
+    CFE_UtAssert_SUCCESS(CFE_TIME_TaskInit());
+    UtAssert_ZERO(CFE_TIME_Global.MinorFrameRate);
+
+    CFE_TIME_Global.MinorFrameRate = 10;
+    UT_InitData();
+    UT_SetDefaultReturnValue(UT_KEY(OS_TimeBaseGetIdByName), OS_ERROR);
+    CFE_UtAssert_SUCCESS(CFE_TIME_TaskInit());
+    UtAssert_ZERO(CFE_TIME_Global.MinorFrameRate);
 }
 
 /*
@@ -753,6 +816,45 @@ void Test_TimeOp(void)
      */
     UT_InitData();
     UtAssert_INT32_EQ(CFE_TIME_Compare(time2, time1), CFE_TIME_A_LT_B);
+
+    /* Test packing and unpacking a time value */
+    time1.Seconds    = 0x12345678;
+    time1.Subseconds = 0x9abcdef0;
+    UtAssert_True(CFE_TIME_Pack(time1) == 0x123456789abcdef0, "CFE_TIME_Pack");
+    result = CFE_TIME_Unpack(CFE_TIME_Pack(time1));
+    UtAssert_MemCmp(&result, &time1, sizeof(CFE_TIME_SysTime_t), "CFE_TIME_Unpack");
+
+    /* Test packed arithmetic with subseconds carry and seconds roll over */
+    time1.Seconds    = 0xffffffff;
+    time1.Subseconds = 0xffffffff;
+    time2.Seconds    = 1;
+    time2.Subseconds = 1;
+
+    result     = CFE_TIME_Unpack(CFE_TIME_PackedAdd(CFE_TIME_Pack(time1), CFE_TIME_Pack(time2)));
+    exp_result = CFE_TIME_Add(time1, time2);
+    UtAssert_MemCmp(&result, &exp_result, sizeof(CFE_TIME_SysTime_t), "CFE_TIME_PackedAdd, carry and roll over");
+    UtAssert_UINT32_EQ(result.Seconds, 1);
+    UtAssert_UINT32_EQ(result.Subseconds, 0);
+
+    result     = CFE_TIME_Unpack(CFE_TIME_PackedSubtract(CFE_TIME_Pack(time2), CFE_TIME_Pack(time1)));
+    exp_result = CFE_TIME_Subtract(time2, time1);
+    UtAssert_MemCmp(&result, &exp_result, sizeof(CFE_TIME_SysTime_t), "CFE_TIME_PackedSubtract, borrow and roll under");
+    UtAssert_UINT32_EQ(result.Seconds, 1);
+    UtAssert_UINT32_EQ(result.Subseconds, 2);
+
+    /* Test packed comparison, including across roll over */
+    UtAssert_INT32_EQ(CFE_TIME_PackedCompare(CFE_TIME_Pack(time1), CFE_TIME_Pack(time1)), CFE_TIME_EQUAL);
+    UtAssert_INT32_EQ(CFE_TIME_PackedCompare(CFE_TIME_Pack(time1), CFE_TIME_Pack(time2)), CFE_TIME_A_LT_B);
+    UtAssert_INT32_EQ(CFE_TIME_PackedCompare(CFE_TIME_Pack(time2), CFE_TIME_Pack(time1)), CFE_TIME_A_GT_B);
+    UtAssert_INT32_EQ(CFE_TIME_PackedCompare(0x100000000, 0xffffffff), CFE_TIME_A_GT_B);
+    UtAssert_INT32_EQ(CFE_TIME_PackedCompare(0xffffffff, 0x100000000), CFE_TIME_A_LT_B);
+
+    /* Test packed conversions to and from microseconds */
+    UtAssert_True(CFE_TIME_PackedToMicroSecs(0x280000000) == 2500000, "CFE_TIME_PackedToMicroSecs, 2.5 seconds");
+    UtAssert_True(CFE_TIME_PackedToMicroSecs(0xffffffff) == 999999, "CFE_TIME_PackedToMicroSecs, max subseconds");
+    UtAssert_True(CFE_TIME_PackedFromMicroSecs(2500000) == 0x280000000, "CFE_TIME_PackedFromMicroSecs, 2.5 seconds");
+    UtAssert_True(CFE_TIME_PackedToMicroSecs(CFE_TIME_PackedFromMicroSecs(1000001)) == 1000001,
+                  "CFE_TIME_PackedFromMicroSecs, round trip");
 }
 
 /*
@@ -763,6 +865,12 @@ void Test_ConvertTime(void)
     CFE_TIME_SysTime_t                  METTime;
     CFE_TIME_SysTime_t                  resultTime;
     CFE_TIME_SysTime_t                  expectedMET2SCTime;
+    CFE_TIME_SysTime_t                  METTimes[3];
+    CFE_TIME_SysTime_t                  Times[3];
+    CFE_TIME_ConversionRef_t            ConvRef;
+    uint32                              SubSecs[3];
+    uint32                              MicroSecs[3];
+    uint32                              i;
     volatile CFE_TIME_ReferenceState_t *RefState;
 
     UtPrintf("Begin Test Convert Time");
@@ -788,6 +896,62 @@ void Test_ConvertTime(void)
     UtAssert_UINT32_EQ(resultTime.Seconds, expectedMET2SCTime.Seconds);
     UtAssert_UINT32_EQ(resultTime.Subseconds, expectedMET2SCTime.Subseconds);
 
+    /* Test batch MET conversion against a reference snapshot */
+    UtAssert_INT32_EQ(CFE_TIME_GetConversionRef(NULL), CFE_TIME_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(CFE_TIME_GetConversionRef(&ConvRef));
+    UtAssert_UINT32_EQ(ConvRef.STCF.Seconds, 7240);
+    UtAssert_UINT32_EQ(ConvRef.STCF.Subseconds, 45);
+    UtAssert_INT32_EQ(ConvRef.LeapSeconds, 32);
+
+    METTimes[0].Seconds    = 0;
+    METTimes[0].Subseconds = 0;
+    METTimes[1].Seconds    = 100;
+    METTimes[1].Subseconds = 0xFFFFFFF0; /* carries into the seconds */
+    METTimes[2].Seconds    = 0xFFFFFFFF; /* rolls over */
+    METTimes[2].Subseconds = 0x80000000;
+
+    CFE_UtAssert_SUCCESS(CFE_TIME_ConvertMETArray(&ConvRef, CFE_TIME_CONVERT_TO_SC, METTimes, Times, 3));
+    for (i = 0; i < 3; ++i)
+    {
+        resultTime = CFE_TIME_MET2SCTime(METTimes[i]);
+        UtAssert_UINT32_EQ(Times[i].Seconds, resultTime.Seconds);
+        UtAssert_UINT32_EQ(Times[i].Subseconds, resultTime.Subseconds);
+    }
+
+    CFE_UtAssert_SUCCESS(CFE_TIME_ConvertMETArray(&ConvRef, CFE_TIME_CONVERT_TO_TAI, METTimes, Times, 3));
+    UtAssert_UINT32_EQ(Times[1].Seconds, 7341);
+    UtAssert_UINT32_EQ(Times[1].Subseconds, 0x1D);
+    UtAssert_UINT32_EQ(Times[2].Seconds, 7239);
+    UtAssert_UINT32_EQ(Times[2].Subseconds, 0x8000002D);
+
+    /* In place, and with no elements */
+    CFE_UtAssert_SUCCESS(CFE_TIME_ConvertMETArray(&ConvRef, CFE_TIME_CONVERT_TO_UTC, METTimes, METTimes, 3));
+    UtAssert_UINT32_EQ(METTimes[0].Seconds, 7208);
+    UtAssert_UINT32_EQ(METTimes[0].Subseconds, 45);
+    UtAssert_UINT32_EQ(METTimes[1].Seconds, 7309);
+    UtAssert_UINT32_EQ(METTimes[1].Subseconds, 0x1D);
+    CFE_UtAssert_SUCCESS(CFE_TIME_ConvertMETArray(&ConvRef, CFE_TIME_CONVERT_TO_UTC, METTimes, Times, 0));
+
+    UtAssert_INT32_EQ(CFE_TIME_ConvertMETArray(&ConvRef, 3, METTimes, Times, 3), CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_ConvertMETArray(NULL, CFE_TIME_CONVERT_TO_SC, METTimes, Times, 3),
+                      CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_ConvertMETArray(&ConvRef, CFE_TIME_CONVERT_TO_SC, NULL, Times, 3),
+                      CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_ConvertMETArray(&ConvRef, CFE_TIME_CONVERT_TO_SC, METTimes, NULL, 3),
+                      CFE_TIME_BAD_ARGUMENT);
+
+    /* Test batch subseconds to microseconds conversion, matching the single value routine */
+    SubSecs[0] = 0;
+    SubSecs[1] = 0x80000000;
+    SubSecs[2] = 0xffffffff;
+    CFE_UtAssert_SUCCESS(CFE_TIME_Sub2MicroSecsArray(SubSecs, MicroSecs, 3));
+    for (i = 0; i < 3; ++i)
+    {
+        UtAssert_UINT32_EQ(MicroSecs[i], CFE_TIME_Sub2MicroSecs(SubSecs[i]));
+    }
+    UtAssert_INT32_EQ(CFE_TIME_Sub2MicroSecsArray(NULL, MicroSecs, 3), CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_Sub2MicroSecsArray(SubSecs, NULL, 3), CFE_TIME_BAD_ARGUMENT);
+
     /* NOTE: Microseconds <-> Subseconds conversion routines are implemented
      * as part of OS_time_t in OSAL, and are coverage tested there.  CFE time
      * conversions are now just wrappers of these OSAL routines.
@@ -910,6 +1074,144 @@ void Test_Print(void)
     }
 }
 
+/*
+** Reference calendar conversion for Test_PrintCalendar, counting whole
+** years from the epoch one at a time
+*/
+static void UT_TIME_ReferencePrint(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
+{
+    uint32 Years;
+    uint32 Days;
+    uint32 Hours;
+    uint32 Minutes;
+    uint32 Seconds;
+    uint32 Micros;
+    uint32 DaysInYear;
+
+    Micros  = CFE_TIME_Sub2MicroSecs(TimeToPrint.Subseconds) + CFE_MISSION_TIME_EPOCH_MICROS;
+    Minutes = (Micros / 60000000) + (TimeToPrint.Seconds / 60) + CFE_MISSION_TIME_EPOCH_MINUTE;
+    Micros  = Micros % 60000000;
+    Seconds = (Micros / 1000000) + (TimeToPrint.Seconds % 60) + CFE_MISSION_TIME_EPOCH_SECOND;
+    Micros  = Micros % 1000000;
+    Minutes += Seconds / 60;
+    Seconds = Seconds % 60;
+    Hours   = (Minutes / 60) + CFE_MISSION_TIME_EPOCH_HOUR;
+    Minutes = Minutes % 60;
+    Days    = (Hours / 24) + (CFE_MISSION_TIME_EPOCH_DAY - 1);
+    Hours   = Hours % 24;
+    Years   = CFE_MISSION_TIME_EPOCH_YEAR;
+
+    while (true)
+    {
+        DaysInYear = ((Years % 4) == 0 && ((Years % 100) != 0 || (Years % 400) == 0)) ? 366 : 365;
+        if (Days < DaysInYear)
+        {
+            break;
+        }
+        Days -= DaysInYear;
+        Years++;
+    }
+
+    snprintf(PrintBuffer, CFE_TIME_PRINTED_STRING_SIZE, "%04u-%03u-%02u:%02u:%02u.%05u", (unsigned int)Years,
+             (unsigned int)(Days + 1), (unsigned int)Hours, (unsigned int)Minutes, (unsigned int)Seconds,
+             (unsigned int)(Micros / 10));
+}
+
+/*
+** Test the day table and cached day used by CFE_TIME_Print across the
+** full range of the epoch
+*/
+void Test_PrintCalendar(void)
+{
+    char               timeBuf[CFE_TIME_PRINTED_STRING_SIZE];
+    char               expectedBuf[CFE_TIME_PRINTED_STRING_SIZE];
+    CFE_TIME_SysTime_t time;
+    uint32             Year;
+    uint32             DaysBefore;
+    uint32             Offset;
+    uint32             Checked;
+    uint32             Mismatched;
+    uint64             Seconds;
+
+    UtPrintf("Begin Test Print Calendar");
+
+    UT_InitData();
+    CFE_TIME_Global.PrintDayCache = 0;
+    Checked                       = 0;
+    Mismatched                    = 0;
+
+    /*
+     * Walk the whole range of seconds with a stride that is not a multiple
+     * of a day, so every time of day and every day of the year is visited
+     */
+    time.Subseconds = 0x89ABCDEF;
+    for (Seconds = 0; Seconds <= 0xFFFFFFFF; Seconds += (3 * 86400) + 3607)
+    {
+        time.Seconds = (uint32)Seconds;
+        CFE_TIME_Print(timeBuf, time);
+        UT_TIME_ReferencePrint(expectedBuf, time);
+        ++Checked;
+        if (strcmp(timeBuf, expectedBuf) != 0)
+        {
+            UtPrintf("Mismatch at %u: %s != %s", (unsigned int)time.Seconds, timeBuf, expectedBuf);
+            ++Mismatched;
+        }
+    }
+
+    /*
+     * Check either side of every new year's midnight in range, each twice so
+     * the second call is formatted from the cached day
+     */
+    time.Subseconds = 0xFFFFFFFF;
+    DaysBefore      = 0;
+    for (Year = CFE_MISSION_TIME_EPOCH_YEAR; Year < CFE_MISSION_TIME_EPOCH_YEAR + 137; ++Year)
+    {
+        DaysBefore += ((Year % 4) == 0 && ((Year % 100) != 0 || (Year % 400) == 0)) ? 366 : 365;
+        Seconds = ((uint64)DaysBefore - (CFE_MISSION_TIME_EPOCH_DAY - 1)) * 86400 -
+                  (CFE_MISSION_TIME_EPOCH_HOUR * 3600) - (CFE_MISSION_TIME_EPOCH_MINUTE * 60) -
+                  CFE_MISSION_TIME_EPOCH_SECOND;
+
+        for (Offset = 0; Offset < 4 && (Seconds + Offset) >= 2 && (Seconds + Offset) <= 0x100000001; ++Offset)
+        {
+            time.Seconds = (uint32)(Seconds + Offset - 2);
+            UT_TIME_ReferencePrint(expectedBuf, time);
+            CFE_TIME_Print(timeBuf, time);
+            Checked += 2;
+            if (strcmp(timeBuf, expectedBuf) != 0)
+            {
+                UtPrintf("Mismatch at %u: %s != %s", (unsigned int)time.Seconds, timeBuf, expectedBuf);
+                ++Mismatched;
+            }
+            CFE_TIME_Print(timeBuf, time);
+            if (strcmp(timeBuf, expectedBuf) != 0)
+            {
+                UtPrintf("Cached mismatch at %u: %s != %s", (unsigned int)time.Seconds, timeBuf, expectedBuf);
+                ++Mismatched;
+            }
+        }
+    }
+
+    UtAssert_NONZERO(Checked);
+    UtAssert_ZERO(Mismatched);
+
+    /* The last converted day is cached, and a stale cache entry is replaced */
+    time.Seconds    = 0;
+    time.Subseconds = 0;
+    CFE_TIME_Print(timeBuf, time);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.PrintDayCache >> CFE_TIME_PRINT_CACHE_DAY_SHIFT,
+                       CFE_MISSION_TIME_EPOCH_DAY + ((CFE_MISSION_TIME_EPOCH_HOUR * 3600 +
+                                                      CFE_MISSION_TIME_EPOCH_MINUTE * 60 +
+                                                      CFE_MISSION_TIME_EPOCH_SECOND) /
+                                                     86400));
+    UtAssert_UINT32_EQ(CFE_TIME_Global.PrintDayCache & CFE_TIME_PRINT_CACHE_YEAR_MASK, 0);
+    time.Seconds = 86400 * 400;
+    CFE_TIME_Print(timeBuf, time);
+    UT_TIME_ReferencePrint(expectedBuf, time);
+    UtAssert_STRINGBUF_EQ(timeBuf, sizeof(timeBuf), expectedBuf, sizeof(expectedBuf));
+    UtAssert_UINT32_EQ(CFE_TIME_Global.PrintDayCache & CFE_TIME_PRINT_CACHE_YEAR_MASK,
+                       strtoul(expectedBuf, NULL, 10) - CFE_MISSION_TIME_EPOCH_YEAR);
+}
+
 /*
 ** Test function for use with register and unregister synch callback API tests
 */
@@ -924,7 +1226,7 @@ int32 ut_time_MyCallbackFunc(void)
 */
 void Test_RegisterSyncCallbackTrue(void)
 {
-    uint32 AppIndex;
+    uint32 i;
 
     UtPrintf("Begin Test Register Synch Callback");
     UT_InitData();
@@ -941,38 +1243,26 @@ void Test_RegisterSyncCallbackTrue(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, -1);
     UtAssert_INT32_EQ(CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc), -1);
 
-    /* CFE_ES_AppID_ToIndex failure */
-    UT_InitData();
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, -2);
-    UtAssert_INT32_EQ(CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc), -2);
-
     /* Test registering the callback function the maximum number of times,
      * then attempt registering one more time
      */
     UT_InitData();
-    CFE_TIME_Global.SynchCallback[0].Ptr = NULL;
+    memset(CFE_TIME_Global.SynchCallback, 0, sizeof(CFE_TIME_Global.SynchCallback));
 
     /*
-     * One callback per application is allowed; the first should succeed,
-     * the second should fail.
+     * The same application may register several callbacks, until the
+     * registry is full.
      */
-    CFE_UtAssert_SUCCESS(CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc));
+    for (i = 0; i < (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])); i++)
+    {
+        CFE_UtAssert_SUCCESS(CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc));
+    }
 
     UtAssert_INT32_EQ(CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc), CFE_TIME_TOO_MANY_SYNCH_CALLBACKS);
+    UtAssert_STUB_COUNT(OS_MutSemTake, i + 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, i + 1);
 
-    AppIndex = 2;
-    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
-
-    CFE_UtAssert_SUCCESS(CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc));
-
-    /*
-     * This test case should not be possible in real flight as ES should never
-     * return "success" with an appid out of range, but nonetheless
-     * we need to make sure we do not overwrite our own memory here.
-     */
-    AppIndex = 99999;
-    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
-    UtAssert_INT32_EQ(CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc), CFE_TIME_TOO_MANY_SYNCH_CALLBACKS);
+    memset(CFE_TIME_Global.SynchCallback, 0, sizeof(CFE_TIME_Global.SynchCallback));
 }
 
 /*
@@ -1451,6 +1741,7 @@ void Test_PipeCmds(void)
     UT_CallTaskPipe(CFE_TIME_TaskPipe, &CmdBuf.message, sizeof(CmdBuf.diagtlmcmd),
                     UT_TPID_CFE_TIME_CMD_SEND_DIAGNOSTIC_TLM_CC);
     CFE_UtAssert_EVENTSENT(CFE_TIME_DIAG_EID);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
 
     /* Request diagnostics with bad size */
     UT_InitData();
@@ -1929,8 +2220,33 @@ void Test_PipeCmds(void)
     /* In the 1Hz state machine it should call PSP GetTime as part,
         of latching the clock.  This is tested only to see that the latch executed. */
     UT_InitData();
+    CFE_TIME_Global.SynchTaskNeeded = false;
     UT_CallTaskPipe(CFE_TIME_TaskPipe, &CmdBuf.message, sizeof(CmdBuf.onehzcmd), UT_TPID_CFE_TIME_1HZ_CMD);
     UtAssert_NONZERO(UT_GetStubCount(UT_KEY(CFE_PSP_GetTime)));
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    /* The 1Hz command starts the synch task once it is needed */
+    UT_InitData();
+    CFE_TIME_Global.SynchTaskID     = CFE_ES_TASKID_UNDEFINED;
+    CFE_TIME_Global.SynchTaskNeeded = true;
+    UT_CallTaskPipe(CFE_TIME_TaskPipe, &CmdBuf.message, sizeof(CmdBuf.onehzcmd), UT_TPID_CFE_TIME_1HZ_CMD);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+    UtAssert_BOOL_FALSE(CFE_TIME_Global.SynchTaskNeeded);
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_DEFINED(CFE_TIME_Global.SynchTaskID));
+
+    /* Only one synch task is created */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TIME_StartSynchTask());
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    /* A failure creating the synch task is not retried until requested again */
+    UT_InitData();
+    CFE_TIME_Global.SynchTaskID = CFE_ES_TASKID_UNDEFINED;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -5);
+    UtAssert_INT32_EQ(CFE_TIME_StartSynchTask(), -5);
+    UtAssert_BOOL_FALSE(CFE_TIME_Global.SynchTaskNeeded);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CFE_TIME_Global.SynchTaskID));
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
 }
 
 /*
@@ -2170,6 +2486,105 @@ void Test_GetReference(void)
     CFE_TIME_Global.GetReferenceFail = false;
 }
 
+/*
+** Test getting the current time through the local clock mapping
+*/
+void Test_GetMappedTime(void)
+{
+    CFE_TIME_Reference_t                Reference;
+    volatile CFE_TIME_ReferenceState_t *RefState;
+    CFE_TIME_SysTime_t                  Expected;
+    CFE_TIME_SysTime_t                  Actual;
+    CFE_TIME_SysTime_t                  SaveMaxLocalClock = CFE_TIME_Global.MaxLocalClock;
+    uint32                              UpdateCount;
+
+    UtPrintf("Begin Test Get Mapped Time");
+
+    /* Test that the mapping matches the reference data, with a delay and negative leap seconds */
+    UT_InitData();
+    RefState                                 = CFE_TIME_StartReferenceUpdate();
+    RefState->AtToneMET.Seconds              = 20;
+    RefState->AtToneMET.Subseconds           = 0x80000000;
+    RefState->AtToneSTCF.Seconds             = 3600;
+    RefState->AtToneSTCF.Subseconds          = 0xC0000000;
+    RefState->AtToneLeapSeconds              = -5;
+    RefState->AtToneDelay.Seconds            = 0;
+    RefState->AtToneDelay.Subseconds         = 0x90000000;
+    RefState->DelayDirection                 = CFE_TIME_AdjustDirection_SUBTRACT;
+    RefState->AtToneLatch.Seconds            = 10;
+    RefState->AtToneLatch.Subseconds         = 0xA0000000;
+    CFE_TIME_Global.MaxLocalClock.Seconds    = 1000;
+    CFE_TIME_Global.MaxLocalClock.Subseconds = 0;
+    CFE_TIME_FinishReferenceUpdate(RefState);
+    UT_SetBSP_Time(15, 250000);
+    CFE_TIME_GetReference(&Reference);
+
+    UT_SetBSP_Time(15, 250000);
+    Actual = CFE_TIME_GetMET();
+    UtAssert_UINT32_EQ(Actual.Seconds, Reference.CurrentMET.Seconds);
+    UtAssert_UINT32_EQ(Actual.Subseconds, Reference.CurrentMET.Subseconds);
+
+    UT_SetBSP_Time(15, 250000);
+    Expected = CFE_TIME_CalculateTAI(&Reference);
+    Actual   = CFE_TIME_GetTAI();
+    UtAssert_UINT32_EQ(Actual.Seconds, Expected.Seconds);
+    UtAssert_UINT32_EQ(Actual.Subseconds, Expected.Subseconds);
+
+    UT_SetBSP_Time(15, 250000);
+    Expected = CFE_TIME_CalculateUTC(&Reference);
+    Actual   = CFE_TIME_GetUTC();
+    UtAssert_UINT32_EQ(Actual.Seconds, Expected.Seconds);
+    UtAssert_UINT32_EQ(Actual.Subseconds, Expected.Subseconds);
+
+    /* Test that the mapping matches the reference data with local clock rollover and an added delay */
+    UT_InitData();
+    RefState                         = CFE_TIME_StartReferenceUpdate();
+    RefState->AtToneDelay.Seconds    = 1;
+    RefState->AtToneDelay.Subseconds = 0x10000000;
+    RefState->DelayDirection         = CFE_TIME_AdjustDirection_ADD;
+    CFE_TIME_FinishReferenceUpdate(RefState);
+    UT_SetBSP_Time(2, 500000);
+    CFE_TIME_GetReference(&Reference);
+
+    UT_SetBSP_Time(2, 500000);
+    Actual = CFE_TIME_GetMET();
+    UtAssert_UINT32_EQ(Actual.Seconds, Reference.CurrentMET.Seconds);
+    UtAssert_UINT32_EQ(Actual.Subseconds, Reference.CurrentMET.Subseconds);
+
+    UT_SetBSP_Time(2, 500000);
+    Expected = CFE_TIME_CalculateUTC(&Reference);
+    Actual   = CFE_TIME_GetUTC();
+    UtAssert_UINT32_EQ(Actual.Seconds, Expected.Seconds);
+    UtAssert_UINT32_EQ(Actual.Subseconds, Expected.Subseconds);
+
+    /* Use a hook function to test the behavior when the read needs to be retried */
+    UT_InitData();
+    memset((void *)CFE_TIME_Global.ReferenceState, 0, sizeof(CFE_TIME_Global.ReferenceState));
+    CFE_TIME_Global.GetReferenceFail = false;
+    UpdateCount                      = 1;
+    UT_SetHookFunction(UT_KEY(CFE_PSP_GetTime), UT_TimeRefUpdateHook, &UpdateCount);
+    UT_SetBSP_Time(20, 0);
+    UT_SetBSP_Time(20, 100);
+    Actual = CFE_TIME_GetMET();
+
+    /* This should not have set the flag, and the output should be valid*/
+    UtAssert_UINT32_EQ(CFE_TIME_Global.GetReferenceFail, false);
+    UtAssert_UINT32_EQ(Actual.Seconds, 19);
+    UtAssert_UINT32_EQ(Actual.Subseconds, 429497);
+
+    /* With multiple retries, it should fail */
+    UpdateCount = 1000000;
+    Actual      = CFE_TIME_GetTAI();
+
+    /* This should have set the flag, and the output should be all zero */
+    UtAssert_UINT32_EQ(CFE_TIME_Global.GetReferenceFail, true);
+    UtAssert_UINT32_EQ(Actual.Seconds, 0);
+    UtAssert_UINT32_EQ(Actual.Subseconds, 0);
+
+    CFE_TIME_Global.GetReferenceFail = false;
+    CFE_TIME_Global.MaxLocalClock    = SaveMaxLocalClock;
+}
+
 /*
 ** Test send tone, and validate tone and data packet functions
 */
@@ -2554,8 +2969,11 @@ void Test_1Hz(void)
     CFE_TIME_Global.MaxLocalClock.Subseconds   = 0;
     CFE_TIME_Global.ToneSignalLatch.Seconds    = 0;
     CFE_TIME_Global.ToneSignalLatch.Subseconds = 0;
+    memset(&CFE_TIME_Global.AcceptedToneLatch, 0, sizeof(CFE_TIME_Global.AcceptedToneLatch));
     CFE_TIME_Tone1HzISR();
     UtAssert_BOOL_FALSE(CFE_TIME_Global.IsToneGood);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.ToneSignalLatch.Seconds, 1);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.AcceptedToneLatch.Seconds, 0);
 
     /* Test the tone 1Hz task with the tone signal within the time limits */
     UT_InitData();
@@ -2565,6 +2983,7 @@ void Test_1Hz(void)
     CFE_TIME_Global.ToneSignalLatch.Subseconds = 0;
     CFE_TIME_Tone1HzISR();
     UtAssert_BOOL_TRUE(CFE_TIME_Global.IsToneGood);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.AcceptedToneLatch.Subseconds, CFE_TIME_Global.ToneSignalLatch.Subseconds);
 
     /* Test the tone 1Hz task with the tone signal under the time limit */
     UT_InitData();
@@ -2628,13 +3047,203 @@ void Test_1Hz(void)
     UtAssert_UINT32_EQ(CFE_TIME_Global.LocalIntCounter, 2);
 }
 
+/*
+** Test tone interval, tone to data latch and drift statistics
+*/
+void Test_ToneStats(void)
+{
+    CFE_TIME_ToneStatsTlm_Payload_t *Payload = &CFE_TIME_Global.ToneStatsPacket.Payload;
+    CFE_TIME_ResetCountersCmd_t      ResetCmd;
+    CFE_TIME_SysTime_t               Interval;
+    CFE_TIME_SysTime_t               Delta;
+    CFE_TIME_SysTime_t               Time1;
+    CFE_TIME_SysTime_t               Time2;
+    int32                            DriftRate;
+    uint32                           i;
+#if (CFE_PLATFORM_TIME_CFG_DRIFT_CORRECTION == true)
+    volatile CFE_TIME_ReferenceState_t *RefState;
+#endif
+
+    UtPrintf("Begin Test Tone Statistics");
+
+    /* Test reporting with no tone intervals measured */
+    UT_InitData();
+    memset(&CFE_TIME_Global.ToneStats, 0, sizeof(CFE_TIME_Global.ToneStats));
+    CFE_TIME_GetToneStatsData();
+    UtAssert_UINT32_EQ(Payload->ToneIntervalCount, 0);
+    UtAssert_UINT32_EQ(Payload->ToneIntervalMin, 0);
+    UtAssert_UINT32_EQ(Payload->ToneIntervalMax, 0);
+    UtAssert_UINT32_EQ(Payload->ToneIntervalMean, 0);
+    UtAssert_UINT32_EQ(Payload->ToneIntervalStdDev, 0);
+    UtAssert_INT32_EQ(Payload->DriftRate, 0);
+
+    /* Test one long and one short interval, which average out to one second
+     * and cancel in the drift estimate (1/1024 second is 976.5625 micro-seconds)
+     */
+    UT_InitData();
+    Interval.Seconds    = 1;
+    Interval.Subseconds = 0x00400000;
+    CFE_TIME_RecordToneInterval(Interval);
+    UtAssert_INT32_EQ(CFE_TIME_Global.ToneStats.DriftRate, 976562);
+    Interval.Seconds    = 0;
+    Interval.Subseconds = 0xFFC00000;
+    CFE_TIME_RecordToneInterval(Interval);
+    CFE_TIME_GetToneStatsData();
+    UtAssert_UINT32_EQ(Payload->ToneIntervalCount, 2);
+    UtAssert_UINT32_EQ(Payload->ToneIntervalMin, 999023);
+    UtAssert_UINT32_EQ(Payload->ToneIntervalMax, 1000976);
+    UtAssert_UINT32_EQ(Payload->ToneIntervalMean, 1000000);
+    UtAssert_UINT32_EQ(Payload->ToneIntervalStdDev, 976);
+    UtAssert_INT32_EQ(Payload->DriftRate, 0);
+
+    /* Test a steady fast local clock (2^16 sub-seconds is ~15.26 micro-seconds) */
+    UT_InitData();
+    memset(&CFE_TIME_Global.ToneStats, 0, sizeof(CFE_TIME_Global.ToneStats));
+    Interval.Seconds    = 1;
+    Interval.Subseconds = 0x00010000;
+    for (i = 0; i < (2 * CFE_TIME_DRIFT_AVERAGE_DEPTH); ++i)
+    {
+        CFE_TIME_RecordToneInterval(Interval);
+    }
+    CFE_TIME_GetToneStatsData();
+    UtAssert_UINT32_EQ(Payload->ToneIntervalCount, 2 * CFE_TIME_DRIFT_AVERAGE_DEPTH);
+    UtAssert_UINT32_EQ(Payload->ToneIntervalMean, 1000015);
+    UtAssert_UINT32_EQ(Payload->ToneIntervalStdDev, 0);
+    UtAssert_INT32_EQ(Payload->DriftRate, 15258);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.ToneStats.DriftSamples, 2 * CFE_TIME_DRIFT_AVERAGE_DEPTH);
+
+    /* Test the tone to data latch histogram bins */
+    UT_InitData();
+    Delta.Seconds    = 0;
+    Delta.Subseconds = 0;
+    CFE_TIME_RecordToneLatchDelta(Delta);
+    Delta.Subseconds = 0x00010000;
+    CFE_TIME_RecordToneLatchDelta(Delta);
+    Delta.Subseconds = 0x00400000;
+    CFE_TIME_RecordToneLatchDelta(Delta);
+    Delta.Subseconds = 0xF0000000;
+    CFE_TIME_RecordToneLatchDelta(Delta);
+    Delta.Seconds    = 1;
+    Delta.Subseconds = 0;
+    CFE_TIME_RecordToneLatchDelta(Delta);
+    CFE_TIME_GetToneStatsData();
+    UtAssert_UINT32_EQ(Payload->ToneLatchHistogram[0], 1);
+    UtAssert_UINT32_EQ(Payload->ToneLatchHistogram[4], 1);
+    UtAssert_UINT32_EQ(Payload->ToneLatchHistogram[10], 1);
+    UtAssert_UINT32_EQ(Payload->ToneLatchHistogram[CFE_MISSION_TIME_TONE_HIST_BINS - 1], 2);
+
+    /* Test that tone verification records the tone to data latch delta */
+    UT_InitData();
+    CFE_TIME_Global.Forced2Fly = true;
+    Time1.Seconds              = 1234;
+    Time1.Subseconds           = 0;
+    Time2.Seconds              = 1234;
+    Time2.Subseconds           = 0x00400000;
+    CFE_TIME_ToneVerify(Time1, Time2);
+    CFE_TIME_Global.Forced2Fly = false;
+    UtAssert_UINT32_EQ(CFE_TIME_Global.ToneStats.ToneLatchHistogram[10], 2);
+
+    /* Test that a valid tone signal interrupt records the tone interval */
+    UT_InitData();
+    CFE_TIME_Global.ToneSignalLatch.Seconds    = 0;
+    CFE_TIME_Global.ToneSignalLatch.Subseconds = 0;
+    UT_SetBSP_Time(1, 0);
+    CFE_TIME_Tone1HzISR();
+    UtAssert_UINT32_EQ(CFE_TIME_Global.ToneStats.IntervalCount, 2 * CFE_TIME_DRIFT_AVERAGE_DEPTH + 1);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.ToneStats.IntervalMin, 1000000);
+
+    /* Test that an invalid tone signal interrupt is not recorded */
+    UT_InitData();
+    CFE_TIME_Global.ToneSignalLatch.Seconds    = 1;
+    CFE_TIME_Global.ToneSignalLatch.Subseconds = 0;
+    UT_SetBSP_Time(4, 0);
+    CFE_TIME_Tone1HzISR();
+    UtAssert_UINT32_EQ(CFE_TIME_Global.ToneStats.IntervalCount, 2 * CFE_TIME_DRIFT_AVERAGE_DEPTH + 1);
+
+    /* Test that resetting counters clears the statistics but keeps the drift */
+    UT_InitData();
+    DriftRate = CFE_TIME_Global.ToneStats.DriftRate;
+    memset(&ResetCmd, 0, sizeof(ResetCmd));
+    CFE_UtAssert_SUCCESS(CFE_TIME_ResetCountersCmd(&ResetCmd));
+    CFE_TIME_GetToneStatsData();
+    UtAssert_UINT32_EQ(Payload->ToneIntervalCount, 0);
+    UtAssert_UINT32_EQ(Payload->ToneLatchHistogram[10], 0);
+    UtAssert_UINT32_EQ(Payload->ToneLatchHistogram[CFE_MISSION_TIME_TONE_HIST_BINS - 1], 0);
+    UtAssert_INT32_EQ(Payload->DriftRate, DriftRate);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.ToneStats.DriftSamples, 2 * CFE_TIME_DRIFT_AVERAGE_DEPTH + 1);
+
+#if (CFE_PLATFORM_TIME_CFG_DRIFT_CORRECTION == true)
+    /* Test that drift correction waits for enough samples */
+    UT_InitData();
+    CFE_TIME_Global.ToneStats.DriftSamples           = CFE_TIME_DRIFT_MIN_SAMPLES - 1;
+    CFE_TIME_Global.ToneStats.DriftCorrectionActive  = false;
+    CFE_TIME_Global.ToneStats.DriftAdjust.Seconds    = 0;
+    CFE_TIME_Global.ToneStats.DriftAdjust.Subseconds = 0;
+    CFE_TIME_UpdateDriftCorrection(CFE_TIME_FlywheelState_IS_FLY);
+    UtAssert_BOOL_FALSE(CFE_TIME_Global.ToneStats.DriftCorrectionActive);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.ToneStats.DriftAdjust.Subseconds, 0);
+
+    /* Test that a fast clock is corrected while flywheeling, leaving the commanded 1Hz adjustment alone */
+    UT_InitData();
+    CFE_TIME_Global.OneHzAdjust.Seconds    = 0;
+    CFE_TIME_Global.OneHzAdjust.Subseconds = 1000;
+    CFE_TIME_Global.OneHzDirection         = CFE_TIME_AdjustDirection_ADD;
+    CFE_TIME_Global.ToneStats.DriftSamples = CFE_TIME_DRIFT_MIN_SAMPLES;
+    CFE_TIME_Global.ToneStats.DriftRate    = 1000000;
+    CFE_TIME_UpdateDriftCorrection(CFE_TIME_FlywheelState_IS_FLY);
+    UtAssert_BOOL_TRUE(CFE_TIME_Global.ToneStats.DriftCorrectionActive);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.ToneStats.DriftAdjust.Seconds, 0);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.ToneStats.DriftAdjust.Subseconds, 4294967);
+    UtAssert_INT32_EQ(CFE_TIME_Global.ToneStats.DriftDirection, CFE_TIME_AdjustDirection_SUBTRACT);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.OneHzAdjust.Subseconds, 1000);
+    UtAssert_INT32_EQ(CFE_TIME_Global.OneHzDirection, CFE_TIME_AdjustDirection_ADD);
+
+    /* Test that the correction is cleared once the tone is back, still leaving the commanded adjustment */
+    UT_InitData();
+    CFE_TIME_UpdateDriftCorrection(CFE_TIME_FlywheelState_NO_FLY);
+    UtAssert_BOOL_FALSE(CFE_TIME_Global.ToneStats.DriftCorrectionActive);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.ToneStats.DriftAdjust.Subseconds, 0);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.OneHzAdjust.Subseconds, 1000);
+    UtAssert_INT32_EQ(CFE_TIME_Global.OneHzDirection, CFE_TIME_AdjustDirection_ADD);
+
+    /* Test that a slow clock is corrected while flywheeling */
+    UT_InitData();
+    CFE_TIME_Global.ToneStats.DriftRate = -1000000;
+    CFE_TIME_UpdateDriftCorrection(CFE_TIME_FlywheelState_IS_FLY);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.ToneStats.DriftAdjust.Subseconds, 4294967);
+    UtAssert_INT32_EQ(CFE_TIME_Global.ToneStats.DriftDirection, CFE_TIME_AdjustDirection_ADD);
+
+    /* Test that the 1Hz state machine applies both the commanded and the drift adjustment */
+    UT_InitData();
+    RefState                        = CFE_TIME_StartReferenceUpdate();
+    RefState->ClockFlyState         = CFE_TIME_FlywheelState_IS_FLY;
+    RefState->AtToneSTCF.Seconds    = 10;
+    RefState->AtToneSTCF.Subseconds = 0;
+    CFE_TIME_FinishReferenceUpdate(RefState);
+    CFE_TIME_Global.OneHzAdjust.Seconds              = 1;
+    CFE_TIME_Global.OneHzAdjust.Subseconds           = 0;
+    CFE_TIME_Global.OneHzDirection                   = CFE_TIME_AdjustDirection_ADD;
+    CFE_TIME_Global.ToneStats.DriftAdjust.Seconds    = 0;
+    CFE_TIME_Global.ToneStats.DriftAdjust.Subseconds = 0x80000000;
+    CFE_TIME_Global.ToneStats.DriftDirection         = CFE_TIME_AdjustDirection_SUBTRACT;
+    UT_SetBSP_Time(0, 0);
+    CFE_TIME_Local1HzStateMachine();
+    RefState = CFE_TIME_GetReferenceState();
+    UtAssert_UINT32_EQ(RefState->AtToneSTCF.Seconds, 10);
+    UtAssert_UINT32_EQ(RefState->AtToneSTCF.Subseconds, 0x80000000);
+
+    CFE_TIME_Global.OneHzAdjust.Seconds = 0;
+    CFE_TIME_UpdateDriftCorrection(CFE_TIME_FlywheelState_NO_FLY);
+#endif
+}
+
 /*
 ** Test unregistering synchronization callback function
 */
 void Test_UnregisterSynchCallback(void)
 {
-    uint32 i = 0;
-    uint32 AppIndex;
+    CFE_TIME_SynchCallbackId_t SynchCallbackId;
+    CFE_TIME_SynchCallbackId_t StaleId;
 
     ut_time_CallbackCalled = 0;
 
@@ -2648,62 +3257,655 @@ void Test_UnregisterSynchCallback(void)
      * invalid cases
      */
     UT_InitData();
-
-    /* Set up the sync callback table with callbacks for 3 apps */
-    for (i = 0; i < (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])); i++)
-    {
-        if (i < 3)
-        {
-            CFE_TIME_Global.SynchCallback[i].Ptr = &ut_time_MyCallbackFunc;
-        }
-        else
-        {
-            CFE_TIME_Global.SynchCallback[i].Ptr = NULL;
-        }
-    }
-
-    /* App ID 4 should not have a callback */
-    AppIndex = 4;
-    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
-    UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallback(&ut_time_MyCallbackFunc), CFE_TIME_CALLBACK_NOT_REGISTERED);
+    memset(CFE_TIME_Global.SynchCallback, 0, sizeof(CFE_TIME_Global.SynchCallback));
 
     /*
-     * One callback per application is allowed; the first should succeed,
-     * the second should fail.
+     * The same function registered by another app is left alone; only the
+     * caller's own registration is removed.
      */
-    /* App ID 2 should have a callback */
-    AppIndex = 2;
-    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    CFE_UtAssert_SUCCESS(CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc));
+    CFE_UtAssert_SUCCESS(CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc));
+    CFE_TIME_Global.SynchCallback[0].AppId = CFE_ES_APPID_UNDEFINED;
 
     CFE_UtAssert_SUCCESS(CFE_TIME_UnregisterSynchCallback(&ut_time_MyCallbackFunc));
-
-    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    UtAssert_NULL(CFE_TIME_Global.SynchCallback[1].Ptr);
     UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallback(&ut_time_MyCallbackFunc), CFE_TIME_CALLBACK_NOT_REGISTERED);
+    UtAssert_NOT_NULL(CFE_TIME_Global.SynchCallback[0].Ptr);
 
     /* Test unregistering the callback function with a bad application ID */
     UT_InitData();
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, -1);
     UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallback(&ut_time_MyCallbackFunc), -1);
 
-    /* CFE_ES_AppID_ToIndex failure */
+    /* Test unregistering by registration ID, leaving the app's other registrations */
     UT_InitData();
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, -2);
-    UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallback(&ut_time_MyCallbackFunc), -2);
-
-    /* App Index outside bounds of SynchCallback array */
-    AppIndex = (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0]));
-    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
-    UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallback(&ut_time_MyCallbackFunc), CFE_TIME_CALLBACK_NOT_REGISTERED);
+    memset(CFE_TIME_Global.SynchCallback, 0, sizeof(CFE_TIME_Global.SynchCallback));
+    CFE_UtAssert_SUCCESS(CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc));
+    CFE_UtAssert_SUCCESS(
+        CFE_TIME_RegisterSynchCallbackEx(&SynchCallbackId, &ut_time_MyCallbackFunc, 2, CFE_TIME_SYNCH_INLINE));
+    UtAssert_UINT32_EQ(SynchCallbackId & 0xFFFF, 2);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, -1);
+    UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallbackById(SynchCallbackId), -1);
+    CFE_UtAssert_SUCCESS(CFE_TIME_UnregisterSynchCallbackById(SynchCallbackId));
+    UtAssert_NULL(CFE_TIME_Global.SynchCallback[1].Ptr);
+    UtAssert_NOT_NULL(CFE_TIME_Global.SynchCallback[0].Ptr);
+    UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallbackById(SynchCallbackId), CFE_TIME_CALLBACK_NOT_REGISTERED);
+
+    /* An ID is not valid for a later registration in the same entry */
+    UT_InitData();
+    StaleId = SynchCallbackId;
+    CFE_UtAssert_SUCCESS(
+        CFE_TIME_RegisterSynchCallbackEx(&SynchCallbackId, &ut_time_MyCallbackFunc, 1, CFE_TIME_SYNCH_INLINE));
+    UtAssert_UINT32_EQ(SynchCallbackId & 0xFFFF, StaleId & 0xFFFF);
+    UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallbackById(StaleId), CFE_TIME_CALLBACK_NOT_REGISTERED);
+    UtAssert_NOT_NULL(CFE_TIME_Global.SynchCallback[1].Ptr);
+
+    /* Only the app that registered may unregister by ID */
+    CFE_TIME_Global.SynchCallback[1].AppId = CFE_ES_APPID_UNDEFINED;
+    UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallbackById(SynchCallbackId), CFE_TIME_CALLBACK_NOT_REGISTERED);
+    UtAssert_NOT_NULL(CFE_TIME_Global.SynchCallback[1].Ptr);
+
+    /* IDs that do not refer to a registry entry */
+    UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallbackById(CFE_TIME_SYNCHCALLBACKID_UNDEFINED),
+                      CFE_TIME_CALLBACK_NOT_REGISTERED);
+    UtAssert_INT32_EQ(CFE_TIME_UnregisterSynchCallbackById(0xFFFF), CFE_TIME_CALLBACK_NOT_REGISTERED);
+    CFE_TIME_Global.SynchCallback[1].AppId = CFE_TIME_Global.SynchCallback[0].AppId;
+
+    /* Mutex errors are reported to the system log */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, OS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemGive), 1, OS_ERROR);
+    CFE_UtAssert_SUCCESS(CFE_TIME_UnregisterSynchCallbackById(SynchCallbackId));
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 2);
 
     /* Test tone notification with an invalid time synch application */
     UT_InitData();
     CFE_TIME_Global.IsToneGood = true;
-    for (i = 0; i < (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])); i++)
+    memset(CFE_TIME_Global.SynchCallback, 0, sizeof(CFE_TIME_Global.SynchCallback));
+    CFE_TIME_NotifyTimeSynchApps();
+    UtAssert_INT32_EQ(ut_time_CallbackCalled, 0);
+}
+
+/*
+** Test function for use with the synch callback execution time tests;
+** advances the local clock to the given time while "executing"
+*/
+static uint32 UT_TIME_CallbackEndSecs;
+static uint32 UT_TIME_CallbackEndMicros;
+
+static int32 UT_TIME_TimedCallbackFunc(void)
+{
+    UT_SetBSP_Time(UT_TIME_CallbackEndSecs, UT_TIME_CallbackEndMicros);
+    return CFE_SUCCESS;
+}
+
+/*
+** Test synch callback rate divisors, deferred execution and statistics
+*/
+void Test_SynchCallbackOptions(void)
+{
+    CFE_TIME_SynchCallbackStats_t     Stats;
+    CFE_TIME_ResetCountersCmd_t       ResetCmd;
+    CFE_TIME_SysTime_t                SaveMaxLocalClock;
+    CFE_TIME_SynchCallbackRegEntry_t *Entry;
+    CFE_TIME_SynchCallbackId_t        SynchCallbackId;
+    uint32                            i;
+
+    UtPrintf("Begin Test Synch Callback Options");
+
+    memset(CFE_TIME_Global.SynchCallback, 0, sizeof(CFE_TIME_Global.SynchCallback));
+    SaveMaxLocalClock = CFE_TIME_Global.MaxLocalClock;
+    Entry             = &CFE_TIME_Global.SynchCallback[0];
+
+    /* Test registering with invalid arguments */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_TIME_RegisterSynchCallbackEx(NULL, &ut_time_MyCallbackFunc, 1, CFE_TIME_SYNCH_INLINE),
+                      CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_RegisterSynchCallbackEx(&SynchCallbackId, NULL, 1, CFE_TIME_SYNCH_INLINE),
+                      CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(
+        CFE_TIME_RegisterSynchCallbackEx(&SynchCallbackId, &ut_time_MyCallbackFunc, 0, CFE_TIME_SYNCH_INLINE),
+        CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_RegisterSynchCallbackEx(&SynchCallbackId, &ut_time_MyCallbackFunc, 1, 0x80),
+                      CFE_TIME_BAD_ARGUMENT);
+    UtAssert_STUB_COUNT(CFE_ES_GetAppID, 0);
+
+    /* An inline callback with a divisor of 3 is called on every third tone */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(
+        CFE_TIME_RegisterSynchCallbackEx(&SynchCallbackId, &ut_time_MyCallbackFunc, 3, CFE_TIME_SYNCH_INLINE));
+    CFE_TIME_Global.IsToneGood = true;
+    ut_time_CallbackCalled     = 0;
+    for (i = 0; i < 7; ++i)
     {
-        CFE_TIME_Global.SynchCallback[i].Ptr = NULL;
+        CFE_TIME_NotifyTimeSynchApps();
     }
+    UtAssert_INT32_EQ(ut_time_CallbackCalled, 3);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 0);
+
+    /* No tones are passed on while the tone is not good */
+    CFE_TIME_Global.IsToneGood = false;
     CFE_TIME_NotifyTimeSynchApps();
+    CFE_TIME_NotifyTimeSynchApps();
+    UtAssert_INT32_EQ(ut_time_CallbackCalled, 3);
+    CFE_TIME_Global.IsToneGood = true;
+
+    /* Statistics of the registered callback */
+    CFE_UtAssert_SUCCESS(CFE_TIME_GetSynchCallbackStats(SynchCallbackId, &Stats));
+    UtAssert_UINT32_EQ(Stats.RateDivisor, 3);
+    UtAssert_UINT32_EQ(Stats.Options, CFE_TIME_SYNCH_INLINE);
+    UtAssert_UINT32_EQ(Stats.CallCount, 3);
+    UtAssert_ZERO(Stats.OverrunCount);
+
+    /* Statistics failures */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_TIME_GetSynchCallbackStats(SynchCallbackId, NULL), CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_GetSynchCallbackStats(SynchCallbackId + 1, &Stats), CFE_TIME_CALLBACK_NOT_REGISTERED);
+    UtAssert_INT32_EQ(CFE_TIME_GetSynchCallbackStats(SynchCallbackId + 0x10000, &Stats),
+                      CFE_TIME_CALLBACK_NOT_REGISTERED);
+    UtAssert_INT32_EQ(CFE_TIME_GetSynchCallbackStats(CFE_TIME_SYNCHCALLBACKID_UNDEFINED, &Stats),
+                      CFE_TIME_CALLBACK_NOT_REGISTERED);
+
+    /* A deferred callback is released by the tone and counts an overrun if not yet called */
+    UT_InitData();
+    Entry->Ptr                      = NULL;
+    CFE_TIME_Global.SynchTaskID     = CFE_ES_TASKID_UNDEFINED;
+    CFE_TIME_Global.SynchTaskNeeded = false;
+    CFE_UtAssert_SUCCESS(
+        CFE_TIME_RegisterSynchCallbackEx(&SynchCallbackId, &ut_time_MyCallbackFunc, 1, CFE_TIME_SYNCH_DEFERRED));
+    UtAssert_BOOL_TRUE(CFE_TIME_Global.SynchTaskNeeded);
+    ut_time_CallbackCalled = 0;
+    CFE_TIME_NotifyTimeSynchApps();
+    UtAssert_BOOL_TRUE(Entry->Pending);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    CFE_TIME_NotifyTimeSynchApps();
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_UINT32_EQ(Entry->Stats.OverrunCount, 1);
     UtAssert_INT32_EQ(ut_time_CallbackCalled, 0);
+
+    /* The synch task makes the pending call */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 2, OS_ERROR);
+    UtAssert_VOIDCALL(CFE_TIME_SynchTask());
+    UtAssert_INT32_EQ(ut_time_CallbackCalled, 1);
+    UtAssert_BOOL_FALSE(Entry->Pending);
+    UtAssert_UINT32_EQ(Entry->Stats.CallCount, 1);
+
+    /* A callback unregistered after its release is not called */
+    UT_InitData();
+    CFE_TIME_NotifyTimeSynchApps();
+    UtAssert_BOOL_TRUE(Entry->Pending);
+    Entry->Ptr = NULL;
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 2, OS_ERROR);
+    UtAssert_VOIDCALL(CFE_TIME_SynchTask());
+    UtAssert_INT32_EQ(ut_time_CallbackCalled, 1);
+    UtAssert_BOOL_FALSE(Entry->Pending);
+
+    /* Execution time of a callback */
+    UT_InitData();
+    memset(&Entry->Stats, 0, sizeof(Entry->Stats));
+    UT_SetBSP_Time(100, 0);
+    UT_TIME_CallbackEndSecs   = 100;
+    UT_TIME_CallbackEndMicros = 1500;
+    CFE_TIME_CallSynchCallback(Entry, UT_TIME_TimedCallbackFunc);
+    UtAssert_UINT32_EQ(Entry->Stats.CallCount, 1);
+    UtAssert_UINT32_GTEQ(Entry->Stats.LastExecMicros, 1499);
+    UtAssert_UINT32_LTEQ(Entry->Stats.LastExecMicros, 1500);
+    UtAssert_UINT32_EQ(Entry->Stats.MaxExecMicros, Entry->Stats.LastExecMicros);
+
+    /* A shorter call does not change the maximum, including across a local clock rollover */
+    UT_InitData();
+    CFE_TIME_Global.MaxLocalClock.Seconds    = 200;
+    CFE_TIME_Global.MaxLocalClock.Subseconds = 0;
+    UT_SetBSP_Time(199, 999500);
+    UT_TIME_CallbackEndSecs   = 0;
+    UT_TIME_CallbackEndMicros = 500;
+    CFE_TIME_CallSynchCallback(Entry, UT_TIME_TimedCallbackFunc);
+    UtAssert_UINT32_EQ(Entry->Stats.CallCount, 2);
+    UtAssert_UINT32_GTEQ(Entry->Stats.LastExecMicros, 999);
+    UtAssert_UINT32_LTEQ(Entry->Stats.LastExecMicros, 1000);
+    UtAssert_UINT32_GTEQ(Entry->Stats.MaxExecMicros, 1499);
+    CFE_TIME_Global.MaxLocalClock = SaveMaxLocalClock;
+
+    /* Execution time saturates rather than wrapping */
+    UT_InitData();
+    UT_SetBSP_Time(0, 0);
+    UT_TIME_CallbackEndSecs   = 5000;
+    UT_TIME_CallbackEndMicros = 0;
+    CFE_TIME_CallSynchCallback(Entry, UT_TIME_TimedCallbackFunc);
+    UtAssert_UINT32_EQ(Entry->Stats.LastExecMicros, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(Entry->Stats.MaxExecMicros, 0xFFFFFFFF);
+
+    /* Resetting the counters clears the statistics but not the registration */
+    UT_InitData();
+    Entry->Ptr                = &ut_time_MyCallbackFunc;
+    Entry->Stats.OverrunCount = 4;
+    memset(&ResetCmd, 0, sizeof(ResetCmd));
+    CFE_UtAssert_SUCCESS(CFE_TIME_ResetCountersCmd(&ResetCmd));
+    UtAssert_ZERO(Entry->Stats.CallCount);
+    UtAssert_ZERO(Entry->Stats.OverrunCount);
+    UtAssert_ZERO(Entry->Stats.LastExecMicros);
+    UtAssert_ZERO(Entry->Stats.MaxExecMicros);
+    UtAssert_UINT32_EQ(Entry->Stats.RateDivisor, 1);
+    UtAssert_UINT32_EQ(Entry->Stats.Options, CFE_TIME_SYNCH_DEFERRED);
+
+    memset(CFE_TIME_Global.SynchCallback, 0, sizeof(CFE_TIME_Global.SynchCallback));
+    ut_time_CallbackCalled = 0;
+}
+
+/*
+** Test the minor frame scheduler
+*/
+void Test_FrameScheduler(void)
+{
+    CFE_TIME_FrameSlotStats_t   Stats;
+    CFE_TIME_ResetCountersCmd_t ResetCmd;
+    CFE_TIME_SysTime_t          SaveMaxLocalClock;
+    OS_bin_sem_prop_t           SemProp;
+    uint32                      AppIndex;
+    osal_id_t                   SemId = OS_ObjectIdFromInteger(1);
+    CFE_SB_MsgId_t              MsgId = CFE_SB_ValueToMsgId(1);
+
+    UtPrintf("Begin Test Frame Scheduler");
+
+    memset(CFE_TIME_Global.FrameSlot, 0, sizeof(CFE_TIME_Global.FrameSlot));
+    SaveMaxLocalClock = CFE_TIME_Global.MaxLocalClock;
+
+    /* Registration is rejected when the scheduler is not running */
+    UT_InitData();
+    CFE_TIME_Global.MinorFrameRate = 0;
+    UtAssert_INT32_EQ(CFE_TIME_RegisterFrameSem(1, 0, SemId), CFE_TIME_NOT_IMPLEMENTED);
+    UtAssert_VOIDCALL(CFE_TIME_MinorFrameISR());
+
+    /* Rates must divide the minor frame rate, and the phase fit the period */
+    CFE_TIME_Global.MinorFrameRate = 10;
+    UtAssert_INT32_EQ(CFE_TIME_RegisterFrameSem(0, 0, SemId), CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_RegisterFrameSem(3, 0, SemId), CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_RegisterFrameSem(5, 2, SemId), CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_RegisterFrameSem(5, 1, OS_OBJECT_ID_UNDEFINED), CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_RegisterFrameMsg(5, 1, CFE_SB_INVALID_MSG_ID), CFE_TIME_BAD_ARGUMENT);
+
+    /* Failures identifying the calling application */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, -1);
+    UtAssert_INT32_EQ(CFE_TIME_RegisterFrameSem(5, 1, SemId), -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, -2);
+    UtAssert_INT32_EQ(CFE_TIME_RegisterFrameSem(5, 1, SemId), -2);
+    AppIndex = 99999;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    UtAssert_INT32_EQ(CFE_TIME_RegisterFrameSem(5, 1, SemId), CFE_TIME_TOO_MANY_SYNCH_CALLBACKS);
+
+    /* App 0 takes a semaphore at 5Hz on odd frames, app 1 a message every frame */
+    UT_InitData();
+    AppIndex = 0;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    CFE_UtAssert_SUCCESS(CFE_TIME_RegisterFrameSem(5, 1, SemId));
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    UtAssert_INT32_EQ(CFE_TIME_RegisterFrameMsg(10, 0, MsgId), CFE_TIME_TOO_MANY_SYNCH_CALLBACKS);
+    AppIndex = 1;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    CFE_UtAssert_SUCCESS(CFE_TIME_RegisterFrameMsg(10, 0, MsgId));
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+
+    /* Frame 0 at the tone releases only the message */
+    UT_InitData();
+    CFE_TIME_Global.MinorFrameCounter            = 0;
+    CFE_TIME_Global.MinorFrameSkipCounter        = 0;
+    CFE_TIME_Global.AcceptedToneLatch.Seconds    = 100;
+    CFE_TIME_Global.AcceptedToneLatch.Subseconds = 0;
+    UT_SetBSP_Time(100, 0);
+    CFE_TIME_MinorFrameISR();
+    UtAssert_UINT32_EQ(CFE_TIME_Global.MinorFrameCounter, 1);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.NextMinorFrame, 1);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.FrameSlot[0].Stats.ReleaseCount, 0);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.FrameSlot[1].Stats.ReleaseCount, 1);
+    UtAssert_BOOL_TRUE(CFE_TIME_Global.FrameSlot[1].MsgPending);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /* The same frame is not released twice */
+    CFE_TIME_MinorFrameISR();
+    UtAssert_UINT32_EQ(CFE_TIME_Global.MinorFrameCounter, 1);
+
+    /*
+     * A tick just before frame 1 counts as frame 1; the semaphore is still
+     * full and the message has not been sent, so both slots overrun
+     */
+    UT_InitData();
+    memset(&SemProp, 0, sizeof(SemProp));
+    SemProp.value = 1;
+    UT_SetDataBuffer(UT_KEY(OS_BinSemGetInfo), &SemProp, sizeof(SemProp), false);
+    UT_SetBSP_Time(100, 99000);
+    CFE_TIME_MinorFrameISR();
+    UtAssert_STUB_COUNT(OS_BinSemGive, 2);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.FrameSlot[0].Stats.ReleaseCount, 1);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.FrameSlot[0].Stats.OverrunCount, 1);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.FrameSlot[1].Stats.OverrunCount, 1);
+    UtAssert_UINT32_GTEQ(CFE_TIME_Global.FrameSlot[0].Stats.LastJitterMicros, 999);
+    UtAssert_UINT32_LTEQ(CFE_TIME_Global.FrameSlot[0].Stats.LastJitterMicros, 1001);
+
+    /* A late tick releases the frames it missed, measuring their jitter */
+    UT_InitData();
+    UT_SetBSP_Time(100, 480000);
+    CFE_TIME_MinorFrameISR();
+    UtAssert_UINT32_EQ(CFE_TIME_Global.MinorFrameCounter, 6);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.FrameSlot[0].Stats.ReleaseCount, 3);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.FrameSlot[1].Stats.ReleaseCount, 6);
+    UtAssert_UINT32_GTEQ(CFE_TIME_Global.FrameSlot[0].Stats.MaxJitterMicros, 179999);
+    UtAssert_UINT32_LTEQ(CFE_TIME_Global.FrameSlot[0].Stats.MaxJitterMicros, 180001);
+    UtAssert_UINT32_GTEQ(CFE_TIME_Global.FrameSlot[0].Stats.LastJitterMicros, 19999);
+    UtAssert_UINT32_LTEQ(CFE_TIME_Global.FrameSlot[0].Stats.LastJitterMicros, 20001);
+
+    /* No more than one major frame is released at once when far behind */
+    UT_InitData();
+    UT_SetBSP_Time(103, 0);
+    CFE_TIME_MinorFrameISR();
+    UtAssert_UINT32_EQ(CFE_TIME_Global.MinorFrameSkipCounter, 15);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.MinorFrameCounter, 16);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.NextMinorFrame, 31);
+
+    /* Frames restart at the next tone, including across a local clock rollover */
+    UT_InitData();
+    CFE_TIME_Global.MaxLocalClock.Seconds        = 200;
+    CFE_TIME_Global.MaxLocalClock.Subseconds     = 0;
+    CFE_TIME_Global.AcceptedToneLatch.Seconds    = 199;
+    CFE_TIME_Global.AcceptedToneLatch.Subseconds = 0;
+    UT_SetBSP_Time(0, 500000);
+    CFE_TIME_MinorFrameISR();
+    UtAssert_UINT32_EQ(CFE_TIME_Global.NextMinorFrame, 16);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.MinorFrameSkipCounter, 21);
+    CFE_TIME_Global.MaxLocalClock = SaveMaxLocalClock;
+
+    /* The minor frame task sends the pending wakeup messages */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 2, OS_ERROR);
+    UtAssert_VOIDCALL(CFE_TIME_FrameTask());
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_BOOL_FALSE(CFE_TIME_Global.FrameSlot[1].MsgPending);
+
+    /* Timer callback wrapper */
+    UT_InitData();
+    UtAssert_VOIDCALL(CFE_TIME_MinorFrameTimerCallback(OS_ObjectIdFromInteger(123), NULL));
+
+    /* Slot statistics */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_TIME_GetFrameSlotStats(CFE_ES_APPID_UNDEFINED, NULL), CFE_TIME_BAD_ARGUMENT);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, -2);
+    UtAssert_INT32_EQ(CFE_TIME_GetFrameSlotStats(CFE_ES_APPID_UNDEFINED, &Stats), -2);
+    AppIndex = 2;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    UtAssert_INT32_EQ(CFE_TIME_GetFrameSlotStats(CFE_ES_APPID_UNDEFINED, &Stats), CFE_TIME_CALLBACK_NOT_REGISTERED);
+    AppIndex = 99999;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    UtAssert_INT32_EQ(CFE_TIME_GetFrameSlotStats(CFE_ES_APPID_UNDEFINED, &Stats), CFE_TIME_CALLBACK_NOT_REGISTERED);
+    AppIndex = 0;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    CFE_UtAssert_SUCCESS(CFE_TIME_GetFrameSlotStats(CFE_ES_APPID_UNDEFINED, &Stats));
+    UtAssert_UINT32_EQ(Stats.RateHz, 5);
+    UtAssert_UINT32_EQ(Stats.Phase, 1);
+    UtAssert_UINT32_EQ(Stats.ReleaseCount, CFE_TIME_Global.FrameSlot[0].Stats.ReleaseCount);
+
+    /* The reset counters command clears the statistics but keeps the slots */
+    UT_InitData();
+    memset(&ResetCmd, 0, sizeof(ResetCmd));
+    CFE_UtAssert_SUCCESS(CFE_TIME_ResetCountersCmd(&ResetCmd));
+    UtAssert_ZERO(CFE_TIME_Global.FrameSlot[0].Stats.ReleaseCount);
+    UtAssert_ZERO(CFE_TIME_Global.MinorFrameCounter);
+    UtAssert_BOOL_TRUE(CFE_TIME_Global.FrameSlot[0].Active);
+
+    /* Unregistering */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, -1);
+    UtAssert_INT32_EQ(CFE_TIME_UnregisterFrameSlot(), -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, -2);
+    UtAssert_INT32_EQ(CFE_TIME_UnregisterFrameSlot(), -2);
+    AppIndex = 99999;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    UtAssert_INT32_EQ(CFE_TIME_UnregisterFrameSlot(), CFE_TIME_CALLBACK_NOT_REGISTERED);
+    AppIndex = 0;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    CFE_UtAssert_SUCCESS(CFE_TIME_UnregisterFrameSlot());
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    UtAssert_INT32_EQ(CFE_TIME_UnregisterFrameSlot(), CFE_TIME_CALLBACK_NOT_REGISTERED);
+
+    /* Deleting the application releases its slot */
+    UT_InitData();
+    AppIndex = 1;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    CFE_UtAssert_SUCCESS(CFE_TIME_CleanUpApp(CFE_ES_APPID_UNDEFINED));
+    UtAssert_BOOL_FALSE(CFE_TIME_Global.FrameSlot[1].Active);
+
+    CFE_TIME_Global.MinorFrameRate = 0;
+}
+
+/*
+** Test function for use with the timer wheel tests; counts calls in the
+** argument and may cancel another timer
+*/
+static CFE_TIME_TimerId_t UT_TIME_LastTimerId;
+static CFE_TIME_TimerId_t UT_TIME_CancelTimerId;
+static int32              UT_TIME_CancelTimerStatus;
+
+static void UT_TIME_TimerCallbackFunc(CFE_TIME_TimerId_t TimerId, void *Arg)
+{
+    ++(*(uint32 *)Arg);
+    UT_TIME_LastTimerId = TimerId;
+
+    if (UT_TIME_CancelTimerId != CFE_TIME_TIMERID_UNDEFINED)
+    {
+        UT_TIME_CancelTimerStatus = CFE_TIME_CancelTimer(UT_TIME_CancelTimerId);
+        UT_TIME_CancelTimerId     = CFE_TIME_TIMERID_UNDEFINED;
+    }
+}
+
+/*
+** Test the timer wheel
+*/
+void Test_TimerWheel(void)
+{
+    volatile CFE_TIME_ReferenceState_t *RefState;
+    CFE_TIME_SysTime_t                  SaveMaxLocalClock;
+    CFE_TIME_SysTime_t                  Deadline;
+    CFE_TIME_SysTime_t                  Interval;
+    CFE_TIME_TimerId_t                  TimerId;
+    CFE_TIME_TimerId_t                  OtherTimerId;
+    uint32                              CallCount;
+    uint16                              Index;
+    uint32                              AppIndex;
+    CFE_SB_MsgId_t                      MsgId = CFE_SB_ValueToMsgId(1);
+
+    UtPrintf("Begin Test Timer Wheel");
+
+    /* MET follows the local clock, SC time is 1000 seconds ahead of it less the leap seconds */
+    UT_InitData();
+    SaveMaxLocalClock                        = CFE_TIME_Global.MaxLocalClock;
+    CFE_TIME_Global.MaxLocalClock.Seconds    = 0xFFFFFFFF;
+    CFE_TIME_Global.MaxLocalClock.Subseconds = 0;
+    RefState                                 = CFE_TIME_StartReferenceUpdate();
+    RefState->AtToneMET.Seconds              = 0;
+    RefState->AtToneMET.Subseconds           = 0;
+    RefState->AtToneLatch.Seconds            = 0;
+    RefState->AtToneLatch.Subseconds         = 0;
+    RefState->AtToneDelay.Seconds            = 0;
+    RefState->AtToneDelay.Subseconds         = 0;
+    RefState->AtToneSTCF.Seconds             = 1000;
+    RefState->AtToneSTCF.Subseconds          = 0;
+    RefState->AtToneLeapSeconds              = 37;
+    CFE_TIME_FinishReferenceUpdate(RefState);
+
+    Interval.Seconds    = 0;
+    Interval.Subseconds = 0;
+    Deadline            = Interval;
+    CallCount           = 0;
+
+    /* Timers are not available without the minor frame scheduler */
+    CFE_TIME_Global.MinorFrameRate = 0;
+    CFE_TIME_InitTimers();
+    UtAssert_INT32_EQ(CFE_TIME_StartTimer(&TimerId, CFE_TIME_TIMER_RELATIVE, Deadline, Interval,
+                                          UT_TIME_TimerCallbackFunc, &CallCount),
+                      CFE_TIME_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(CFE_TIME_CancelTimer(CFE_TIME_TIMERID_UNDEFINED), CFE_TIME_TIMER_NOT_ACTIVE);
+
+    /* Invalid arguments */
+    CFE_TIME_Global.MinorFrameRate = 10;
+    UtAssert_INT32_EQ(CFE_TIME_StartTimer(&TimerId, CFE_TIME_TIMER_RELATIVE, Deadline, Interval, NULL, NULL),
+                      CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TIME_StartTimer(NULL, CFE_TIME_TIMER_RELATIVE, Deadline, Interval,
+                                          UT_TIME_TimerCallbackFunc, &CallCount),
+                      CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(
+        CFE_TIME_StartTimer(&TimerId, 3, Deadline, Interval, UT_TIME_TimerCallbackFunc, &CallCount),
+        CFE_TIME_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(
+        CFE_TIME_StartTimerMsg(&TimerId, CFE_TIME_TIMER_RELATIVE, Deadline, Interval, CFE_SB_INVALID_MSG_ID),
+        CFE_TIME_BAD_ARGUMENT);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, -1);
+    UtAssert_INT32_EQ(CFE_TIME_StartTimer(&TimerId, CFE_TIME_TIMER_RELATIVE, Deadline, Interval,
+                                          UT_TIME_TimerCallbackFunc, &CallCount),
+                      -1);
+    UtAssert_ZERO(CFE_TIME_Global.TimerCount);
+
+    /* A relative one-shot timer expires at the first minor frame at or after its deadline */
+    UT_InitData();
+    Deadline.Subseconds = 0x80000000;
+    UT_SetBSP_Time(100, 0);
+    CFE_UtAssert_SUCCESS(CFE_TIME_StartTimer(&TimerId, CFE_TIME_TIMER_RELATIVE, Deadline, Interval,
+                                             UT_TIME_TimerCallbackFunc, &CallCount));
+    UtAssert_UINT32_EQ(CFE_TIME_Global.TimerCount, 1);
+    UT_SetBSP_Time(100, 0);
+    CFE_TIME_AdvanceTimerWheel();
+    UT_SetBSP_Time(100, 450000);
+    CFE_TIME_AdvanceTimerWheel();
+    UtAssert_ZERO(CallCount);
+    UT_SetBSP_Time(100, 550000);
+    CFE_TIME_AdvanceTimerWheel();
+    UtAssert_UINT32_EQ(CallCount, 1);
+    UtAssert_UINT32_EQ(UT_TIME_LastTimerId, TimerId);
+    UtAssert_ZERO(CFE_TIME_Global.TimerCount);
+
+    /* An expired one-shot timer can no longer be cancelled */
+    UtAssert_INT32_EQ(CFE_TIME_CancelTimer(TimerId), CFE_TIME_TIMER_NOT_ACTIVE);
+
+    /* A periodic timer keeps its phase and skips the expiries it missed */
+    UT_InitData();
+    Deadline.Seconds    = 200;
+    Deadline.Subseconds = 0;
+    Interval.Seconds    = 1;
+    CallCount           = 0;
+    CFE_UtAssert_SUCCESS(CFE_TIME_StartTimer(&TimerId, CFE_TIME_TIMER_ABS_MET, Deadline, Interval,
+                                             UT_TIME_TimerCallbackFunc, &CallCount));
+    UT_SetBSP_Time(150, 0);
+    CFE_TIME_AdvanceTimerWheel();
+    UtAssert_ZERO(CallCount);
+    UT_SetBSP_Time(200, 50000);
+    CFE_TIME_AdvanceTimerWheel();
+    UtAssert_UINT32_EQ(CallCount, 1);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.TimerCount, 1);
+    UT_SetBSP_Time(203, 550000);
+    CFE_TIME_AdvanceTimerWheel();
+    UtAssert_UINT32_EQ(CallCount, 2);
+    Index = (uint16)((TimerId & 0xFFFF) - 1);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.Timer[Index].Deadline >> 32, 204);
+    UT_SetBSP_Time(204, 50000);
+    CFE_TIME_AdvanceTimerWheel();
+    UtAssert_UINT32_EQ(CallCount, 3);
+    CFE_UtAssert_SUCCESS(CFE_TIME_CancelTimer(TimerId));
+    UtAssert_INT32_EQ(CFE_TIME_CancelTimer(TimerId), CFE_TIME_TIMER_NOT_ACTIVE);
+    UtAssert_INT32_EQ(CFE_TIME_CancelTimer(TimerId + 1), CFE_TIME_TIMER_NOT_ACTIVE);
+
+    /* A message timer sends its message, and one already past its deadline expires at the next tick */
+    UT_InitData();
+    Interval.Seconds = 0;
+    Deadline.Seconds = 10;
+    CallCount        = 0;
+    CFE_UtAssert_SUCCESS(CFE_TIME_StartTimerMsg(&TimerId, CFE_TIME_TIMER_ABS_MET, Deadline, Interval, MsgId));
+    CFE_UtAssert_SUCCESS(CFE_TIME_StartTimer(&OtherTimerId, CFE_TIME_TIMER_ABS_MET, Deadline, Interval,
+                                             UT_TIME_TimerCallbackFunc, &CallCount));
+    UT_SetBSP_Time(204, 150000);
+    CFE_TIME_AdvanceTimerWheel();
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(CallCount, 1);
+    UtAssert_ZERO(CFE_TIME_Global.TimerCount);
+
+    /* A timer on Spacecraft Time is kept in MET */
+    UT_InitData();
+#if (CFE_MISSION_TIME_CFG_DEFAULT_TAI == true)
+    Deadline.Seconds = 1300;
+#else
+    Deadline.Seconds = 1263;
+#endif
+    CFE_UtAssert_SUCCESS(CFE_TIME_StartTimer(&TimerId, CFE_TIME_TIMER_ABS_SC, Deadline, Interval,
+                                             UT_TIME_TimerCallbackFunc, &CallCount));
+    Index = (uint16)((TimerId & 0xFFFF) - 1);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.Timer[Index].Deadline >> 32, 300);
+    UtAssert_UINT32_EQ(CFE_TIME_Global.Timer[Index].State, CFE_TIME_TIMER_STATE_ARMED);
+
+    /* MET set back restarts the wheel from there */
+    UT_SetBSP_Time(50, 0);
+    CFE_TIME_AdvanceTimerWheel();
+    UtAssert_UINT32_EQ(CFE_TIME_Global.TimerWheelTick, 500);
+    UtAssert_UINT32_EQ(CallCount, 1);
+
+    /* Timers are cancelled when their application is cleaned up */
+    AppIndex = 0;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    CFE_UtAssert_SUCCESS(CFE_TIME_CleanUpApp(CFE_TIME_Global.Timer[Index].AppId));
+    UtAssert_ZERO(CFE_TIME_Global.TimerCount);
+    UtAssert_INT32_EQ(CFE_TIME_CancelTimer(TimerId), CFE_TIME_TIMER_NOT_ACTIVE);
+
+    /* A callback can cancel another timer that expired with it, before it is acted on */
+    UT_InitData();
+    Deadline.Seconds = 60;
+    CallCount        = 0;
+    CFE_UtAssert_SUCCESS(CFE_TIME_StartTimer(&TimerId, CFE_TIME_TIMER_ABS_MET, Deadline, Interval,
+                                             UT_TIME_TimerCallbackFunc, &CallCount));
+    CFE_UtAssert_SUCCESS(CFE_TIME_StartTimer(&OtherTimerId, CFE_TIME_TIMER_ABS_MET, Deadline, Interval,
+                                             UT_TIME_TimerCallbackFunc, &CallCount));
+    UT_TIME_CancelTimerId = OtherTimerId;
+    UT_SetBSP_Time(60, 0);
+    CFE_TIME_AdvanceTimerWheel();
+    UtAssert_UINT32_EQ(CallCount, 1);
+    UtAssert_UINT32_EQ(UT_TIME_LastTimerId, TimerId);
+    CFE_UtAssert_SUCCESS(UT_TIME_CancelTimerStatus);
+    UtAssert_ZERO(CFE_TIME_Global.TimerCount);
+
+    /* No free timers */
+    UT_InitData();
+    CFE_TIME_Global.FreeTimerHead = CFE_TIME_TIMER_NONE;
+    UtAssert_INT32_EQ(CFE_TIME_StartTimer(&TimerId, CFE_TIME_TIMER_ABS_MET, Deadline, Interval,
+                                          UT_TIME_TimerCallbackFunc, &CallCount),
+                      CFE_TIME_TOO_MANY_TIMERS);
+    CFE_TIME_InitTimers();
+
+    /* Mutex errors are reported to the system log */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, OS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemGive), 1, OS_ERROR);
+    UT_SetBSP_Time(60, 0);
+    CFE_TIME_AdvanceTimerWheel();
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 2);
+
+    /* The minor frame timer wakes the minor frame task to advance the timer wheel */
+    UT_InitData();
+    memset(CFE_TIME_Global.FrameSlot, 0, sizeof(CFE_TIME_Global.FrameSlot));
+    Deadline.Seconds = 300;
+    CallCount        = 0;
+    CFE_UtAssert_SUCCESS(CFE_TIME_StartTimer(&TimerId, CFE_TIME_TIMER_ABS_MET, Deadline, Interval,
+                                             UT_TIME_TimerCallbackFunc, &CallCount));
+    CFE_TIME_Global.AcceptedToneLatch.Seconds    = 300;
+    CFE_TIME_Global.AcceptedToneLatch.Subseconds = 0;
+    CFE_TIME_Global.MinorFrameToneLatch          = 0;
+    UT_SetBSP_Time(300, 0);
+    CFE_TIME_MinorFrameISR();
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UT_SetBSP_Time(300, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 2, OS_ERROR);
+    UtAssert_VOIDCALL(CFE_TIME_FrameTask());
+    UtAssert_UINT32_EQ(CallCount, 1);
+    UtAssert_ZERO(CFE_TIME_Global.TimerCount);
+
+    CFE_TIME_Global.MaxLocalClock  = SaveMaxLocalClock;
+    CFE_TIME_Global.MinorFrameRate = 0;
+    CFE_TIME_InitTimers();
 }
 
 /*
@@ -2722,23 +3924,16 @@ void Test_CleanUpApp(void)
     CFE_ES_GetAppID(&TestAppId);
 
     /* Clear out the sync callback table */
-    for (i = 0; i < (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])); i++)
-    {
-        CFE_TIME_Global.SynchCallback[i].Ptr = NULL;
-    }
+    memset(CFE_TIME_Global.SynchCallback, 0, sizeof(CFE_TIME_Global.SynchCallback));
 
-    /* Add callbacks for 3 apps into callback registry table */
-    AppIndex = 1;
-    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    /* Add 3 callbacks into callback registry table, the first two from another app */
     CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc);
-    AppIndex = 2;
-    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
     CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc);
-    AppIndex = 3;
-    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
     CFE_TIME_RegisterSynchCallback(&ut_time_MyCallbackFunc);
+    CFE_TIME_Global.SynchCallback[0].AppId = CFE_ES_APPID_UNDEFINED;
+    CFE_TIME_Global.SynchCallback[1].AppId = CFE_ES_APPID_UNDEFINED;
 
-    /* Clean up an app which did not have a callback */
+    /* Clean up an app which had one callback, leaving those of the other app */
     AppIndex = 4;
     UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
     CFE_UtAssert_SUCCESS(CFE_TIME_CleanUpApp(TestAppId));
@@ -2752,11 +3947,9 @@ void Test_CleanUpApp(void)
         }
     }
 
-    /* should not have affected the callback table */
-    UtAssert_UINT32_EQ(Count, 3);
+    UtAssert_UINT32_EQ(Count, 2);
 
-    /* Clean up an app which did have a callback */
-    AppIndex = 2;
+    /* Clean up an app which did not have a callback */
     UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
     CFE_UtAssert_SUCCESS(CFE_TIME_CleanUpApp(TestAppId));
 
@@ -2769,8 +3962,25 @@ void Test_CleanUpApp(void)
         }
     }
 
+    /* should not have affected the callback table */
     UtAssert_UINT32_EQ(Count, 2);
 
+    /* Clean up an app which had several callbacks */
+    AppIndex = 2;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_AppID_ToIndex), &AppIndex, sizeof(AppIndex), false);
+    CFE_UtAssert_SUCCESS(CFE_TIME_CleanUpApp(CFE_ES_APPID_UNDEFINED));
+
+    Count = 0;
+    for (i = 0; i < (sizeof(CFE_TIME_Global.SynchCallback) / sizeof(CFE_TIME_Global.SynchCallback[0])); i++)
+    {
+        if (CFE_TIME_Global.SynchCallback[i].Ptr != NULL)
+        {
+            ++Count;
+        }
+    }
+
+    UtAssert_UINT32_EQ(Count, 0);
+
     /* Test response to a bad application ID -
      * This is effectively a no-op but here for coverage */
     AppIndex = 99999;
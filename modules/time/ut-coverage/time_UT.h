@@ -38,6 +38,8 @@
 /*
 ** Includes
 */
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "cfe_time_module_all.h"
 #include "ut_support.h"
@@ -141,6 +143,23 @@ void Test_ConvertTime(void);
 ******************************************************************************/
 void Test_Print(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the calendar conversion used when printing times
+**
+** \par Description
+**        This function checks CFE_TIME_Print against a year by year
+**        reference conversion across the full epoch range, including
+**        output formatted from the cached day.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_PrintCalendar(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function for use with register and unregister synch callback
@@ -286,6 +305,22 @@ void Test_State(void);
 ******************************************************************************/
 void Test_GetReference(void);
 
+/*****************************************************************************/
+/**
+** \brief Test getting the current time through the local clock mapping
+**
+** \par Description
+**        This function tests that the mapped MET, TAI and UTC match the
+**        values computed from the full reference data.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_GetMappedTime(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send tone, and validate tone and data packet functions
@@ -319,6 +354,23 @@ void Test_Tone(void);
 ******************************************************************************/
 void Test_1Hz(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the tone statistics and drift correction
+**
+** \par Description
+**        This function tests the tone interval statistics, the tone to data
+**        latch histogram, the local clock drift estimate and its correction
+**        through the 1Hz STCF adjustment.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ToneStats(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test unregistering synchronization callback function
@@ -334,6 +386,58 @@ void Test_1Hz(void);
 ******************************************************************************/
 void Test_UnregisterSynchCallback(void);
 
+/*****************************************************************************/
+/**
+** \brief Test synch callback rate divisors and deferred execution
+**
+** \par Description
+**        This function tests registering synch callbacks with a rate
+**        divisor and the deferred option, the calls made from the tone
+**        notification and the synch task, and the callback statistics.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SynchCallbackOptions(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the minor frame scheduler
+**
+** \par Description
+**        This function tests registering for minor frame slots, releasing
+**        them from the minor frame timer relative to the tone, the minor
+**        frame task and the slot statistics.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_FrameScheduler(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the timer wheel
+**
+** \par Description
+**        This function tests starting and cancelling one-shot, periodic and
+**        message timers against relative, MET and spacecraft time deadlines,
+**        advancing the timer wheel as MET moves forward and back, and the
+**        minor frame task driving it.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TimerWheel(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function to free resources associated with an application